@@ -14,6 +14,7 @@
 #include "4C_adapter_ale_xffsi.hpp"
 #include "4C_ale.hpp"
 #include "4C_ale_input.hpp"
+#include "4C_ale_rbf.hpp"
 #include "4C_fem_condition_periodic.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_global_data.hpp"
@@ -139,6 +140,13 @@ void Adapter::AleBaseAlgorithm::setup_ale(
 
       break;
     }
+    // interpolation of the prescribed displacements without system matrix
+    case ALE::rbf:
+    {
+      ale = std::make_shared<ALE::AleRbf>(actdis, solver, adyn, output);
+
+      break;
+    }
     default:
     {
       FOUR_C_THROW("Decide, whether ALE_TYPE = '%s' is linear or nonlinear.",
@@ -189,6 +197,7 @@ void Adapter::AleBaseAlgorithm::setup_ale(
                coupling == fsi_iter_stagg_MFNK_FSI or coupling == fsi_iter_stagg_MPE or
                coupling == fsi_iter_stagg_NLCG or coupling == fsi_iter_stagg_Newton_FD or
                coupling == fsi_iter_stagg_Newton_I or coupling == fsi_iter_stagg_RRE or
+               coupling == fsi_iter_stagg_IQN_ILS or coupling == fsi_iter_stagg_IQN_IMVJ or
                coupling == fsi_iter_stagg_fixed_rel_param or
                coupling == fsi_iter_stagg_steep_desc or coupling == fsi_iter_stagg_steep_desc_force)
       {
@@ -221,6 +230,7 @@ void Adapter::AleBaseAlgorithm::setup_ale(
                coupling == fsi_iter_stagg_MFNK_FSI or coupling == fsi_iter_stagg_MPE or
                coupling == fsi_iter_stagg_NLCG or coupling == fsi_iter_stagg_Newton_FD or
                coupling == fsi_iter_stagg_Newton_I or coupling == fsi_iter_stagg_RRE or
+               coupling == fsi_iter_stagg_IQN_ILS or coupling == fsi_iter_stagg_IQN_IMVJ or
                coupling == fsi_iter_stagg_fixed_rel_param or
                coupling == fsi_iter_stagg_steep_desc or coupling == fsi_iter_stagg_steep_desc_force)
       {
@@ -679,7 +679,7 @@ void Adapter::FluidBaseAlgorithm::setup_fluid(const Teuchos::ParameterList& prbd
                  coupling == fsi_iter_stagg_AITKEN_rel_force or
                  coupling == fsi_iter_stagg_steep_desc_force or
                  coupling == fsi_iter_stagg_steep_desc_force or
-                 coupling == fsi_iter_stagg_steep_desc_force)
+                 coupling == fsi_iter_stagg_IQN_ILS or coupling == fsi_iter_stagg_IQN_IMVJ)
         {
           condition_name = "XFEMSurfFSIPart";
         }
@@ -31,9 +31,9 @@ void ALE::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>& list)
   Core::Utils::string_to_integral_parameter<ALE::AleDynamic>("ALE_TYPE", "solid",
       "ale mesh movement algorithm",
       tuple<std::string>("solid", "solid_linear", "laplace_material", "laplace_spatial",
-          "springs_material", "springs_spatial"),
+          "springs_material", "springs_spatial", "rbf"),
       tuple<ALE::AleDynamic>(solid, solid_linear, laplace_material, laplace_spatial,
-          springs_material, springs_spatial),
+          springs_material, springs_spatial, rbf),
       adyn);
 
   adyn.specs.emplace_back(parameter<bool>("ASSESSMESHQUALITY",
@@ -75,6 +75,18 @@ void ALE::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>& list)
   // Function to evaluate initial displacement
   Core::Utils::int_parameter("STARTFUNCNO", -1, "Function for Initial displacement", adyn);
 
+  // radial basis function mesh motion
+  adyn.specs.emplace_back(parameter<double>("RBF_SUPPORT_RADIUS",
+      {.description = "Support radius of the radial basis functions for ALE_TYPE rbf. A value "
+                      "<= 0 uses the diameter of the prescribed nodes, i.e., global support.",
+          .default_value = 0.0}));
+  adyn.specs.emplace_back(parameter<double>("RBF_GREEDY_TOL",
+      {.description = "Control points are added until the interpolation error at all prescribed "
+                      "nodes is below this fraction of the maximum prescribed displacement",
+          .default_value = 1.0e-3}));
+  Core::Utils::int_parameter(
+      "RBF_MAX_POINTS", 1000, "Maximum number of control points for ALE_TYPE rbf", adyn);
+
   // linear solver id used for scalar ale problems
   Core::Utils::int_parameter(
       "LINEAR_SOLVER", -1, "number of linear solver used for ale problems...", adyn);
@@ -36,7 +36,8 @@ namespace ALE
     springs_material,  ///< use a spring analogy based on material configuration
     springs_spatial,   ///< use a spring analogy based on spatial configuration
     solid,             ///< nonlinear pseudo-structure approach
-    solid_linear       ///< linear pseudo-structure approach
+    solid_linear,      ///< linear pseudo-structure approach
+    rbf                ///< radial basis function interpolation of the boundary displacements
   };
   /// Handling of non-converged nonlinear solver
   enum DivContAct
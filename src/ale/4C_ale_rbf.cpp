@@ -0,0 +1,330 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_ale_rbf.hpp"
+
+#include "4C_ale_utils_mapextractor.hpp"
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_utils_sparse_algebra_create.hpp"
+
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  //! Wendland C2 function of the distance of two points
+  double distance_basis_function(
+      const double* x, const double* y, const int ndim, const double radius)
+  {
+    double dist2 = 0.0;
+    for (int d = 0; d < ndim; ++d) dist2 += (x[d] - y[d]) * (x[d] - y[d]);
+
+    return ALE::Rbf::wendland_c2(std::sqrt(dist2) / radius);
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------------*/
+ALE::AleRbf::AleRbf(std::shared_ptr<Core::FE::Discretization> actdis,
+    std::shared_ptr<Core::LinAlg::Solver> solver, std::shared_ptr<Teuchos::ParameterList> params_in,
+    std::shared_ptr<Core::IO::DiscretizationWriter> output)
+    : Ale(actdis, solver, params_in, output),
+      ndim_(Global::Problem::instance()->n_dim()),
+      support_radius_(params_in->get<double>("RBF_SUPPORT_RADIUS")),
+      greedy_tol_(params_in->get<double>("RBF_GREEDY_TOL")),
+      max_points_(std::max(params_in->get<int>("RBF_MAX_POINTS"), 1))
+{
+  if (Teuchos::getIntegralValue<ALE::MeshTying>(*params_in, "MESHTYING") != ALE::no_meshtying)
+    FOUR_C_THROW("Mesh tying and mesh sliding are not supported for ALE_TYPE 'rbf'.");
+  if (locsys_manager() != nullptr)
+    FOUR_C_THROW("Local coordinate systems are not supported for ALE_TYPE 'rbf'.");
+
+  increment_ = Core::LinAlg::create_vector(*discretization()->dof_row_map(), true);
+}
+
+/*----------------------------------------------------------------------------*/
+void ALE::AleRbf::evaluate(std::shared_ptr<const Core::LinAlg::Vector<double>> stepinc,
+    ALE::Utils::MapExtractor::AleDBCSetType dbc_type)
+{
+  // Note: What we get here is the sum of all increments in this time
+  // step, not just the latest increment.
+  if (stepinc != nullptr) write_access_dispnp()->Update(1.0, *stepinc, 1.0, *dispn(), 0.0);
+
+  dbc_type_ = dbc_type;
+
+  // the prescribed displacements are interpolated exactly, there is no residual
+  write_access_residual()->PutScalar(0.0);
+}
+
+/*----------------------------------------------------------------------------*/
+int ALE::AleRbf::solve()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ALE::AleRbf::solve");
+
+  const Core::FE::Discretization& dis = *discretization();
+  const Epetra_BlockMap& dofrowmap = dispnp()->Map();
+  const Epetra_Map& condmap = *get_dbc_map_extractor(dbc_type_)->cond_map();
+  const Core::LinAlg::Vector<double>& current_disp = *dispnp();
+
+  // collect the nodes with all displacement dofs prescribed
+  std::vector<double> my_coords;
+  std::vector<double> my_disp;
+  for (int lnodeid = 0; lnodeid < dis.num_my_row_nodes(); ++lnodeid)
+  {
+    const Core::Nodes::Node* node = dis.l_row_node(lnodeid);
+    const std::vector<int> dofs = dis.dof(node);
+
+    bool prescribed = true;
+    for (int d = 0; d < ndim_; ++d) prescribed = prescribed and condmap.MyGID(dofs[d]);
+    if (not prescribed) continue;
+
+    for (int d = 0; d < ndim_; ++d)
+    {
+      my_coords.push_back(node->x()[d]);
+      my_disp.push_back(current_disp[dofrowmap.LID(dofs[d])]);
+    }
+  }
+
+  // every processor gets all prescribed nodes in the same order
+  const std::vector<double> coords = Core::Communication::all_reduce(my_coords, dis.get_comm());
+  const std::vector<double> disp = Core::Communication::all_reduce(my_disp, dis.get_comm());
+
+  double radius = support_radius_;
+  if (radius <= 0.0)
+  {
+    // global support: diameter of the bounding box of the prescribed nodes
+    double diameter2 = 0.0;
+    for (int d = 0; d < ndim_; ++d)
+    {
+      double min = std::numeric_limits<double>::max();
+      double max = std::numeric_limits<double>::lowest();
+      for (std::size_t i = d; i < coords.size(); i += ndim_)
+      {
+        min = std::min(min, coords[i]);
+        max = std::max(max, coords[i]);
+      }
+      if (max > min) diameter2 += (max - min) * (max - min);
+    }
+    radius = diameter2 > 0.0 ? 1.01 * std::sqrt(diameter2) : 1.0;
+  }
+
+  const Rbf::Interpolant interpolant =
+      Rbf::select_control_points(coords, disp, ndim_, radius, greedy_tol_, max_points_);
+  const int num_points = interpolant.num_points();
+
+  if (Core::Communication::my_mpi_rank(dis.get_comm()) == 0)
+  {
+    Core::IO::cout(Core::IO::verbose) << "ALE rbf: " << num_points << " of "
+                                      << coords.size() / ndim_ << " prescribed nodes selected"
+                                      << Core::IO::endl;
+  }
+
+  // evaluate the interpolant at the free dofs of the row nodes
+  increment_->PutScalar(0.0);
+  std::vector<double> value(ndim_);
+  for (int lnodeid = 0; lnodeid < dis.num_my_row_nodes(); ++lnodeid)
+  {
+    const Core::Nodes::Node* node = dis.l_row_node(lnodeid);
+    const std::vector<int> dofs = dis.dof(node);
+
+    interpolant.evaluate(node->x().data(), value.data());
+
+    for (int d = 0; d < ndim_; ++d)
+    {
+      if (condmap.MyGID(dofs[d])) continue;
+      const int lid = dofrowmap.LID(dofs[d]);
+      (*increment_)[lid] = value[d] - current_disp[lid];
+    }
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+void ALE::AleRbf::update_iter() { write_access_dispnp()->Update(1.0, *increment_, 1.0); }
+
+/*----------------------------------------------------------------------------*/
+void ALE::AleRbf::time_step(ALE::Utils::MapExtractor::AleDBCSetType dbc_type)
+{
+  evaluate(nullptr, dbc_type);
+  solve();
+  update_iter();
+}
+
+/*----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::SparseMatrix> ALE::AleRbf::system_matrix()
+{
+  FOUR_C_THROW(
+      "ALE_TYPE 'rbf' has no system matrix. Use a partitioned coupling scheme or another "
+      "ALE_TYPE.");
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> ALE::AleRbf::block_system_matrix()
+{
+  FOUR_C_THROW(
+      "ALE_TYPE 'rbf' has no system matrix. Use a partitioned coupling scheme or another "
+      "ALE_TYPE.");
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+double ALE::Rbf::wendland_c2(const double xi)
+{
+  if (xi >= 1.0) return 0.0;
+
+  return std::pow(1.0 - xi, 4) * (4.0 * xi + 1.0);
+}
+
+/*----------------------------------------------------------------------------*/
+double ALE::Rbf::Interpolant::basis_function(const double* x, const int i) const
+{
+  return distance_basis_function(x, &points[i * ndim], ndim, radius);
+}
+
+/*----------------------------------------------------------------------------*/
+void ALE::Rbf::Interpolant::evaluate(const double* x, double* value) const
+{
+  std::fill(value, value + ndim, 0.0);
+  for (int i = 0; i < num_points(); ++i)
+  {
+    const double phi = basis_function(x, i);
+    if (phi == 0.0) continue;
+    for (int d = 0; d < ndim; ++d) value[d] += phi * coefficients[i * ndim + d];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+ALE::Rbf::Interpolant ALE::Rbf::select_control_points(const std::vector<double>& coords,
+    const std::vector<double>& disp, const int ndim, const double radius, const double greedy_tol,
+    const int max_points)
+{
+  Interpolant interpolant{.ndim = ndim, .radius = radius};
+
+  const int n = coords.size() / ndim;
+  if (n == 0) return interpolant;
+
+  const auto norm = [ndim](const double* v)
+  {
+    double norm2 = 0.0;
+    for (int d = 0; d < ndim; ++d) norm2 += v[d] * v[d];
+    return std::sqrt(norm2);
+  };
+
+  // start with the largest prescribed displacement
+  int next = 0;
+  double max_disp = 0.0;
+  for (int j = 0; j < n; ++j)
+  {
+    const double dj = norm(&disp[j * ndim]);
+    if (dj > max_disp)
+    {
+      max_disp = dj;
+      next = j;
+    }
+  }
+  if (max_disp == 0.0) return interpolant;
+
+  // Cholesky factor L of the interpolation matrix of the selected points (packed rows), the
+  // forward substituted displacements z = L^{-1} d and the coefficients gamma = L^{-T} z
+  std::vector<int> selected;
+  std::vector<double> chol;
+  std::vector<double> z;
+  std::vector<double> gamma;
+  std::vector<double> row;
+  std::vector<double> error(ndim);
+
+  while (true)
+  {
+    const int k = selected.size();
+    const double* xnew = &coords[next * ndim];
+
+    // new row of the Cholesky factor
+    row.assign(k + 1, 0.0);
+    double diag2 = distance_basis_function(xnew, xnew, ndim, radius);
+    for (int i = 0; i < k; ++i)
+    {
+      double li = distance_basis_function(xnew, &coords[selected[i] * ndim], ndim, radius);
+      for (int j = 0; j < i; ++j) li -= chol[i * (i + 1) / 2 + j] * row[j];
+      li /= chol[i * (i + 1) / 2 + i];
+      row[i] = li;
+      diag2 -= li * li;
+    }
+
+    // the new point is (numerically) linear dependent on the selected ones
+    if (diag2 <= 1.0e-12) break;
+    row[k] = std::sqrt(diag2);
+
+    selected.push_back(next);
+    chol.insert(chol.end(), row.begin(), row.end());
+    for (int d = 0; d < ndim; ++d)
+    {
+      double zk = disp[next * ndim + d];
+      for (int i = 0; i < k; ++i) zk -= row[i] * z[i * ndim + d];
+      z.push_back(zk / row[k]);
+    }
+
+    // back substitution for the coefficients
+    const int m = k + 1;
+    gamma.assign(m * ndim, 0.0);
+    for (int i = m - 1; i >= 0; --i)
+    {
+      for (int d = 0; d < ndim; ++d)
+      {
+        double gi = z[i * ndim + d];
+        for (int j = i + 1; j < m; ++j) gi -= chol[j * (j + 1) / 2 + i] * gamma[j * ndim + d];
+        gamma[i * ndim + d] = gi / chol[i * (i + 1) / 2 + i];
+      }
+    }
+
+    if (m >= max_points) break;
+
+    // the prescribed node with the largest interpolation error is selected next
+    double max_error = 0.0;
+    for (int j = 0; j < n; ++j)
+    {
+      for (int d = 0; d < ndim; ++d) error[d] = disp[j * ndim + d];
+      for (int i = 0; i < m; ++i)
+      {
+        const double phi =
+            distance_basis_function(&coords[j * ndim], &coords[selected[i] * ndim], ndim, radius);
+        if (phi == 0.0) continue;
+        for (int d = 0; d < ndim; ++d) error[d] -= phi * gamma[i * ndim + d];
+      }
+
+      const double ej = norm(error.data());
+      if (ej > max_error)
+      {
+        max_error = ej;
+        next = j;
+      }
+    }
+
+    if (max_error <= greedy_tol * max_disp) break;
+  }
+
+  for (const int j : selected)
+  {
+    interpolant.points.insert(
+        interpolant.points.end(), &coords[j * ndim], &coords[j * ndim] + ndim);
+  }
+  interpolant.coefficients = gamma;
+
+  return interpolant;
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,172 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_ALE_RBF_HPP
+#define FOUR_C_ALE_RBF_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_ale.hpp"
+
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace ALE
+{
+  namespace Rbf
+  {
+    //! Wendland C2 function \f$\phi(\xi) = (1-\xi)^4 (4\xi+1)\f$, zero for \f$\xi \geq 1\f$
+    double wendland_c2(double xi);
+
+    //! Radial basis function interpolant of the displacements
+    struct Interpolant
+    {
+      //! number of spatial dimensions
+      int ndim = 0;
+
+      //! support radius of the basis functions
+      double radius = 1.0;
+
+      //! coordinates of the control points (ndim per point)
+      std::vector<double> points;
+
+      //! coefficients of the control points (ndim per point)
+      std::vector<double> coefficients;
+
+      [[nodiscard]] int num_points() const { return ndim > 0 ? points.size() / ndim : 0; }
+
+      //! basis function of the control point i at x
+      [[nodiscard]] double basis_function(const double* x, int i) const;
+
+      //! evaluate the interpolated displacement (ndim values) at x
+      void evaluate(const double* x, double* value) const;
+    };
+
+    /*! \brief Greedy selection of the control points and computation of their coefficients
+     *
+     *  Starting from the node with the largest displacement, the node with the largest
+     *  interpolation error is added until the error at all nodes is below greedy_tol times the
+     *  largest displacement or max_points are selected.
+     *
+     *  @param[in] coords      coordinates of all prescribed nodes (ndim per node)
+     *  @param[in] disp        displacements of all prescribed nodes (ndim per node)
+     *  @param[in] ndim        number of spatial dimensions
+     *  @param[in] radius      support radius of the basis functions
+     *  @param[in] greedy_tol  relative tolerance of the interpolation error
+     *  @param[in] max_points  maximum number of control points
+     */
+    Interpolant select_control_points(const std::vector<double>& coords,
+        const std::vector<double>& disp, int ndim, double radius, double greedy_tol,
+        int max_points);
+  }  // namespace Rbf
+
+  /*! \class AleRbf
+   *  \brief Mesh motion by radial basis function interpolation
+   *
+   *  Instead of solving a pseudo-structure or Laplace problem on the whole mesh,
+   *  the displacements of all nodes with prescribed displacements (Dirichlet
+   *  and, in partitioned FSI, interface nodes) are interpolated into the volume:
+   *  \f[
+   *    d(X) = \sum_j \gamma_j \phi(\|X - X_j\| / r)
+   *  \f]
+   *  with the compactly supported Wendland C2 function
+   *  \f$\phi(\xi) = (1-\xi)^4 (4\xi+1)\f$ for \f$\xi < 1\f$ and the support
+   *  radius r (RBF_SUPPORT_RADIUS) in the material configuration. Only nodes
+   *  with all displacement dofs prescribed are used as control points.
+   *
+   *  To keep the dense interpolation system small, the control points are
+   *  selected greedily: starting from the point with the largest displacement,
+   *  the point with the largest interpolation error is added until the error at
+   *  all prescribed nodes is below RBF_GREEDY_TOL times the largest prescribed
+   *  displacement or RBF_MAX_POINTS are selected. The interpolation matrix is
+   *  factorized by a Cholesky decomposition that grows by one row with every
+   *  added point. The prescribed nodes are gathered on every processor, the
+   *  interpolant is evaluated at the row nodes of each processor.
+   *
+   *  There is no system matrix. Hence, this mesh motion can only be used by
+   *  pure ALE problems and partitioned schemes, but not in monolithic FSI.
+   *
+   *  <h3>References:</h3>
+   *  <ul>
+   *  <li> de Boer, A., van der Schoot, M. S. and Bijl, H.: Mesh deformation based
+   *       on radial basis function interpolation, Computers & Structures (85),
+   *       No. 11-14, pp. 784-795, 2007 </li>
+   *  <li> Rendall, T. C. S. and Allen, C. B.: Efficient mesh motion using radial
+   *       basis functions with data reduction algorithms, Journal of
+   *       Computational Physics (228), No. 17, pp. 6231-6249, 2009 </li>
+   *  </ul>
+   *
+   */
+  class AleRbf : public Ale
+  {
+   public:
+    //! Constructor
+    AleRbf(std::shared_ptr<Core::FE::Discretization> actdis,  ///< pointer to discretization
+        std::shared_ptr<Core::LinAlg::Solver> solver,         ///< linear solver
+        std::shared_ptr<Teuchos::ParameterList> params_in,    ///< parameter list
+        std::shared_ptr<Core::IO::DiscretizationWriter> output  ///< output writing
+    );
+
+    //! There is no system matrix to allocate.
+    void create_system_matrix(
+        std::shared_ptr<const ALE::Utils::MapExtractor> interface = nullptr) override
+    {
+    }
+
+    /*! \brief Remember the Dirichlet set for the next interpolation
+     *
+     *  The prescribed displacements are taken from the displacement vector.
+     *  No element is evaluated.
+     */
+    void evaluate(std::shared_ptr<const Core::LinAlg::Vector<double>> stepinc = nullptr,
+        ALE::Utils::MapExtractor::AleDBCSetType dbc_type =
+            ALE::Utils::MapExtractor::dbc_set_std) override;
+
+    //! Interpolate the prescribed displacements into the volume
+    int solve() override;
+
+    //! Apply the increment to the interpolated displacements
+    void update_iter() override;
+
+    //! Interpolate once, there is nothing to iterate
+    void time_step(ALE::Utils::MapExtractor::AleDBCSetType dbc_type =
+                       ALE::Utils::MapExtractor::dbc_set_std) override;
+
+    //! not available for radial basis function mesh motion
+    std::shared_ptr<Core::LinAlg::SparseMatrix> system_matrix() override;
+
+    //! not available for radial basis function mesh motion
+    std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> block_system_matrix() override;
+
+   private:
+    //! number of spatial dimensions
+    const int ndim_;
+
+    //! support radius (<= 0: diameter of the prescribed nodes)
+    const double support_radius_;
+
+    //! relative tolerance of the greedy selection
+    const double greedy_tol_;
+
+    //! maximum number of control points
+    const int max_points_;
+
+    //! Dirichlet set of the last call to evaluate()
+    ALE::Utils::MapExtractor::AleDBCSetType dbc_type_ = ALE::Utils::MapExtractor::dbc_set_std;
+
+    //! displacement increment of the last interpolation
+    std::shared_ptr<Core::LinAlg::Vector<double>> increment_;
+
+  };  // class AleRbf
+
+}  // namespace ALE
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -3484,10 +3484,8 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues,
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
 void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     calc_stiffmat_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot2,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot2,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
         Core::LinAlg::SerialDenseMatrix& stiffmat21,
         Core::LinAlg::SerialDenseMatrix& stiffmat22) const
@@ -3516,13 +3514,11 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
 void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     add_stiffmat_contributions_xi_master_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot2,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot2,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
         Core::LinAlg::SerialDenseMatrix& stiffmat21,
@@ -3560,11 +3556,10 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     calc_fpot_gausspoint_automatic_differentiation_if_required(
         Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, double>& force_pot1,
         Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, double>& force_pot2,
-        Sacado::Fad::DFad<double> const& interaction_potential,
-        Sacado::Fad::DFad<double> const& potential_reduction_factor,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        fad_type const& interaction_potential, fad_type const& potential_reduction_factor,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs) const
 {
   const unsigned int dim = 3 * numnodalvalues * numnodes;
@@ -3586,15 +3581,12 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
 void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     calc_fpot_gausspoint_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            force_pot2,
-        Sacado::Fad::DFad<double> const& interaction_potential,
-        Sacado::Fad::DFad<double> const& potential_reduction_factor,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& force_pot2,
+        fad_type const& interaction_potential, fad_type const& potential_reduction_factor,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs) const
 {
   const unsigned int dim = 3 * numnodalvalues * numnodes;
@@ -3714,10 +3706,8 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::rese
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
 void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     set_automatic_differentiation_variables_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele1centerlinedofvec,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele2centerlinedofvec)
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele1centerlinedofvec,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele2centerlinedofvec)
 {
   // The 2*3*numnodes*numnodalvalues primary DoFs consist of all nodal positions and tangents
   for (unsigned int i = 0; i < 3 * numnodes * numnodalvalues; ++i)
@@ -3733,11 +3723,9 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
 void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     set_automatic_differentiation_variables_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele1centerlinedofvec,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele2centerlinedofvec,
-        Sacado::Fad::DFad<double>& xi_master)
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele1centerlinedofvec,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele2centerlinedofvec,
+        fad_type& xi_master)
 {
   // The 2*3*numnodes*numnodalvalues primary DoFs consist of all nodal positions and tangents
   for (unsigned int i = 0; i < 3 * numnodes * numnodalvalues; ++i)
@@ -3813,14 +3801,19 @@ bool BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues,
 
 // explicit template instantiations
 template class BeamInteraction::BeamToBeamPotentialPair<2, 1, double>;
-template class BeamInteraction::BeamToBeamPotentialPair<2, 1, Sacado::Fad::DFad<double>>;
+template class BeamInteraction::BeamToBeamPotentialPair<2, 1,
+    BeamInteraction::beam_to_beam_potential_fad_type<2, 1>>;
 template class BeamInteraction::BeamToBeamPotentialPair<3, 1, double>;
-template class BeamInteraction::BeamToBeamPotentialPair<3, 1, Sacado::Fad::DFad<double>>;
+template class BeamInteraction::BeamToBeamPotentialPair<3, 1,
+    BeamInteraction::beam_to_beam_potential_fad_type<3, 1>>;
 template class BeamInteraction::BeamToBeamPotentialPair<4, 1, double>;
-template class BeamInteraction::BeamToBeamPotentialPair<4, 1, Sacado::Fad::DFad<double>>;
+template class BeamInteraction::BeamToBeamPotentialPair<4, 1,
+    BeamInteraction::beam_to_beam_potential_fad_type<4, 1>>;
 template class BeamInteraction::BeamToBeamPotentialPair<5, 1, double>;
-template class BeamInteraction::BeamToBeamPotentialPair<5, 1, Sacado::Fad::DFad<double>>;
+template class BeamInteraction::BeamToBeamPotentialPair<5, 1,
+    BeamInteraction::beam_to_beam_potential_fad_type<5, 1>>;
 template class BeamInteraction::BeamToBeamPotentialPair<2, 2, double>;
-template class BeamInteraction::BeamToBeamPotentialPair<2, 2, Sacado::Fad::DFad<double>>;
+template class BeamInteraction::BeamToBeamPotentialPair<2, 2,
+    BeamInteraction::beam_to_beam_potential_fad_type<2, 2>>;
 
 FOUR_C_NAMESPACE_CLOSE
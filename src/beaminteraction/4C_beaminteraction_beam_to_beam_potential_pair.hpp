@@ -35,6 +35,17 @@ namespace Discret
 
 namespace BeamInteraction
 {
+  /*!
+   \brief FAD type for the automatic linearization of beam-to-beam potential pairs
+
+   The number of derivative directions is known at compile time: the centerline DoFs of both
+   elements and, if required, the parameter coordinate of the closest point on the master beam.
+   In contrast to Sacado::Fad::DFad, no memory is allocated for the derivatives of temporaries.
+   */
+  template <unsigned int numnodes, unsigned int numnodalvalues>
+  using beam_to_beam_potential_fad_type =
+      Sacado::Fad::SLFad<double, 2 * 3 * numnodes * numnodalvalues + 1>;
+
   /*!
    \brief class for potential-based interaction between two 3D beam elements
    */
@@ -42,6 +53,9 @@ namespace BeamInteraction
   class BeamToBeamPotentialPair : public BeamPotentialPair
   {
    public:
+    //! FAD type used for the automatic linearization
+    using fad_type = beam_to_beam_potential_fad_type<numnodes, numnodalvalues>;
+
     //! @name Friends
     // no friend classes defined
     //@}
@@ -181,9 +195,8 @@ namespace BeamInteraction
      *
      */
     void evaluate_stiffpot_analytic_contributions_large_sep_approx(
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& dist,
-        Sacado::Fad::DFad<double> const& norm_dist, Sacado::Fad::DFad<double> const& norm_dist_exp1,
-        double q1q2_JacFac_GaussWeights,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& dist, fad_type const& norm_dist,
+        fad_type const& norm_dist_exp1, double q1q2_JacFac_GaussWeights,
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N1_i_GP1,
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N2_i_GP2,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
@@ -222,9 +235,8 @@ namespace BeamInteraction
      *
      */
     void evaluate_stiffpot_analytic_contributions_double_length_specific_small_sep_approx(
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& dist,
-        Sacado::Fad::DFad<double> const& norm_dist, Sacado::Fad::DFad<double> const& gap,
-        Sacado::Fad::DFad<double> const& gap_regularized, Sacado::Fad::DFad<double> const& gap_exp1,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& dist, fad_type const& norm_dist,
+        fad_type const& gap, fad_type const& gap_regularized, fad_type const& gap_exp1,
         double q1q2_JacFac_GaussWeights,
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N1_i_GP1,
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N2_i_GP2,
@@ -313,7 +325,7 @@ namespace BeamInteraction
      *
      */
     void scale_stiffpot_analytic_contributions_if_required(
-        Sacado::Fad::DFad<double> const& scalefactor, Core::LinAlg::SerialDenseMatrix& stiffmat11,
+        fad_type const& scalefactor, Core::LinAlg::SerialDenseMatrix& stiffmat11,
         Core::LinAlg::SerialDenseMatrix& stiffmat12, Core::LinAlg::SerialDenseMatrix& stiffmat21,
         Core::LinAlg::SerialDenseMatrix& stiffmat22) const
     {
@@ -339,10 +351,8 @@ namespace BeamInteraction
      *
      */
     void calc_stiffmat_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot2,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot2,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
         Core::LinAlg::SerialDenseMatrix& stiffmat21,
         Core::LinAlg::SerialDenseMatrix& stiffmat22) const;
@@ -372,13 +382,11 @@ namespace BeamInteraction
      *
      */
     void add_stiffmat_contributions_xi_master_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>> const&
-            force_pot2,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type> const& force_pot2,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
         Core::LinAlg::SerialDenseMatrix& stiffmat21,
@@ -390,26 +398,22 @@ namespace BeamInteraction
     void calc_fpot_gausspoint_automatic_differentiation_if_required(
         Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, double>& force_pot1,
         Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, double>& force_pot2,
-        Sacado::Fad::DFad<double> const& interaction_potential,
-        Sacado::Fad::DFad<double> const& potential_reduction_factor,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        fad_type const& interaction_potential, fad_type const& potential_reduction_factor,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs) const;
 
     /** \brief compute discrete force vectors using automatic differentiation
      *
      */
     void calc_fpot_gausspoint_automatic_differentiation_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            force_pot1,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            force_pot2,
-        Sacado::Fad::DFad<double> const& interaction_potential,
-        Sacado::Fad::DFad<double> const& potential_reduction_factor,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& force_pot1,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& force_pot2,
+        fad_type const& interaction_potential, fad_type const& potential_reduction_factor,
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_slaveDofs,
-        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
+        Core::LinAlg::Matrix<1, 3 * numnodes * numnodalvalues, fad_type> const&
             lin_xi_master_masterDofs) const;
 
     /** \brief compute discrete force vectors using automatic differentiation
@@ -466,36 +470,27 @@ namespace BeamInteraction
     void evaluate_stiffpot_analytic_contributions_single_length_specific_small_sep_approx_simple(
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N_i_slave,
         Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double> const& N_i_xi_slave,
-        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
-            N_i_master,
-        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
-            N_i_xi_master,
-        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, Sacado::Fad::DFad<double>> const&
-            N_i_xixi_master,
-        Sacado::Fad::DFad<double> const& xi_master,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& r_xi_slave,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& r_xi_master,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& r_xixi_master,
-        Sacado::Fad::DFad<double> const& norm_dist_ul,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& normal_ul,
-        Sacado::Fad::DFad<double> const& pot_red_fac,
-        Sacado::Fad::DFad<double> const& pot_red_fac_deriv_xi_master,
-        Sacado::Fad::DFad<double> const& pot_red_fac_2ndderiv_xi_master,
-        Sacado::Fad::DFad<double> const& pot_ia,
-        Sacado::Fad::DFad<double> const& pot_ia_deriv_gap_ul,
-        Sacado::Fad::DFad<double> const& pot_ia_deriv_cos_alpha,
-        Sacado::Fad::DFad<double> const& pot_ia_2ndderiv_gap_ul,
-        Sacado::Fad::DFad<double> const& pot_ia_deriv_gap_ul_deriv_cos_alpha,
-        Sacado::Fad::DFad<double> const& pot_ia_2ndderiv_cos_alpha,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& gap_ul_deriv_r_slave,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& gap_ul_deriv_r_master,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& cos_alpha_deriv_r_slave,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& cos_alpha_deriv_r_master,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& cos_alpha_deriv_r_xi_slave,
-        Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const& cos_alpha_deriv_r_xi_master,
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>> const& xi_master_partial_r_slave,
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>> const& xi_master_partial_r_master,
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>> const& xi_master_partial_r_xi_master,
+        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, fad_type> const& N_i_master,
+        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, fad_type> const& N_i_xi_master,
+        Core::LinAlg::Matrix<1, numnodes * numnodalvalues, fad_type> const& N_i_xixi_master,
+        fad_type const& xi_master, Core::LinAlg::Matrix<3, 1, fad_type> const& r_xi_slave,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& r_xi_master,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& r_xixi_master, fad_type const& norm_dist_ul,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& normal_ul, fad_type const& pot_red_fac,
+        fad_type const& pot_red_fac_deriv_xi_master, fad_type const& pot_red_fac_2ndderiv_xi_master,
+        fad_type const& pot_ia, fad_type const& pot_ia_deriv_gap_ul,
+        fad_type const& pot_ia_deriv_cos_alpha, fad_type const& pot_ia_2ndderiv_gap_ul,
+        fad_type const& pot_ia_deriv_gap_ul_deriv_cos_alpha,
+        fad_type const& pot_ia_2ndderiv_cos_alpha,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& gap_ul_deriv_r_slave,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& gap_ul_deriv_r_master,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& cos_alpha_deriv_r_slave,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& cos_alpha_deriv_r_master,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& cos_alpha_deriv_r_xi_slave,
+        Core::LinAlg::Matrix<3, 1, fad_type> const& cos_alpha_deriv_r_xi_master,
+        Core::LinAlg::Matrix<1, 3, fad_type> const& xi_master_partial_r_slave,
+        Core::LinAlg::Matrix<1, 3, fad_type> const& xi_master_partial_r_master,
+        Core::LinAlg::Matrix<1, 3, fad_type> const& xi_master_partial_r_xi_master,
         Core::LinAlg::SerialDenseMatrix& stiffmat11, Core::LinAlg::SerialDenseMatrix& stiffmat12,
         Core::LinAlg::SerialDenseMatrix& stiffmat21,
         Core::LinAlg::SerialDenseMatrix& stiffmat22) const
@@ -544,10 +539,8 @@ namespace BeamInteraction
      *
      */
     void set_automatic_differentiation_variables_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele1centerlinedofvec,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele2centerlinedofvec);
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele1centerlinedofvec,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele2centerlinedofvec);
 
     /** \brief set primary variables including xi_master for FAD if required
      *
@@ -564,11 +557,9 @@ namespace BeamInteraction
      *
      */
     void set_automatic_differentiation_variables_if_required(
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele1centerlinedofvec,
-        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, Sacado::Fad::DFad<double>>&
-            ele2centerlinedofvec,
-        Sacado::Fad::DFad<double>& xi_master);
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele1centerlinedofvec,
+        Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, fad_type>& ele2centerlinedofvec,
+        fad_type& xi_master);
 
     /** \brief estimate whether the elements' separation is much more than the cutoff distance
      *
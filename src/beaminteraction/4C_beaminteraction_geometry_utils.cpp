@@ -8,6 +8,7 @@
 #include "4C_beaminteraction_geometry_utils.hpp"
 
 #include "4C_beam3_spatial_discretization_utils.hpp"
+#include "4C_beaminteraction_beam_to_beam_potential_pair.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_utils_fad.hpp"
 
@@ -15,6 +16,13 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! FAD type of the beam-to-beam potential pairs calling these functions
+  template <unsigned int numnodes, unsigned int numnodalvalues>
+  using FadType = BeamInteraction::beam_to_beam_potential_fad_type<numnodes, numnodalvalues>;
+}  // namespace
+
 /*-----------------------------------------------------------------------------------------------*
  *-----------------------------------------------------------------------------------------------*/
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
@@ -666,6 +674,8 @@ void BeamInteraction::Geo::calc_enclosed_angle(T& angle, T& cosine_angle,
 
 
 // explicit template instantiations
+// note: functions only templated on the scalar type are instantiated for FadType<2, 1>, ...,
+// FadType<5, 1>, the pair with (numnodes, numnodalvalues) = (2, 2) shares the FAD type of (4, 1)
 template bool BeamInteraction::Geo::point_to_curve_projection<2, 1, double>(
     Core::LinAlg::Matrix<3, 1, double> const&, double&, double const&,
     const Core::LinAlg::Matrix<6, 1, double>&, const Core::FE::CellType&, double);
@@ -681,26 +691,21 @@ template bool BeamInteraction::Geo::point_to_curve_projection<5, 1, double>(
 template bool BeamInteraction::Geo::point_to_curve_projection<2, 2, double>(
     Core::LinAlg::Matrix<3, 1, double> const&, double&, double const&,
     const Core::LinAlg::Matrix<12, 1, double>&, const Core::FE::CellType&, double);
-template bool BeamInteraction::Geo::point_to_curve_projection<2, 1, Sacado::Fad::DFad<double>>(
-    Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const&, Sacado::Fad::DFad<double>&,
-    double const&, const Core::LinAlg::Matrix<6, 1, Sacado::Fad::DFad<double>>&,
-    const Core::FE::CellType&, double);
-template bool BeamInteraction::Geo::point_to_curve_projection<3, 1, Sacado::Fad::DFad<double>>(
-    Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const&, Sacado::Fad::DFad<double>&,
-    double const&, const Core::LinAlg::Matrix<9, 1, Sacado::Fad::DFad<double>>&,
-    const Core::FE::CellType&, double);
-template bool BeamInteraction::Geo::point_to_curve_projection<4, 1, Sacado::Fad::DFad<double>>(
-    Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const&, Sacado::Fad::DFad<double>&,
-    double const&, const Core::LinAlg::Matrix<12, 1, Sacado::Fad::DFad<double>>&,
-    const Core::FE::CellType&, double);
-template bool BeamInteraction::Geo::point_to_curve_projection<5, 1, Sacado::Fad::DFad<double>>(
-    Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const&, Sacado::Fad::DFad<double>&,
-    double const&, const Core::LinAlg::Matrix<15, 1, Sacado::Fad::DFad<double>>&,
-    const Core::FE::CellType&, double);
-template bool BeamInteraction::Geo::point_to_curve_projection<2, 2, Sacado::Fad::DFad<double>>(
-    Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>> const&, Sacado::Fad::DFad<double>&,
-    double const&, const Core::LinAlg::Matrix<12, 1, Sacado::Fad::DFad<double>>&,
-    const Core::FE::CellType&, double);
+template bool BeamInteraction::Geo::point_to_curve_projection<2, 1, FadType<2, 1>>(
+    Core::LinAlg::Matrix<3, 1, FadType<2, 1>> const&, FadType<2, 1>&, double const&,
+    const Core::LinAlg::Matrix<6, 1, FadType<2, 1>>&, const Core::FE::CellType&, double);
+template bool BeamInteraction::Geo::point_to_curve_projection<3, 1, FadType<3, 1>>(
+    Core::LinAlg::Matrix<3, 1, FadType<3, 1>> const&, FadType<3, 1>&, double const&,
+    const Core::LinAlg::Matrix<9, 1, FadType<3, 1>>&, const Core::FE::CellType&, double);
+template bool BeamInteraction::Geo::point_to_curve_projection<4, 1, FadType<4, 1>>(
+    Core::LinAlg::Matrix<3, 1, FadType<4, 1>> const&, FadType<4, 1>&, double const&,
+    const Core::LinAlg::Matrix<12, 1, FadType<4, 1>>&, const Core::FE::CellType&, double);
+template bool BeamInteraction::Geo::point_to_curve_projection<5, 1, FadType<5, 1>>(
+    Core::LinAlg::Matrix<3, 1, FadType<5, 1>> const&, FadType<5, 1>&, double const&,
+    const Core::LinAlg::Matrix<15, 1, FadType<5, 1>>&, const Core::FE::CellType&, double);
+template bool BeamInteraction::Geo::point_to_curve_projection<2, 2, FadType<2, 2>>(
+    Core::LinAlg::Matrix<3, 1, FadType<2, 2>> const&, FadType<2, 2>&, double const&,
+    const Core::LinAlg::Matrix<12, 1, FadType<2, 2>>&, const Core::FE::CellType&, double);
 
 template void
 BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<2, 1,
@@ -732,56 +737,49 @@ BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coo
     const Core::LinAlg::Matrix<3, 1, double>&, const Core::LinAlg::Matrix<3, 1, double>&,
     const Core::LinAlg::Matrix<3, 1, double>&, const Core::LinAlg::Matrix<3, 12, double>&,
     const Core::LinAlg::Matrix<3, 12, double>&, const Core::LinAlg::Matrix<3, 12, double>&);
-template void
-BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<2, 1,
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<1, 6, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<1, 6, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 6, double>&,
-    const Core::LinAlg::Matrix<3, 6, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 6, Sacado::Fad::DFad<double>>&);
-template void
-BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<3, 1,
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<1, 9, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<1, 9, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 9, double>&,
-    const Core::LinAlg::Matrix<3, 9, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 9, Sacado::Fad::DFad<double>>&);
-template void
-BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<4, 1,
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<1, 12, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<1, 12, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 12, double>&,
-    const Core::LinAlg::Matrix<3, 12, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 12, Sacado::Fad::DFad<double>>&);
-template void
-BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<5, 1,
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<1, 15, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<1, 15, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 15, double>&,
-    const Core::LinAlg::Matrix<3, 15, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 15, Sacado::Fad::DFad<double>>&);
-template void
-BeamInteraction::Geo::calc_linearization_point_to_curve_projection_parameter_coord_master<2, 2,
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<1, 12, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<1, 12, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 12, double>&,
-    const Core::LinAlg::Matrix<3, 12, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 12, Sacado::Fad::DFad<double>>&);
+template void BeamInteraction::Geo::
+    calc_linearization_point_to_curve_projection_parameter_coord_master<2, 1, FadType<2, 1>>(
+        Core::LinAlg::Matrix<1, 6, FadType<2, 1>>&, Core::LinAlg::Matrix<1, 6, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&, const Core::LinAlg::Matrix<3, 6, double>&,
+        const Core::LinAlg::Matrix<3, 6, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 6, FadType<2, 1>>&);
+template void BeamInteraction::Geo::
+    calc_linearization_point_to_curve_projection_parameter_coord_master<3, 1, FadType<3, 1>>(
+        Core::LinAlg::Matrix<1, 9, FadType<3, 1>>&, Core::LinAlg::Matrix<1, 9, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&, const Core::LinAlg::Matrix<3, 9, double>&,
+        const Core::LinAlg::Matrix<3, 9, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 9, FadType<3, 1>>&);
+template void BeamInteraction::Geo::
+    calc_linearization_point_to_curve_projection_parameter_coord_master<4, 1, FadType<4, 1>>(
+        Core::LinAlg::Matrix<1, 12, FadType<4, 1>>&, Core::LinAlg::Matrix<1, 12, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 12, double>&,
+        const Core::LinAlg::Matrix<3, 12, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 12, FadType<4, 1>>&);
+template void BeamInteraction::Geo::
+    calc_linearization_point_to_curve_projection_parameter_coord_master<5, 1, FadType<5, 1>>(
+        Core::LinAlg::Matrix<1, 15, FadType<5, 1>>&, Core::LinAlg::Matrix<1, 15, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 15, double>&,
+        const Core::LinAlg::Matrix<3, 15, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 15, FadType<5, 1>>&);
+template void BeamInteraction::Geo::
+    calc_linearization_point_to_curve_projection_parameter_coord_master<2, 2, FadType<2, 2>>(
+        Core::LinAlg::Matrix<1, 12, FadType<2, 2>>&, Core::LinAlg::Matrix<1, 12, FadType<2, 2>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 2>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 2>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 2>>&,
+        const Core::LinAlg::Matrix<3, 12, double>&,
+        const Core::LinAlg::Matrix<3, 12, FadType<2, 2>>&,
+        const Core::LinAlg::Matrix<3, 12, FadType<2, 2>>&);
 
 template void
 BeamInteraction::Geo::calc_point_to_curve_projection_parameter_coord_master_partial_derivs<double>(
@@ -789,13 +787,33 @@ BeamInteraction::Geo::calc_point_to_curve_projection_parameter_coord_master_part
     Core::LinAlg::Matrix<1, 3, double>&, const Core::LinAlg::Matrix<3, 1, double>&,
     const Core::LinAlg::Matrix<3, 1, double>&, const Core::LinAlg::Matrix<3, 1, double>&);
 template void BeamInteraction::Geo::
-    calc_point_to_curve_projection_parameter_coord_master_partial_derivs<Sacado::Fad::DFad<double>>(
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-        Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-        const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-        const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-        const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&);
+    calc_point_to_curve_projection_parameter_coord_master_partial_derivs<FadType<2, 1>>(
+        Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial_derivs<FadType<3, 1>>(
+        Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial_derivs<FadType<4, 1>>(
+        Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial_derivs<FadType<5, 1>>(
+        Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&);
 
 template void BeamInteraction::Geo::
     calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<double>(
@@ -812,39 +830,101 @@ template void BeamInteraction::Geo::
         const Core::LinAlg::Matrix<3, 3, double>&, const Core::LinAlg::Matrix<3, 1, double>&,
         const Core::LinAlg::Matrix<3, 1, double>&, const Core::LinAlg::Matrix<3, 1, double>&,
         const Core::LinAlg::Matrix<3, 1, double>&);
-template void
-BeamInteraction::Geo::calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<
-    Sacado::Fad::DFad<double>>(Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<1, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 3, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<FadType<2, 1>>(
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<FadType<3, 1>>(
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<FadType<4, 1>>(
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&);
+template void BeamInteraction::Geo::
+    calc_point_to_curve_projection_parameter_coord_master_partial2nd_derivs<FadType<5, 1>>(
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&, Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<1, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 3, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+        const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&);
 
 template void BeamInteraction::Geo::calc_enclosed_angle<double>(double&, double&,
     const Core::LinAlg::Matrix<3, 1, double>&, const Core::LinAlg::Matrix<3, 1, double>&);
-template void BeamInteraction::Geo::calc_enclosed_angle<Sacado::Fad::DFad<double>>(
-    Sacado::Fad::DFad<double>&, Sacado::Fad::DFad<double>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&,
-    const Core::LinAlg::Matrix<3, 1, Sacado::Fad::DFad<double>>&);
+template void BeamInteraction::Geo::calc_enclosed_angle<FadType<2, 1>>(
+    FadType<2, 1>&, FadType<2, 1>&, const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&,
+    const Core::LinAlg::Matrix<3, 1, FadType<2, 1>>&);
+template void BeamInteraction::Geo::calc_enclosed_angle<FadType<3, 1>>(
+    FadType<3, 1>&, FadType<3, 1>&, const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&,
+    const Core::LinAlg::Matrix<3, 1, FadType<3, 1>>&);
+template void BeamInteraction::Geo::calc_enclosed_angle<FadType<4, 1>>(
+    FadType<4, 1>&, FadType<4, 1>&, const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&,
+    const Core::LinAlg::Matrix<3, 1, FadType<4, 1>>&);
+template void BeamInteraction::Geo::calc_enclosed_angle<FadType<5, 1>>(
+    FadType<5, 1>&, FadType<5, 1>&, const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&,
+    const Core::LinAlg::Matrix<3, 1, FadType<5, 1>>&);
+
 
 FOUR_C_NAMESPACE_CLOSE
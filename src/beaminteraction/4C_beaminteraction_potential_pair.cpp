@@ -88,7 +88,7 @@ std::shared_ptr<BeamInteraction::BeamPotentialPair> BeamInteraction::BeamPotenti
           {
             if (beam_potential_params.use_fad())
               return std::make_shared<
-                  BeamInteraction::BeamToBeamPotentialPair<2, 1, Sacado::Fad::DFad<double>>>();
+                  BeamToBeamPotentialPair<2, 1, beam_to_beam_potential_fad_type<2, 1>>>();
             else
               return std::make_shared<BeamInteraction::BeamToBeamPotentialPair<2, 1, double>>();
           }
@@ -101,7 +101,7 @@ std::shared_ptr<BeamInteraction::BeamPotentialPair> BeamInteraction::BeamPotenti
           {
             if (beam_potential_params.use_fad())
               return std::make_shared<
-                  BeamInteraction::BeamToBeamPotentialPair<3, 1, Sacado::Fad::DFad<double>>>();
+                  BeamToBeamPotentialPair<3, 1, beam_to_beam_potential_fad_type<3, 1>>>();
             else
               return std::make_shared<BeamInteraction::BeamToBeamPotentialPair<3, 1, double>>();
           }
@@ -114,7 +114,7 @@ std::shared_ptr<BeamInteraction::BeamPotentialPair> BeamInteraction::BeamPotenti
           {
             if (beam_potential_params.use_fad())
               return std::make_shared<
-                  BeamInteraction::BeamToBeamPotentialPair<4, 1, Sacado::Fad::DFad<double>>>();
+                  BeamToBeamPotentialPair<4, 1, beam_to_beam_potential_fad_type<4, 1>>>();
             else
               return std::make_shared<BeamInteraction::BeamToBeamPotentialPair<4, 1, double>>();
           }
@@ -127,7 +127,7 @@ std::shared_ptr<BeamInteraction::BeamPotentialPair> BeamInteraction::BeamPotenti
           {
             if (beam_potential_params.use_fad())
               return std::make_shared<
-                  BeamInteraction::BeamToBeamPotentialPair<5, 1, Sacado::Fad::DFad<double>>>();
+                  BeamToBeamPotentialPair<5, 1, beam_to_beam_potential_fad_type<5, 1>>>();
             else
               return std::make_shared<BeamInteraction::BeamToBeamPotentialPair<5, 1, double>>();
           }
@@ -156,7 +156,7 @@ std::shared_ptr<BeamInteraction::BeamPotentialPair> BeamInteraction::BeamPotenti
           {
             if (beam_potential_params.use_fad())
               return std::make_shared<
-                  BeamInteraction::BeamToBeamPotentialPair<2, 2, Sacado::Fad::DFad<double>>>();
+                  BeamToBeamPotentialPair<2, 2, beam_to_beam_potential_fad_type<2, 2>>>();
             else
               return std::make_shared<BeamInteraction::BeamToBeamPotentialPair<2, 2, double>>();
           }
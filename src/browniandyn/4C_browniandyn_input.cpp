@@ -53,6 +53,19 @@ void BrownianDynamics::set_valid_parameters(std::map<std::string, Core::IO::Inpu
           BrownianDynamics::input_file),
       browniandyn_list);
 
+  // the way how the random numbers of the stochastic forces are generated
+  Core::Utils::string_to_integral_parameter<RandomNumberGeneration>("RANDOM_NUMBER_GENERATION",
+      "global_engine",
+      "How are the random numbers of the stochastic forces generated? 'global_engine' draws them "
+      "from the random number engine of each processor, so they depend on the parallel "
+      "distribution. 'counter_based' computes them from the seed, the element id and the "
+      "stochastic step, so they are identical for any number of processors. The two options give "
+      "different random forces and hence different results.",
+      tuple<std::string>("global_engine", "counter_based"),
+      tuple<RandomNumberGeneration>(
+          BrownianDynamics::global_engine, BrownianDynamics::counter_based),
+      browniandyn_list);
+
   // values for damping coefficients of beams if they are specified via input file
   // (per unit length, NOT yet multiplied by fluid viscosity)
   browniandyn_list.specs.emplace_back(parameter<std::string>("BEAMS_DAMPING_COEFF_PER_UNITLENGTH",
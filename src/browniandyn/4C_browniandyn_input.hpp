@@ -28,6 +28,15 @@ namespace BrownianDynamics
     vague
   };
 
+  /// the way how the random numbers of the stochastic forces are generated
+  enum RandomNumberGeneration
+  {
+    /// stream of the global random number engine of each processor
+    global_engine,
+    /// counter-based generator keyed by seed, element id and stochastic step
+    counter_based
+  };
+
   /// set the brownian dynamic parameters
   void set_valid_parameters(std::map<std::string, Core::IO::InputSpec>& list);
 
@@ -9,6 +9,7 @@
 
 #include "4C_beam3_base.hpp"
 #include "4C_beaminteraction_calc_utils.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_geometry_periodic_boundingbox.hpp"
 #include "4C_global_data.hpp"
@@ -20,6 +21,7 @@
 #include "4C_structure_new_integrator.hpp"
 #include "4C_structure_new_model_evaluator_data.hpp"
 #include "4C_structure_new_timint_base.hpp"
+#include "4C_utils_random.hpp"
 
 #include <Teuchos_ParameterList.hpp>
 
@@ -69,6 +71,10 @@ void Solid::ModelEvaluator::BrownianDyn::setup()
   }
 
   brown_dyn_state_data_.browndyn_step = -1;
+
+  // the random forces are computed from the same seed on every processor
+  brown_dyn_state_data_.browndyn_seed = Global::Problem::instance()->random()->rand_seed();
+  Core::Communication::broadcast(brown_dyn_state_data_.browndyn_seed, 0, discret_ptr_->get_comm());
   // -------------------------------------------------------------------------
   // setup the brownian forces and the external force pointers
   // -------------------------------------------------------------------------
@@ -666,50 +672,62 @@ void Solid::ModelEvaluator::BrownianDyn::generate_gaussian_random_numbers()
   double standarddeviation =
       pow(2.0 * eval_browniandyn_ptr_->kt() / brown_dyn_state_data_.browndyn_dt, 0.5);
 
-  // Set mean value and standard deviation of normal distribution
-  Global::Problem::instance()->random()->set_mean_variance(meanvalue, standarddeviation);
-  Global::Problem::instance()->random()->set_rand_range(0.0, 1.0);
-
-  // multivector for stochastic forces evaluated by each element based on row map
-  std::shared_ptr<Core::LinAlg::MultiVector<double>> randomnumbersrow =
+  // multivector for stochastic forces evaluated by each element based on column map
+  std::shared_ptr<Core::LinAlg::MultiVector<double>> randomnumberscol =
       eval_browniandyn_ptr_->get_random_forces();
 
-  int numele = randomnumbersrow->MyLength();
-  int numperele = randomnumbersrow->NumVectors();
-  int count = numele * numperele;
-  std::vector<double> randvec(count);
-  Global::Problem::instance()->random()->normal(randvec, count);
+  int numele = randomnumberscol->MyLength();
+  int numperele = randomnumberscol->NumVectors();
 
-  // MAXRANDFORCE is a multiple of the standard deviation
-  double maxrandforcefac = eval_browniandyn_ptr_->max_rand_force();
-  if (maxrandforcefac == -1.0)
+  if (eval_browniandyn_ptr_->random_number_generation() == BrownianDynamics::counter_based)
   {
+    /* the random numbers of an element only depend on the seed, its global id and the stochastic
+     * step. Hence, row and ghosted elements get the same random numbers on every processor
+     * without communication and the results do not depend on the parallel distribution */
+    const Epetra_BlockMap& elecolmap = randomnumberscol->Map();
+    std::vector<double> randvec(numperele);
     for (int i = 0; i < numele; ++i)
+    {
+      Core::Utils::Random::normal(brown_dyn_state_data_.browndyn_seed, elecolmap.GID(i),
+          browndyn_step, randvec, numperele);
       for (int j = 0; j < numperele; ++j)
-      {
-        (*randomnumbersrow)(j)[i] = randvec[i * numperele + j];
-      }
+        (*randomnumberscol)(j)[i] = meanvalue + standarddeviation * randvec[j];
+    }
   }
   else
+  {
+    // Set mean value and standard deviation of normal distribution
+    Global::Problem::instance()->random()->set_mean_variance(meanvalue, standarddeviation);
+    Global::Problem::instance()->random()->set_rand_range(0.0, 1.0);
+
+    int count = numele * numperele;
+    std::vector<double> randvec(count);
+    Global::Problem::instance()->random()->normal(randvec, count);
+
+    for (int i = 0; i < numele; ++i)
+      for (int j = 0; j < numperele; ++j) (*randomnumberscol)(j)[i] = randvec[i * numperele + j];
+  }
+
+  // MAXRANDFORCE is a multiple of the standard deviation
+  double maxrandforcefac = eval_browniandyn_ptr_->max_rand_force();
+  if (maxrandforcefac != -1.0)
   {
     for (int i = 0; i < numele; ++i)
       for (int j = 0; j < numperele; ++j)
       {
-        (*randomnumbersrow)(j)[i] = randvec[i * numperele + j];
-
-        if ((*randomnumbersrow)(j)[i] > maxrandforcefac * standarddeviation + meanvalue)
+        if ((*randomnumberscol)(j)[i] > maxrandforcefac * standarddeviation + meanvalue)
         {
           std::cout << "warning: stochastic force restricted according to MAXRANDFORCE"
                        " this should not happen to often"
                     << std::endl;
-          (*randomnumbersrow)(j)[i] = maxrandforcefac * standarddeviation + meanvalue;
+          (*randomnumberscol)(j)[i] = maxrandforcefac * standarddeviation + meanvalue;
         }
-        else if ((*randomnumbersrow)(j)[i] < -maxrandforcefac * standarddeviation + meanvalue)
+        else if ((*randomnumberscol)(j)[i] < -maxrandforcefac * standarddeviation + meanvalue)
         {
           std::cout << "warning: stochastic force restricted according to MAXRANDFORCE"
                        " this should not happen to often"
                     << std::endl;
-          (*randomnumbersrow)(j)[i] = -maxrandforcefac * standarddeviation + meanvalue;
+          (*randomnumberscol)(j)[i] = -maxrandforcefac * standarddeviation + meanvalue;
         }
       }
   }
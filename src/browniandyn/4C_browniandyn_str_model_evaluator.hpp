@@ -173,6 +173,7 @@ namespace Solid
       {
         double browndyn_dt;  // inputfile
         int browndyn_step;
+        unsigned int browndyn_seed;  // same on all processors
       };
 
       //! brownian dyn evaluation data container
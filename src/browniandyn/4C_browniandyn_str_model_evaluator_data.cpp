@@ -26,6 +26,7 @@ Solid::ModelEvaluator::BrownianDynData::BrownianDynData()
       kt_(0.0),
       maxrandforce_(0.0),
       timeintconstrandnumb_(0.0),
+      random_number_generation_(BrownianDynamics::global_engine),
       beam_damping_coeff_specified_via_(BrownianDynamics::vague),
       beams_damping_coefficient_prefactors_perunitlength_{0.0, 0.0, 0.0},
       randomforces_(nullptr)
@@ -53,6 +54,9 @@ void Solid::ModelEvaluator::BrownianDynData::init(
   maxrandforce_ = browndyn_params_list.get<double>("MAXRANDFORCE");
   // time interval with constant random forces
   timeintconstrandnumb_ = browndyn_params_list.get<double>("TIMESTEP");
+  // the way how the random numbers of the stochastic forces are generated
+  random_number_generation_ = Teuchos::getIntegralValue<BrownianDynamics::RandomNumberGeneration>(
+      browndyn_params_list, "RANDOM_NUMBER_GENERATION");
 
   // the way how damping coefficient values for beams are specified
   beam_damping_coeff_specified_via_ =
@@ -8,8 +8,11 @@
 #include "4C_comm_exporter.hpp"
 
 #include "4C_comm_mpi_utils.hpp"
+#include "4C_io_performance_telemetry.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <array>
+#include <map>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -42,6 +45,8 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
 {
   if (my_pid() != frompid) return;
   MPI_Isend((void*)data, dsize, MPI_CHAR, topid, tag, get_comm(), &request);
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::communicated_bytes, dsize * sizeof(char));
 }
 
 void Core::Communication::Exporter::i_send(const int frompid, const int topid, const int* data,
@@ -49,6 +54,8 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
 {
   if (my_pid() != frompid) return;
   MPI_Isend((void*)data, dsize, MPI_INT, topid, tag, get_comm(), &request);
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::communicated_bytes, dsize * sizeof(int));
 }
 
 void Core::Communication::Exporter::i_send(const int frompid, const int topid, const double* data,
@@ -56,6 +63,8 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
 {
   if (my_pid() != frompid) return;
   MPI_Isend((void*)data, dsize, MPI_DOUBLE, topid, tag, get_comm(), &request);
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::communicated_bytes, dsize * sizeof(double));
 }
 
 void Core::Communication::Exporter::receive_any(
@@ -171,6 +180,91 @@ void Core::Communication::Exporter::construct_exporter()
   // send_plan()(lid,MyPID()) = 0 always! (I never send to myself)
   send_plan().resize(num_proc());
 
+  if (source_map().UniqueGIDs())
+    construct_plans_by_sparse_data_exchange();
+  else
+    construct_plans_by_broadcast();
+}
+
+void Core::Communication::Exporter::construct_plans_by_sparse_data_exchange()
+{
+  // find the owners of all gids I need but do not have
+  std::vector<int> wantgids;
+  for (int i = 0; i < target_map().NumMyElements(); ++i)
+  {
+    const int gid = target_map().GID(i);
+    if (not source_map().MyGID(gid)) wantgids.push_back(gid);
+  }
+  std::vector<int> owners(wantgids.size());
+  std::vector<int> ownerlids(wantgids.size());
+  source_map().RemoteIDList(
+      static_cast<int>(wantgids.size()), wantgids.data(), owners.data(), ownerlids.data());
+
+  // requests to the owners (gids that are not in the source map are not received at all)
+  std::map<int, std::vector<int>> requests;
+  for (std::size_t i = 0; i < wantgids.size(); ++i)
+    if (owners[i] >= 0) requests[owners[i]].push_back(wantgids[i]);
+
+  recv_plan().clear();
+  std::vector<MPI_Request> requestsends;
+  requestsends.reserve(requests.size());
+  for (const auto& [owner, gids] : requests)
+  {
+    recv_plan().push_back(owner);
+    requestsends.emplace_back();
+    MPI_Issend(gids.data(), static_cast<int>(gids.size()), MPI_INT, owner, plan_tag_, get_comm(),
+        &requestsends.back());
+  }
+
+  // Serve the requests of the other procs until all procs have sent their requests and all
+  // requests have been received (a synchronous send only completes if it was received). This
+  // way only the actual communication partners exchange messages (NBX algorithm by Hoefler et
+  // al., Scalable communication protocols for dynamic sparse data exchange, 2010).
+  MPI_Request barrier = MPI_REQUEST_NULL;
+  bool barrier_active = false;
+  std::vector<int> recvgids;
+  while (true)
+  {
+    int pending = 0;
+    MPI_Status status;
+    MPI_Iprobe(MPI_ANY_SOURCE, plan_tag_, get_comm(), &pending, &status);
+    if (pending)
+    {
+      int length = 0;
+      MPI_Get_count(&status, MPI_INT, &length);
+      recvgids.resize(length);
+      MPI_Recv(recvgids.data(), length, MPI_INT, status.MPI_SOURCE, plan_tag_, get_comm(),
+          MPI_STATUS_IGNORE);
+      for (const int gid : recvgids) send_plan()[status.MPI_SOURCE].insert(source_map().LID(gid));
+    }
+
+    if (barrier_active)
+    {
+      int done = 0;
+      MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+      if (done) break;
+    }
+    else
+    {
+      int sent = 0;
+      MPI_Testall(static_cast<int>(requestsends.size()), requestsends.data(), &sent,
+          MPI_STATUSES_IGNORE);
+      if (sent)
+      {
+        MPI_Ibarrier(get_comm(), &barrier);
+        barrier_active = true;
+      }
+    }
+  }
+
+  // A proc may leave the loop above while others still probe for requests. Without this barrier,
+  // the requests of a subsequently constructed exporter on the same communicator could be
+  // received as requests of this one, since both use the same tag.
+  Core::Communication::barrier(get_comm());
+}
+
+void Core::Communication::Exporter::construct_plans_by_broadcast()
+{
   // To build these plans, everybody has to communicate what he has and wants:
   // bundle this info to save on communication:
   int sizes[2];
@@ -184,6 +278,7 @@ void Core::Communication::Exporter::construct_exporter()
   std::copy(target_map().MyGlobalElements(),
       target_map().MyGlobalElements() + target_map().NumMyElements(), std::back_inserter(sendbuff));
 
+  recv_plan().clear();
   for (int proc = 0; proc < num_proc(); ++proc)
   {
     int recvsizes[2];
@@ -194,12 +289,12 @@ void Core::Communication::Exporter::construct_exporter()
     std::vector<int> recvbuff(recvsize);
     if (proc == my_pid()) std::copy(sendbuff.begin(), sendbuff.end(), recvbuff.data());
     Core::Communication::broadcast(recvbuff.data(), recvsize, proc, get_comm());
-    // const int* have = recvbuff.data();            // this is what proc has
+    const int* have = recvbuff.data();          // this is what proc has
     const int* want = &recvbuff[recvsizes[0]];  // this is what proc needs
 
-    // Loop what proc wants and what I have (send_plan)
     if (proc != my_pid())
     {
+      // Loop what proc wants and what I have (send_plan)
       for (int i = 0; i < recvsizes[1]; ++i)
       {
         const int gid = want[i];
@@ -209,8 +304,17 @@ void Core::Communication::Exporter::construct_exporter()
           send_plan()[proc].insert(lid);
         }
       }
+
+      // Loop what proc has and what I want (proc will send to me)
+      for (int i = 0; i < recvsizes[0]; ++i)
+      {
+        if (target_map().MyGID(have[i]))
+        {
+          recv_plan().push_back(proc);
+          break;
+        }
+      }
     }
-    Core::Communication::barrier(get_comm());
   }
 }
 
@@ -221,66 +325,58 @@ void Core::Communication::Exporter::generic_export(ExporterHelper& helper)
 
   helper.pre_export_test(this);
 
-  //------------------------------------------------ do the send/recv loop
-  for (int i = 0; i < num_proc() - 1; ++i)
+  //------------------------------------------------ do sending to all targets
+  // only procs that need data from me are contacted
+  std::vector<int> targets;
+  for (int proc = 0; proc < num_proc(); ++proc)
+    if (not send_plan()[proc].empty()) targets.push_back(proc);
+
+  // the buffers have to stay alive until the sends are completed
+  std::vector<Core::Communication::PackBuffer> sendblocks(targets.size());
+  std::vector<std::vector<int>> sendgids(targets.size());
+  std::vector<std::array<int, 2>> snmessages(targets.size());
+  std::vector<MPI_Request> sendrequests(3 * targets.size());
+
+  for (std::size_t t = 0; t < targets.size(); ++t)
   {
-    int tproc = my_pid() + 1 + i;
-    int sproc = my_pid() - 1 - i;
-    if (tproc < 0) tproc += num_proc();
-    if (sproc < 0) sproc += num_proc();
-    if (tproc > num_proc() - 1) tproc -= num_proc();
-    if (sproc > num_proc() - 1) sproc -= num_proc();
-    // cout << "Proc " << MyPID() << " tproc " << tproc << " sproc " << sproc << endl;
-    // fflush(stdout);
-
-    //------------------------------------------------ do sending to tproc
-    // gather all objects to be send
-    Core::Communication::PackBuffer sendblock;
-    std::vector<int> sendgid;
-    sendgid.reserve(send_plan()[tproc].size());
+    const int tproc = targets[t];
 
+    // gather all objects to be send
+    sendgids[t].reserve(send_plan()[tproc].size());
     for (int lid : send_plan()[tproc])
     {
       const int gid = source_map().GID(lid);
-      if (helper.pack_object(gid, sendblock)) sendgid.push_back(gid);
+      if (helper.pack_object(gid, sendblocks[t])) sendgids[t].push_back(gid);
     }
 
-    // send tproc no. of chars tproc must receive
-    std::vector<int> snmessages(2);
-    snmessages[0] = sendblock().size();
-    snmessages[1] = sendgid.size();
-
-    MPI_Request sizerequest;
-    i_send(my_pid(), tproc, snmessages.data(), 2, 1, sizerequest);
-
-    // do the sending of the objects
-    MPI_Request sendrequest;
-    i_send(my_pid(), tproc, sendblock().data(), sendblock().size(), 2, sendrequest);
-
-    MPI_Request sendgidrequest;
-    i_send(my_pid(), tproc, sendgid.data(), sendgid.size(), 3, sendgidrequest);
+    // send tproc no. of chars tproc must receive, the objects and their gids
+    snmessages[t] = {
+        static_cast<int>(sendblocks[t]().size()), static_cast<int>(sendgids[t].size())};
+    i_send(my_pid(), tproc, snmessages[t].data(), 2, 1, sendrequests[3 * t]);
+    i_send(my_pid(), tproc, sendblocks[t]().data(), sendblocks[t]().size(), 2,
+        sendrequests[3 * t + 1]);
+    i_send(my_pid(), tproc, sendgids[t].data(), sendgids[t].size(), 3, sendrequests[3 * t + 2]);
+  }
 
-    //---------------------------------------- do the receiving from sproc
+  //---------------------------------------- do the receiving from all sources
+  // the receive buffers are reused for all sources
+  std::vector<int> rnmessages(2);
+  std::vector<char> recvblock;
+  std::vector<int> recvgid;
+  for (const int sproc : recv_plan())
+  {
     // receive how many messages I will receive from sproc
-    std::vector<int> rnmessages(2);
-    int source = sproc;
     int length = 0;
-    int tag = 1;
-    // do a blocking specific receive
-    receive(source, tag, rnmessages, length);
-    if (length != 2 or tag != 1) FOUR_C_THROW("Messages got mixed up");
+    receive(sproc, 1, rnmessages, length);
+    if (length != 2) FOUR_C_THROW("Messages got mixed up");
 
     // receive the objects
-    std::vector<char> recvblock(rnmessages[0]);
-    tag = 2;
-    receive_any(source, tag, recvblock, length);
-    if (tag != 2) FOUR_C_THROW("Messages got mixed up");
+    recvblock.resize(rnmessages[0]);
+    receive(sproc, 2, recvblock, length);
 
     // receive the gids
-    std::vector<int> recvgid(rnmessages[1]);
-    tag = 3;
-    receive_any(source, tag, recvgid, length);
-    if (tag != 3) FOUR_C_THROW("Messages got mixed up");
+    recvgid.resize(rnmessages[1]);
+    receive(sproc, 3, recvgid, length);
 
     int j = 0;
 
@@ -291,15 +387,13 @@ void Core::Communication::Exporter::generic_export(ExporterHelper& helper)
       helper.unpack_object(gid, buffer);
       j += 1;
     }
+  }
 
-    //----------------------------------- do waiting for messages to tproc to leave
-    wait(sizerequest);
-    wait(sendrequest);
-    wait(sendgidrequest);
+  //----------------------------------- do waiting for messages to targets to leave
+  MPI_Waitall(static_cast<int>(sendrequests.size()), sendrequests.data(), MPI_STATUSES_IGNORE);
 
-    // make sure we do not get mixed up messages as we use wild card receives here
-    Core::Communication::barrier(get_comm());
-  }
+  // make sure we do not get mixed up messages with subsequent wild card receives
+  Core::Communication::barrier(get_comm());
 
   helper.post_export_cleanup(this);
 }
@@ -438,6 +438,22 @@ namespace Core::Communication
     */
     void construct_exporter();
 
+    /*!
+    \brief Build the send and receive plans for a source map with unique gids
+
+    The owners of the wanted gids are looked up in the directory of the source map. Each proc
+    only sends its requests to these owners and serves the requests it receives, i.e., there is
+    no communication between procs that do not exchange data.
+    */
+    void construct_plans_by_sparse_data_exchange();
+
+    /*!
+    \brief Build the send and receive plans for a source map with non-unique gids
+
+    Every proc broadcasts the gids it has and wants to all other procs.
+    */
+    void construct_plans_by_broadcast();
+
     /*!
     \brief Get PID
     */
@@ -452,6 +468,11 @@ namespace Core::Communication
     */
     inline std::vector<std::set<int>>& send_plan() { return sendplan_; }
 
+    /*!
+    \brief Get recvplan_
+    */
+    inline std::vector<int>& recv_plan() { return recvplan_; }
+
     /*!
     \brief generic export algorithm that delegates the specific pack/unpack to a helper
      */
@@ -472,6 +493,10 @@ namespace Core::Communication
     int numproc_;
     //! sending information
     std::vector<std::set<int>> sendplan_;
+    //! procs that send data to me in an export
+    std::vector<int> recvplan_;
+    //! mpi tag of the requests while building the plans
+    static constexpr int plan_tag_ = 4;
 
     /// Internal helper class for Exporter that encapsulates packing and unpacking
     /*!
@@ -41,6 +41,18 @@ namespace Core::Communication
 
     const std::vector<char>& operator()() const { return buf_; }
 
+    /**
+     * Reserve memory for at least @p size bytes of packed data. Use this if the size of the
+     * data to be packed is known or can be estimated to avoid repeated reallocations.
+     */
+    void reserve(std::size_t size) { buf_.reserve(size); }
+
+    /**
+     * Remove all packed data but keep the allocated memory, such that the buffer can be reused,
+     * e.g., in several rounds of communication.
+     */
+    void clear() { buf_.clear(); }
+
     /// Add a trivially copyable object, i.e., an object of a type that can be copied with memcpy.
     template <typename T>
       requires std::is_trivially_copyable_v<T>
@@ -49,12 +61,10 @@ namespace Core::Communication
 #ifdef FOUR_C_ENABLE_ASSERTIONS
       // Write the type into the buffer
       const std::size_t hash = typeid(T).hash_code();
-      buf_.resize(buf_.size() + sizeof(hash));
-      std::memcpy(buf_.data() + buf_.size() - sizeof(hash), &hash, sizeof(hash));
+      append(&hash, sizeof(hash));
 #endif
 
-      buf_.resize(buf_.size() + sizeof(T));
-      std::memcpy(buf_.data() + buf_.size() - sizeof(T), &stuff, sizeof(T));
+      append(&stuff, sizeof(T));
     }
 
     /// Add an array of trivially copyable objects, i.e., objects of a type that can be copied with
@@ -68,15 +78,21 @@ namespace Core::Communication
 #ifdef FOUR_C_ENABLE_ASSERTIONS
       // Write the type into the buffer
       const std::size_t hash = typeid(T).hash_code();
-      buf_.resize(buf_.size() + sizeof(hash));
-      std::memcpy(buf_.data() + buf_.size() - sizeof(hash), &hash, sizeof(hash));
+      append(&hash, sizeof(hash));
 #endif
 
-      buf_.resize(buf_.size() + stuff_size);
-      std::memcpy(buf_.data() + buf_.size() - stuff_size, stuff, stuff_size);
+      append(stuff, stuff_size);
     }
 
    private:
+    /// Append the raw bytes of @p data to the buffer. In contrast to resize() and memcpy(), the
+    /// new bytes are written only once and not zero-initialized before.
+    void append(const void* data, std::size_t size)
+    {
+      const char* bytes = static_cast<const char*>(data);
+      buf_.insert(buf_.end(), bytes, bytes + size);
+    }
+
     //! The actual buffer containing the packed data.
     std::vector<char> buf_;
 
@@ -0,0 +1,194 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_comm_exporter.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Epetra_Map.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  //! global ids owned or needed by a proc
+  using Distribution = std::function<std::vector<int>(int rank, int num_ranks)>;
+
+  constexpr int num_gids = 40;
+
+  std::vector<int> block(const int rank, const int num_ranks)
+  {
+    std::vector<int> gids;
+    for (int gid = rank * num_gids / num_ranks; gid < (rank + 1) * num_gids / num_ranks; ++gid)
+      gids.push_back(gid);
+    return gids;
+  }
+
+  std::vector<int> reversed_block(const int rank, const int num_ranks)
+  {
+    return block(num_ranks - 1 - rank, num_ranks);
+  }
+
+  std::vector<int> cyclic(const int rank, const int num_ranks)
+  {
+    std::vector<int> gids;
+    for (int gid = rank; gid < num_gids; gid += num_ranks) gids.push_back(gid);
+    return gids;
+  }
+
+  std::vector<int> shifted_block(const int rank, const int num_ranks)
+  {
+    return block((rank + 1) % num_ranks, num_ranks);
+  }
+
+  //! block with two additional gids on each side (overlapping)
+  std::vector<int> ghosted_block(const int rank, const int num_ranks)
+  {
+    std::vector<int> gids;
+    for (int gid = rank * num_gids / num_ranks - 2; gid < (rank + 1) * num_gids / num_ranks + 2;
+        ++gid)
+      if (gid >= 0 and gid < num_gids) gids.push_back(gid);
+    return gids;
+  }
+
+  //! all gids on the first proc, none on the others
+  std::vector<int> gathered(const int rank, int)
+  {
+    return rank == 0 ? cyclic(0, 1) : std::vector<int>{};
+  }
+
+  //! all gids on all procs (overlapping)
+  std::vector<int> everywhere(int, int) { return cyclic(0, 1); }
+
+  //! the first proc needs everything, the others only what they own
+  std::vector<int> gathered_and_block(const int rank, const int num_ranks)
+  {
+    return rank == 0 ? cyclic(0, 1) : block(rank, num_ranks);
+  }
+
+  class ExporterTest : public ::testing::Test
+  {
+   protected:
+    ExporterTest()
+        : comm_(MPI_COMM_WORLD),
+          rank_(Core::Communication::my_mpi_rank(comm_)),
+          num_ranks_(Core::Communication::num_mpi_ranks(comm_))
+    {
+    }
+
+    //! Create an exporter, the maps are kept alive by the test.
+    Core::Communication::Exporter& create_exporter(
+        const Distribution& source, const Distribution& target)
+    {
+      sources_.emplace_back(create_map(source));
+      targets_.emplace_back(create_map(target));
+      exporters_.emplace_back(std::make_unique<Core::Communication::Exporter>(
+          *sources_.back(), *targets_.back(), comm_));
+      return *exporters_.back();
+    }
+
+    //! Export data that identifies the gid and the exporter and check the result.
+    void export_and_check(const int exporter_id)
+    {
+      const Core::Communication::Exporter& exporter = *exporters_[exporter_id];
+
+      std::map<int, std::vector<int>> data;
+      for (int lid = 0; lid < exporter.source_map().NumMyElements(); ++lid)
+      {
+        const int gid = exporter.source_map().GID(lid);
+        data[gid] = expected_data(gid, exporter_id);
+      }
+
+      exporters_[exporter_id]->do_export(data);
+
+      EXPECT_EQ(static_cast<int>(data.size()), exporter.target_map().NumMyElements());
+      for (int lid = 0; lid < exporter.target_map().NumMyElements(); ++lid)
+      {
+        const int gid = exporter.target_map().GID(lid);
+        ASSERT_EQ(data.count(gid), 1) << "gid " << gid << " of exporter " << exporter_id;
+        EXPECT_EQ(data[gid], expected_data(gid, exporter_id));
+      }
+    }
+
+    static std::vector<int> expected_data(const int gid, const int exporter_id)
+    {
+      return std::vector<int>(1 + (gid + exporter_id) % 4, 1000 * exporter_id + gid);
+    }
+
+    std::shared_ptr<Epetra_Map> create_map(const Distribution& distribution) const
+    {
+      const std::vector<int> gids = distribution(rank_, num_ranks_);
+      return std::make_shared<Epetra_Map>(-1, static_cast<int>(gids.size()), gids.data(), 0,
+          Core::Communication::as_epetra_comm(comm_));
+    }
+
+    MPI_Comm comm_;
+    int rank_;
+    int num_ranks_;
+
+    std::vector<std::shared_ptr<Epetra_Map>> sources_;
+    std::vector<std::shared_ptr<Epetra_Map>> targets_;
+    std::vector<std::unique_ptr<Core::Communication::Exporter>> exporters_;
+  };
+
+  TEST_F(ExporterTest, BackToBackExportersWithUniqueSourceMaps)
+  {
+    ASSERT_GT(num_ranks_, 1);
+
+    // all exporters are constructed before the first export, such that the construction of one
+    // exporter directly follows the one of another
+    const std::vector<std::pair<Distribution, Distribution>> maps = {{block, cyclic},
+        {cyclic, ghosted_block}, {block, gathered}, {gathered, block}, {reversed_block, everywhere},
+        {block, block}, {cyclic, shifted_block}, {block, gathered_and_block},
+        {shifted_block, gathered}, {cyclic, gathered_and_block}};
+    for (const auto& [source, target] : maps) create_exporter(source, target);
+
+    for (int i = 0; i < static_cast<int>(exporters_.size()); ++i) export_and_check(i);
+
+    // the plans do not change with repeated exports
+    for (int i = static_cast<int>(exporters_.size()) - 1; i >= 0; --i) export_and_check(i);
+  }
+
+  TEST_F(ExporterTest, BackToBackExportersWithOverlappingSourceMaps)
+  {
+    ASSERT_GT(num_ranks_, 1);
+
+    const std::vector<std::pair<Distribution, Distribution>> maps = {{ghosted_block, cyclic},
+        {everywhere, gathered}, {ghosted_block, shifted_block}, {everywhere, ghosted_block},
+        {ghosted_block, gathered_and_block}};
+    for (const auto& [source, target] : maps) create_exporter(source, target);
+
+    for (int i = 0; i < static_cast<int>(exporters_.size()); ++i) export_and_check(i);
+  }
+
+  TEST_F(ExporterTest, AlternatingConstructionAndExport)
+  {
+    ASSERT_GT(num_ranks_, 1);
+
+    // unique and overlapping source maps alternate, each exporter is used right after its
+    // construction and the next one is constructed right after the export
+    const std::vector<std::pair<Distribution, Distribution>> maps = {{gathered, cyclic},
+        {ghosted_block, gathered}, {cyclic, gathered_and_block}, {everywhere, shifted_block},
+        {block, gathered}, {gathered, reversed_block}, {ghosted_block, cyclic},
+        {reversed_block, gathered_and_block}};
+    for (int repetition = 0; repetition < 5; ++repetition)
+    {
+      for (const auto& [source, target] : maps)
+      {
+        create_exporter(source, target);
+        export_and_check(static_cast<int>(exporters_.size()) - 1);
+      }
+    }
+  }
+}  // namespace
@@ -98,4 +98,28 @@ namespace
     EXPECT_EQ(data, unpacked_data);
   }
 
+  TYPED_TEST(PackUnpackStandardTypes, ReusedBuffer)
+  {
+    TypeParam data;
+    fill_data(data);
+    Core::Communication::PackBuffer pack_buffer;
+    pack_buffer.reserve(1024);
+    Core::Communication::add_to_pack(pack_buffer, std::vector<double>(100, 1.0));
+
+    // the buffer keeps its memory but not its data
+    const auto capacity = pack_buffer().capacity();
+    pack_buffer.clear();
+    EXPECT_TRUE(pack_buffer().empty());
+    EXPECT_EQ(pack_buffer().capacity(), capacity);
+
+    Core::Communication::add_to_pack(pack_buffer, data);
+
+    TypeParam unpacked_data;
+    Core::Communication::UnpackBuffer unpack_buffer(pack_buffer());
+    Core::Communication::extract_from_pack(unpack_buffer, unpacked_data);
+
+    EXPECT_EQ(data, unpacked_data);
+    EXPECT_TRUE(unpack_buffer.at_end());
+  }
+
 }  // namespace
\ No newline at end of file
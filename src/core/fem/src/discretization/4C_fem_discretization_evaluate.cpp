@@ -13,6 +13,7 @@
 #include "4C_fem_general_elements_paramsinterface.hpp"
 #include "4C_fem_general_node.hpp"
 #include "4C_io_input_parameter_container.hpp"
+#include "4C_io_performance_telemetry.hpp"
 #include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_serialdensevector.hpp"
 #include "4C_linalg_sparsematrix.hpp"
@@ -23,6 +24,8 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <chrono>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*
@@ -87,6 +90,15 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
 
   Core::Elements::LocationArray la(dofsets_.size());
 
+  // time spent in the element routines and in the assembly (recorded once after the loop), the
+  // clock is only read if performance telemetry is written
+  const bool measure_time = Core::IO::PerformanceTelemetry::enabled();
+  std::chrono::duration<double> evaluation_time{0.0};
+  std::chrono::duration<double> assembly_time{0.0};
+  std::chrono::steady_clock::time_point last_time;
+  std::chrono::steady_clock::time_point evaluated_time;
+  if (measure_time) last_time = std::chrono::steady_clock::now();
+
   // loop over column elements
   for (auto* actele : my_col_element_range())
   {
@@ -101,12 +113,32 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
     element_action(*actele, la, strategy.elematrix1(), strategy.elematrix2(), strategy.elevector1(),
         strategy.elevector2(), strategy.elevector3());
 
+    if (measure_time)
+    {
+      evaluated_time = std::chrono::steady_clock::now();
+      evaluation_time += evaluated_time - last_time;
+    }
+
     int eid = actele->id();
     strategy.assemble_matrix1(eid, la[row].lm_, la[col].lm_, la[row].lmowner_, la[col].stride_);
     strategy.assemble_matrix2(eid, la[row].lm_, la[col].lm_, la[row].lmowner_, la[col].stride_);
     strategy.assemble_vector1(la[row].lm_, la[row].lmowner_);
     strategy.assemble_vector2(la[row].lm_, la[row].lmowner_);
     strategy.assemble_vector3(la[row].lm_, la[row].lmowner_);
+
+    if (measure_time)
+    {
+      last_time = std::chrono::steady_clock::now();
+      assembly_time += last_time - evaluated_time;
+    }
+  }
+
+  if (measure_time)
+  {
+    Core::IO::PerformanceTelemetry::record(
+        Core::IO::PerformanceTelemetry::element_evaluation_time, evaluation_time.count());
+    Core::IO::PerformanceTelemetry::record(
+        Core::IO::PerformanceTelemetry::assembly_time, assembly_time.count());
   }
 }
 
@@ -11,9 +11,12 @@
 #include "4C_fem_discretization_utils.hpp"
 #include "4C_fem_general_assemblestrategy.hpp"
 #include "4C_fem_general_element.hpp"
+#include "4C_io_performance_telemetry.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <chrono>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------------*
@@ -90,6 +93,12 @@ void Core::FE::Utils::evaluate(Core::FE::Discretization& discret, Teuchos::Param
   const int numcolele = col_ele_map->NumMyElements();
   const int* ele_gids = col_ele_map->MyGlobalElements();
 
+  // time spent in the element routines and in the assembly (recorded once after the loop), the
+  // clock is only read if performance telemetry is written
+  const bool measure_time = Core::IO::PerformanceTelemetry::enabled();
+  std::chrono::duration<double> evaluation_time{0.0};
+  std::chrono::duration<double> assembly_time{0.0};
+
   for (int i = 0; i < numcolele; ++i)
   {
     Core::Elements::Element* actele = nullptr;
@@ -115,6 +124,8 @@ void Core::FE::Utils::evaluate(Core::FE::Discretization& discret, Teuchos::Param
       strategy.clear_element_storage(la[row].size(), la[col].size());
     }
 
+    std::chrono::steady_clock::time_point start_time;
+    if (measure_time) start_time = std::chrono::steady_clock::now();
     {
       TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Utils::Evaluate elements");
       // call the element evaluate method
@@ -125,6 +136,13 @@ void Core::FE::Utils::evaluate(Core::FE::Discretization& discret, Teuchos::Param
             Core::Communication::my_mpi_rank(discret.get_comm()), actele->id(), err);
     }
 
+    std::chrono::steady_clock::time_point evaluated_time;
+    if (measure_time)
+    {
+      evaluated_time = std::chrono::steady_clock::now();
+      evaluation_time += evaluated_time - start_time;
+    }
+
     {
       TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Utils::Evaluate assemble");
       int eid = actele->id();
@@ -134,9 +152,18 @@ void Core::FE::Utils::evaluate(Core::FE::Discretization& discret, Teuchos::Param
       strategy.assemble_vector2(la[row].lm_, la[row].lmowner_);
       strategy.assemble_vector3(la[row].lm_, la[row].lmowner_);
     }
+    if (measure_time) assembly_time += std::chrono::steady_clock::now() - evaluated_time;
 
   }  // loop over all considered elements
 
+  if (measure_time)
+  {
+    Core::IO::PerformanceTelemetry::record(
+        Core::IO::PerformanceTelemetry::element_evaluation_time, evaluation_time.count());
+    Core::IO::PerformanceTelemetry::record(
+        Core::IO::PerformanceTelemetry::assembly_time, assembly_time.count());
+  }
+
   return;
 }
 
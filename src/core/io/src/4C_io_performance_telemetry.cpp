@@ -0,0 +1,116 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_io_performance_telemetry.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  constexpr std::array<const char*, 3> statistics{"min", "mean", "max"};
+}  // namespace
+
+namespace Core::IO
+{
+  PerformanceTelemetry::PerformanceTelemetry(
+      MPI_Comm comm, const Core::IO::OutputControl& output_control, std::string outputname)
+      : comm_(comm),
+        csv_writer_(Core::Communication::my_mpi_rank(comm), output_control, std::move(outputname))
+  {
+    const int precision = 6;
+    for (int metric = 0; metric < num_metrics; ++metric)
+    {
+      for (const char* statistic : statistics)
+      {
+        csv_writer_.register_data_vector(
+            metric_name(static_cast<Metric>(metric)) + "_" + statistic, 1, precision);
+      }
+    }
+
+    // everything before the first time step (e.g. setup) is not attributed to it
+    current_step_.fill(0.0);
+    enabled_ = true;
+  }
+
+  PerformanceTelemetry::~PerformanceTelemetry()
+  {
+    enabled_ = false;
+    if (pending_write_.valid()) pending_write_.wait();
+  }
+
+  void PerformanceTelemetry::write_step(const double time, const unsigned int timestep)
+  {
+    // minimum and maximum in one reduction, since the minimum is the negative maximum of the
+    // negated values
+    std::array<double, 2 * num_metrics> local_extrema;
+    for (int metric = 0; metric < num_metrics; ++metric)
+    {
+      local_extrema[metric] = current_step_[metric];
+      local_extrema[num_metrics + metric] = -current_step_[metric];
+    }
+    std::array<double, 2 * num_metrics> global_extrema;
+    Core::Communication::max_all(
+        local_extrema.data(), global_extrema.data(), 2 * num_metrics, comm_);
+
+    std::array<double, num_metrics> global_sum;
+    Core::Communication::sum_all(current_step_.data(), global_sum.data(), num_metrics, comm_);
+
+    current_step_.fill(0.0);
+
+    if (Core::Communication::my_mpi_rank(comm_) != 0) return;
+
+    const int num_ranks = Core::Communication::num_mpi_ranks(comm_);
+    std::map<std::string, std::vector<double>> data;
+    for (int metric = 0; metric < num_metrics; ++metric)
+    {
+      const std::string name = metric_name(static_cast<Metric>(metric));
+      data[name + "_" + statistics[0]] = {-global_extrema[num_metrics + metric]};
+      data[name + "_" + statistics[1]] = {global_sum[metric] / num_ranks};
+      data[name + "_" + statistics[2]] = {global_extrema[metric]};
+    }
+
+    // only one line is written at a time to keep the order of the time steps
+    if (pending_write_.valid()) pending_write_.get();
+    pending_write_ = std::async(std::launch::async,
+        [this, time, timestep, data = std::move(data)]()
+        { csv_writer_.write_data_to_file(time, timestep, data); });
+  }
+
+  std::string PerformanceTelemetry::metric_name(const Metric metric)
+  {
+    switch (metric)
+    {
+      case element_evaluation_time:
+        return "element_evaluation_time";
+      case assembly_time:
+        return "assembly_time";
+      case linear_solver_setup_time:
+        return "linear_solver_setup_time";
+      case linear_solve_time:
+        return "linear_solve_time";
+      case output_time:
+        return "output_time";
+      case nonlinear_iterations:
+        return "nonlinear_iterations";
+      case linear_iterations:
+        return "linear_iterations";
+      case communicated_bytes:
+        return "communicated_bytes";
+      default:
+        FOUR_C_THROW("Unknown metric %d", metric);
+    }
+  }
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
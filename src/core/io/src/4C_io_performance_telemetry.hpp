@@ -0,0 +1,128 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_IO_PERFORMANCE_TELEMETRY_HPP
+#define FOUR_C_IO_PERFORMANCE_TELEMETRY_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_io_runtime_csv_writer.hpp"
+
+#include <mpi.h>
+
+#include <array>
+#include <chrono>
+#include <future>
+#include <string>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::IO
+{
+  class OutputControl;
+
+  /*!
+   * \brief Write performance metrics of every time step in csv format at runtime
+   *
+   * The metrics (wall time of the main phases, iteration counts and communication volume) are
+   * accumulated on every rank via record() or ScopedTimer. Recording only adds to a process-wide
+   * array, hence the instrumentation stays in place even if no telemetry is written. Wall times are
+   * only measured while a PerformanceTelemetry object exists, see enabled(), such that the clock is
+   * not read in hot loops otherwise.
+   *
+   * At the end of every time step, write_step() reduces the metrics over all ranks and starts a
+   * new step. Rank 0 writes the minimum, mean and maximum of every metric to
+   * <output>-<outputname>.csv, the ratio of maximum and mean indicates the load imbalance. The file
+   * is written asynchronously, such that the time loop does not wait for the file system.
+   */
+  class PerformanceTelemetry
+  {
+   public:
+    //! metrics recorded per time step
+    enum Metric
+    {
+      element_evaluation_time,
+      assembly_time,
+      linear_solver_setup_time,
+      linear_solve_time,
+      output_time,
+      nonlinear_iterations,
+      linear_iterations,
+      communicated_bytes,
+      num_metrics
+    };
+
+    //! Measure the wall time of a scope and record it for @p metric.
+    class ScopedTimer
+    {
+     public:
+      explicit ScopedTimer(const Metric metric)
+          : metric_(metric),
+            active_(enabled()),
+            start_(active_ ? std::chrono::steady_clock::now()
+                           : std::chrono::steady_clock::time_point{})
+      {
+      }
+
+      ~ScopedTimer()
+      {
+        if (!active_) return;
+        record(metric_,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+      }
+
+      ScopedTimer(const ScopedTimer&) = delete;
+      ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+     private:
+      const Metric metric_;
+      const bool active_;
+      const std::chrono::steady_clock::time_point start_;
+    };
+
+    PerformanceTelemetry(
+        MPI_Comm comm, const Core::IO::OutputControl& output_control, std::string outputname);
+
+    //! Wait for the last line to be written.
+    ~PerformanceTelemetry();
+
+    PerformanceTelemetry(const PerformanceTelemetry&) = delete;
+    PerformanceTelemetry& operator=(const PerformanceTelemetry&) = delete;
+
+    //! Return whether a telemetry stream is written, i.e., whether wall times should be measured.
+    static bool enabled() { return enabled_; }
+
+    //! Add @p value to @p metric of the current time step on this rank.
+    static void record(const Metric metric, const double value) { current_step_[metric] += value; }
+
+    //! Reduce the metrics of the current time step over all ranks, write them at @p time and
+    //! @p timestep and start a new time step. This is a collective call.
+    void write_step(double time, unsigned int timestep);
+
+    //! name of @p metric in the csv file
+    static std::string metric_name(Metric metric);
+
+   private:
+    //! whether a telemetry object exists on this rank
+    static inline bool enabled_ = false;
+
+    //! metrics of the current time step on this rank
+    static inline std::array<double, num_metrics> current_step_{};
+
+    MPI_Comm comm_;
+
+    //! writer of the csv file (only writes on rank 0)
+    Core::IO::RuntimeCsvWriter csv_writer_;
+
+    //! line that is currently written
+    std::future<void> pending_write_;
+  };
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,172 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_performance_telemetry.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_io_control.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  std::vector<std::string> split_csv_line(const std::string& line)
+  {
+    std::vector<std::string> entries;
+    std::stringstream stream(line);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) entries.push_back(entry);
+    return entries;
+  }
+
+  //! read all lines of a csv file into maps from column name to value
+  std::vector<std::map<std::string, double>> read_csv_file(const std::string& file_name)
+  {
+    std::ifstream file(file_name);
+    EXPECT_TRUE(file.is_open()) << "Could not open " << file_name;
+
+    std::string line;
+    std::getline(file, line);
+    const std::vector<std::string> header = split_csv_line(line);
+
+    std::vector<std::map<std::string, double>> rows;
+    while (std::getline(file, line))
+    {
+      const std::vector<std::string> entries = split_csv_line(line);
+      EXPECT_EQ(entries.size(), header.size());
+
+      std::map<std::string, double> row;
+      for (std::size_t i = 0; i < header.size() and i < entries.size(); ++i)
+        row[header[i]] = std::stod(entries[i]);
+      rows.push_back(row);
+    }
+    return rows;
+  }
+
+  class PerformanceTelemetryTest : public ::testing::Test
+  {
+   protected:
+    PerformanceTelemetryTest()
+        : comm_(MPI_COMM_WORLD),
+          output_prefix_(
+              (std::filesystem::temp_directory_path() / "performance_telemetry_test").string()),
+          output_control_(comm_, "none", Core::FE::ShapeFunctionType::polynomial, "none.dat",
+              output_prefix_, 3, 0, 1000, false)
+    {
+    }
+
+    MPI_Comm comm_;
+    const std::string output_prefix_;
+    Core::IO::OutputControl output_control_;
+  };
+
+  TEST_F(PerformanceTelemetryTest, WritesMinMeanMaxOverRanks)
+  {
+    using Telemetry = Core::IO::PerformanceTelemetry;
+
+    const int num_ranks = Core::Communication::num_mpi_ranks(comm_);
+    const int rank = Core::Communication::my_mpi_rank(comm_);
+    ASSERT_EQ(num_ranks, 3);
+
+    {
+      Telemetry telemetry(comm_, output_control_, "telemetry");
+
+      // imbalanced first step: rank i spends i+1 seconds in the element evaluation
+      Telemetry::record(Telemetry::element_evaluation_time, rank + 1.0);
+      Telemetry::record(Telemetry::communicated_bytes, 100.0 * (rank + 1));
+      Telemetry::record(Telemetry::communicated_bytes, 100.0 * (rank + 1));
+      telemetry.write_step(0.5, 1);
+
+      // second step: only rank 0 solves
+      if (rank == 0) Telemetry::record(Telemetry::linear_iterations, 3.0);
+      telemetry.write_step(1.0, 2);
+    }
+
+    if (rank != 0) return;
+
+    const auto rows = read_csv_file(output_prefix_ + "-telemetry.csv");
+    ASSERT_EQ(rows.size(), 2);
+
+    EXPECT_EQ(rows[0].at("step"), 1);
+    EXPECT_DOUBLE_EQ(rows[0].at("time"), 0.5);
+    EXPECT_DOUBLE_EQ(rows[0].at("element_evaluation_time_min"), 1.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("element_evaluation_time_mean"), 2.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("element_evaluation_time_max"), 3.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("communicated_bytes_min"), 200.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("communicated_bytes_mean"), 400.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("communicated_bytes_max"), 600.0);
+    EXPECT_DOUBLE_EQ(rows[0].at("linear_iterations_max"), 0.0);
+
+    // the metrics are reset after every step
+    EXPECT_EQ(rows[1].at("step"), 2);
+    EXPECT_DOUBLE_EQ(rows[1].at("time"), 1.0);
+    EXPECT_DOUBLE_EQ(rows[1].at("element_evaluation_time_max"), 0.0);
+    EXPECT_DOUBLE_EQ(rows[1].at("communicated_bytes_max"), 0.0);
+    EXPECT_DOUBLE_EQ(rows[1].at("linear_iterations_min"), 0.0);
+    EXPECT_DOUBLE_EQ(rows[1].at("linear_iterations_mean"), 1.0);
+    EXPECT_DOUBLE_EQ(rows[1].at("linear_iterations_max"), 3.0);
+  }
+
+  TEST_F(PerformanceTelemetryTest, WritesAllMetrics)
+  {
+    using Telemetry = Core::IO::PerformanceTelemetry;
+
+    {
+      Telemetry telemetry(comm_, output_control_, "telemetry");
+      telemetry.write_step(0.0, 0);
+    }
+
+    if (Core::Communication::my_mpi_rank(comm_) != 0) return;
+
+    const auto rows = read_csv_file(output_prefix_ + "-telemetry.csv");
+    ASSERT_EQ(rows.size(), 1);
+
+    // step, time and three statistics per metric
+    EXPECT_EQ(rows[0].size(), 2 + 3 * Telemetry::num_metrics);
+    for (int metric = 0; metric < Telemetry::num_metrics; ++metric)
+    {
+      const std::string name = Telemetry::metric_name(static_cast<Telemetry::Metric>(metric));
+      for (const std::string statistic : {"_min", "_mean", "_max"})
+        EXPECT_EQ(rows[0].count(name + statistic), 1) << name + statistic;
+    }
+  }
+
+  TEST_F(PerformanceTelemetryTest, MeasuresTimeOnlyWhileEnabled)
+  {
+    using Telemetry = Core::IO::PerformanceTelemetry;
+
+    EXPECT_FALSE(Telemetry::enabled());
+    {
+      Telemetry telemetry(comm_, output_control_, "telemetry");
+      EXPECT_TRUE(Telemetry::enabled());
+
+      {
+        Telemetry::ScopedTimer timer(Telemetry::output_time);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      telemetry.write_step(0.0, 0);
+    }
+    EXPECT_FALSE(Telemetry::enabled());
+
+    if (Core::Communication::my_mpi_rank(comm_) != 0) return;
+
+    const auto rows = read_csv_file(output_prefix_ + "-telemetry.csv");
+    ASSERT_EQ(rows.size(), 1);
+    EXPECT_GE(rows[0].at("output_time_min"), 1.0e-3);
+  }
+}  // namespace
@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_linalg_fixedsizematrix_simd_kernels.hpp"
 #include "4C_utils_exceptions.hpp"
 #include "4C_utils_mathoperations.hpp"
 
@@ -866,6 +867,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::set, false, false, i, j, k>(
+            out, 1.0, 1.0, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -892,6 +901,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::set, false, false, i, j, k>(
+            out, 1.0, 1.0, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -918,6 +935,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::set, false, true, i, j, k>(
+            out, 1.0, 1.0, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -944,6 +969,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::set, true, false, i, j, k>(
+            out, 1.0, 1.0, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
@@ -970,6 +1003,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::set, true, true, i, j, k>(
+            out, 1.0, 1.0, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
@@ -996,6 +1037,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::scale, false, false, i, j, k>(
+            out, 1.0, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1022,6 +1071,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::scale, false, false, i, j, k>(
+            out, 1.0, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1048,6 +1105,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::scale, false, true, i, j, k>(
+            out, 1.0, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1074,6 +1139,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::scale, true, false, i, j, k>(
+            out, 1.0, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
@@ -1100,6 +1173,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::scale, true, true, i, j, k>(
+            out, 1.0, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
@@ -1127,6 +1208,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeOutfac, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::update, false, false, i, j, k>(
+            out, outfac, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1154,6 +1243,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeOutfac, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::update, false, false, i, j, k>(
+            out, outfac, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1181,6 +1278,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeOutfac, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::update, false, true, i, j, k>(
+            out, outfac, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i; ++c2)
@@ -1208,6 +1313,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeOutfac, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::update, true, false, i, j, k>(
+            out, outfac, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < j * k; c1 += j)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
@@ -1235,6 +1348,14 @@ namespace Core::LinAlg
       if constexpr (std::is_same_v<ValueTypeOut, ValueTypeRight>)
         FOUR_C_ASSERT(out != right, "'out' and 'right' point to same memory location");
 #endif
+      if constexpr (SimdKernels::is_supported<i, j, k, ValueTypeOut, ValueTypeLeft,
+                        ValueTypeRight, ValueTypeOutfac, ValueTypeInfac>())
+      {
+        SimdKernels::multiply<SimdKernels::Assignment::update, true, true, i, j, k>(
+            out, outfac, infac, left, right);
+        return;
+      }
+
       for (unsigned int c1 = 0; c1 < k; ++c1)
       {
         for (unsigned int c2 = 0; c2 < i * j; c2 += j)
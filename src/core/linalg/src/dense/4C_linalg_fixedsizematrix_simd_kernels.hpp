@@ -0,0 +1,231 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_LINALG_FIXEDSIZEMATRIX_SIMD_KERNELS_HPP
+#define FOUR_C_LINALG_FIXEDSIZEMATRIX_SIMD_KERNELS_HPP
+
+#include "4C_config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+
+#if defined(FOUR_C_ENABLE_NATIVE_OPTIMIZATIONS) && __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define FOUR_C_LINALG_FIXEDSIZEMATRIX_SIMD_KERNELS_AVAILABLE
+#endif
+
+FOUR_C_NAMESPACE_OPEN
+
+/**
+ * Explicitly vectorized kernels for the products of fixed size matrices of doubles.
+ *
+ * The kernels compute the columns of the (column-major) result as linear combinations of the
+ * contiguous columns of the left matrix, vectorized over the rows. Each loaded column chunk of the
+ * left matrix is reused for a block of result columns. A transposed left matrix is transposed once
+ * into a temporary. The summation order per entry is the same as in the generic loops of
+ * DenseFunctions, such that the results only differ by the contraction to fused multiply-adds.
+ *
+ * The kernels are only used if 4C is configured with FOUR_C_ENABLE_NATIVE_OPTIMIZATIONS and the
+ * standard library provides std::experimental::simd. They are restricted to the sizes occurring in
+ * the element routines of 3D solids and fluids, all other sizes use the generic loops.
+ */
+namespace Core::LinAlg::DenseFunctions::SimdKernels
+{
+  //! how the product of left and right matrix is assigned to the result matrix
+  enum class Assignment
+  {
+    set,    ///< out = left * right
+    scale,  ///< out = infac * left * right
+    update  ///< out = outfac * out + infac * left * right
+  };
+
+  //! flag indicating whether the vectorized kernels are compiled
+#ifdef FOUR_C_LINALG_FIXEDSIZEMATRIX_SIMD_KERNELS_AVAILABLE
+  inline constexpr bool available = true;
+#else
+  inline constexpr bool available = false;
+#endif
+
+  //! check whether @p n is a dimension of the matrices in element routines (Voigt, hex8, hex27)
+  constexpr bool is_kernel_dimension(const unsigned int n)
+  {
+    return n == 6 or n == 24 or n == 81;
+  }
+
+  /**
+   * Check whether the product of an i x j and a j x k matrix is computed by a vectorized kernel.
+   * This holds for matrices of doubles with i being 6, 24 or 81 and j, k being at least 6, e.g.
+   * B^T C B of solid elements. Products of 3xN matrices (e.g. the Jacobian) are faster in the
+   * generic loops.
+   */
+  template <unsigned int i, unsigned int j, unsigned int k, class ValueTypeOut,
+      class ValueTypeLeft, class ValueTypeRight, class... ValueTypeFactors>
+  constexpr bool is_supported()
+  {
+    return available and std::is_same_v<ValueTypeOut, double> and
+           std::is_same_v<ValueTypeLeft, double> and std::is_same_v<ValueTypeRight, double> and
+           (std::is_arithmetic_v<ValueTypeFactors> and ...) and is_kernel_dimension(i) and
+           j >= 6 and k >= 6;
+  }
+
+  /**
+   * Compute the product of the i x j matrix @p left (or its transpose) and the j x k matrix
+   * @p right (or its transpose) and assign it to the i x k matrix @p out as defined by
+   * @p assignment. All matrices are stored column-major, @p out must not alias the operands.
+   */
+  template <Assignment assignment, bool transpose_left, bool transpose_right, unsigned int i,
+      unsigned int j, unsigned int k>
+  inline void multiply(double* out, double outfac, double infac, const double* left,
+      const double* right);
+
+#ifdef FOUR_C_LINALG_FIXEDSIZEMATRIX_SIMD_KERNELS_AVAILABLE
+  namespace Internal
+  {
+    namespace stdx = std::experimental;
+
+    //! number of result columns sharing the loaded chunks of the left matrix
+    inline constexpr unsigned int column_block_size = 4;
+
+    //! maximum number of doubles per vector register
+    inline constexpr unsigned int native_width = stdx::native_simd<double>::size();
+
+    //! vector of n doubles mapped to a native register (n being a power of two)
+    template <unsigned int n>
+    using SimdOfSize = stdx::simd<double, stdx::simd_abi::deduce_t<double, n>>;
+
+    //! entries (r,p),...,(r+Simd::size()-1,p) of the i x j left matrix
+    template <class Simd, bool transpose_left, unsigned int i, unsigned int j>
+    inline Simd left_column_chunk(const double* left, const unsigned int r, const unsigned int p)
+    {
+      if constexpr (transpose_left)
+        return Simd([&](const auto lane) { return left[p + (r + lane) * j]; });
+      else
+        return Simd(&left[r + p * i], stdx::element_aligned);
+    }
+
+    //! entry (p,c) of the j x k right matrix
+    template <bool transpose_right, unsigned int j, unsigned int k>
+    inline double right_entry(const double* right, const unsigned int p, const unsigned int c)
+    {
+      if constexpr (transpose_right)
+        return right[c + p * k];
+      else
+        return right[p + c * j];
+    }
+
+    /**
+     * Compute the chunk of rows r,...,r+Simd::size()-1 of the ncols result columns starting at
+     * column c.
+     */
+    template <class Simd, Assignment assignment, bool transpose_left, bool transpose_right,
+        unsigned int i, unsigned int j, unsigned int k, unsigned int ncols>
+    inline void multiply_chunk(const unsigned int r, const unsigned int c, double* out,
+        const double outfac, const double infac, const double* left, const double* right)
+    {
+      std::array<Simd, ncols> sum;
+      for (unsigned int m = 0; m < ncols; ++m) sum[m] = 0.0;
+
+      for (unsigned int p = 0; p < j; ++p)
+      {
+        const Simd leftcolumn = left_column_chunk<Simd, transpose_left, i, j>(left, r, p);
+        for (unsigned int m = 0; m < ncols; ++m)
+          sum[m] += leftcolumn * right_entry<transpose_right, j, k>(right, p, c + m);
+      }
+
+      for (unsigned int m = 0; m < ncols; ++m)
+      {
+        double* outcolumn = &out[r + (c + m) * i];
+        if constexpr (assignment == Assignment::set)
+        {
+          sum[m].copy_to(outcolumn, stdx::element_aligned);
+        }
+        else if constexpr (assignment == Assignment::scale)
+        {
+          const Simd result = infac * sum[m];
+          result.copy_to(outcolumn, stdx::element_aligned);
+        }
+        else
+        {
+          const Simd result = Simd(outcolumn, stdx::element_aligned) * outfac + infac * sum[m];
+          result.copy_to(outcolumn, stdx::element_aligned);
+        }
+      }
+    }
+
+    //! compute the chunk of rows r,...,r+Simd::size()-1 of all result columns
+    template <class Simd, Assignment assignment, bool transpose_left, bool transpose_right,
+        unsigned int i, unsigned int j, unsigned int k>
+    inline void multiply_rows(const unsigned int r, double* out, const double outfac,
+        const double infac, const double* left, const double* right)
+    {
+      constexpr unsigned int nfull = (k / column_block_size) * column_block_size;
+
+      for (unsigned int c = 0; c < nfull; c += column_block_size)
+      {
+        multiply_chunk<Simd, assignment, transpose_left, transpose_right, i, j, k,
+            column_block_size>(r, c, out, outfac, infac, left, right);
+      }
+
+      if constexpr (k > nfull)
+      {
+        multiply_chunk<Simd, assignment, transpose_left, transpose_right, i, j, k, k - nfull>(
+            r, nfull, out, outfac, infac, left, right);
+      }
+    }
+
+    /**
+     * Compute the rows r,...,i-1 of the result in chunks of the largest vector size fitting the
+     * remaining rows, e.g. 81 rows as 10 chunks of 8 rows and one single row for AVX-512.
+     */
+    template <unsigned int r, Assignment assignment, bool transpose_left, bool transpose_right,
+        unsigned int i, unsigned int j, unsigned int k>
+    inline void multiply_row_chunks(double* out, const double outfac, const double infac,
+        const double* left, const double* right)
+    {
+      if constexpr (r < i)
+      {
+        constexpr unsigned int chunk = std::bit_floor(std::min(i - r, native_width));
+        using Simd = SimdOfSize<chunk>;
+        multiply_rows<Simd, assignment, transpose_left, transpose_right, i, j, k>(
+            r, out, outfac, infac, left, right);
+
+        multiply_row_chunks<r + chunk, assignment, transpose_left, transpose_right, i, j, k>(
+            out, outfac, infac, left, right);
+      }
+    }
+  }  // namespace Internal
+
+  template <Assignment assignment, bool transpose_left, bool transpose_right, unsigned int i,
+      unsigned int j, unsigned int k>
+  inline void multiply(double* out, const double outfac, const double infac, const double* left,
+      const double* right)
+  {
+    if constexpr (transpose_left and k > Internal::column_block_size)
+    {
+      // transpose left matrix once such that its columns are contiguous
+      std::array<double, i * j> lefttransposed;
+      for (unsigned int r = 0; r < i; ++r)
+        for (unsigned int p = 0; p < j; ++p) lefttransposed[r + p * i] = left[p + r * j];
+
+      multiply<assignment, false, transpose_right, i, j, k>(
+          out, outfac, infac, lefttransposed.data(), right);
+    }
+    else
+    {
+      // the chunks of a transposed left matrix are only loaded once and thus gathered directly
+      Internal::multiply_row_chunks<0, assignment, transpose_left, transpose_right, i, j, k>(
+          out, outfac, infac, left, right);
+    }
+  }
+#endif
+}  // namespace Core::LinAlg::DenseFunctions::SimdKernels
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
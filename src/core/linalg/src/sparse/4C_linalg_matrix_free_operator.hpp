@@ -0,0 +1,36 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_LINALG_MATRIX_FREE_OPERATOR_HPP
+#define FOUR_C_LINALG_MATRIX_FREE_OPERATOR_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Operator.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinAlg
+{
+  /*!
+   * \brief Linear operator whose action is evaluated without assembling the full matrix
+   *
+   * Preconditioners are built from assembled matrices. Hence, a matrix-free operator provides an
+   * assembled approximation of itself, which the iterative solvers use to set up the
+   * preconditioner, while the Krylov iteration applies the operator itself.
+   */
+  class MatrixFreeOperator : public Epetra_Operator
+  {
+   public:
+    //! assembled approximation of this operator to set up the preconditioner from
+    [[nodiscard]] virtual Epetra_Operator& assembled_approximation() const = 0;
+  };
+}  // namespace Core::LinAlg
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,194 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  template <unsigned int rows, unsigned int cols>
+  Core::LinAlg::Matrix<rows, cols> make_test_matrix(const double seed)
+  {
+    Core::LinAlg::Matrix<rows, cols> mat(false);
+    for (unsigned int r = 0; r < rows; ++r)
+      for (unsigned int c = 0; c < cols; ++c) mat(r, c) = std::sin(seed + 0.7 * r + 1.3 * c);
+    return mat;
+  }
+
+  //! product (left^T or left) * (right^T or right) computed entry by entry
+  template <bool transpose_left, bool transpose_right, unsigned int rows, unsigned int cols,
+      class Left, class Right>
+  Core::LinAlg::Matrix<rows, cols> reference_product(const Left& left, const Right& right)
+  {
+    constexpr unsigned int inner = transpose_left ? Left::num_rows() : Left::num_cols();
+
+    Core::LinAlg::Matrix<rows, cols> product(true);
+    for (unsigned int r = 0; r < rows; ++r)
+      for (unsigned int c = 0; c < cols; ++c)
+        for (unsigned int p = 0; p < inner; ++p)
+          product(r, c) += (transpose_left ? left(p, r) : left(r, p)) *
+                           (transpose_right ? right(c, p) : right(p, c));
+    return product;
+  }
+
+  //! compare all products of a rows x inner and an inner x cols matrix with the reference
+  template <unsigned int rows, unsigned int inner, unsigned int cols>
+  void check_products()
+  {
+    const double tol = 1.0e-13 * inner;
+
+    const auto left = make_test_matrix<rows, inner>(0.1);
+    const auto left_t = make_test_matrix<inner, rows>(0.2);
+    const auto right = make_test_matrix<inner, cols>(0.3);
+    const auto right_t = make_test_matrix<cols, inner>(0.4);
+    const auto init = make_test_matrix<rows, cols>(0.5);
+
+    Core::LinAlg::Matrix<rows, cols> result(false);
+
+    result.multiply_nn(left, right);
+    FOUR_C_EXPECT_NEAR(result, (reference_product<false, false, rows, cols>(left, right)), tol);
+
+    result.multiply_nt(left, right_t);
+    FOUR_C_EXPECT_NEAR(result, (reference_product<false, true, rows, cols>(left, right_t)), tol);
+
+    result.multiply_tn(left_t, right);
+    FOUR_C_EXPECT_NEAR(result, (reference_product<true, false, rows, cols>(left_t, right)), tol);
+
+    result.multiply_tt(left_t, right_t);
+    FOUR_C_EXPECT_NEAR(result, (reference_product<true, true, rows, cols>(left_t, right_t)), tol);
+
+    // scaled product
+    Core::LinAlg::Matrix<rows, cols> expected(false);
+    expected.update(2.5, reference_product<true, false, rows, cols>(left_t, right));
+    result.multiply_tn(2.5, left_t, right);
+    FOUR_C_EXPECT_NEAR(result, expected, tol);
+
+    // update with product
+    expected.update(-0.5, init, 2.5, reference_product<false, false, rows, cols>(left, right));
+    result = init;
+    result.multiply_nn(2.5, left, right, -0.5);
+    FOUR_C_EXPECT_NEAR(result, expected, tol);
+  }
+
+  TEST(FixedSizeMatrixSimdKernelsTest, SolidElementSizes)
+  {
+    check_products<6, 6, 6>();
+    check_products<6, 6, 24>();
+    check_products<24, 6, 24>();
+    check_products<6, 24, 6>();
+    check_products<24, 24, 24>();
+    check_products<6, 6, 81>();
+    check_products<81, 6, 81>();
+    check_products<81, 81, 81>();
+  }
+
+  TEST(FixedSizeMatrixSimdKernelsTest, GenericSizes)
+  {
+    check_products<3, 3, 8>();
+    check_products<3, 8, 3>();
+    check_products<8, 3, 3>();
+    check_products<27, 3, 3>();
+    check_products<3, 27, 3>();
+    check_products<3, 3, 27>();
+    check_products<6, 3, 6>();
+    check_products<5, 7, 2>();
+    check_products<1, 4, 4>();
+  }
+
+  //! average time in microseconds of a product computed by the given function
+  template <class Function>
+  double time_per_product(Function&& function)
+  {
+    constexpr int num_repetitions = 20000;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < num_repetitions; ++n) function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / num_repetitions;
+  }
+
+  template <unsigned int rows, unsigned int inner, unsigned int cols>
+  void benchmark_product_tn()
+  {
+    const auto left_t = make_test_matrix<inner, rows>(0.2);
+    auto right = make_test_matrix<inner, cols>(0.3);
+    Core::LinAlg::Matrix<rows, cols> result(false);
+
+    // the input is modified and the output is used in every repetition to prevent the compiler
+    // from hoisting the product out of the loop
+    double checksum = 0.0;
+
+    const double t_matrix = time_per_product(
+        [&]()
+        {
+          result.multiply_tn(left_t, right);
+          right(0, 0) += 1.0e-12;
+          checksum += result(rows - 1, cols - 1);
+        });
+
+    // generic loop over entries as used for all sizes without vectorized kernel
+    const double t_generic = time_per_product(
+        [&]()
+        {
+          const double* left = left_t.data();
+          const double* r = right.data();
+          double* out = result.data();
+          for (unsigned int c1 = 0; c1 < inner * cols; c1 += inner)
+          {
+            for (unsigned int c2 = 0; c2 < rows * inner; c2 += inner)
+            {
+              double tmp = left[c2] * r[c1];
+              for (unsigned int c3 = 1; c3 < inner; ++c3) tmp += left[c2 + c3] * r[c1 + c3];
+              *out++ = tmp;
+            }
+          }
+          right(0, 0) += 1.0e-12;
+          checksum += result(rows - 1, cols - 1);
+        });
+
+    std::cout << "  " << std::setw(2) << inner << "x" << std::setw(2) << rows << " ^T * "
+              << std::setw(2) << inner << "x" << std::setw(2) << cols << ":  generic "
+              << std::setw(9) << std::setprecision(3) << std::fixed << t_generic << " us,  Matrix "
+              << std::setw(9) << t_matrix << " us,  speedup " << std::setw(6)
+              << t_generic / t_matrix << std::endl;
+
+    EXPECT_TRUE(std::isfinite(checksum));
+  }
+
+  /*
+   * Timings of the products occurring in the element routines. Run with
+   * --gtest_also_run_disabled_tests --gtest_filter=*Benchmark* in a build with
+   * FOUR_C_ENABLE_NATIVE_OPTIMIZATIONS to see the gain of the vectorized kernels.
+   */
+  TEST(FixedSizeMatrixSimdKernelsTest, DISABLED_BenchmarkProducts)
+  {
+    std::cout << "vectorized kernels "
+              << (Core::LinAlg::DenseFunctions::SimdKernels::available ? "enabled" : "disabled")
+              << std::endl;
+
+    benchmark_product_tn<6, 6, 6>();
+    benchmark_product_tn<6, 6, 24>();
+    benchmark_product_tn<24, 6, 6>();
+    benchmark_product_tn<24, 6, 24>();
+    benchmark_product_tn<24, 24, 24>();
+    benchmark_product_tn<6, 6, 81>();
+    benchmark_product_tn<81, 6, 81>();
+    benchmark_product_tn<81, 81, 81>();
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -36,7 +36,7 @@ template <class MatrixType, class VectorType>
 void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
     std::shared_ptr<MatrixType> matrix, std::shared_ptr<VectorType> x,
     std::shared_ptr<VectorType> b, const bool refactor, const bool reset,
-    std::shared_ptr<Core::LinAlg::KrylovProjector> projector)
+    const bool reuse_preconditioner, std::shared_ptr<Core::LinAlg::KrylovProjector> projector)
 {
   std::shared_ptr<Epetra_CrsMatrix> crsA = std::dynamic_pointer_cast<Epetra_CrsMatrix>(matrix);
 
@@ -45,6 +45,9 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
   {
     std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> Ablock =
         std::dynamic_pointer_cast<Core::LinAlg::BlockSparseMatrixBase>(matrix);
+    FOUR_C_ASSERT_ALWAYS(Ablock != nullptr,
+        "Direct solvers require an assembled matrix, use an iterative solver for matrix-free "
+        "operators.");
 
     int matrixDim = Ablock->full_range_map().NumGlobalElements();
     if (matrixDim > 50000)
@@ -34,10 +34,13 @@ namespace Core::LinearSolver
      * @param b Right-hand side vector of the linear system
      * @param refactor Boolean flag to enforce a refactorization of the matrix
      * @param reset Boolean flag to enforce a full reset of the solver object
+     * @param reuse_preconditioner Boolean flag to keep an existing preconditioner, since the
+     * matrix did not change
      * @param projector Krylov projector
      */
     void setup(std::shared_ptr<MatrixType> matrix, std::shared_ptr<VectorType> x,
         std::shared_ptr<VectorType> b, const bool refactor, const bool reset,
+        const bool reuse_preconditioner,
         std::shared_ptr<Core::LinAlg::KrylovProjector> projector = nullptr) override;
 
     //! Actual call to the underlying amesos solver
@@ -7,6 +7,7 @@
 
 #include "4C_linear_solver_method_iterative.hpp"
 
+#include "4C_linalg_matrix_free_operator.hpp"
 #include "4C_linear_solver_amgnxn_preconditioner.hpp"
 #include "4C_linear_solver_preconditioner_ifpack.hpp"
 #include "4C_linear_solver_preconditioner_krylovprojection.hpp"
@@ -45,13 +46,16 @@ Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::IterativeSolver(
 template <class MatrixType, class VectorType>
 void Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::setup(
     std::shared_ptr<MatrixType> A, std::shared_ptr<VectorType> x, std::shared_ptr<VectorType> b,
-    const bool refactor, const bool reset, std::shared_ptr<Core::LinAlg::KrylovProjector> projector)
+    const bool refactor, const bool reset, const bool reuse_preconditioner,
+    std::shared_ptr<Core::LinAlg::KrylovProjector> projector)
 {
   if (!params().isSublist("Belos Parameters")) FOUR_C_THROW("Do not have belos parameter list");
   Teuchos::ParameterList& belist = params().sublist("Belos Parameters");
 
   const int reuse = belist.get("reuse", 0);
-  const bool create = !allow_reuse_preconditioner(reuse, reset);
+  // the preconditioner of an unchanged matrix is kept
+  const bool keep = reuse_preconditioner and preconditioner_ != nullptr and not reset;
+  const bool create = not keep and !allow_reuse_preconditioner(reuse, reset);
   if (create)
   {
     ncall_ = 0;
@@ -62,7 +66,12 @@ void Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::setup(
   x_ = x;
   b_ = b;
 
-  preconditioner_->setup(create, a_.get(), x_.get(), b_.get());
+  // the preconditioner of a matrix-free operator is built from its assembled approximation
+  Epetra_Operator* preconditioner_matrix = a_.get();
+  if (auto* matrix_free_operator = dynamic_cast<Core::LinAlg::MatrixFreeOperator*>(a_.get()))
+    preconditioner_matrix = &matrix_free_operator->assembled_approximation();
+
+  preconditioner_->setup(create, preconditioner_matrix, x_.get(), b_.get());
 }
 
 //----------------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include "4C_linear_solver_method_linalg.hpp"
 
 #include "4C_comm_mpi_utils.hpp"
+#include "4C_io_performance_telemetry.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_linalg_sparsematrix.hpp"
 #include "4C_linear_solver_method_direct.hpp"
@@ -23,6 +24,23 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  // only iterative solvers report their number of iterations
+  void record_linear_iterations(
+      const Core::LinearSolver::SolverTypeBase<Epetra_Operator, Core::LinAlg::MultiVector<double>>&
+          solver)
+  {
+    using IterativeSolver =
+        Core::LinearSolver::IterativeSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+    if (const auto* iterative_solver = dynamic_cast<const IterativeSolver*>(&solver))
+    {
+      Core::IO::PerformanceTelemetry::record(
+          Core::IO::PerformanceTelemetry::linear_iterations, iterative_solver->get_num_iters());
+    }
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 Core::LinAlg::Solver::Solver(const Teuchos::ParameterList& inparams, MPI_Comm comm,
@@ -151,6 +169,8 @@ void Core::LinAlg::Solver::setup(std::shared_ptr<Epetra_Operator> matrix,
     std::shared_ptr<Core::LinAlg::MultiVector<double>> b, const SolverParams& params)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Core::LinAlg::Solver:  1)   Setup");
+  Core::IO::PerformanceTelemetry::ScopedTimer telemetry_timer(
+      Core::IO::PerformanceTelemetry::linear_solver_setup_time);
 
   FOUR_C_ASSERT(!(params.lin_tol_better > -1.0 and params.tolerance > 0.0),
       "Do not set tolerance and adaptive tolerance to the linear solver.");
@@ -194,7 +214,8 @@ void Core::LinAlg::Solver::setup(std::shared_ptr<Epetra_Operator> matrix,
       FOUR_C_THROW("Unknown type of solver");
   }
 
-  solver_->setup(matrix, x, b, refactor, params.reset, params.projector);
+  solver_->setup(
+      matrix, x, b, refactor, params.reset, params.reuse_preconditioner, params.projector);
 }
 
 /*----------------------------------------------------------------------*
@@ -209,8 +230,11 @@ int Core::LinAlg::Solver::solve_with_multi_vector(std::shared_ptr<Epetra_Operato
   int error_value = 0;
   {
     TEUCHOS_FUNC_TIME_MONITOR("Core::LinAlg::Solver:  2)   Solve");
+    Core::IO::PerformanceTelemetry::ScopedTimer telemetry_timer(
+        Core::IO::PerformanceTelemetry::linear_solve_time);
     error_value = solver_->solve();
   }
+  record_linear_iterations(*solver_);
 
   return error_value;
 }
@@ -224,8 +248,11 @@ int Core::LinAlg::Solver::solve(std::shared_ptr<Epetra_Operator> matrix,
   int error_value = 0;
   {
     TEUCHOS_FUNC_TIME_MONITOR("Core::LinAlg::Solver:  2)   Solve");
+    Core::IO::PerformanceTelemetry::ScopedTimer telemetry_timer(
+        Core::IO::PerformanceTelemetry::linear_solve_time);
     error_value = solver_->solve();
   }
+  record_linear_iterations(*solver_);
 
   return error_value;
 }
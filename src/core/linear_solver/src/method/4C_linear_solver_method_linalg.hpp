@@ -49,6 +49,10 @@ namespace Core::LinAlg
     //! data from previous solves should be recalculated including preconditioners
     bool reset = false;
 
+    //! the matrix did not change since the last solve, hence an existing preconditioner of an
+    //! iterative solver is kept (direct solvers keep their factorization if refactor is false)
+    bool reuse_preconditioner = false;
+
     //! Krylov space projector
     std::shared_ptr<Core::LinAlg::KrylovProjector> projector = nullptr;
 
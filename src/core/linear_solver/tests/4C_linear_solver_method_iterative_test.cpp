@@ -0,0 +1,146 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_method_iterative.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_multi_vector.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+#include <Teuchos_ParameterList.hpp>
+
+#include <cmath>
+#include <memory>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  using SolverType =
+      Core::LinearSolver::IterativeSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+
+  class IterativeSolverTest : public testing::Test
+  {
+   protected:
+    IterativeSolverTest()
+        : comm_(MPI_COMM_WORLD),
+          map_(std::make_shared<Epetra_Map>(
+              num_rows_, 0, Core::Communication::as_epetra_comm(comm_))),
+          x_(std::make_shared<Core::LinAlg::MultiVector<double>>(*map_, 1, true)),
+          b_(std::make_shared<Core::LinAlg::MultiVector<double>>(*map_, 1, true))
+    {
+      Teuchos::ParameterList& belos_params = params_.sublist("Belos Parameters");
+      belos_params.set("Solver Type", "GMRES");
+      belos_params.set("Convergence Tolerance", 1.0e-10);
+      belos_params.set("Maximum Iterations", 100);
+      belos_params.set("Num Blocks", 100);
+      belos_params.set("reuse", 0);
+      belos_params.set("Preconditioner Type", "ILU");
+      params_.sublist("IFPACK Parameters");
+
+      for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+        b_->ReplaceGlobalValue(map_->GID(lid), 0, std::cos(map_->GID(lid)));
+    }
+
+    /*!
+     * Tridiagonal matrix, whose incomplete LU factorization without fill-in is exact. Hence, a
+     * preconditioner built from this matrix solves it in one iteration.
+     */
+    std::shared_ptr<Epetra_CrsMatrix> create_matrix(const double diagonal_perturbation) const
+    {
+      auto matrix = std::make_shared<Epetra_CrsMatrix>(Copy, *map_, 3);
+      for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+      {
+        const int row = map_->GID(lid);
+        const double diagonal = 4.0 + diagonal_perturbation * std::sin(3.0 * row);
+        matrix->InsertGlobalValues(row, 1, &diagonal, &row);
+        for (const int col : {row - 1, row + 1})
+        {
+          if (col < 0 or col >= num_rows_) continue;
+          const double value = -1.0;
+          matrix->InsertGlobalValues(row, 1, &value, &col);
+        }
+      }
+      matrix->FillComplete();
+      return matrix;
+    }
+
+    //! Set up the solver for the matrix and solve from a zero initial guess.
+    int solve(SolverType& solver, const std::shared_ptr<Epetra_CrsMatrix>& matrix,
+        const bool reset, const bool reuse_preconditioner)
+    {
+      x_->PutScalar(0.0);
+      solver.setup(matrix, x_, b_, false, reset, reuse_preconditioner, nullptr);
+      EXPECT_EQ(solver.solve(), 0);
+      return solver.get_num_iters();
+    }
+
+    static constexpr int num_rows_ = 20;
+
+    MPI_Comm comm_;
+    std::shared_ptr<Epetra_Map> map_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> x_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> b_;
+    Teuchos::ParameterList params_;
+  };
+
+  TEST_F(IterativeSolverTest, PreconditionerIsRebuiltWithoutReuseFlag)
+  {
+    SolverType solver(comm_, params_);
+
+    EXPECT_EQ(solve(solver, create_matrix(0.0), false, false), 1);
+    EXPECT_EQ(solver.ncall(), 1);
+
+    // a new preconditioner is built for the changed matrix
+    EXPECT_EQ(solve(solver, create_matrix(2.0), false, false), 1);
+    EXPECT_EQ(solver.ncall(), 1);
+  }
+
+  TEST_F(IterativeSolverTest, PreconditionerIsKeptWithReuseFlag)
+  {
+    SolverType solver(comm_, params_);
+
+    EXPECT_EQ(solve(solver, create_matrix(0.0), false, false), 1);
+
+    // the preconditioner of the first matrix is applied to the changed matrix, so it is not exact
+    // anymore
+    EXPECT_GT(solve(solver, create_matrix(2.0), false, true), 1);
+    EXPECT_EQ(solver.ncall(), 2);
+
+    // the solution is still correct
+    auto residual = std::make_shared<Core::LinAlg::MultiVector<double>>(*b_);
+    create_matrix(2.0)->Multiply(false, *x_->get_ptr_of_Epetra_MultiVector(),
+        *residual->get_ptr_of_Epetra_MultiVector());
+    residual->Update(-1.0, *b_, 1.0);
+    double residual_norm = 0.0;
+    residual->Norm2(&residual_norm);
+    EXPECT_LT(residual_norm, 1.0e-8);
+  }
+
+  TEST_F(IterativeSolverTest, ResetOverridesReuseFlag)
+  {
+    SolverType solver(comm_, params_);
+
+    EXPECT_EQ(solve(solver, create_matrix(0.0), false, false), 1);
+
+    EXPECT_EQ(solve(solver, create_matrix(2.0), true, true), 1);
+    EXPECT_EQ(solver.ncall(), 1);
+  }
+
+  TEST_F(IterativeSolverTest, ReuseFlagWithoutPreconditionerBuildsOne)
+  {
+    SolverType solver(comm_, params_);
+
+    EXPECT_EQ(solve(solver, create_matrix(2.0), false, true), 1);
+    EXPECT_EQ(solver.ncall(), 1);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,229 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_DOUBLEDOUBLE_HPP
+#define FOUR_C_UTILS_DOUBLEDOUBLE_HPP
+
+#include "4C_config.hpp"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core
+{
+  /**
+   * \brief Floating point type with about 32 significant decimal digits
+   *
+   * A value is represented as the unevaluated sum of two doubles @p hi and @p lo with
+   * |lo| <= ulp(hi)/2 (double-double arithmetic). The operations are built on the error-free
+   * transformations of sums and products (Dekker, Knuth, Shewchuk) and thus only need a few
+   * double operations each. This makes the type an inexpensive intermediate precision between
+   * double and arbitrary precision arithmetic (e.g. CLN), that works with all code templated on
+   * the scalar type, e.g. Core::LinAlg::Matrix.
+   *
+   * \note The exponent range is the one of double, i.e. there is no protection against overflow
+   * or underflow of the low order part.
+   */
+  class DoubleDouble
+  {
+   public:
+    constexpr DoubleDouble() : hi_(0.0), lo_(0.0) {}
+
+    //! implicit conversion from double is exact
+    constexpr DoubleDouble(const double a) : hi_(a), lo_(0.0) {}
+
+    //! construct from the unevaluated sum hi + lo, which has to be normalized already
+    constexpr DoubleDouble(const double hi, const double lo) : hi_(hi), lo_(lo) {}
+
+    //! high order part, i.e. the value rounded to double
+    [[nodiscard]] constexpr double hi() const { return hi_; }
+
+    //! low order part
+    [[nodiscard]] constexpr double lo() const { return lo_; }
+
+    //! value rounded to double
+    [[nodiscard]] constexpr double to_double() const { return hi_; }
+
+    //! relative rounding error of the arithmetic operations
+    static constexpr double epsilon()
+    {
+      return std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon();
+    }
+
+    //! @name Error-free transformations of double operations
+    //! @{
+
+    //! return s = fl(a + b) and set err such that s + err = a + b exactly
+    static constexpr double two_sum(const double a, const double b, double& err)
+    {
+      const double s = a + b;
+      const double bb = s - a;
+      err = (a - (s - bb)) + (b - bb);
+      return s;
+    }
+
+    //! same as two_sum() but only valid for |a| >= |b|
+    static constexpr double quick_two_sum(const double a, const double b, double& err)
+    {
+      const double s = a + b;
+      err = b - (s - a);
+      return s;
+    }
+
+    //! return p = fl(a * b) and set err such that p + err = a * b exactly
+    static double two_prod(const double a, const double b, double& err)
+    {
+      const double p = a * b;
+#ifdef FP_FAST_FMA
+      err = std::fma(a, b, -p);
+#else
+      // Dekker's product based on the splitting of the factors into two halves
+      double ahi, alo, bhi, blo;
+      split(a, ahi, alo);
+      split(b, bhi, blo);
+      err = ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo;
+#endif
+      return p;
+    }
+
+    //! @}
+
+    inline DoubleDouble& operator+=(const DoubleDouble& other)
+    {
+      double e1, e2;
+      double s = two_sum(hi_, other.hi_, e1);
+      const double t = two_sum(lo_, other.lo_, e2);
+      e1 += t;
+      s = quick_two_sum(s, e1, e1);
+      e1 += e2;
+      hi_ = quick_two_sum(s, e1, lo_);
+      return *this;
+    }
+
+    inline DoubleDouble& operator-=(const DoubleDouble& other) { return *this += -other; }
+
+    inline DoubleDouble& operator*=(const DoubleDouble& other)
+    {
+      double e;
+      const double p = two_prod(hi_, other.hi_, e);
+      e += hi_ * other.lo_ + lo_ * other.hi_;
+      hi_ = quick_two_sum(p, e, lo_);
+      return *this;
+    }
+
+    inline DoubleDouble& operator/=(const DoubleDouble& other)
+    {
+      // long division with three partial quotients
+      const double q1 = hi_ / other.hi_;
+      DoubleDouble r = *this - other * q1;
+      const double q2 = r.hi_ / other.hi_;
+      r -= other * q2;
+      const double q3 = r.hi_ / other.hi_;
+
+      double e;
+      const double q = quick_two_sum(q1, q2, e);
+      *this = DoubleDouble(q, e) + q3;
+      return *this;
+    }
+
+    inline DoubleDouble operator-() const { return DoubleDouble(-hi_, -lo_); }
+
+    friend inline DoubleDouble operator+(DoubleDouble first, const DoubleDouble& second)
+    {
+      return first += second;
+    }
+    friend inline DoubleDouble operator-(DoubleDouble first, const DoubleDouble& second)
+    {
+      return first -= second;
+    }
+    friend inline DoubleDouble operator*(DoubleDouble first, const DoubleDouble& second)
+    {
+      return first *= second;
+    }
+    friend inline DoubleDouble operator/(DoubleDouble first, const DoubleDouble& second)
+    {
+      return first /= second;
+    }
+
+    // the arithmetic operators with a double as one operand resolve to the ones above by the
+    // implicit conversion, the comparisons need the same treatment
+    friend inline bool operator==(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return first.hi_ == second.hi_ and first.lo_ == second.lo_;
+    }
+    friend inline bool operator!=(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return not(first == second);
+    }
+    friend inline bool operator<(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return first.hi_ < second.hi_ or (first.hi_ == second.hi_ and first.lo_ < second.lo_);
+    }
+    friend inline bool operator>(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return second < first;
+    }
+    friend inline bool operator<=(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return not(second < first);
+    }
+    friend inline bool operator>=(const DoubleDouble& first, const DoubleDouble& second)
+    {
+      return not(first < second);
+    }
+
+    //! absolute value of @p a
+    static DoubleDouble abs(const DoubleDouble& a) { return (a.hi_ < 0.0) ? -a : a; }
+
+    //! square root of @p a (NaN for negative values)
+    static DoubleDouble sqrt(const DoubleDouble& a)
+    {
+      if (a.hi_ <= 0.0) return DoubleDouble(std::sqrt(a.hi_));
+
+      // one Newton step for the root based on the double approximation (Karp's trick)
+      const double x = 1.0 / std::sqrt(a.hi_);
+      const double ax = a.hi_ * x;
+
+      double e;
+      const double ax2 = two_prod(ax, ax, e);
+      const DoubleDouble residual = a - DoubleDouble(ax2, e);
+
+      return DoubleDouble(ax) + residual.hi_ * (x * 0.5);
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const DoubleDouble& a)
+    {
+      stream << a.hi_;
+      if (a.lo_ != 0.0) stream << (a.lo_ > 0.0 ? "+" : "") << a.lo_;
+      return stream;
+    }
+
+   private:
+    //! split a into two halves of 26 bits each, such that a = hi + lo
+    static constexpr void split(const double a, double& hi, double& lo)
+    {
+      constexpr double splitter = 134217729.0;  // 2^27 + 1
+      const double t = splitter * a;
+      hi = t - (t - a);
+      lo = a - hi;
+    }
+
+    //! high order part
+    double hi_;
+
+    //! low order part
+    double lo_;
+  };
+
+}  // namespace Core
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,46 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_MATHOPERATIONS_DOUBLEDOUBLE_HPP
+#define FOUR_C_UTILS_MATHOPERATIONS_DOUBLEDOUBLE_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_utils_doubledouble.hpp"
+#include "4C_utils_mathoperations.hpp"
+
+#include <cstdlib>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core
+{
+  template <typename T>
+    requires std::is_same_v<std::decay_t<T>, Core::DoubleDouble>
+  struct MathOperations<T>
+  {
+    static T abs(const T& t) { return Core::DoubleDouble::abs(t); }
+    static T sqrt(const T& t) { return Core::DoubleDouble::sqrt(t); }
+    static T pow(const T& base, const int exponent)
+    {
+      // binary exponentiation keeps the double-double accuracy
+      Core::DoubleDouble result = 1.0;
+      Core::DoubleDouble factor = base;
+      for (unsigned int n = std::abs(exponent); n > 0; n /= 2)
+      {
+        if (n % 2 == 1) result *= factor;
+        factor *= factor;
+      }
+      return (exponent < 0) ? 1.0 / result : result;
+    }
+    static double get_double(const T& t) { return t.to_double(); }
+  };
+
+}  // namespace Core
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
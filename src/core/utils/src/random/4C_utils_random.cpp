@@ -7,6 +7,8 @@
 
 #include "4C_utils_random.hpp"
 
+#include <cmath>
+
 FOUR_C_NAMESPACE_OPEN
 
 /// get a random number
@@ -40,7 +42,11 @@ void Core::Utils::Random::normal(std::vector<double>& randvec, int count)
 }
 
 /// set the random seed
-void Core::Utils::Random::set_rand_seed(const unsigned int seed) { rand_engine_.seed(seed); }
+void Core::Utils::Random::set_rand_seed(const unsigned int seed)
+{
+  seed_ = seed;
+  rand_engine_.seed(seed);
+}
 
 /// set the range for the uniform rng
 void Core::Utils::Random::set_rand_range(const double lower, const double upper)
@@ -56,5 +62,64 @@ void Core::Utils::Random::set_mean_variance(const double mean, const double var)
   norm_dist_.param(parameters);
 }
 
+/// get a vector of unit normal random numbers of size count for a given key
+void Core::Utils::Random::normal(std::uint64_t seed, std::uint32_t id, std::uint32_t counter,
+    std::vector<double>& randvec, int count)
+{
+  // resize vector
+  randvec.resize(count);
+
+  const std::array<std::uint32_t, 2> key = {
+      static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+
+  // uniform number in (0,1) from 53 random bits
+  const auto uniform = [](std::uint32_t lo, std::uint32_t hi)
+  {
+    const std::uint64_t bits = ((static_cast<std::uint64_t>(hi) << 32) | lo) >> 11;
+    return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+  };
+
+  // each block of 128 random bits gives two numbers by the Box-Muller transform
+  for (int i = 0; i < count; i += 2)
+  {
+    const std::array<std::uint32_t, 4> bits =
+        philox4x32({id, counter, static_cast<std::uint32_t>(i / 2), 0}, key);
+
+    const double radius = std::sqrt(-2.0 * std::log(uniform(bits[0], bits[1])));
+    const double angle = 2.0 * M_PI * uniform(bits[2], bits[3]);
+
+    randvec[i] = radius * std::cos(angle);
+    if (i + 1 < count) randvec[i + 1] = radius * std::sin(angle);
+  }
+}
+
+/// Philox4x32-10 counter-based random number generator
+std::array<std::uint32_t, 4> Core::Utils::philox4x32(
+    std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key)
+{
+  constexpr std::uint32_t multiplier0 = 0xD2511F53;
+  constexpr std::uint32_t multiplier1 = 0xCD9E8D57;
+  constexpr std::uint32_t weyl0 = 0x9E3779B9;
+  constexpr std::uint32_t weyl1 = 0xBB67AE85;
+
+  for (int round = 0; round < 10; ++round)
+  {
+    if (round > 0)
+    {
+      key[0] += weyl0;
+      key[1] += weyl1;
+    }
+
+    const std::uint64_t product0 = static_cast<std::uint64_t>(multiplier0) * counter[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(multiplier1) * counter[2];
+
+    counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+        static_cast<std::uint32_t>(product1),
+        static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+        static_cast<std::uint32_t>(product0)};
+  }
+
+  return counter;
+}
 
 FOUR_C_NAMESPACE_CLOSE
@@ -10,7 +10,10 @@
 
 #include "4C_config.hpp"
 
+#include <array>
+#include <cstdint>
 #include <random>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -37,13 +40,31 @@ namespace Core::Utils
     /// set the random seed
     void set_rand_seed(const unsigned int seed);
 
+    /// get the random seed
+    [[nodiscard]] unsigned int rand_seed() const { return seed_; }
+
     /// set the range for the uniform rng
     void set_rand_range(const double lower, const double upper);
 
     /// set the mean and variance for the normal rng
     void set_mean_variance(const double mean, const double var);
 
+    /*!
+    \brief get a vector of unit normal random numbers of size count for a given key
+
+    In contrast to the stateful generators above, the numbers are a pure function of the key
+    (@p seed, @p id, @p counter) and their position in @p randvec. Each processor and thread
+    obtains the same numbers for the same key without any communication, independent of the
+    parallel distribution, e.g., for the stochastic forces of the element with global id @p id
+    in the stochastic time step @p counter.
+    */
+    static void normal(std::uint64_t seed, std::uint32_t id, std::uint32_t counter,
+        std::vector<double>& randvec, int count);
+
    private:
+    /// random seed
+    unsigned int seed_ = 0;
+
     /// @name Random number generation
     /// @{
     /// random number engine
@@ -56,6 +77,19 @@ namespace Core::Utils
     std::normal_distribution<double> norm_dist_{};
     //@}
   };
+
+  /*!
+  \brief Philox4x32-10 counter-based random number generator
+
+  Maps a 128 bit @p counter and a 64 bit @p key to 128 random bits. The mapping is a bijection
+  of the counter for a fixed key and passes the BigCrush tests, see
+
+  Salmon, J. K., Moraes, M. A., Dror, R. O. and Shaw, D. E.: Parallel random numbers: as easy as
+  1, 2, 3, Proceedings of the International Conference for High Performance Computing,
+  Networking, Storage and Analysis (SC11), 2011
+  */
+  std::array<std::uint32_t, 4> philox4x32(
+      std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key);
 }  // namespace Core::Utils
 
 FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,106 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_doubledouble.hpp"
+
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_linalg_gauss.templates.hpp"
+#include "4C_utils_mathoperations_doubledouble.hpp"
+
+#include <cmath>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  TEST(DoubleDoubleTest, ErrorFreeTransformations)
+  {
+    double err;
+    const double s = Core::DoubleDouble::two_sum(1.0, 1.0e-20, err);
+    EXPECT_EQ(s, 1.0);
+    EXPECT_EQ(err, 1.0e-20);
+
+    // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60 is not representable in double
+    const double a = 1.0 + std::ldexp(1.0, -30);
+    const double p = Core::DoubleDouble::two_prod(a, a, err);
+    EXPECT_EQ(p, 1.0 + std::ldexp(1.0, -29));
+    EXPECT_EQ(err, std::ldexp(1.0, -60));
+  }
+
+  TEST(DoubleDoubleTest, Arithmetic)
+  {
+    const Core::DoubleDouble one(1.0);
+    const Core::DoubleDouble tiny(1.0e-20);
+
+    // the low order part keeps what is lost in double
+    const Core::DoubleDouble sum = one + tiny;
+    EXPECT_EQ(sum.hi(), 1.0);
+    EXPECT_EQ(sum.lo(), 1.0e-20);
+    EXPECT_EQ((sum - one).to_double(), 1.0e-20);
+    EXPECT_TRUE(sum > one);
+    EXPECT_TRUE(one < sum);
+    EXPECT_TRUE(sum != 1.0);
+    EXPECT_TRUE(2.0 * sum - sum == sum);
+
+    // division and multiplication are inverse up to the double-double rounding
+    const Core::DoubleDouble third = one / 3.0;
+    const Core::DoubleDouble diff = third * 3.0 - one;
+    EXPECT_LE(std::abs(diff.to_double()), 4.0 * Core::DoubleDouble::epsilon());
+    EXPECT_NE(third.lo(), 0.0);
+
+    const Core::DoubleDouble root = Core::MathOperations<Core::DoubleDouble>::sqrt(2.0);
+    EXPECT_LE(std::abs((root * root - 2.0).to_double()), 8.0 * Core::DoubleDouble::epsilon());
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::abs(-third), third);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::sqrt(0.0), 0.0);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::pow(sum, 2), sum * sum);
+    EXPECT_EQ(Core::MathOperations<Core::DoubleDouble>::pow(third, 0), 1.0);
+    const Core::DoubleDouble cube = Core::MathOperations<Core::DoubleDouble>::pow(third, -3);
+    EXPECT_LE(std::abs((cube - 27.0).to_double()), 64.0 * Core::DoubleDouble::epsilon());
+  }
+
+  TEST(DoubleDoubleTest, CancellationInDeterminant)
+  {
+    // nearly singular matrix, whose determinant -2^-80 is lost completely in double
+    const double eps = std::ldexp(1.0, -40);
+    Core::LinAlg::Matrix<2, 2, Core::DoubleDouble> A;
+    A(0, 0) = 1.0 + eps;
+    A(0, 1) = 1.0;
+    A(1, 0) = 1.0;
+    A(1, 1) = 1.0 - eps;
+
+    Core::LinAlg::Matrix<2, 2> A_double;
+    for (unsigned i = 0; i < 4; ++i) A_double.data()[i] = A.data()[i].to_double();
+
+    EXPECT_EQ(A.determinant(), -eps * eps);
+    EXPECT_EQ(A_double.determinant(), 0.0);
+  }
+
+  TEST(DoubleDoubleTest, LinearSolve)
+  {
+    Core::LinAlg::Matrix<3, 3, Core::DoubleDouble> A;
+    Core::LinAlg::Matrix<3, 1, Core::DoubleDouble> x_ref;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      x_ref(i) = 1.0 / (i + 1.0);
+      for (unsigned j = 0; j < 3; ++j) A(i, j) = 1.0 / (i + j + 1.0);
+    }
+
+    Core::LinAlg::Matrix<3, 1, Core::DoubleDouble> b;
+    b.multiply(A, x_ref);
+
+    Core::LinAlg::Matrix<3, 1, Core::DoubleDouble> x;
+    Core::LinAlg::gauss_elimination<true, 3, Core::DoubleDouble>(A, b, x);
+
+    Core::LinAlg::Matrix<3, 1, Core::DoubleDouble> diff;
+    diff.update(1.0, x, -1.0, x_ref);
+    EXPECT_LT(diff.norm2(), 1.0e-28);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
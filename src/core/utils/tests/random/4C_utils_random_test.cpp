@@ -0,0 +1,73 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_random.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+  using namespace Core::Utils;
+
+  TEST(RandomTest, Philox4x32KnownAnswers)
+  {
+    // known answer tests of the reference implementation (Random123)
+    EXPECT_EQ(philox4x32({0, 0, 0, 0}, {0, 0}),
+        (std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                  {0xffffffff, 0xffffffff}),
+        (std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                  {0xa4093822, 0x299f31d0}),
+        (std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+  }
+
+  TEST(RandomTest, CounterBasedNormalIsReproducible)
+  {
+    std::vector<double> first;
+    std::vector<double> second;
+    Random::normal(42, 7, 3, first, 5);
+    Random::normal(42, 7, 3, second, 6);
+
+    // the numbers only depend on the key and their position
+    ASSERT_EQ(first.size(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(first[i], second[i]);
+
+    Random::normal(42, 8, 3, second, 5);
+    EXPECT_NE(first[0], second[0]);
+    Random::normal(42, 7, 4, second, 5);
+    EXPECT_NE(first[0], second[0]);
+    Random::normal(43, 7, 3, second, 5);
+    EXPECT_NE(first[0], second[0]);
+  }
+
+  TEST(RandomTest, CounterBasedNormalMoments)
+  {
+    double mean = 0.0;
+    double variance = 0.0;
+    const int numids = 20000;
+    const int count = 5;
+    std::vector<double> randvec;
+    for (int id = 0; id < numids; ++id)
+    {
+      Random::normal(42, id, 3, randvec, count);
+      for (const double value : randvec)
+      {
+        mean += value;
+        variance += value * value;
+      }
+    }
+    mean /= numids * count;
+    variance /= numids * count;
+
+    EXPECT_NEAR(mean, 0.0, 0.01);
+    EXPECT_NEAR(variance, 1.0, 0.02);
+  }
+}  // namespace
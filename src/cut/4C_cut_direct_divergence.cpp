@@ -170,7 +170,7 @@ void Cut::DirectDivergence::list_facets(std::vector<plain_facet_set::const_itera
     // consider only facet whose x-direction normal component is non-zero
     if (fabs(RefPlaneTemp[0]) > TOL_EQN_PLANE)  // This could give issues with non-planar facets?
     {
-      TEUCHOS_FUNC_TIME_MONITOR("Cut::DirectDivergence::list_facets-tmp1");
+      // TEUCHOS_FUNC_TIME_MONITOR( "Cut::DirectDivergence::list_facets-tmp1" );
 
 #ifdef LOCAL
       if (warpFac.size() > 0)  // if there are warped facets that are not yet processed
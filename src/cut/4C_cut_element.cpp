@@ -1281,6 +1281,35 @@ void Cut::Element::direct_divergence_gauss_rule(
   }
 }
 
+/*----------------------------------------------------------------------------*
+ * Prepare the direct divergence Gauss rules of this element and collect the
+ * volumecells whose Gauss rules can be computed independently of all other
+ * volumecells. Level set facets are triangulated during the Gauss rule
+ * computation, hence elements with level set sides are treated completely here
+ *----------------------------------------------------------------------------*/
+void Cut::Element::prepare_direct_divergence_gauss_rule(Mesh& mesh, bool include_inner,
+    Cut::BCellGaussPts Bcellgausstype, std::vector<VolumeCell*>& cells)
+{
+  if (not active_) return;
+
+  // try to create one single simple shaped integration cell if possible
+  if (create_simple_shaped_integration_cells(mesh)) return;
+  // return if this was possible
+
+  eleinttype_ = Cut::EleIntType_DirectDivergence;
+
+  const bool levelset = has_level_set_side();
+
+  for (plain_volumecell_set::iterator i = cells_.begin(); i != cells_.end(); i++)
+  {
+    VolumeCell* cell1 = *i;
+    if (levelset)
+      cell1->direct_divergence_gauss_rule(this, mesh, include_inner, Bcellgausstype);
+    else if (cell1->prepare_direct_divergence_gauss_rule(this, mesh, include_inner, Bcellgausstype))
+      cells.push_back(cell1);
+  }
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 bool Cut::Element::has_level_set_side()
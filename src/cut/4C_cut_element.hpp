@@ -182,6 +182,11 @@ namespace Cut
     void direct_divergence_gauss_rule(
         Mesh& mesh, bool include_inner, Cut::BCellGaussPts Bcellgausstype);
 
+    /*! \brief Prepare the direct divergence quadrature rules and append all volumecells whose
+     *  quadrature rules can be computed concurrently to cells */
+    void prepare_direct_divergence_gauss_rule(Mesh& mesh, bool include_inner,
+        Cut::BCellGaussPts Bcellgausstype, std::vector<VolumeCell*>& cells);
+
     /*! \brief Return the level set value at the given global coordinate
      *  which has to be INSIDE the element. */
     template <class T>
@@ -750,7 +750,7 @@ void Cut::FacetIntegration::temporary_quad4(
 void Cut::FacetIntegration::divergence_integration_rule_new(
     Mesh& mesh, Core::FE::CollectedGaussPoints& cgp)
 {
-  TEUCHOS_FUNC_TIME_MONITOR("Cut::FacetIntegration::divergence_integration_rule");
+  // TEUCHOS_FUNC_TIME_MONITOR( "Cut::FacetIntegration::divergence_integration_rule" );
 
   std::list<std::shared_ptr<BoundaryCell>> divCells;
 
@@ -13,7 +13,9 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <array>
 #include <iostream>
+#include <limits>
 #include <unordered_map>
 
 FOUR_C_NAMESPACE_OPEN
@@ -601,20 +603,69 @@ bool Cut::Kernel::is_clockwise_ordered_polygon(
     ind2 = 1;
   }
 
-  int numpts = polyPoints.size();
+  const int numpts = polyPoints.size();
+  std::vector<std::array<double, 2>> coords(numpts);
+  for (int i = 0; i < numpts; i++)
+  {
+    const double* pt = polyPoints[i]->x();
+    coords[i] = {pt[ind1], pt[ind2]};
+  }
+
+  // Evaluate the sign of the (doubled) signed area as a filtered predicate: The sum is only
+  // trusted on double, if it exceeds the a priori bound of its rounding error. Otherwise it is
+  // recomputed on double-double and, if still ambiguous, on the reference precision of CLN.
   double crossProd = 0.0;
+  double magnitude = 0.0;
   for (int i = 0; i < numpts; i++)
   {
-    double pt1[3], pt2[3];
+    const std::array<double, 2>& pt1 = coords[i];
+    const std::array<double, 2>& pt2 = coords[(i + 1) % numpts];
+    const double term = (pt2[0] - pt1[0]) * (pt2[1] + pt1[1]);
+    crossProd += term;
+    magnitude += std::abs(term);
+  }
 
-    polyPoints[i]->coordinates(pt1);
-    polyPoints[(i + 1) % numpts]->coordinates(pt2);
+  const double error_bound = (numpts + 3) * std::numeric_limits<double>::epsilon() * magnitude;
+  if (std::abs(crossProd) > error_bound)
+  {
+    CutKernelStatistics::get_cut_kernel_statistics().count(
+        KernelPredicate::orientation, PrecisionTier::double_precision);
+    return crossProd > 0.0;
+  }
 
-    crossProd += (pt2[ind1] - pt1[ind1]) * (pt2[ind2] + pt1[ind2]);
+  // differences and sums of two doubles are exact on double-double
+  Core::DoubleDouble ddCrossProd = 0.0;
+  for (int i = 0; i < numpts; i++)
+  {
+    const std::array<double, 2>& pt1 = coords[i];
+    const std::array<double, 2>& pt2 = coords[(i + 1) % numpts];
+    ddCrossProd += (Core::DoubleDouble(pt2[0]) - pt1[0]) * (Core::DoubleDouble(pt2[1]) + pt1[1]);
   }
 
-  if (crossProd > 0.0) return true;
-  return false;
+  const double dd_error_bound = (numpts + 3) * 4.0 * Core::DoubleDouble::epsilon() * magnitude;
+  if (std::abs(ddCrossProd.to_double()) > dd_error_bound)
+  {
+    CutKernelStatistics::get_cut_kernel_statistics().count(
+        KernelPredicate::orientation, PrecisionTier::double_double);
+    return ddCrossProd > 0.0;
+  }
+
+  CutKernelStatistics::get_cut_kernel_statistics().count(
+      KernelPredicate::orientation, PrecisionTier::cln);
+  const unsigned int prev_prec = Core::CLN::ClnWrapper::get_precision();
+  Core::CLN::ClnWrapper::set_precision(CLN_REFERENCE_PREC);
+  Core::CLN::ClnWrapper clnCrossProd = 0.0;
+  for (int i = 0; i < numpts; i++)
+  {
+    const std::array<double, 2>& pt1 = coords[i];
+    const std::array<double, 2>& pt2 = coords[(i + 1) % numpts];
+    clnCrossProd += (Core::CLN::ClnWrapper(pt2[0]) - Core::CLN::ClnWrapper(pt1[0])) *
+                    (Core::CLN::ClnWrapper(pt2[1]) + Core::CLN::ClnWrapper(pt1[1]));
+  }
+  const bool isClockwise = clnCrossProd > 0.0;
+  Core::CLN::ClnWrapper::set_precision(prev_prec);
+
+  return isClockwise;
 }
 
 /*----------------------------------------------------------------------------*
@@ -863,6 +914,12 @@ double Cut::Kernel::get_area_convex_quad(std::vector<Point*>& poly)
 bool Cut::Kernel::close_to_zero(const double a) { return ((a < 1e-30) and (a > -1e-30)); };
 
 
+bool Cut::Kernel::close_to_zero(const Core::DoubleDouble& a)
+{
+  return ((a < std::numeric_limits<double>::min()) and (a > -std::numeric_limits<double>::min()));
+};
+
+
 bool Cut::Kernel::close_to_zero(const Core::CLN::ClnWrapper& a)
 {
   cln::cl_F lpf = cln::least_positive_float(cln::float_format(a.Value()));
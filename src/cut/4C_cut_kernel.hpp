@@ -18,7 +18,10 @@
 #include "4C_utils_cln_matrix_conversion.hpp"
 #include "4C_utils_clnwrapper.hpp"
 #include "4C_utils_mathoperations_cln.hpp"
+#include "4C_utils_mathoperations_doubledouble.hpp"
 
+#include <array>
+#include <iomanip>
 #include <unordered_map>
 
 
@@ -37,9 +40,28 @@ namespace Cut::Kernel
   // functions to compare determinant to zero, e.g when computing the condition_number
   bool close_to_zero(const double a);
 
+  bool close_to_zero(const Core::DoubleDouble& a);
+
   bool close_to_zero(const Core::CLN::ClnWrapper& a);
 
-  // Class to collects statistics about runs on double and cln in the cut intersection
+  /// precision tiers of the cut kernel, the next tier is only used if the result of the
+  /// previous one is not reliable
+  enum class PrecisionTier
+  {
+    double_precision = 0,
+    double_double = 1,
+    cln = 2
+  };
+
+  /// computations of the cut kernel running through the precision tiers
+  enum class KernelPredicate
+  {
+    intersection = 0,
+    distance = 1,
+    orientation = 2
+  };
+
+  // Class to collects statistics about the precision tiers used in the cut kernel
   class CutKernelStatistics
   {
    public:
@@ -48,26 +70,45 @@ namespace Cut::Kernel
       static CutKernelStatistics intersection_counter_;
       return intersection_counter_;
     }
-    void double_intersection_counter() { double_int_++; };
-    void double_distance_counter() { double_dist_++; };
-    void cln_intersection_counter() { cln_int_++; };
-    void cln_distance_counter() { cln_dist_++; };
+
+    /// count a computation of the predicate, whose result was obtained on the given tier
+    void count(const KernelPredicate predicate, const PrecisionTier tier)
+    {
+      if (CUT_KERNEL_STATISTICS)
+        ++counter_[static_cast<int>(predicate)][static_cast<int>(tier)];
+    }
+
     ~CutKernelStatistics()
     {
+      unsigned long long int total = 0;
+      for (const auto& predicate_counter : counter_)
+        for (unsigned long long int tier_counter : predicate_counter) total += tier_counter;
+      if (total == 0) return;
+
       std::cout << "\n\n =====================INTERSECTION "
                    "STATISTICS====================================\n\n";
-      std::cout << "During compute intersection " << double_int_ << "/" << double_int_ + cln_int_
-                << " was done on double only " << std::endl;
-      std::cout << "During compute distance     " << double_dist_ << "/" << double_dist_ + cln_dist_
-                << " was done on double only " << std::endl;
+      print_hit_rates("compute intersection", counter_[0]);
+      print_hit_rates("compute distance    ", counter_[1]);
+      print_hit_rates("polygon orientation ", counter_[2]);
     }
 
    private:
-    CutKernelStatistics() { /* blank */ };
-    unsigned long long int double_int_;
-    unsigned long long int double_dist_;
-    unsigned long long int cln_int_;
-    unsigned long long int cln_dist_;
+    CutKernelStatistics() = default;
+
+    static void print_hit_rates(
+        const std::string& name, const std::array<unsigned long long int, 3>& tier_counter)
+    {
+      const unsigned long long int total = tier_counter[0] + tier_counter[1] + tier_counter[2];
+      if (total == 0) return;
+
+      std::cout << "During " << name << " " << total << " calls finished on double "
+                << std::fixed << std::setprecision(3) << 100.0 * tier_counter[0] / total
+                << "%, on double-double " << 100.0 * tier_counter[1] / total << "%, on cln "
+                << 100.0 * tier_counter[2] / total << "%" << std::endl;
+    }
+
+    /// number of results of each predicate (rows) obtained on each precision tier (columns)
+    std::array<std::array<unsigned long long int, 3>, 3> counter_{};
   };
 
   /// Information about the location of the point on the surface
@@ -738,6 +779,23 @@ namespace Cut::Kernel
         xyze, px, initial_rhs);  // forwarding to normal function
   }
 
+  /// computes the Newton tolerance for the computations on double-double precision
+  template <class T1, class T2, class T3>
+  Core::DoubleDouble adaptive_combined_newton_tolerance(
+      const T1& xyze, const T2& px, const T3& initial_rhs, Core::DoubleDouble&)
+  {
+    /* --- Build the absolute tolerance */
+    Core::DoubleDouble tol = xyze.norm_inf();
+    Core::DoubleDouble linescale = px.norm_inf();
+    if (linescale > tol) tol = linescale;
+    tol *= DOUBLE_DOUBLE_LINSOLVETOL;
+
+    /* --- Add the relative tolerance */
+    tol += DOUBLE_DOUBLE_LINSOLVETOL * initial_rhs.norm_inf();
+
+    return tol;
+  }
+
 #ifdef CUT_CLN_CALC
 
   /// computes adaptive precision for AdaptivePrecision strategies
@@ -810,6 +868,11 @@ namespace Cut::Kernel
    public:
     /// constructor
     NewtonSolve(Core::LinAlg::Matrix<dim, 1>& xsi, bool checklimits) : Strategy(xsi, checklimits) {}
+    /// required constructor for double-double
+    NewtonSolve(Core::LinAlg::Matrix<dim, 1, Core::DoubleDouble>& xsi, bool checklimits)
+        : Strategy(xsi, checklimits)
+    {
+    }
 #ifdef CUT_CLN_CALC
     /// required constructor for CLN
     NewtonSolve(Core::LinAlg::Matrix<dim, 1, Core::CLN::ClnWrapper>& xsi, bool checklimits)
@@ -2919,6 +2982,150 @@ namespace Cut::Kernel
 
 #endif
 
+  /*--------------------------------------------------------------------------*/
+  /** \brief Strategy class for distance between side and point on double-double precision
+   *
+   *  Intermediate tier between the computation on double and the adaptive precision computation
+   *  on CLN. The Newton scheme is solved once on double-double precision. The result is only
+   *  accepted, if it fulfills the error criterion of the CLN computation. Otherwise, the caller
+   *  has to switch to CLN.
+   *
+   *  inheritance diagram:
+   *
+   *  compute_distance --> ComputeDistanceDoubleDouble --> NewtonSolve
+   *                      ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+   *  --> ComputeDistanceStrategy --> EmptyNewtonStrategy  */
+  template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type,
+      unsigned dim_side = Core::FE::dim<side_type>,
+      unsigned num_nodes_side = Core::FE::num_nodes<side_type>>
+  class ComputeDistanceDoubleDouble : Strategy
+  {
+   public:
+    /// constructor
+    ComputeDistanceDoubleDouble(Core::LinAlg::Matrix<prob_dim, 1>& xsi, bool checklimits)
+        : Strategy(ddxsi_, checklimits), xsi_(xsi), ddxsi_(true)
+    {
+    }
+
+    /// solve the distance calculation and return true, if the result is accurate enough
+    bool operator()(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, 1>& px, double& distance, bool signeddistance = false)
+    {
+      // the conversion from double is exact
+      for (unsigned i = 0; i < prob_dim * num_nodes_side; ++i)
+        ddxyze_side_.data()[i] = xyze_side.data()[i];
+      for (unsigned i = 0; i < prob_dim; ++i) ddpx_(i) = px(i);
+
+      this->setup(ddxyze_side_, ddpx_, false);
+      if ((not this->solve()) or this->zero_area()) return false;
+
+      std::pair<bool, Core::DoubleDouble> cond_pair = this->condition_number();
+      if (not cond_pair.first) return false;
+
+      // the right hand side of the last Newton step is the residual of the converged solution
+      if (this->get_residual_l2_norm() * cond_pair.second > DOUBLE_DOUBLE_LIMIT_ERROR)
+        return false;
+
+      if (not get_topology_information()) return false;
+      fix_corner_case();
+
+      for (unsigned i = 0; i < prob_dim; ++i) xsi_(i) = ddxsi_(i).to_double();
+      if (not signeddistance)
+        distance = this->distance().to_double();
+      else
+        distance = this->signed_distance()[0].to_double();
+
+      return true;
+    }
+
+    PointOnSurfaceLoc get_side_location() { return location_; }
+
+    const std::vector<int>& get_touched_side_edges() { return touched_edges_ids_; }
+
+    const std::vector<int>& get_touched_nodes() { return touched_nodes_ids_; }
+
+   private:
+    // Transform tolerances into local coordinate system and get location of the point on the
+    // surface as well as touched edges and nodes
+    bool get_topology_information()
+    {
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> scaled_tolerance;
+      if (not this->get_local_tolerance(SIDE_DETECTION_TOLERANCE, scaled_tolerance)) return false;
+
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> zero_tolerance_side;
+      bool is_inside = within_limits<side_type>(ddxsi_, zero_tolerance_side);
+      location_ = PointOnSurfaceLoc(is_inside, is_on_surface(SIDE_DETECTION_TOLERANCE));
+
+      touched_edges_ids_.clear();
+      touched_nodes_ids_.clear();
+      if (location_.on_side())
+      {
+        get_edges_at<side_type>(ddxsi_, touched_edges_ids_, scaled_tolerance);
+        get_nodes_at<side_type>(ddxsi_, touched_nodes_ids_, scaled_tolerance);
+      }
+      return true;
+    }
+
+    /// check whether the point is on the surface within the global tolerance err
+    bool is_on_surface(const Core::DoubleDouble& err) const
+    {
+      if (prob_dim - dim_side == 1)
+      {
+        const Core::DoubleDouble& signed_distance = Strategy::signed_distance()[0];
+        return (signed_distance + err >= 0.0) and (signed_distance - err <= 0.0);
+      }
+      return Strategy::distance() - err <= 0.0;
+    }
+
+    /// a point close to the corner, but outside of the side, might touch two edges without
+    /// being close enough to the corner point to be merged with it, see
+    /// ComputeDistanceAdaptivePrecision
+    void fix_corner_case()
+    {
+      if (touched_edges_ids_.size() < 2 or not location_.within_side()) return;
+
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> zero_tolerance_side;
+      if (within_limits<side_type>(ddxsi_, zero_tolerance_side)) return;
+
+      Core::DoubleDouble min_dist;
+      for (unsigned int inode = 0; inode < num_nodes_side; ++inode)
+      {
+        const Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> coord(
+            ddxyze_side_.data() + inode * prob_dim, true);
+        Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> dist;
+        dist.update(1.0, coord, -1.0, ddpx_);
+        const Core::DoubleDouble tmp_dist = dist.norm2();
+        if ((inode == 0) or (tmp_dist < min_dist)) min_dist = tmp_dist;
+      }
+
+      if (min_dist > NON_TOPOLOGICAL_TOLERANCE)
+      {
+        touched_edges_ids_.clear();
+        location_ = PointOnSurfaceLoc(false, location_.on_side());
+      }
+    }
+
+    // touched edges ids
+    std::vector<int> touched_edges_ids_;
+
+    // touched nodes ids
+    std::vector<int> touched_nodes_ids_;
+
+    // side coordinates converted to double-double
+    Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::DoubleDouble> ddxyze_side_;
+
+    // global position of the point converted to double-double
+    Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> ddpx_;
+
+    // reference to the double Matrix
+    Core::LinAlg::Matrix<prob_dim, 1>& xsi_;
+
+    Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> ddxsi_;
+
+    // determines position of this point with respect to the side limits
+    PointOnSurfaceLoc location_;
+  };  // class ComputeDistanceDoubleDouble
+
   /*--------------------------------------------------------------------------*/
   /** \brief generic distance between side and point
    *
@@ -2969,6 +3176,7 @@ namespace Cut::Kernel
         }
       }
       bool got_topology_info = get_topology_information();
+      PrecisionTier tier = PrecisionTier::double_precision;
 #ifdef CUT_CLN_CALC
       if (compute_cln or !got_topology_info)
       {
@@ -2982,10 +3190,27 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
-          // CutKernelStatistics::get_cut_kernel_statistics().ClnDistanceCounter();
-
+          // most of the cases, which fail on double, are resolved on double-double precision,
+          // which is much cheaper than the adaptive precision loop on CLN
+          tier = PrecisionTier::double_double;
+          ComputeDistanceDoubleDouble<
+              NewtonSolve<ComputeDistanceStrategy<false, prob_dim, side_type, dim_side,
+                              num_nodes_side, Core::DoubleDouble, ComputeDistanceNoStaticMembers>,
+                  prob_dim>,
+              prob_dim, side_type>
+              dd_calc(xsi_ref_, checklimits_ref_);
+          if (dd_calc(xyze_side, px, distance, signeddistance))
+          {
+            conv = true;
+            location_ = dd_calc.get_side_location();
+            touched_edges_ids_ = dd_calc.get_touched_side_edges();
+            touched_nodes_ids_ = dd_calc.get_touched_nodes();
+            cond_infinity_ = false;
+          }
+          else
 #endif
           {
+            tier = PrecisionTier::cln;
             ComputeDistanceAdaptivePrecision<
                 NewtonSolve<
                     ComputeDistanceStrategy<false, prob_dim, side_type, dim_side, num_nodes_side,
@@ -3013,13 +3238,10 @@ namespace Cut::Kernel
 #endif
 #if DOUBLE_PLUS_CLN_COMPUTE
         }
-        else
-        {
-          // CutKernelStatistics::get_cut_kernel_statistics().double_distance_counter();
-        }
 #endif
       }
 #endif
+      CutKernelStatistics::get_cut_kernel_statistics().count(KernelPredicate::distance, tier);
       return conv;
     }
     // get the local coordinates
@@ -4324,6 +4546,162 @@ namespace Cut::Kernel
 
 #endif
 
+  /*--------------------------------------------------------------------------*/
+  /** \brief Strategy class for intersection of side and line/edge on double-double precision
+   *
+   *  Intermediate tier between the computation on double and the adaptive precision computation
+   *  on CLN, see ComputeDistanceDoubleDouble.
+   *
+   *  inheritance diagram:
+   *
+   *  ComputeIntersection --> ComputeIntersectionDoubleDouble --> NewtonSolve
+   *                          ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+   *  --> ComputeIntersectionStrategy --> EmptyNewtonStrategy  */
+  template <class Strategy, unsigned prob_dim, Core::FE::CellType edge_type,
+      Core::FE::CellType side_type, unsigned dim_edge = Core::FE::dim<edge_type>,
+      unsigned dim_side = Core::FE::dim<side_type>,
+      unsigned num_nodes_edge = Core::FE::num_nodes<edge_type>,
+      unsigned num_nodes_side = Core::FE::num_nodes<side_type>>
+  class ComputeIntersectionDoubleDouble : Strategy
+  {
+   public:
+    //! constructor
+    ComputeIntersectionDoubleDouble(
+        Core::LinAlg::Matrix<dim_edge + dim_side, 1>& xsi, bool checklimits)
+        : Strategy(ddxsi_, checklimits), xsi_(xsi), ddxsi_(true)
+    {
+    }
+
+    //! solve the intersection problem and return true, if the result is accurate enough
+    bool operator()(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, num_nodes_edge>& xyze_edge)
+    {
+      // the conversion from double is exact
+      for (unsigned i = 0; i < prob_dim * num_nodes_side; ++i)
+        ddxyze_side_.data()[i] = xyze_side.data()[i];
+      for (unsigned i = 0; i < prob_dim * num_nodes_edge; ++i)
+        ddxyze_edge_.data()[i] = xyze_edge.data()[i];
+
+      this->setup(ddxyze_side_, ddxyze_edge_);
+      if (not this->solve()) return false;
+
+      std::pair<bool, Core::DoubleDouble> cond_pair = this->condition_number();
+      if (not cond_pair.first) return false;
+      if (compute_error() * cond_pair.second > DOUBLE_DOUBLE_LIMIT_ERROR) return false;
+
+      if (not get_topology_information()) return false;
+      if (not is_corner_case_consistent()) return false;
+
+      for (unsigned i = 0; i < dim_edge + dim_side; ++i) xsi_(i) = ddxsi_(i).to_double();
+      return true;
+    }
+
+    PointOnSurfaceLoc get_side_location() { return side_location_; }
+
+    PointOnSurfaceLoc get_edge_location() { return edge_location_; }
+
+    const std::vector<int>& get_touched_side_edges() { return touched_edges_ids_; }
+
+    double distance_between() const { return Strategy::distance_between().to_double(); }
+
+   private:
+    //  Converts tolerance in the local coordinates and computes topological information, such
+    //  as touched_edges and location on the surface
+    bool get_topology_information()
+    {
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> scaled_tolerance_side_touched_edges;
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> scaled_tolerance_side;
+      Core::LinAlg::Matrix<dim_edge, 1, Core::DoubleDouble> scaled_tolerance_edge;
+      if ((not this->get_local_tolerance_side(INSIDE_OUTSIDE_TOLERANCE, scaled_tolerance_side)) or
+          (not this->get_local_tolerance_side(
+              SIDE_DETECTION_TOLERANCE, scaled_tolerance_side_touched_edges)) or
+          (not this->get_local_tolerance_edge(INSIDE_OUTSIDE_TOLERANCE, scaled_tolerance_edge)))
+        return false;
+
+      side_location_ =
+          PointOnSurfaceLoc(within_limits<side_type>(ddxsi_, scaled_tolerance_side), true);
+      const Core::LinAlg::Matrix<dim_edge, 1, Core::DoubleDouble> ddxsi_line(
+          ddxsi_.data() + dim_side, true);
+      edge_location_ =
+          PointOnSurfaceLoc(within_limits<edge_type>(ddxsi_line, scaled_tolerance_edge), true);
+
+      touched_edges_ids_.clear();
+      if (side_location_.within_side())
+        get_edges_at<side_type>(ddxsi_, touched_edges_ids_, scaled_tolerance_side_touched_edges);
+      return true;
+    }
+
+    // Evaluate difference between global coordinates in the intersection when computed based on
+    // side and based on edge
+    Core::DoubleDouble compute_error() const
+    {
+      const Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> xsi_side(ddxsi_.data(), true);
+      const Core::LinAlg::Matrix<dim_edge, 1, Core::DoubleDouble> xsi_edge(
+          ddxsi_.data() + dim_side, true);
+
+      Core::LinAlg::Matrix<num_nodes_side, 1, Core::DoubleDouble> side_funct;
+      Core::LinAlg::Matrix<num_nodes_edge, 1, Core::DoubleDouble> edge_funct;
+      Core::FE::shape_function<side_type>(xsi_side, side_funct);
+      Core::FE::shape_function<edge_type>(xsi_edge, edge_funct);
+
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> diff_vec;
+      for (unsigned int isd = 0; isd < (dim_edge + dim_side); ++isd)
+      {
+        for (unsigned int inode = 0; inode < num_nodes_edge; ++inode)
+          diff_vec(isd) += ddxyze_edge_(isd, inode) * edge_funct(inode);
+        for (unsigned int inode = 0; inode < num_nodes_side; ++inode)
+          diff_vec(isd) -= ddxyze_side_(isd, inode) * side_funct(inode);
+      }
+      return diff_vec.norm2();
+    }
+
+    /// A point touching two side edges has to be close to their common corner, see
+    /// ComputeIntersectionAdaptivePrecision. Instead of throwing, this case is left to CLN.
+    bool is_corner_case_consistent() const
+    {
+      if (touched_edges_ids_.size() < 2) return true;
+
+      Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> zero_tolerance_side;
+      if (within_limits<side_type>(ddxsi_, zero_tolerance_side)) return true;
+
+      const Core::LinAlg::Matrix<dim_side, 1, Core::DoubleDouble> xsi_side(ddxsi_.data(), true);
+      Core::LinAlg::Matrix<num_nodes_side, 1, Core::DoubleDouble> side_funct;
+      Core::FE::shape_function<side_type>(xsi_side, side_funct);
+      Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> x_global;
+      x_global.multiply(ddxyze_side_, side_funct);
+
+      Core::DoubleDouble min_dist;
+      for (unsigned int inode = 0; inode < num_nodes_side; ++inode)
+      {
+        const Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> coord(
+            ddxyze_side_.data() + inode * prob_dim, true);
+        Core::LinAlg::Matrix<prob_dim, 1, Core::DoubleDouble> dist;
+        dist.update(1.0, coord, -1.0, x_global);
+        const Core::DoubleDouble tmp_dist = dist.norm2();
+        if ((inode == 0) or (tmp_dist < min_dist)) min_dist = tmp_dist;
+      }
+      return min_dist <= NON_TOPOLOGICAL_TOLERANCE;
+    }
+
+    // touched edges ids
+    std::vector<int> touched_edges_ids_;
+
+    // side and edge coordinates converted to double-double
+    Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::DoubleDouble> ddxyze_side_;
+    Core::LinAlg::Matrix<prob_dim, num_nodes_edge, Core::DoubleDouble> ddxyze_edge_;
+
+    // reference to the double Matrix
+    Core::LinAlg::Matrix<dim_edge + dim_side, 1>& xsi_;
+
+    Core::LinAlg::Matrix<dim_edge + dim_side, 1, Core::DoubleDouble> ddxsi_;
+
+    // determines location of this point with respect to the edge that cuts it
+    PointOnSurfaceLoc side_location_;
+
+    // determines location of this point with respect to the side that cuts it
+    PointOnSurfaceLoc edge_location_;
+  };  // class ComputeIntersectionDoubleDouble
+
   /*--------------------------------------------------------------------------*/
   /** \brief generic strategy class for intersection of side and line/edge
    *
@@ -4360,6 +4738,7 @@ namespace Cut::Kernel
       this->setup(xyze_side, xyze_edge);
       conv = this->solve();
       bool got_topology_info = get_topology_information();
+      PrecisionTier tier = PrecisionTier::double_precision;
 
 #ifdef CUT_CLN_CALC
       if (compute_cln or (!got_topology_info))
@@ -4370,9 +4749,28 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
-//             CutKernelStatistics::get_cut_kernel_statistics().cln_intersection_counter();
+          tier = PrecisionTier::double_double;
+          ComputeIntersectionDoubleDouble<
+              NewtonSolve<ComputeIntersectionStrategy<false, prob_dim, edge_type, side_type,
+                              dim_edge, dim_side, num_nodes_edge, num_nodes_side,
+                              Core::DoubleDouble, ComputeIntersectionNoStaticMembers>,
+                  dim_edge + dim_side>,
+              prob_dim, edge_type, side_type>
+              ddcalc(xsi_, checklimits_);
+          if (ddcalc(xyze_side, xyze_edge))
+          {
+            conv = true;
+            edge_location_ = ddcalc.get_edge_location();
+            side_location_ = ddcalc.get_side_location();
+            cond_infinity_ = false;
+            touched_edges_ids_ = ddcalc.get_touched_side_edges();
+
+            if (prob_dim > dim_edge + dim_side) distance_between_ = ddcalc.distance_between();
+          }
+          else
 #endif
           {
+            tier = PrecisionTier::cln;
             ComputeIntersectionAdaptivePrecision<
                 NewtonSolve<ComputeIntersectionStrategy<false, prob_dim, edge_type, side_type,
                                 dim_edge, dim_side, num_nodes_edge, num_nodes_side,
@@ -4399,13 +4797,10 @@ namespace Cut::Kernel
 #endif
 #if DOUBLE_PLUS_CLN_COMPUTE
         }
-        else
-        {
-          //             CutKernelStatistics::get_cut_kernel_statistics().double_intersection_counter();
-        }
 #endif
       }
 #endif
+      CutKernelStatistics::get_cut_kernel_statistics().count(KernelPredicate::intersection, tier);
       return conv;
     }
 
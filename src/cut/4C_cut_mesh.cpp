@@ -19,6 +19,7 @@
 #include "4C_fem_geometry_searchtree.hpp"
 #include "4C_utils_shared_ptr_from_ref.hpp"
 
+#include <Kokkos_Core.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
 FOUR_C_NAMESPACE_OPEN
@@ -1500,16 +1501,23 @@ void Cut::Mesh::moment_fit_gauss_weights(bool include_inner, Cut::BCellGaussPts
 
 /*-------------------------------------------------------------------------------------*
  * Call the DirectDivergence method for each element to generate the Gaussian integration rule
+ *
+ * All modifications of shared points, facets and sides are done sequentially in a fixed
+ * element order, whereas the Gauss rules of the volumecells are computed thread-parallel.
+ * Hence, the result is independent of the number of threads.
  *-------------------------------------------------------------------------------------*/
 void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGaussPts Bcellgausstype)
 {
+  // volumecells whose Gauss rules are computed thread-parallel
+  std::vector<VolumeCell*> cells;
+
   for (std::map<int, std::shared_ptr<Element>>::iterator i = elements_.begin();
       i != elements_.end(); ++i)
   {
     Element& e = *i->second;
     try
     {
-      e.direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype);
+      e.prepare_direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype, cells);
     }
     catch (Core::Exception& err)
     {
@@ -1523,7 +1531,7 @@ void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGauss
     Element& e = *i->second;
     try
     {
-      e.direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype);
+      e.prepare_direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype, cells);
     }
     catch (Core::Exception& err)
     {
@@ -1531,6 +1539,45 @@ void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGauss
       throw;
     }
   }
+
+  // no exception of any type must leave the parallel region, failed volumecells are only marked
+  // here
+  std::vector<char> failed(cells.size(), 0);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, cells.size()),
+      [&](const int i)
+      {
+        try
+        {
+          cells[i]->compute_direct_divergence_gauss_rule(cells[i]->parent_element(), *this);
+        }
+        catch (...)
+        {
+          failed[i] = 1;
+        }
+      });
+  Kokkos::DefaultHostExecutionSpace().fence();
+
+  for (std::size_t i = 0; i < cells.size(); ++i)
+  {
+    VolumeCell* cell = cells[i];
+    Element* e = cell->parent_element();
+    try
+    {
+      // repeat failed Gauss rule computation sequentially to throw the error of the first
+      // failed volumecell
+      if (failed[i]) cell->compute_direct_divergence_gauss_rule(e, *this);
+
+      // generate boundary cells -- when using tessellation this is automatically done
+      cell->generate_boundary_cells(*this, cell->position(), e, 0, Bcellgausstype);
+    }
+    catch (Core::Exception& err)
+    {
+      debug_dump(e, __FILE__, __LINE__);
+      throw;
+    }
+  }
 }
 
 
@@ -108,6 +108,21 @@
 // whether we run on double + (soemtimes) cln or double + (always) cln
 #define DOUBLE_PLUS_CLN_COMPUTE true
 
+// basic tolerance for the computations on double-double precision, which are tried before
+// switching from double to cln
+#define DOUBLE_DOUBLE_BASICTOL 1e-30
+
+// tolerance for the Newton schemes on double-double precision (similarly as for double)
+#define DOUBLE_DOUBLE_LINSOLVETOL (DOUBLE_DOUBLE_BASICTOL / sqrt(3) * 10.0)
+
+// limiting error, until which the result on double-double precision is accepted (otherwise cln
+// is used)
+#define DOUBLE_DOUBLE_LIMIT_ERROR CLN_LIMIT_ERROR
+
+// whether the number of computations finished on double, double-double and cln precision is
+// collected and printed at the end of the run
+#define CUT_KERNEL_STATISTICS false
+
 // global tolerance for detecting sides near the point in the cut_kernel
 #define SIDE_DETECTION_TOLERANCE 1e-14
 
@@ -1482,6 +1482,21 @@ is identified which will be used to find the modified integral in fluid integrat
 *----------------------------------------------------------------------------------------------------------------*/
 void Cut::VolumeCell::direct_divergence_gauss_rule(
     Element* elem, Mesh& mesh, bool include_inner, Cut::BCellGaussPts BCellgausstype)
+{
+  if (not prepare_direct_divergence_gauss_rule(elem, mesh, include_inner, BCellgausstype)) return;
+
+  compute_direct_divergence_gauss_rule(elem, mesh);
+
+  // generate boundary cells -- when using tessellation this is automatically done
+  generate_boundary_cells(mesh, position(), elem, 0, BCellgausstype);
+}
+
+/*----------------------------------------------------------------------------------------------------*
+ * Do everything that modifies points, facets or sides shared with other volumecells before the
+ * Gauss rule is computed. Returns false if no Gauss rule is needed for this volumecell
+ *----------------------------------------------------------------------------------------------------*/
+bool Cut::VolumeCell::prepare_direct_divergence_gauss_rule(
+    Element* elem, Mesh& mesh, bool include_inner, Cut::BCellGaussPts BCellgausstype)
 {
   if (elem->shape() != Core::FE::CellType::hex8 && elem->shape() != Core::FE::CellType::hex20)
     FOUR_C_THROW("direct_divergence_gauss_rule: Just hex8 and hex20 available yet in DD!");
@@ -1504,14 +1519,31 @@ void Cut::VolumeCell::direct_divergence_gauss_rule(
 
   // if the volumecell is inside and includeinner is false, no need to compute the Gaussian points
   // as this vc will never be computed in xfem algorithm
-  if (position() == Point::inside and include_inner == false) return;
+  if (position() == Point::inside and include_inner == false) return false;
 
   // If the Volume Cell consists of less than 4 facets, it can't span a volume in 3D.
   if (facets().size() < 4)
     FOUR_C_THROW(
         "If the Volume Cell consists of less than 4 facets, it can't span a volume in 3D?");
-  // return;
 
+  // check planarity of all facets once, non-planar facets are triangulated here. Afterwards the
+  // planarity is stored in the facets and the Gauss rule computation does not modify them anymore
+  for (plain_facet_set::const_iterator i = facets_.begin(); i != facets_.end(); ++i)
+  {
+    Facet* fe = *i;
+    fe->is_planar(mesh, fe->corner_points());
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------*
+ * Compute the Gauss rule of this volumecell by applying the divergence theorem. Only this
+ * volumecell is modified, hence this can be called concurrently for different volumecells after
+ * prepare_direct_divergence_gauss_rule()
+ *----------------------------------------------------------------------------------------------------*/
+void Cut::VolumeCell::compute_direct_divergence_gauss_rule(Element* elem, Mesh& mesh)
+{
   is_negligible_small_ = false;
 
 
@@ -1551,8 +1583,6 @@ void Cut::VolumeCell::direct_divergence_gauss_rule(
     project_gauss_points_to_local_coordinates();
 #endif
   }
-  // generate boundary cells -- when using tessellation this is automatically done
-  generate_boundary_cells(mesh, position(), elem, 0, BCellgausstype);
 }
 
 /*----------------------------------------------------------------------------------------------------*
@@ -94,6 +94,19 @@ namespace Cut
     void direct_divergence_gauss_rule(Element* elem, Mesh& mesh, bool include_inner,
         Cut::BCellGaussPts BCellgausstype = Cut::BCellGaussPts_Tessellation);
 
+    /*!
+    \brief Prepare the direct divergence quadrature rule by doing all modifications of shared
+    facets. Returns false if no quadrature rule is needed for this volumecell
+     */
+    bool prepare_direct_divergence_gauss_rule(Element* elem, Mesh& mesh, bool include_inner,
+        Cut::BCellGaussPts BCellgausstype = Cut::BCellGaussPts_Tessellation);
+
+    /*!
+    \brief Compute the direct divergence quadrature rule of a prepared volumecell. Only this
+    volumecell is modified, such that volumecells can be treated concurrently
+     */
+    void compute_direct_divergence_gauss_rule(Element* elem, Mesh& mesh);
+
     /*!
     \brief Project the integration rule generated w.r to the global coordinates of the element to
     its local coordinate system
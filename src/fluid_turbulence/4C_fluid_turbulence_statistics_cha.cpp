@@ -21,10 +21,46 @@
 #include "4C_scatra_ele_action.hpp"
 #include "4C_utils_parameter_list.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 FOUR_C_NAMESPACE_OPEN
 
 #define NODETOL 1e-9
 
+namespace
+{
+  //! processor-local part of the dot product of two vectors with identical maps
+  double local_dot(const Core::LinAlg::Vector<double>& a, const Core::LinAlg::Vector<double>& b)
+  {
+    double dot = 0.0;
+    for (int rr = 0; rr < a.MyLength(); ++rr) dot += a[rr] * b[rr];
+    return dot;
+  }
+
+  //! pack in-plane sums and number of processed elements into one buffer
+  std::vector<double> pack_plane_sums(
+      const std::vector<std::shared_ptr<std::vector<double>>>& sums, const int numprocessedeles)
+  {
+    std::vector<double> buffer;
+    for (const auto& sum : sums) buffer.insert(buffer.end(), sum->begin(), sum->end());
+    buffer.push_back(numprocessedeles);
+    return buffer;
+  }
+
+  //! unpack in-plane sums from buffer and return number of processed elements
+  int unpack_plane_sums(
+      const double* buffer, const std::vector<std::shared_ptr<std::vector<double>>>& sums)
+  {
+    for (const auto& sum : sums)
+    {
+      std::copy(buffer, buffer + sum->size(), sum->begin());
+      buffer += sum->size();
+    }
+    return static_cast<int>(std::lround(*buffer));
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------
 
                   Standard Constructor (public)
@@ -49,7 +85,8 @@ FLD::TurbulenceStatisticsCha::TurbulenceStatisticsCha(
       shc_(1.0),
       scnum_(1.0),
       myxwall_(xwallobj),
-      numsubdivisions_(params_.sublist("TURBULENCE MODEL").get<int>("CHA_NUMSUBDIVISIONS"))
+      numsubdivisions_(params_.sublist("TURBULENCE MODEL").get<int>("CHA_NUMSUBDIVISIONS")),
+      deferredsum_(actdis->get_comm())
 {
   //----------------------------------------------------------------------
   // plausibility check
@@ -1427,49 +1464,29 @@ void FLD::TurbulenceStatisticsCha::do_time_sample(
         }
       }
 
-      // compute forces by dot product
-      double inc = 0.0;
-      {
-        double local_inc = 0.0;
-        for (int rr = 0; rr < (*toggleu_).MyLength(); ++rr)
-        {
-          local_inc += (*toggleu_)[rr] * (*toggleu_)[rr];
-        }
-        Core::Communication::sum_all(&local_inc, &inc, 1, discret_->get_comm());
-
-        if (abs(inc) < 1e-9)
-        {
-          FOUR_C_THROW("there are no forced nodes on the boundary\n");
-        }
-
-        local_inc = 0.0;
-        for (int rr = 0; rr < force.MyLength(); ++rr)
-        {
-          local_inc += (force)[rr] * (*toggleu_)[rr];
-        }
-        Core::Communication::sum_all(&local_inc, &inc, 1, discret_->get_comm());
-        sumforceu_ += inc;
-
-        local_inc = 0.0;
-        for (int rr = 0; rr < force.MyLength(); ++rr)
-        {
-          local_inc += (force)[rr] * (*togglev_)[rr];
-        }
-        Core::Communication::sum_all(&local_inc, &inc, 1, discret_->get_comm());
-        sumforcev_ += inc;
-
+      // compute forces by dot product (added to the deferred summation of this sample)
+      deferredsum_.add({local_dot(*toggleu_, *toggleu_), local_dot(force, *toggleu_),
+                           local_dot(force, *togglev_), local_dot(force, *togglew_)},
+          [this](const double* inc)
+          {
+            if (abs(inc[0]) < 1e-9)
+            {
+              FOUR_C_THROW("there are no forced nodes on the boundary\n");
+            }
 
-        local_inc = 0.0;
-        for (int rr = 0; rr < force.MyLength(); ++rr)
-        {
-          local_inc += (force)[rr] * (*togglew_)[rr];
-        }
-        Core::Communication::sum_all(&local_inc, &inc, 1, discret_->get_comm());
-        sumforcew_ += inc;
-      }
+            sumforceu_ += inc[1];
+            sumforcev_ += inc[2];
+            sumforcew_ += inc[3];
+          });
     }
   }
 
+  //----------------------------------------------------------------------
+  // start summation of all quantities of this sample over all processors
+  // (completed before the next sample is taken or the statistics are written)
+
+  deferredsum_.start();
+
   //----------------------------------------------------------------------
   // add increment of last iteration to the sum of Cs values
   // (statistics for dynamic Smagorinsky model)
@@ -1560,18 +1577,15 @@ void FLD::TurbulenceStatisticsCha::do_loma_time_sample(const Core::LinAlg::Vecto
         }
       }
 
-      double inc = 0.0;
-      force.Dot(*toggleu_, &inc);
-      sumforcebu_ += inc;
-      inc = 0.0;
-      force.Dot(*togglev_, &inc);
-      sumforcebv_ += inc;
-      inc = 0.0;
-      force.Dot(*togglew_, &inc);
-      sumforcebw_ += inc;
-      inc = 0.0;
-      force.Dot(*togglep_, &inc);
-      sumqwb_ += inc;
+      deferredsum_.add({local_dot(force, *toggleu_), local_dot(force, *togglev_),
+                           local_dot(force, *togglew_), local_dot(force, *togglep_)},
+          [this](const double* inc)
+          {
+            sumforcebu_ += inc[0];
+            sumforcebv_ += inc[1];
+            sumforcebw_ += inc[2];
+            sumqwb_ += inc[3];
+          });
     }
 
     // only true for top plane
@@ -1613,21 +1627,24 @@ void FLD::TurbulenceStatisticsCha::do_loma_time_sample(const Core::LinAlg::Vecto
         }
       }
 
-      double inc = 0.0;
-      force.Dot(*toggleu_, &inc);
-      sumforcetu_ += inc;
-      inc = 0.0;
-      force.Dot(*togglev_, &inc);
-      sumforcetv_ += inc;
-      inc = 0.0;
-      force.Dot(*togglew_, &inc);
-      sumforcetw_ += inc;
-      inc = 0.0;
-      force.Dot(*togglep_, &inc);
-      sumqwt_ += inc;
+      deferredsum_.add({local_dot(force, *toggleu_), local_dot(force, *togglev_),
+                           local_dot(force, *togglew_), local_dot(force, *togglep_)},
+          [this](const double* inc)
+          {
+            sumforcetu_ += inc[0];
+            sumforcetv_ += inc[1];
+            sumforcetw_ += inc[2];
+            sumqwt_ += inc[3];
+          });
     }
   }
 
+  //----------------------------------------------------------------------
+  // start summation of all quantities of this sample over all processors
+  // (completed before the next sample is taken or the statistics are written)
+
+  deferredsum_.start();
+
   //----------------------------------------------------------------------
   // add increment of last iteration to the sum of Cs values
   // (statistics for dynamic Smagorinsky model)
@@ -1718,18 +1735,15 @@ void FLD::TurbulenceStatisticsCha::do_scatra_time_sample(const Core::LinAlg::Vec
         }
       }
 
-      double inc = 0.0;
-      force.Dot(*toggleu_, &inc);
-      sumforcebu_ += inc;
-      inc = 0.0;
-      force.Dot(*togglev_, &inc);
-      sumforcebv_ += inc;
-      inc = 0.0;
-      force.Dot(*togglew_, &inc);
-      sumforcebw_ += inc;
-      inc = 0.0;
-      force.Dot(*togglep_, &inc);
-      sumqwb_ += inc;
+      deferredsum_.add({local_dot(force, *toggleu_), local_dot(force, *togglev_),
+                           local_dot(force, *togglew_), local_dot(force, *togglep_)},
+          [this](const double* inc)
+          {
+            sumforcebu_ += inc[0];
+            sumforcebv_ += inc[1];
+            sumforcebw_ += inc[2];
+            sumqwb_ += inc[3];
+          });
     }
 
     // only true for top plane
@@ -1771,21 +1785,24 @@ void FLD::TurbulenceStatisticsCha::do_scatra_time_sample(const Core::LinAlg::Vec
         }
       }
 
-      double inc = 0.0;
-      force.Dot(*toggleu_, &inc);
-      sumforcetu_ += inc;
-      inc = 0.0;
-      force.Dot(*togglev_, &inc);
-      sumforcetv_ += inc;
-      inc = 0.0;
-      force.Dot(*togglew_, &inc);
-      sumforcetw_ += inc;
-      inc = 0.0;
-      force.Dot(*togglep_, &inc);
-      sumqwt_ += inc;
+      deferredsum_.add({local_dot(force, *toggleu_), local_dot(force, *togglev_),
+                           local_dot(force, *togglew_), local_dot(force, *togglep_)},
+          [this](const double* inc)
+          {
+            sumforcetu_ += inc[0];
+            sumforcetv_ += inc[1];
+            sumforcetw_ += inc[2];
+            sumqwt_ += inc[3];
+          });
     }
   }
 
+  //----------------------------------------------------------------------
+  // start summation of all quantities of this sample over all processors
+  // (completed before the next sample is taken or the statistics are written)
+
+  deferredsum_.start();
+
   //----------------------------------------------------------------------
   // add increment of last iteration to the sum of Cs values
   // (statistics for dynamic Smagorinsky model)
@@ -1961,59 +1978,57 @@ void FLD::TurbulenceStatisticsCha::evaluate_integral_mean_values_in_planes()
 
   //----------------------------------------------------------------------
   // add contributions from all processors
-  Core::Communication::sum_all(locarea->data(), globarea->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumu->data(), globsumu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumv->data(), globsumv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumw->data(), globsumw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsump->data(), globsump->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumsqu->data(), globsumsqu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqv->data(), globsumsqv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqw->data(), globsumsqw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuv->data(), globsumuv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuw->data(), globsumuw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumvw->data(), globsumvw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqp->data(), globsumsqp->data(), size, discret_->get_comm());
-
-
-  //----------------------------------------------------------------------
-  // the sums are divided by the layers area to get the area average
+  //
+  // all sums are reduced in one deferred, non-blocking summation, which is completed before the
+  // next sample is taken or the statistics are written
+  const std::vector<std::shared_ptr<std::vector<double>>> locsums = {locarea, locsumu, locsumv,
+      locsumw, locsump, locsumsqu, locsumsqv, locsumsqw, locsumuv, locsumuw, locsumvw, locsumsqp};
+  const std::vector<std::shared_ptr<std::vector<double>>> globsums = {globarea, globsumu, globsumv,
+      globsumw, globsump, globsumsqu, globsumsqv, globsumsqw, globsumuv, globsumuw, globsumvw,
+      globsumsqp};
+
+  deferredsum_.add(pack_plane_sums(locsums, locprocessedeles),
+      [=, this](const double* sums)
+      {
+        const int globprocessedeles = unpack_plane_sums(sums, globsums);
 
-  Core::FE::Nurbs::NurbsDiscretization* nurbsdis =
-      dynamic_cast<Core::FE::Nurbs::NurbsDiscretization*>(&(*discret_));
+        //----------------------------------------------------------------------
+        // the sums are divided by the layers area to get the area average
 
-  if (nurbsdis == nullptr)
-  {
-    Core::Communication::sum_all(&locprocessedeles, &numele_, 1, discret_->get_comm());
-  }
-  else
-  {
-    // get nurbs dis' element numbers
-    std::vector<int> nele_x_mele_x_lele(nurbsdis->return_nele_x_mele_x_lele(0));
+        Core::FE::Nurbs::NurbsDiscretization* nurbsdis =
+            dynamic_cast<Core::FE::Nurbs::NurbsDiscretization*>(&(*discret_));
 
-    numele_ = nele_x_mele_x_lele[0] * nele_x_mele_x_lele[2];
-  }
+        if (nurbsdis == nullptr)
+        {
+          numele_ = globprocessedeles;
+        }
+        else
+        {
+          // get nurbs dis' element numbers
+          std::vector<int> nele_x_mele_x_lele(nurbsdis->return_nele_x_mele_x_lele(0));
 
+          numele_ = nele_x_mele_x_lele[0] * nele_x_mele_x_lele[2];
+        }
 
-  for (unsigned i = 0; i < planecoordinates_->size(); ++i)
-  {
-    // get average element size
-    (*globarea)[i] /= numele_;
-
-    (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
-    (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
-    (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
-    (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
-
-    (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
-    (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
-    (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
-    (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
-    (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
-    (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
-    (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
-  }
+        for (unsigned i = 0; i < planecoordinates_->size(); ++i)
+        {
+          // get average element size
+          (*globarea)[i] /= numele_;
+
+          (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
+          (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
+          (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
+          (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
+
+          (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
+          (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
+          (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
+          (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
+          (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
+          (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
+          (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
+        }
+      });
 
   return;
 
@@ -2191,67 +2206,56 @@ void FLD::TurbulenceStatisticsCha::evaluate_loma_integral_mean_values_in_planes(
 
   //----------------------------------------------------------------------
   // add contributions from all processors
-  Core::Communication::sum_all(locarea->data(), globarea->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumu->data(), globsumu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumv->data(), globsumv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumw->data(), globsumw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsump->data(), globsump->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumrho->data(), globsumrho->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumT->data(), globsumT->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumrhou->data(), globsumrhou->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(
-      locsumrhouT->data(), globsumrhouT->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumsqu->data(), globsumsqu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqv->data(), globsumsqv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqw->data(), globsumsqw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqp->data(), globsumsqp->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(
-      locsumsqrho->data(), globsumsqrho->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqT->data(), globsumsqT->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumuv->data(), globsumuv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuw->data(), globsumuw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumvw->data(), globsumvw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuT->data(), globsumuT->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumvT->data(), globsumvT->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumwT->data(), globsumwT->data(), size, discret_->get_comm());
-
-
-  //----------------------------------------------------------------------
-  // the sums are divided by the layers area to get the area average
-  Core::Communication::sum_all(&locprocessedeles, &numele_, 1, discret_->get_comm());
+  //
+  // all sums are reduced in one deferred, non-blocking summation, which is completed before the
+  // next sample is taken or the statistics are written
+  const std::vector<std::shared_ptr<std::vector<double>>> locsums = {locarea, locsumu, locsumv,
+      locsumw, locsump, locsumrho, locsumT, locsumrhou, locsumrhouT, locsumsqu, locsumsqv,
+      locsumsqw, locsumsqp, locsumsqrho, locsumsqT, locsumuv, locsumuw, locsumvw, locsumuT,
+      locsumvT, locsumwT};
+  const std::vector<std::shared_ptr<std::vector<double>>> globsums = {globarea, globsumu, globsumv,
+      globsumw, globsump, globsumrho, globsumT, globsumrhou, globsumrhouT, globsumsqu, globsumsqv,
+      globsumsqw, globsumsqp, globsumsqrho, globsumsqT, globsumuv, globsumuw, globsumvw, globsumuT,
+      globsumvT, globsumwT};
+
+  deferredsum_.add(pack_plane_sums(locsums, locprocessedeles),
+      [=, this](const double* sums)
+      {
+        const int globprocessedeles = unpack_plane_sums(sums, globsums);
 
+        //----------------------------------------------------------------------
+        // the sums are divided by the layers area to get the area average
+        numele_ = globprocessedeles;
 
-  for (unsigned i = 0; i < planecoordinates_->size(); ++i)
-  {
-    // get average element size
-    (*globarea)[i] /= numele_;
-
-    (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
-    (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
-    (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
-    (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
-    (*sumrho_)[i] += (*globsumrho)[i] / (*globarea)[i];
-    (*sum_t_)[i] += (*globsumT)[i] / (*globarea)[i];
-    (*sumrhou_)[i] += (*globsumrhou)[i] / (*globarea)[i];
-    (*sumrhou_t_)[i] += (*globsumrhouT)[i] / (*globarea)[i];
-
-    (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
-    (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
-    (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
-    (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
-    (*sumsqrho_)[i] += (*globsumsqrho)[i] / (*globarea)[i];
-    (*sumsq_t_)[i] += (*globsumsqT)[i] / (*globarea)[i];
-
-    (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
-    (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
-    (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
-    (*sumu_t_)[i] += (*globsumuT)[i] / (*globarea)[i];
-    (*sumv_t_)[i] += (*globsumvT)[i] / (*globarea)[i];
-    (*sumw_t_)[i] += (*globsumwT)[i] / (*globarea)[i];
-  }
+        for (unsigned i = 0; i < planecoordinates_->size(); ++i)
+        {
+          // get average element size
+          (*globarea)[i] /= numele_;
+
+          (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
+          (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
+          (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
+          (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
+          (*sumrho_)[i] += (*globsumrho)[i] / (*globarea)[i];
+          (*sum_t_)[i] += (*globsumT)[i] / (*globarea)[i];
+          (*sumrhou_)[i] += (*globsumrhou)[i] / (*globarea)[i];
+          (*sumrhou_t_)[i] += (*globsumrhouT)[i] / (*globarea)[i];
+
+          (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
+          (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
+          (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
+          (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
+          (*sumsqrho_)[i] += (*globsumsqrho)[i] / (*globarea)[i];
+          (*sumsq_t_)[i] += (*globsumsqT)[i] / (*globarea)[i];
+
+          (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
+          (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
+          (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
+          (*sumu_t_)[i] += (*globsumuT)[i] / (*globarea)[i];
+          (*sumv_t_)[i] += (*globsumvT)[i] / (*globarea)[i];
+          (*sumw_t_)[i] += (*globsumwT)[i] / (*globarea)[i];
+        }
+      });
 
   return;
 
@@ -2407,61 +2411,53 @@ void FLD::TurbulenceStatisticsCha::evaluate_scatra_integral_mean_values_in_plane
 
   //----------------------------------------------------------------------
   // add contributions from all processors
-  Core::Communication::sum_all(locarea->data(), globarea->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumu->data(), globsumu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumv->data(), globsumv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumw->data(), globsumw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsump->data(), globsump->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumphi->data(), globsumphi->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumsqu->data(), globsumsqu->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqv->data(), globsumsqv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqw->data(), globsumsqw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumsqp->data(), globsumsqp->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(
-      locsumsqphi->data(), globsumsqphi->data(), size, discret_->get_comm());
-
-  Core::Communication::sum_all(locsumuv->data(), globsumuv->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuw->data(), globsumuw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumvw->data(), globsumvw->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumuphi->data(), globsumuphi->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumvphi->data(), globsumvphi->data(), size, discret_->get_comm());
-  Core::Communication::sum_all(locsumwphi->data(), globsumwphi->data(), size, discret_->get_comm());
-
-
-  //----------------------------------------------------------------------
-  // the sums are divided by the layers area to get the area average
-  Core::Communication::sum_all(&locprocessedeles, &numele_, 1, discret_->get_comm());
+  //
+  // all sums are reduced in one deferred, non-blocking summation, which is completed before the
+  // next sample is taken or the statistics are written
+  const std::vector<std::shared_ptr<std::vector<double>>> locsums = {locarea, locsumu, locsumv,
+      locsumw, locsump, locsumphi, locsumsqu, locsumsqv, locsumsqw, locsumsqp, locsumsqphi,
+      locsumuv, locsumuw, locsumvw, locsumuphi, locsumvphi, locsumwphi};
+  const std::vector<std::shared_ptr<std::vector<double>>> globsums = {globarea, globsumu, globsumv,
+      globsumw, globsump, globsumphi, globsumsqu, globsumsqv, globsumsqw, globsumsqp, globsumsqphi,
+      globsumuv, globsumuw, globsumvw, globsumuphi, globsumvphi, globsumwphi};
+
+  deferredsum_.add(pack_plane_sums(locsums, locprocessedeles),
+      [=, this](const double* sums)
+      {
+        const int globprocessedeles = unpack_plane_sums(sums, globsums);
 
+        //----------------------------------------------------------------------
+        // the sums are divided by the layers area to get the area average
+        numele_ = globprocessedeles;
 
-  for (unsigned i = 0; i < planecoordinates_->size(); ++i)
-  {
-    // get average element size
-    (*globarea)[i] /= numele_;
-
-    // renmark:
-    // scalar values named phi are stored in values named T (which are
-    // taken form the loma case)
-    (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
-    (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
-    (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
-    (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
-    (*sum_t_)[i] += (*globsumphi)[i] / (*globarea)[i];
-
-    (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
-    (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
-    (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
-    (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
-    (*sumsq_t_)[i] += (*globsumsqphi)[i] / (*globarea)[i];
-
-    (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
-    (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
-    (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
-    (*sumu_t_)[i] += (*globsumuphi)[i] / (*globarea)[i];
-    (*sumv_t_)[i] += (*globsumvphi)[i] / (*globarea)[i];
-    (*sumw_t_)[i] += (*globsumwphi)[i] / (*globarea)[i];
-  }
+        for (unsigned i = 0; i < planecoordinates_->size(); ++i)
+        {
+          // get average element size
+          (*globarea)[i] /= numele_;
+
+          // renmark:
+          // scalar values named phi are stored in values named T (which are
+          // taken form the loma case)
+          (*sumu_)[i] += (*globsumu)[i] / (*globarea)[i];
+          (*sumv_)[i] += (*globsumv)[i] / (*globarea)[i];
+          (*sumw_)[i] += (*globsumw)[i] / (*globarea)[i];
+          (*sump_)[i] += (*globsump)[i] / (*globarea)[i];
+          (*sum_t_)[i] += (*globsumphi)[i] / (*globarea)[i];
+
+          (*sumsqu_)[i] += (*globsumsqu)[i] / (*globarea)[i];
+          (*sumsqv_)[i] += (*globsumsqv)[i] / (*globarea)[i];
+          (*sumsqw_)[i] += (*globsumsqw)[i] / (*globarea)[i];
+          (*sumsqp_)[i] += (*globsumsqp)[i] / (*globarea)[i];
+          (*sumsq_t_)[i] += (*globsumsqphi)[i] / (*globarea)[i];
+
+          (*sumuv_)[i] += (*globsumuv)[i] / (*globarea)[i];
+          (*sumuw_)[i] += (*globsumuw)[i] / (*globarea)[i];
+          (*sumvw_)[i] += (*globsumvw)[i] / (*globarea)[i];
+          (*sumu_t_)[i] += (*globsumuphi)[i] / (*globarea)[i];
+          (*sumv_t_)[i] += (*globsumvphi)[i] / (*globarea)[i];
+          (*sumw_t_)[i] += (*globsumwphi)[i] / (*globarea)[i];
+        }
+      });
 
   return;
 
@@ -3777,6 +3773,9 @@ void FLD::TurbulenceStatisticsCha::evaluate_residuals(
   ----------------------------------------------------------------------*/
 void FLD::TurbulenceStatisticsCha::time_average_means_and_output_of_statistics(const int step)
 {
+  // complete summation of last sample over all processors
+  deferredsum_.complete();
+
   if (numsamp_ == 0)
   {
     FOUR_C_THROW("No samples to do time average");
@@ -4280,6 +4279,9 @@ void FLD::TurbulenceStatisticsCha::time_average_means_and_output_of_statistics(c
   ----------------------------------------------------------------------*/
 void FLD::TurbulenceStatisticsCha::dump_statistics(const int step)
 {
+  // complete summation of last sample over all processors
+  deferredsum_.complete();
+
   if (numsamp_ == 0)
   {
     FOUR_C_THROW("No samples to do time average");
@@ -4661,6 +4663,9 @@ void FLD::TurbulenceStatisticsCha::dump_statistics(const int step)
  -----------------------------------------------------------------------*/
 void FLD::TurbulenceStatisticsCha::dump_loma_statistics(const int step)
 {
+  // complete summation of last sample over all processors
+  deferredsum_.complete();
+
   if (numsamp_ == 0) FOUR_C_THROW("No samples to do time average");
 
   //----------------------------------------------------------------------
@@ -5156,6 +5161,9 @@ void FLD::TurbulenceStatisticsCha::dump_loma_statistics(const int step)
  -----------------------------------------------------------------------*/
 void FLD::TurbulenceStatisticsCha::dump_scatra_statistics(const int step)
 {
+  // complete summation of last sample over all processors
+  deferredsum_.complete();
+
   if (numsamp_ == 0) FOUR_C_THROW("No samples to do time average");
 
   //----------------------------------------------------------------------
@@ -5695,6 +5703,9 @@ void FLD::TurbulenceStatisticsCha::dump_scatra_statistics(const int step)
   ----------------------------------------------------------------------*/
 void FLD::TurbulenceStatisticsCha::clear_statistics()
 {
+  // complete summation of last sample before the sums are reset
+  deferredsum_.complete();
+
   // reset the number of samples
   numsamp_ = 0;
 
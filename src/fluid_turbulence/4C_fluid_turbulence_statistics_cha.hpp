@@ -14,6 +14,7 @@
 #include "4C_fem_general_utils_nurbs_shapefunctions.hpp"
 #include "4C_fem_nurbs_discretization.hpp"
 #include "4C_fem_nurbs_discretization_control_point.hpp"
+#include "4C_fluid_turbulence_statistics_deferred_sum.hpp"
 #include "4C_inpar_fluid.hpp"
 #include "4C_inpar_scatra.hpp"
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
@@ -657,6 +658,9 @@ namespace FLD
 
     //! number of sampling planes inside the element
     const int numsubdivisions_;
+
+    //! deferred summation of the in-plane sums and wall forces of the last sample
+    TurbulenceStatisticsDeferredSum deferredsum_;
   };
 
 }  // namespace FLD
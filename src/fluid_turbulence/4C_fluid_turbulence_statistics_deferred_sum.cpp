@@ -0,0 +1,69 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fluid_turbulence_statistics_deferred_sum.hpp"
+
+FOUR_C_NAMESPACE_OPEN
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+FLD::TurbulenceStatisticsDeferredSum::~TurbulenceStatisticsDeferredSum()
+{
+  // an outstanding request must not survive the buffers it refers to
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (started_ and not finalized) MPI_Wait(&request_, MPI_STATUS_IGNORE);
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void FLD::TurbulenceStatisticsDeferredSum::add(
+    const std::vector<double>& localvalues, Completion completion)
+{
+  if (started_) complete();
+
+  completions_.emplace_back(localsums_.size(), std::move(completion));
+  localsums_.insert(localsums_.end(), localvalues.begin(), localvalues.end());
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void FLD::TurbulenceStatisticsDeferredSum::start()
+{
+  if (started_ or completions_.empty()) return;
+
+  globalsums_.assign(localsums_.size(), 0.0);
+  MPI_Iallreduce(localsums_.data(), globalsums_.data(), static_cast<int>(localsums_.size()),
+      MPI_DOUBLE, MPI_SUM, comm_, &request_);
+
+  started_ = true;
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void FLD::TurbulenceStatisticsDeferredSum::complete()
+{
+  if (completions_.empty()) return;
+
+  // values added but not yet sent are summed now
+  start();
+  MPI_Wait(&request_, MPI_STATUS_IGNORE);
+  started_ = false;
+
+  // the completion functions may add values to the next summation
+  std::vector<std::pair<std::size_t, Completion>> completions;
+  completions.swap(completions_);
+  localsums_.clear();
+
+  for (const auto& [offset, completion] : completions) completion(&globalsums_[offset]);
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,90 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FLUID_TURBULENCE_STATISTICS_DEFERRED_SUM_HPP
+#define FOUR_C_FLUID_TURBULENCE_STATISTICS_DEFERRED_SUM_HPP
+
+#include "4C_config.hpp"
+
+#include <mpi.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+
+namespace FLD
+{
+  /*!
+  \brief Deferred summation of sampled statistics over all processors
+
+  The processor-local accumulators of a sample are collected in a single buffer, which is
+  summed over all processors by one non-blocking MPI_Iallreduce instead of a sequence of
+  blocking reductions. The summation is completed lazily, i.e., before new values are added or
+  when the statistics are needed (next sample, output, reset). Thus, the communication overlaps
+  with the computations of the following time steps.
+
+  On completion, the function given with the local values is called with the corresponding
+  global sums.
+
+  */
+  class TurbulenceStatisticsDeferredSum
+  {
+   public:
+    //! function called with global sums on completion of summation
+    using Completion = std::function<void(const double* globalsums)>;
+
+    explicit TurbulenceStatisticsDeferredSum(MPI_Comm comm) : comm_(comm) {}
+
+    //! wait for a pending summation without calling the completion functions
+    ~TurbulenceStatisticsDeferredSum();
+
+    TurbulenceStatisticsDeferredSum(const TurbulenceStatisticsDeferredSum&) = delete;
+    TurbulenceStatisticsDeferredSum& operator=(const TurbulenceStatisticsDeferredSum&) = delete;
+
+    /*!
+    \brief Add local values to the next summation
+
+    A pending summation is completed first. The completion function is called with a pointer to
+    the global sums of the given values (in the same order).
+
+    */
+    void add(const std::vector<double>& localvalues, Completion completion);
+
+    //! start the non-blocking summation of all added values
+    void start();
+
+    //! complete the summation (if any) and call the completion functions
+    void complete();
+
+   private:
+    //! communicator
+    MPI_Comm comm_;
+
+    //! processor-local values of all quantities added since last completion
+    std::vector<double> localsums_;
+
+    //! global sums (valid after completion)
+    std::vector<double> globalsums_;
+
+    //! offsets into the buffer and functions to be called on completion
+    std::vector<std::pair<std::size_t, Completion>> completions_;
+
+    //! request of pending summation
+    MPI_Request request_ = MPI_REQUEST_NULL;
+
+    //! flag indicating a started summation
+    bool started_ = false;
+  };
+
+}  // namespace FLD
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
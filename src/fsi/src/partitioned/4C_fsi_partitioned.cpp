@@ -20,6 +20,7 @@
 #include "4C_fsi_debugwriter.hpp"
 #include "4C_fsi_nox_aitken.hpp"
 #include "4C_fsi_nox_fixpoint.hpp"
+#include "4C_fsi_nox_iqn.hpp"
 #include "4C_fsi_nox_jacobian.hpp"
 #include "4C_fsi_nox_linearsystem_gcr.hpp"
 #include "4C_fsi_nox_mpe.hpp"
@@ -338,6 +339,37 @@ void FSI::Partitioned::set_default_parameters(
       lineSearchParams.sublist("Full Step").set("Full Step", 1.0);
       break;
     }
+    case fsi_iter_stagg_IQN_ILS:
+    case fsi_iter_stagg_IQN_IMVJ:
+    {
+      // interface quasi-Newton
+      const bool imvj = Teuchos::getIntegralValue<FsiCoupling>(fsidyn, "COUPALGO") ==
+                        fsi_iter_stagg_IQN_IMVJ;
+      if (imvj)
+        set_method("ITERATIVE STAGGERED SCHEME WITH INTERFACE QUASI-NEWTON (IQN-IMVJ)");
+      else
+        set_method("ITERATIVE STAGGERED SCHEME WITH INTERFACE QUASI-NEWTON (IQN-ILS)");
+
+      nlParams.set("Jacobian", "None");
+      dirParams.set("Method", "User Defined");
+
+      // the factory keeps the direction and thus its history over the time steps
+      Teuchos::RCP<::NOX::Direction::UserDefinedFactory> factory =
+          Teuchos::make_rcp<NOX::FSI::InterfaceQuasiNewtonFactory>();
+      dirParams.set("User Defined Direction Factory", factory);
+
+      Teuchos::ParameterList& iqnParams = dirParams.sublist("Interface Quasi-Newton");
+      iqnParams.set<std::string>("Method", imvj ? "IMVJ" : "ILS");
+      iqnParams.set("omega", fsipart.get<double>("RELAX"));
+      iqnParams.set("max columns", fsipart.get<int>("IQN_MAXCOLUMNS"));
+      iqnParams.set("reuse", fsipart.get<int>("IQN_REUSE"));
+      iqnParams.set("restart", fsipart.get<int>("IQN_IMVJ_RESTART"));
+      iqnParams.set("filter tolerance", fsipart.get<double>("IQN_FILTER"));
+
+      lineSearchParams.set("Method", "Full Step");
+      lineSearchParams.sublist("Full Step").set("Full Step", 1.0);
+      break;
+    }
     case fsi_basic_sequ_stagg:
     {
       // sequential coupling (no iteration!)
@@ -0,0 +1,272 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fsi_nox_iqn.hpp"
+
+#include <NOX_Abstract_Group.H>
+#include <NOX_Abstract_Vector.H>
+#include <NOX_GlobalData.H>
+#include <Teuchos_ParameterList.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+NOX::FSI::InterfaceQuasiNewton::InterfaceQuasiNewton(
+    const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params)
+    : utils_(utils)
+{
+  Teuchos::ParameterList& iqnparams = params.sublist("Interface Quasi-Newton");
+  imvj_ = iqnparams.get<std::string>("Method", "ILS") == "IMVJ";
+  omega_ = iqnparams.get("omega", 0.01);
+  max_columns_ = iqnparams.get("max columns", 50);
+  reuse_ = iqnparams.get("reuse", 0);
+  restart_ = iqnparams.get("restart", 0);
+  filter_tolerance_ = iqnparams.get("filter tolerance", 1e-6);
+}
+
+
+
+bool NOX::FSI::InterfaceQuasiNewton::reset(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params)
+{
+  utils_ = gd->getUtils();
+
+  // the columns of the finished time step enter the history
+  if (imvj_)
+  {
+    store_jacobian_update();
+
+    // explicit restart: start again from the relaxation step without any Jacobian
+    if (restart_ > 0 and ++num_steps_since_restart_ >= restart_)
+    {
+      jacobian_updates_.clear();
+      num_steps_since_restart_ = 0;
+    }
+  }
+  else if (reuse_ > 0 and !current_.v.empty())
+  {
+    previous_.push_front(std::move(current_));
+    while (static_cast<int>(previous_.size()) > reuse_) previous_.pop_back();
+  }
+
+  current_ = Columns();
+  r_old_ = Teuchos::null;
+  xtilde_old_ = Teuchos::null;
+
+  return true;
+}
+
+
+bool NOX::FSI::InterfaceQuasiNewton::compute(
+    ::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& grp, const ::NOX::Solver::Generic& solver)
+{
+  ::NOX::Abstract::Group::ReturnType status;
+
+  // Compute F at current solution
+  status = grp.computeF();
+  if (status != ::NOX::Abstract::Group::Ok) throw_error("compute", "Unable to compute F");
+
+  const ::NOX::Abstract::Vector& x = grp.getX();
+  const ::NOX::Abstract::Vector& r = grp.getF();
+
+  // result of the field solvers x~ = x + r
+  Teuchos::RCP<::NOX::Abstract::Vector> xtilde = x.clone();
+  xtilde->update(1.0, r, 1.0);
+
+  // new columns from the difference to the last iteration
+  if (r_old_ != Teuchos::null)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> v = r.clone();
+    v->update(-1.0, *r_old_, 1.0);
+    Teuchos::RCP<::NOX::Abstract::Vector> w = xtilde->clone();
+    w->update(-1.0, *xtilde_old_, 1.0);
+
+    current_.v.push_front(v);
+    current_.w.push_front(w);
+    while (static_cast<int>(current_.v.size()) > max_columns_)
+    {
+      current_.v.pop_back();
+      current_.w.pop_back();
+    }
+  }
+  r_old_ = r.clone();
+  xtilde_old_ = xtilde;
+
+  // collect the columns of the least-squares problem, newest first
+  std::vector<const ::NOX::Abstract::Vector*> v;
+  std::vector<const ::NOX::Abstract::Vector*> w;
+  for (std::size_t i = 0; i < current_.v.size(); ++i)
+  {
+    v.push_back(current_.v[i].get());
+    w.push_back(current_.w[i].get());
+  }
+  for (const Columns& columns : previous_)
+  {
+    for (std::size_t i = 0; i < columns.v.size(); ++i)
+    {
+      if (static_cast<int>(v.size()) >= max_columns_) break;
+      v.push_back(columns.v[i].get());
+      w.push_back(columns.w[i].get());
+    }
+  }
+
+  if (v.empty())
+  {
+    if (imvj_ and !jacobian_updates_.empty())
+    {
+      // x^{k+1} = x~^k - J_prev r^k
+      Teuchos::RCP<::NOX::Abstract::Vector> jr = r.clone(::NOX::ShapeCopy);
+      jr->init(0.0);
+      apply_previous_jacobian(r, *jr);
+      dir.update(1.0, r, -1.0, *jr, 0.0);
+    }
+    else
+    {
+      dir.update(omega_, r, 0.0);
+    }
+
+    if (utils_->isPrintType(::NOX::Utils::InnerIteration))
+      utils_->out() << "IQN:  no columns, relaxation step\n";
+
+    return true;
+  }
+
+  std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> q;
+  Core::LinAlg::SerialDenseMatrix rmat(v.size(), v.size(), true);
+  std::vector<int> kept;
+  decompose(v, q, rmat, kept);
+  const int m = kept.size();
+
+  // coefficients beta = R^{-1} Q^T r of the least-squares problem V beta = r
+  std::vector<double> beta(m);
+  for (int i = m - 1; i >= 0; --i)
+  {
+    double bi = q[i]->innerProduct(r);
+    for (int j = i + 1; j < m; ++j) bi -= rmat(i, j) * beta[j];
+    beta[i] = bi / rmat(i, i);
+  }
+
+  // x^{k+1} = x~^k - W beta
+  dir.update(1.0, r, 0.0);
+  for (int j = 0; j < m; ++j) dir.update(-beta[j], *w[kept[j]], 1.0);
+
+  if (imvj_ and !jacobian_updates_.empty())
+  {
+    // x^{k+1} = x~^k - W beta - J_prev (r^k - V beta)
+    Teuchos::RCP<::NOX::Abstract::Vector> res = r.clone();
+    for (int j = 0; j < m; ++j) res->update(-beta[j], *v[kept[j]], 1.0);
+
+    Teuchos::RCP<::NOX::Abstract::Vector> jres = r.clone(::NOX::ShapeCopy);
+    jres->init(0.0);
+    apply_previous_jacobian(*res, *jres);
+    dir.update(-1.0, *jres, 1.0);
+  }
+
+  if (utils_->isPrintType(::NOX::Utils::InnerIteration))
+  {
+    utils_->out() << (imvj_ ? "IQN-IMVJ" : "IQN-ILS") << ":  columns=" << m
+                  << "  filtered=" << v.size() - m << "\n";
+  }
+
+  return true;
+}
+
+
+bool NOX::FSI::InterfaceQuasiNewton::compute(::NOX::Abstract::Vector& dir,
+    ::NOX::Abstract::Group& group, const ::NOX::Solver::LineSearchBased& solver)
+{
+  return ::NOX::Direction::Generic::compute(dir, group, solver);
+}
+
+
+void NOX::FSI::InterfaceQuasiNewton::decompose(const std::vector<const ::NOX::Abstract::Vector*>& v,
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& q, Core::LinAlg::SerialDenseMatrix& r,
+    std::vector<int>& kept) const
+{
+  q.clear();
+  kept.clear();
+
+  // modified Gram-Schmidt
+  std::vector<double> coefficients;
+  for (std::size_t i = 0; i < v.size(); ++i)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> y = v[i]->clone();
+    const double norm0 = y->norm();
+
+    coefficients.resize(q.size());
+    for (std::size_t j = 0; j < q.size(); ++j)
+    {
+      coefficients[j] = q[j]->innerProduct(*y);
+      y->update(-coefficients[j], *q[j], 1.0);
+    }
+    const double norm = y->norm();
+
+    // filter columns that (almost) lie in the span of the newer ones
+    if (norm <= filter_tolerance_ * norm0) continue;
+
+    const int k = q.size();
+    for (int j = 0; j < k; ++j) r(j, k) = coefficients[j];
+    r(k, k) = norm;
+
+    y->scale(1.0 / norm);
+    q.push_back(y);
+    kept.push_back(i);
+  }
+}
+
+
+void NOX::FSI::InterfaceQuasiNewton::apply_previous_jacobian(
+    const ::NOX::Abstract::Vector& x, ::NOX::Abstract::Vector& y) const
+{
+  for (const JacobianUpdate& update : jacobian_updates_)
+  {
+    for (std::size_t j = 0; j < update.q.size(); ++j)
+      y.update(update.q[j]->innerProduct(x), *update.a[j], 1.0);
+  }
+}
+
+
+void NOX::FSI::InterfaceQuasiNewton::store_jacobian_update()
+{
+  if (current_.v.empty()) return;
+
+  std::vector<const ::NOX::Abstract::Vector*> v;
+  for (const auto& column : current_.v) v.push_back(column.get());
+
+  JacobianUpdate update;
+  Core::LinAlg::SerialDenseMatrix rmat(v.size(), v.size(), true);
+  std::vector<int> kept;
+  decompose(v, update.q, rmat, kept);
+
+  // (W - J_prev V) (V^T V)^{-1} V^T = A Q^T with A R = W - J_prev V
+  for (std::size_t j = 0; j < kept.size(); ++j)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> a = current_.w[kept[j]]->clone();
+    Teuchos::RCP<::NOX::Abstract::Vector> jv = a->clone(::NOX::ShapeCopy);
+    jv->init(0.0);
+    apply_previous_jacobian(*current_.v[kept[j]], *jv);
+    a->update(-1.0, *jv, 1.0);
+
+    for (std::size_t i = 0; i < j; ++i) a->update(-rmat(i, j), *update.a[i], 1.0);
+    a->scale(1.0 / rmat(j, j));
+    update.a.push_back(a);
+  }
+
+  // all updates since the last restart are kept, since the Jacobian of each time step is defined
+  // relative to the Jacobian of the previous one
+  jacobian_updates_.push_front(std::move(update));
+}
+
+
+void NOX::FSI::InterfaceQuasiNewton::throw_error(
+    const std::string& functionName, const std::string& errorMsg)
+{
+  if (utils_->isPrintType(::NOX::Utils::Error))
+    utils_->err() << "InterfaceQuasiNewton::" << functionName << " - " << errorMsg << std::endl;
+  throw "NOX Error";
+}
+
+FOUR_C_NAMESPACE_CLOSE
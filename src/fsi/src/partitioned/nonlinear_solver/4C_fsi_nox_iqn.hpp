@@ -0,0 +1,217 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FSI_NOX_IQN_HPP
+#define FOUR_C_FSI_NOX_IQN_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+
+#include <NOX_Direction_Generic.H>  // base class
+#include <NOX_Direction_UserDefinedFactory.H>
+#include <NOX_GlobalData.H>
+#include <NOX_Utils.H>
+#include <Teuchos_RCP.hpp>
+
+#include <deque>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace FSI
+  {
+    //! %Calculates the interface quasi-Newton direction.
+    /*!
+
+      Interface quasi-Newton methods approximate the inverse Jacobian of
+      the fixed-point residual r(x) = x~(x) - x of the partitioned
+      scheme by least squares from the differences of the previous
+      residuals V = [r^k - r^{k-1}, ...] and field solver results W =
+      [x~^k - x~^{k-1}, ...]. The new interface vector is
+
+        x^{k+1} = x~^k - J r^k
+
+      Two variants are available:
+
+      - "ILS" (least-squares): J = W (V^T V)^{-1} V^T. Columns of the
+        last "reuse" time steps are kept in V and W.
+
+      - "IMVJ" (multi-vector Jacobian): J = J_prev + (W - J_prev V)
+        (V^T V)^{-1} V^T, where J_prev is the Jacobian at the end of the
+        previous time step. J_prev is never built but stored as a sum
+        of low-rank updates A Q^T, one for each time step since the
+        start or the last restart. Dropping older updates would change
+        J_prev, hence the whole history is kept unless a restart
+        interval is given. After a restart, the next time step starts
+        with a relaxation step.
+
+      The least-squares problems are solved by a QR decomposition via
+      modified Gram-Schmidt. Columns that are close to linear dependent
+      on the newer columns are filtered out of the decomposition.
+
+      Without any column, i.e., in the first iteration of a time step
+      without reuse, a fixed relaxation step x^{k+1} = x^k + omega r^k
+      is done.
+
+      The direction keeps its history between the time steps. Hence,
+      the same object has to be used for the whole simulation, see
+      InterfaceQuasiNewtonFactory.
+
+    <h2>Parameters</h2>
+
+      - "Method" - "ILS" or "IMVJ" (defaults to "ILS")
+
+      - "omega" - relaxation parameter of the first iteration
+                  (defaults to 0.01)
+
+      - "max columns" - maximum number of columns in V and W
+                        (defaults to 50)
+
+      - "reuse" - number of previous time steps whose columns are
+                  reused by ILS (defaults to 0)
+
+      - "restart" - number of time steps after which the IMVJ Jacobian
+                    is discarded, 0 means never (defaults to 0)
+
+      - "filter tolerance" - columns whose norm reduces below this
+                             fraction during the orthogonalization are
+                             filtered (defaults to 1e-6)
+
+    <h2>References</h2>
+
+    Joris Degroote, Klaus-Juergen Bathe, Jan Vierendeels: Performance of
+    a new partitioned procedure versus a monolithic procedure in
+    fluid-structure interaction. Computers & Structures 87(11):
+    793-801, 2009. doi:10.1016/j.compstruc.2008.11.013
+
+    Florian Lindner, Miriam Mehl, Klaudius Scheufele, Benjamin Uekermann:
+    A comparison of various quasi-Newton schemes for partitioned
+    fluid-structure interaction. Proceedings of the 6th International
+    Conference on Computational Methods for Coupled Problems in Science
+    and Engineering, 477-488, 2015.
+    */
+    class InterfaceQuasiNewton : public ::NOX::Direction::Generic
+    {
+     public:
+      //! Constructor
+      InterfaceQuasiNewton(const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params);
+
+
+      //! Start a new time step, the columns of the last time step enter the history.
+      bool reset(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& grp,
+          const ::NOX::Solver::Generic& solver) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group,
+          const ::NOX::Solver::LineSearchBased& solver) override;
+
+     private:
+      //! columns of V and W
+      struct Columns
+      {
+        std::deque<Teuchos::RCP<::NOX::Abstract::Vector>> v;
+        std::deque<Teuchos::RCP<::NOX::Abstract::Vector>> w;
+      };
+
+      //! low-rank update A Q^T of the inverse Jacobian of one time step
+      struct JacobianUpdate
+      {
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> a;
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> q;
+      };
+
+      /*!
+        QR decomposition of the given columns of V with filtering
+
+        On return, @p q holds the orthonormal columns, @p r the upper
+        triangular matrix and @p kept the indices of the columns of V
+        that were not filtered.
+      */
+      void decompose(const std::vector<const ::NOX::Abstract::Vector*>& v,
+          std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& q, Core::LinAlg::SerialDenseMatrix& r,
+          std::vector<int>& kept) const;
+
+      //! apply the inverse Jacobian of the previous time steps: @p y += J_prev @p x
+      void apply_previous_jacobian(
+          const ::NOX::Abstract::Vector& x, ::NOX::Abstract::Vector& y) const;
+
+      //! store the Jacobian update of the finished time step (IMVJ)
+      void store_jacobian_update();
+
+      //! Print error message and throw error
+      void throw_error(const std::string& functionName, const std::string& errorMsg);
+
+     private:
+      //! Printing Utils
+      Teuchos::RCP<::NOX::Utils> utils_;
+
+      //! use the multi-vector Jacobian instead of the least-squares method
+      bool imvj_;
+
+      double omega_;
+
+      //! maximum number of columns
+      int max_columns_;
+
+      //! number of reused time steps (ILS)
+      int reuse_;
+
+      //! number of time steps after which the Jacobian is discarded, 0 means never (IMVJ)
+      int restart_;
+
+      //! number of finished time steps since the last restart (IMVJ)
+      int num_steps_since_restart_ = 0;
+
+      double filter_tolerance_;
+
+      //! columns of the current time step, newest first
+      Columns current_;
+
+      //! columns of the previous time steps, newest first (ILS)
+      std::deque<Columns> previous_;
+
+      //! inverse Jacobian updates of the previous time steps, newest first (IMVJ)
+      std::deque<JacobianUpdate> jacobian_updates_;
+
+      //! residual of the last iteration
+      Teuchos::RCP<::NOX::Abstract::Vector> r_old_;
+
+      //! field solver result of the last iteration
+      Teuchos::RCP<::NOX::Abstract::Vector> xtilde_old_;
+    };
+
+    /// simple factory that keeps the interface quasi-Newton direction over the time steps
+    class InterfaceQuasiNewtonFactory : public ::NOX::Direction::UserDefinedFactory
+    {
+     public:
+      Teuchos::RCP<::NOX::Direction::Generic> buildDirection(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) const override
+      {
+        if (iqn_ == Teuchos::null)
+          iqn_ = Teuchos::make_rcp<InterfaceQuasiNewton>(gd->getUtils(), params);
+        else
+          iqn_->reset(gd, params);
+        return iqn_;
+      }
+
+     private:
+      mutable Teuchos::RCP<InterfaceQuasiNewton> iqn_;
+    };
+
+  }  // namespace FSI
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -591,6 +591,12 @@ std::unordered_map<Core::Materials::MaterialType, Core::IO::InputSpec> Global::v
                               .default_value = "M"}),
             parameter<double>(
                 "TIME_SCALE", {.description = "Scale factor for time units of Model"}),
+            deprecated_selection<Inpar::Mat::GatingIntegrator>("GATING_INTEGRATOR",
+                {{"ImplicitEuler", Inpar::Mat::gating_implicit_euler},
+                    {"RushLarsen", Inpar::Mat::gating_rush_larsen}},
+                {.description = "Time integration of the gating variables: ImplicitEuler "
+                                "(default) or RushLarsen (only MV)",
+                    .default_value = Inpar::Mat::gating_implicit_euler}),
         },
         {.description = "Myocard muscle material"});
   }
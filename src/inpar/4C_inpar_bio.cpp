@@ -301,6 +301,11 @@ void Inpar::ReducedLung::set_valid_parameters(std::map<std::string, Core::IO::In
   Core::Utils::int_parameter("LINEAR_SOLVER", -1,
       "number of linear solver used for reduced dim arterial dynamics", redawdyn);
 
+  redawdyn.specs.emplace_back(parameter<bool>("TREE_SOLVER",
+      {.description = "Solve the reduced lung equations with a direct solver exploiting the tree "
+                      "topology of the network instead of LINEAR_SOLVER",
+          .default_value = false}));
+
   redawdyn.specs.emplace_back(parameter<bool>(
       "SOLVESCATRA", {.description = "Flag to (de)activate solving scalar transport in blood",
                          .default_value = false}));
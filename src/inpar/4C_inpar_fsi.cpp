@@ -21,8 +21,8 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
 
   Core::Utils::SectionSpecs fsidyn{"FSI DYNAMIC"};
 
-  Teuchos::Tuple<std::string, 21> name;
-  Teuchos::Tuple<FsiCoupling, 21> label;
+  Teuchos::Tuple<std::string, 23> name;
+  Teuchos::Tuple<FsiCoupling, 23> label;
 
   name[0] = "basic_sequ_stagg";
   label[0] = fsi_basic_sequ_stagg;
@@ -66,6 +66,10 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
   label[19] = fsi_iter_sliding_monolithicstructuresplit;
   name[20] = "iter_mortar_monolithicfluidsplit_saddlepoint";
   label[20] = fsi_iter_mortar_monolithicfluidsplit_saddlepoint;
+  name[21] = "iter_stagg_IQN_ILS";
+  label[21] = fsi_iter_stagg_IQN_ILS;
+  name[22] = "iter_stagg_IQN_IMVJ";
+  label[22] = fsi_iter_stagg_IQN_IMVJ;
 
 
   Core::Utils::string_to_integral_parameter<FsiCoupling>("COUPALGO", "iter_stagg_AITKEN_rel_param",
@@ -413,6 +417,24 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
       {.description = "Project velocity into divergence-free subspace for partitioned fsi",
           .default_value = false}));
 
+  fsipart.specs.emplace_back(parameter<double>("IQN_FILTER",
+      {.description = "Tolerance of the QR filter of interface quasi-Newton schemes: columns that "
+                      "are almost linear dependent on newer ones are removed",
+          .default_value = 1e-6}));
+
+  Core::Utils::int_parameter("IQN_IMVJ_RESTART", 0,
+      "Number of time steps after which the inverse Jacobian of IQN-IMVJ is discarded (0: the "
+      "whole history is kept)",
+      fsipart);
+
+  Core::Utils::int_parameter("IQN_MAXCOLUMNS", 50,
+      "Maximum number of columns in the least-squares problem of interface quasi-Newton schemes",
+      fsipart);
+
+  Core::Utils::int_parameter("IQN_REUSE", 0,
+      "Number of previous time steps whose columns are reused by IQN-ILS",
+      fsipart);
+
   Core::Utils::int_parameter("ITEMAX", 100, "Maximum number of iterations over fields", fsipart);
 
   fsipart.specs.emplace_back(parameter<double>("MAXOMEGA",
@@ -51,6 +51,8 @@ typedef enum FsiCoupling
   fsi_iter_stagg_MFNK_FSI, /*!< matrix free Newton Krylov with FSI specific Jacobian */
   fsi_iter_stagg_MPE,      /*!< minimal polynomial extrapolation */
   fsi_iter_stagg_RRE,      /*!< reduced rank extrapolation */
+  fsi_iter_stagg_IQN_ILS,  /*!< interface quasi-Newton with least-squares Jacobian */
+  fsi_iter_stagg_IQN_IMVJ, /*!< interface quasi-Newton with multi-vector Jacobian */
   fsi_iter_fluidfluid_monolithicstructuresplit,
   fsi_iter_fluidfluid_monolithicfluidsplit,
   fsi_iter_fluidfluid_monolithicstructuresplit_nonox,
@@ -137,6 +137,11 @@ void Inpar::IO::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>&
                                            "state regardless of the other output/restart intervals",
                                .default_value = false}));
 
+  io.specs.emplace_back(parameter<bool>("PERFORMANCE_TELEMETRY",
+      {.description = "Write timings, iteration counts and communication volume of every time "
+                      "step (min/mean/max over all processors) to a csv file",
+          .default_value = false}));
+
   io.specs.emplace_back(parameter<bool>("PREFIX_GROUP_ID",
       {.description = "Put a <GroupID>: in front of every line", .default_value = false}));
   Core::Utils::int_parameter(
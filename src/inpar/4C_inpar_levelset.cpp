@@ -66,6 +66,11 @@ void Inpar::LevelSet::set_valid_parameters(std::map<std::string, Core::IO::Input
   ls_reinit.specs.emplace_back(parameter<bool>("REINITBAND",
       {.description = "reinitialization only within a band around the interface, or entire domain?",
           .default_value = false}));
+  ls_reinit.specs.emplace_back(parameter<bool>("REINITBANDTREE",
+      {.description = "compute the distance only within the band via a bounding volume hierarchy "
+                      "search of the interface (requires ArborX), level-set values outside are "
+                      "set to +/- REINITBANDWIDTH",
+          .default_value = false}));
   ls_reinit.specs.emplace_back(parameter<double>(
       "REINITBANDWIDTH", {.description = "level-set value defining band width for reinitialization",
                              .default_value = 1.0}));
@@ -51,6 +51,13 @@ namespace Inpar
                                ///< space and time
       map  ///< discrete elementwise-defined activation prescription via an input pattern file
     };
+
+    //! valid time integration schemes of the gating variables of cardiac ionic models
+    enum GatingIntegrator
+    {
+      gating_implicit_euler,  ///< implicit Euler scheme
+      gating_rush_larsen      ///< Rush-Larsen scheme, i.e., exponential integration of the gates
+    };
   }  // namespace Mat
 }  // namespace Inpar
 
@@ -58,6 +58,24 @@ void Inpar::PARTICLE::set_valid_parameters(std::map<std::string, Core::IO::Input
   particledyn.specs.emplace_back(
       parameter<double>("MAXTIME", {.description = "maximum time", .default_value = 1.0}));
 
+  // adaptive time step size control
+  particledyn.specs.emplace_back(parameter<bool>("ADAPTIVE_TIMESTEP",
+      {.description = "adapt time step size based on CFL, viscous and contact limits",
+          .default_value = false}));
+  particledyn.specs.emplace_back(parameter<double>("TIMESTEP_SAFETY_FACTOR",
+      {.description = "safety factor applied to admissible time step size (the critical time step "
+                      "size of the particle interaction is the pure stability limit, the default "
+                      "equals the safety factor of the critical time step check of DEM)",
+          .default_value = 0.75}));
+  particledyn.specs.emplace_back(parameter<double>("TIMESTEP_MIN",
+      {.description = "minimum time step size of adaptive time stepping", .default_value = 0.0}));
+  particledyn.specs.emplace_back(parameter<double>("TIMESTEP_MAX",
+      {.description = "maximum time step size of adaptive time stepping (TIMESTEP if negative)",
+          .default_value = -1.0}));
+  particledyn.specs.emplace_back(parameter<double>("TIMESTEP_MAX_GROWTH",
+      {.description = "maximum growth factor of time step size between two time steps",
+          .default_value = 1.2}));
+
   // gravity acceleration control
   particledyn.specs.emplace_back(parameter<std::string>("GRAVITY_ACCELERATION",
       {.description = "acceleration due to gravity", .default_value = "0.0 0.0 0.0"}));
@@ -47,7 +47,8 @@ void Inpar::NlnSol::set_valid_parameters(std::map<std::string, Core::IO::InputSp
             {.description = "Choose a direction method for the nonlinear solver.",
                 .default_value = "Newton"}));
 
-    std::vector<std::string> user_defined_method_valid_input = {"Newton", "Modified Newton"};
+    std::vector<std::string> user_defined_method_valid_input = {
+        "Newton", "Modified Newton", "L-BFGS", "Broyden"};
     direction.specs.emplace_back(
         deprecated_selection<std::string>("User Defined Method", user_defined_method_valid_input,
             {.description = "Choose a user-defined direction method.",
@@ -78,6 +79,22 @@ void Inpar::NlnSol::set_valid_parameters(std::map<std::string, Core::IO::InputSp
   }
   newton.move_into_collection(list);
 
+  // sub-sub-list "Quasi-Newton"
+  Core::Utils::SectionSpecs quasinewton{direction, "Quasi-Newton"};
+
+  {
+    quasinewton.specs.emplace_back(parameter<int>("Restart Frequency",
+        {.description = "maximum number of iterations of the user defined directions \"Modified "
+                        "Newton\", \"L-BFGS\" and \"Broyden\" before the jacobian is evaluated "
+                        "again",
+            .default_value = 10}));
+    quasinewton.specs.emplace_back(parameter<double>("Max Convergence Rate",
+        {.description = "the jacobian is evaluated again if the norm of the right-hand side is "
+                        "reduced by less than this factor in one iteration",
+            .default_value = 0.5}));
+  }
+  quasinewton.move_into_collection(list);
+
   // sub-sub-list "Steepest Descent"
   Core::Utils::SectionSpecs steepestdescent{direction, "Steepest Descent"};
 
@@ -255,6 +255,32 @@ namespace Inpar
           "LUMPMASS", {.description = "Lump the mass matrix for explicit time integration",
                           .default_value = false}));
 
+      sdyn.specs.emplace_back(parameter<bool>("ELEMENT_BLOCK_EVALUATION",
+          {.description = "Evaluate the internal force and stiffness of hex8 solid elements with "
+                          "nonlinear kinematics in blocks of elements with the same material, "
+                          "such that the compiler can vectorize the loops over the elements",
+              .default_value = false}));
+
+      sdyn.specs.emplace_back(parameter<bool>("MATRIX_FREE_TANGENT",
+          {.description = "Apply the tangent stiffness of hex27 solid elements with nonlinear "
+                          "kinematics matrix-free in the iterative linear solver and assemble "
+                          "only their low-order refined stiffness for the preconditioner",
+              .default_value = false}));
+
+      sdyn.specs.emplace_back(parameter<bool>("EXPLICIT_FAST_PATH",
+          {.description = "Integrate explicit dynamics by applying the inverted lumped mass "
+                          "matrix without nonlinear and linear solver (requires LUMPMASS)",
+              .default_value = false}));
+      sdyn.specs.emplace_back(parameter<double>("EXPLICIT_CRIT_DT_FACTOR",
+          {.description = "Adapt the time step size of the explicit fast path to this factor "
+                          "times the estimated critical time step size bounded by TIMESTEP "
+                          "(inactive if not positive)",
+              .default_value = -1.0}));
+      Core::Utils::int_parameter("EXPLICIT_CRIT_DT_INTERVAL", 0,
+          "Re-estimate the critical time step size every given number of steps (only initially "
+          "if zero)",
+          sdyn);
+
       sdyn.specs.emplace_back(parameter<bool>("MODIFIEDEXPLEULER",
           {.description = "Use the modified explicit Euler time integration scheme",
               .default_value = true}));
@@ -41,6 +41,7 @@ ScaTra::LevelSetAlgorithm::LevelSetAlgorithm(std::shared_ptr<Core::FE::Discretiz
       reinitinterval_(-1),
       reinitband_(false),
       reinitbandwidth_(-1.0),
+      reinitbandtree_(false),
       reinitcorrector_(true),
       useprojectedreinitvel_(Inpar::ScaTra::vel_reinit_integration_point_based),
       lsdim_(Inpar::ScaTra::ls_3D),
@@ -116,6 +117,9 @@ void ScaTra::LevelSetAlgorithm::setup()
     {
       // reinitialization within band around interface only
       reinitband_ = levelsetparams_->sublist("REINITIALIZATION").get<bool>("REINITBAND");
+
+      // search the interface within the band by a bounding volume hierarchy
+      reinitbandtree_ = levelsetparams_->sublist("REINITIALIZATION").get<bool>("REINITBANDTREE");
     }
 
     // set parameters for reinitialization equation
@@ -349,7 +353,10 @@ void ScaTra::LevelSetAlgorithm::reinitialization()
       // potentially required for reinitialization via signed distance to interface
       std::map<int, Core::Geo::BoundaryIntCells> zerolevelset;
       zerolevelset.clear();
-      capture_interface(zerolevelset);
+      // the narrow band reinitialization distributes the interface itself
+      const bool narrowband =
+          reinitaction_ == Inpar::ScaTra::reinitaction_signeddistancefunction and reinitbandtree_;
+      capture_interface(zerolevelset, false, not narrowband);
 
       // -----------------------------------------------------------------
       //                    reinitialize level-set
@@ -360,7 +367,10 @@ void ScaTra::LevelSetAlgorithm::reinitialization()
         case Inpar::ScaTra::reinitaction_signeddistancefunction:
         {
           // reinitialization via signed distance to interface
-          reinit_geo(zerolevelset);
+          if (narrowband)
+            reinit_geo_narrow_band(zerolevelset);
+          else
+            reinit_geo(zerolevelset);
           break;
         }
         case Inpar::ScaTra::reinitaction_sussman:
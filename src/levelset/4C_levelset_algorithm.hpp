@@ -237,6 +237,14 @@ namespace ScaTra
     /// geometric reinitialization via computation of distance of node to interface
     void reinit_geo(const std::map<int, Core::Geo::BoundaryIntCells>& interface);
 
+    /// geometric reinitialization within a band around the interface only, the interface patches
+    /// near the nodes are found by a bounding volume hierarchy
+    void reinit_geo_narrow_band(std::map<int, Core::Geo::BoundaryIntCells>& interface);
+
+    /// compute distance of node to interface patch (helper function for reinit_geo())
+    double compute_distance_to_interface_patch(
+        const Core::LinAlg::Matrix<3, 1>& node, const Core::Geo::BoundaryIntCell& patch);
+
     /// compute normal vector of interface patch (helper function for reinit_geo())
     void compute_normal_vector_to_interface(const Core::Geo::BoundaryIntCell& patch,
         const Core::LinAlg::SerialDenseMatrix& patchcoord, Core::LinAlg::Matrix<3, 1>& normal);
@@ -291,8 +299,8 @@ namespace ScaTra
     void mass_conservation_check(const double actvolminus, const bool writetofile = false);
 
     // reconstruction of interface and output of domains
-    void capture_interface(
-        std::map<int, Core::Geo::BoundaryIntCells>& interface, const bool writetofile = false);
+    void capture_interface(std::map<int, Core::Geo::BoundaryIntCells>& interface,
+        const bool writetofile = false, const bool export_to_all_procs = true);
 
     // -----------------------------------------------------------------
     // members
@@ -319,6 +327,10 @@ namespace ScaTra
     /// band width for reinitialization (maximum level-set value)
     double reinitbandwidth_;
 
+    /// switch for reinitialization within the band via a bounding volume hierarchy
+    /// (reinit_geo_narrow_band() instead of reinit_geo())
+    bool reinitbandtree_;
+
     /// flag to activate corrector step (reinit_eq() only)
     bool reinitcorrector_;
 
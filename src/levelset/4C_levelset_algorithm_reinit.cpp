@@ -6,6 +6,10 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "4C_fem_condition_periodic.hpp"
+#include "4C_fem_geometric_search_bounding_volume.hpp"
+#include "4C_fem_geometric_search_bvh.hpp"
+#include "4C_fem_geometric_search_distributed_tree.hpp"
+#include "4C_global_data.hpp"
 #include "4C_io_control.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_levelset_algorithm.hpp"
@@ -16,6 +20,9 @@
 #include "4C_scatra_ele_action.hpp"
 #include "4C_utils_parameter_list.hpp"
 
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
+#include <algorithm>
 #include <list>
 
 FOUR_C_NAMESPACE_OPEN
@@ -837,78 +844,16 @@ void ScaTra::LevelSetAlgorithm::reinit_geo(
           //-----------------------------------------
           for (int ipatch = 0; ipatch < numpatch; ++ipatch)
           {
-            // get a single patch from group of flamefront patches
-            const Core::Geo::BoundaryIntCell patch = patches[ipatch];
-
-            // only triangles and quadrangles are allowed as flame front patches (boundary cells)
-            if (!(patch.shape() == Core::FE::CellType::tri3 or
-                    patch.shape() == Core::FE::CellType::quad4))
-            {
-              FOUR_C_THROW("invalid type of boundary integration cell for reinitialization");
-            }
-
-            // get coordinates of vertices defining flame front patch
-            const Core::LinAlg::SerialDenseMatrix& patchcoord = patch.cell_nodal_pos_xyz();
-
-            // compute normal vector to flame front patch
-            Core::LinAlg::Matrix<3, 1> normal(true);
-            compute_normal_vector_to_interface(patch, patchcoord, normal);
-
-            //-----------------------------------------
-            // find flame front patches facing the node
-            //-----------------------------------------
-            // boolean indicating if facing patch was found
-            bool facenode = false;
-            // distance to the facing patch
-            double patchdist = 1.0e19;  // default value
-            // check if this patch faces the node
-            find_facing_patch_proj_cell_space(
-                tmpcoord, patch, patchcoord, normal, facenode, patchdist);
-
-            // a facing patch was found
-            if (facenode == true)
-            {
-              // overwrite smallest distance if computed patch distance is smaller
-              if (fabs(patchdist) < fabs(mindist))
-              {
-                // if G-value at the node is negative, the minimal distance has to be negative
-                if ((*phinp_)[doflid] < 0.0)
-                  mindist = -patchdist;
-                else
-                  mindist = patchdist;
-              }
-            }
-
-            //-------------------------------------------------------------
-            // compute smallest distance to edges of this flame front patch
-            //-------------------------------------------------------------
-            // distance to the patch edge
-            double edgedist = 1.0e19;
-            compute_distance_to_edge(tmpcoord, patch, patchcoord, edgedist);
-
-            if (fabs(edgedist) < fabs(mindist))
-            {
-              // if G-value at the node is negative, the minimal distance has to be negative
-              if ((*phinp_)[doflid] < 0.0)
-                mindist = -edgedist;
-              else
-                mindist = edgedist;
-            }
-
-            //----------------------------------------------------------------
-            // compute smallest distance to vertices of this flame front patch
-            //----------------------------------------------------------------
-            // distance to the patch vertex
-            double vertexdist = 1.0e19;
-            compute_distance_to_patch(tmpcoord, patch, patchcoord, vertexdist);
+            // distance to the facing patch, its edges or its vertices
+            const double patchdist = compute_distance_to_interface_patch(tmpcoord, patches[ipatch]);
 
-            if (fabs(vertexdist) < fabs(mindist))
+            if (fabs(patchdist) < fabs(mindist))
             {
               // if G-value at the node is negative, the minimal distance has to be negative
               if ((*phinp_)[doflid] < 0.0)
-                mindist = -vertexdist;
+                mindist = -patchdist;
               else
-                mindist = vertexdist;
+                mindist = patchdist;
             }
           }  // loop over flamefront patches
 
@@ -966,6 +911,195 @@ void ScaTra::LevelSetAlgorithm::reinit_geo(
 }
 
 
+/*----------------------------------------------------------------------*
+ | geometric reinitialization within a narrow band around the interface |
+ *----------------------------------------------------------------------*/
+void ScaTra::LevelSetAlgorithm::reinit_geo_narrow_band(
+    std::map<int, Core::Geo::BoundaryIntCells>& interface)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("SCATRA:    + reinitialization in narrow band");
+
+  if (myrank_ == 0)
+    std::cout << "---  reinitializing level-set field within band around interface ..."
+              << std::flush;
+
+  // set switch flag to true to active reinitialization specific parts
+  switchreinit_ = true;
+
+  {
+    std::vector<Core::Conditions::Condition*> pbcs;
+    discret_->get_condition("SurfacePeriodic", pbcs);
+    if (pbcs.empty()) discret_->get_condition("LinePeriodic", pbcs);
+    if (not pbcs.empty())
+      FOUR_C_THROW(
+          "The narrow band reinitialization does not support periodic boundary conditions. Set "
+          "REINITBANDTREE to false.");
+  }
+
+  const Epetra_Map* dofrowmap = discret_->dof_row_map();
+  const auto verbosity =
+      Teuchos::getIntegralValue<Core::IO::Verbositylevel>(problem_->io_params(), "VERBOSITY");
+
+  const auto node_coordinates = [](const Core::Nodes::Node& node)
+  {
+    Core::LinAlg::Matrix<3, 1> coord(false);
+    for (int idim = 0; idim < 3; ++idim) coord(idim) = node.x()[idim];
+    return coord;
+  };
+
+  const auto add_patch_to_box =
+      [](const Core::Geo::BoundaryIntCell& patch, Core::GeometricSearch::BoundingVolume& box)
+  {
+    const Core::LinAlg::SerialDenseMatrix& patchcoord = patch.cell_nodal_pos_xyz();
+    for (int ivert = 0; ivert < patchcoord.numCols(); ++ivert)
+    {
+      Core::LinAlg::Matrix<3, 1> vertex(false);
+      for (int idim = 0; idim < 3; ++idim) vertex(idim) = patchcoord(idim, ivert);
+      box.add_point(vertex);
+    }
+  };
+
+  //========================================================================
+  // send the interface patches of my cut elements to all procs with row
+  // nodes within the band around them
+  //========================================================================
+  {
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> procbox;
+    if (discret_->num_my_row_nodes() > 0)
+    {
+      Core::GeometricSearch::BoundingVolume box;
+      for (int lnodeid = 0; lnodeid < discret_->num_my_row_nodes(); ++lnodeid)
+        box.add_point(node_coordinates(*discret_->l_row_node(lnodeid)));
+      box.extend_boundaries(reinitbandwidth_);
+      procbox.emplace_back(myrank_, box);
+    }
+
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> elepatchboxes;
+    for (const auto& [elegid, patches] : interface)
+    {
+      Core::GeometricSearch::BoundingVolume box;
+      for (const auto& patch : patches) add_patch_to_box(patch, box);
+      elepatchboxes.emplace_back(elegid, box);
+    }
+
+    const auto collisions = Core::GeometricSearch::global_collision_search(
+        procbox, elepatchboxes, discret_->get_comm(), verbosity);
+
+    std::map<int, std::set<int>> destinations;
+    for (const auto& collision : collisions)
+    {
+      if (collision.pid_primitive != myrank_)
+        destinations[collision.pid_primitive].insert(collision.gid_predicate);
+    }
+
+    ScaTra::LevelSet::Intersection intersect;
+    intersect.distribute_interface(interface, destinations, discret_->get_comm());
+  }
+
+  //========================================================================
+  // find the patches within the band around every row node
+  //========================================================================
+  std::vector<const Core::Geo::BoundaryIntCell*> allpatches;
+  std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> patchboxes;
+  for (const auto& [elegid, patches] : interface)
+  {
+    for (const auto& patch : patches)
+    {
+      Core::GeometricSearch::BoundingVolume box;
+      add_patch_to_box(patch, box);
+      patchboxes.emplace_back(allpatches.size(), box);
+      allpatches.push_back(&patch);
+    }
+  }
+
+  std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> nodeboxes;
+  for (int lnodeid = 0; lnodeid < discret_->num_my_row_nodes(); ++lnodeid)
+  {
+    Core::GeometricSearch::BoundingVolume box;
+    box.add_point(node_coordinates(*discret_->l_row_node(lnodeid)));
+    box.extend_boundaries(reinitbandwidth_);
+    nodeboxes.emplace_back(lnodeid, box);
+  }
+
+  const auto [indices, offsets] = Core::GeometricSearch::collision_search(
+      patchboxes, nodeboxes, discret_->get_comm(), verbosity);
+
+  //========================================================================
+  // compute the distance to the patches within the band, all other nodes
+  // are set to the band width
+  //========================================================================
+  for (int lnodeid = 0; lnodeid < discret_->num_my_row_nodes(); ++lnodeid)
+  {
+    const Core::Nodes::Node* lnode = discret_->l_row_node(lnodeid);
+
+    // since this is a scalar field the dof is always 0
+    const int dofgid = discret_->dof(0, lnode, 0);
+    int doflid = dofrowmap->LID(dofgid);
+    if (doflid < 0)
+      FOUR_C_THROW(
+          "Proc %d: Cannot find dof gid=%d in Core::LinAlg::Vector<double>", myrank_, dofgid);
+
+    const Core::LinAlg::Matrix<3, 1> nodecoord = node_coordinates(*lnode);
+
+    double mindist = reinitbandwidth_;
+    for (int j = offsets[lnodeid]; j < offsets[lnodeid + 1]; ++j)
+    {
+      mindist = std::min(
+          mindist, compute_distance_to_interface_patch(nodecoord, *allpatches[indices[j]]));
+    }
+
+    // if G-value at the node is negative, the minimal distance has to be negative
+    if ((*phinp_)[doflid] < 0.0) mindist = -mindist;
+
+    int err = phinp_->ReplaceMyValues(1, &mindist, &doflid);
+    if (err) FOUR_C_THROW("this did not work");
+  }
+
+  if (myrank_ == 0) std::cout << " done" << std::endl;
+}
+
+
+/*----------------------------------------------------------------------*
+ | distance of a node to a single interface patch                       |
+ *----------------------------------------------------------------------*/
+double ScaTra::LevelSetAlgorithm::compute_distance_to_interface_patch(
+    const Core::LinAlg::Matrix<3, 1>& node, const Core::Geo::BoundaryIntCell& patch)
+{
+  // only triangles and quadrangles are allowed as flame front patches (boundary cells)
+  if (!(patch.shape() == Core::FE::CellType::tri3 or patch.shape() == Core::FE::CellType::quad4))
+  {
+    FOUR_C_THROW("invalid type of boundary integration cell for reinitialization");
+  }
+
+  // get coordinates of vertices defining flame front patch
+  const Core::LinAlg::SerialDenseMatrix& patchcoord = patch.cell_nodal_pos_xyz();
+
+  // compute normal vector to flame front patch
+  Core::LinAlg::Matrix<3, 1> normal(true);
+  compute_normal_vector_to_interface(patch, patchcoord, normal);
+
+  double mindist = 1.0e19;
+
+  // distance to the patch, if the patch faces the node
+  bool facenode = false;
+  double patchdist = 1.0e19;
+  find_facing_patch_proj_cell_space(node, patch, patchcoord, normal, facenode, patchdist);
+  if (facenode) mindist = std::min(mindist, patchdist);
+
+  // smallest distance to the edges of the patch
+  double edgedist = 1.0e19;
+  compute_distance_to_edge(node, patch, patchcoord, edgedist);
+  mindist = std::min(mindist, edgedist);
+
+  // smallest distance to the vertices of the patch
+  double vertexdist = 1.0e19;
+  compute_distance_to_patch(node, patch, patchcoord, vertexdist);
+  mindist = std::min(mindist, vertexdist);
+
+  return mindist;
+}
+
+
 /*--------------------------------------------------------------------- -----------------*
  | find a facing flame front patch by projection of node into boundary cell space        |
  |                                                                           henke 12/09 |
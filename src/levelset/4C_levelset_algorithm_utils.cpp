@@ -111,14 +111,16 @@ void ScaTra::LevelSetAlgorithm::add_problem_specific_parameters_and_vectors(
  | capture interface                                    rasthofer 09/13 |
  *----------------------------------------------------------------------*/
 void ScaTra::LevelSetAlgorithm::capture_interface(
-    std::map<int, Core::Geo::BoundaryIntCells>& interface, const bool writetofile)
+    std::map<int, Core::Geo::BoundaryIntCells>& interface, const bool writetofile,
+    const bool export_to_all_procs)
 {
   double volminus = 0.0;
   double volplus = 0.0;
   double surf = 0.0;
   // reconstruct interface and calculate volumes, etc ...
   ScaTra::LevelSet::Intersection intersect;
-  intersect.capture_zero_level_set(*phinp_, *discret_, volminus, volplus, surf, interface);
+  intersect.capture_zero_level_set(
+      *phinp_, *discret_, volminus, volplus, surf, interface, export_to_all_procs);
 
   // do mass conservation check
   mass_conservation_check(volminus, writetofile);
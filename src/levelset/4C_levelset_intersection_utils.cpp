@@ -44,7 +44,8 @@ void ScaTra::LevelSet::Intersection::reset()
  *----------------------------------------------------------------------------*/
 void ScaTra::LevelSet::Intersection::capture_zero_level_set(const Core::LinAlg::Vector<double>& phi,
     const Core::FE::Discretization& scatradis, double& volumedomainminus, double& volumedomainplus,
-    double& zerosurface, std::map<int, Core::Geo::BoundaryIntCells>& elementBoundaryIntCells)
+    double& zerosurface, std::map<int, Core::Geo::BoundaryIntCells>& elementBoundaryIntCells,
+    const bool export_to_all_procs)
 {
   // reset, just to be sure
   reset();
@@ -62,7 +63,7 @@ void ScaTra::LevelSet::Intersection::capture_zero_level_set(const Core::LinAlg::
   Core::Communication::sum_all(&surface(), &zerosurface, 1, scatradis.get_comm());
 
   // export also interface to all procs
-  export_interface(elementBoundaryIntCells, scatradis.get_comm());
+  if (export_to_all_procs) export_interface(elementBoundaryIntCells, scatradis.get_comm());
 }
 
 /*----------------------------------------------------------------------------*
@@ -503,6 +504,73 @@ void ScaTra::LevelSet::Intersection::export_interface(
 }
 
 
+/*-----------------------------------------------------------------------*
+ *-----------------------------------------------------------------------*/
+void ScaTra::LevelSet::Intersection::distribute_interface(
+    std::map<int, Core::Geo::BoundaryIntCells>& myinterface,
+    const std::map<int, std::set<int>>& destinations, MPI_Comm comm)
+{
+  const int numproc = Core::Communication::num_mpi_ranks(comm);
+
+  //-------------------------------------------------------
+  // pack the requested interface pieces for every proc
+  //-------------------------------------------------------
+  std::vector<int> sendcounts(numproc, 0);
+  std::vector<int> senddispls(numproc, 0);
+  std::vector<char> sendbuffer;
+  for (int proc = 0; proc < numproc; ++proc)
+  {
+    senddispls[proc] = sendbuffer.size();
+
+    const auto destination = destinations.find(proc);
+    if (destination == destinations.end()) continue;
+
+    std::map<int, Core::Geo::BoundaryIntCells> sendinterface;
+    for (const int elegid : destination->second)
+    {
+      const auto cellgroup = myinterface.find(elegid);
+      if (cellgroup == myinterface.end())
+        FOUR_C_THROW("Element %d does not have interface pieces on this proc", elegid);
+      sendinterface.insert(*cellgroup);
+    }
+
+    Core::Communication::PackBuffer data;
+    pack_boundary_int_cells(sendinterface, data);
+    sendbuffer.insert(sendbuffer.end(), data().begin(), data().end());
+    sendcounts[proc] = sendbuffer.size() - senddispls[proc];
+  }
+
+  //-------------------------------------------------------
+  // exchange sizes and data
+  //-------------------------------------------------------
+  std::vector<int> recvcounts(numproc, 0);
+  MPI_Alltoall(sendcounts.data(), 1, MPI_INT, recvcounts.data(), 1, MPI_INT, comm);
+
+  std::vector<int> recvdispls(numproc, 0);
+  for (int proc = 1; proc < numproc; ++proc)
+    recvdispls[proc] = recvdispls[proc - 1] + recvcounts[proc - 1];
+  std::vector<char> recvbuffer(recvdispls[numproc - 1] + recvcounts[numproc - 1]);
+
+  MPI_Alltoallv(sendbuffer.data(), sendcounts.data(), senddispls.data(), MPI_CHAR,
+      recvbuffer.data(), recvcounts.data(), recvdispls.data(), MPI_CHAR, comm);
+
+  //-------------------------------------------------------
+  // unpack and add the received interface pieces
+  //-------------------------------------------------------
+  for (int proc = 0; proc < numproc; ++proc)
+  {
+    if (recvcounts[proc] == 0) continue;
+
+    std::vector<char> data(recvbuffer.begin() + recvdispls[proc],
+        recvbuffer.begin() + recvdispls[proc] + recvcounts[proc]);
+    std::map<int, Core::Geo::BoundaryIntCells> interface_recv;
+    unpack_boundary_int_cells(data, interface_recv);
+
+    myinterface.insert(interface_recv.begin(), interface_recv.end());
+  }
+}
+
+
 /*-----------------------------------------------------------------------*
  *-----------------------------------------------------------------------*/
 void ScaTra::LevelSet::Intersection::pack_boundary_int_cells(
@@ -13,7 +13,9 @@
 #include "4C_cut_point.hpp"
 #include "4C_fem_geometry_geo_utils.hpp"
 
+#include <map>
 #include <memory>
+#include <set>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -55,12 +57,30 @@ namespace ScaTra
       virtual ~Intersection() = default;
 
       /** \brief construct zero iso-contour of level-set field
+       *
+       *  If export_to_all_procs is false, every proc only holds the interface
+       *  pieces of its own row elements.
        *
        *  */
       void capture_zero_level_set(const Core::LinAlg::Vector<double>& phi,
           const Core::FE::Discretization& scatradis, double& volumedomainminus,
           double& volumedomainplus, double& zerosurface,
-          std::map<int, Core::Geo::BoundaryIntCells>& elementBoundaryIntCells);
+          std::map<int, Core::Geo::BoundaryIntCells>& elementBoundaryIntCells,
+          const bool export_to_all_procs = true);
+
+      /** \brief send interface pieces to selected procs
+       *
+       *  \param myinterface  (in/out) : interface pieces of this proc, the received
+       *                                 pieces are added
+       *  \param destinations (in)     : element gids of the interface pieces to be
+       *                                 sent to each proc
+       *
+       *  In contrast to the export to all procs, only the required interface pieces
+       *  are communicated, all in one exchange.
+       *
+       *  */
+      void distribute_interface(std::map<int, Core::Geo::BoundaryIntCells>& myinterface,
+          const std::map<int, std::set<int>>& destinations, MPI_Comm comm);
 
       /** \brief Set desired positions
        *
@@ -124,21 +124,21 @@ void Mat::ConstraintMixture::pack(Core::Communication::PackBuffer& data) const
   }
   else
   {
-    numgp = a1_->size();  // size is number of gausspoints
+    numgp = a1_.size();  // size is number of gausspoints
   }
   add_to_pack(data, numgp);
   // Pack internal variables
   for (int gp = 0; gp < numgp; gp++)
   {
-    add_to_pack(data, a1_->at(gp));
-    add_to_pack(data, a2_->at(gp));
-    add_to_pack(data, a3_->at(gp));
-    add_to_pack(data, a4_->at(gp));
-    add_to_pack(data, vismassstress_->at(gp));
+    add_to_pack(data, a1_[gp]);
+    add_to_pack(data, a2_[gp]);
+    add_to_pack(data, a3_[gp]);
+    add_to_pack(data, a4_[gp]);
+    add_to_pack(data, vismassstress_[gp]);
     add_to_pack(data, refmassdens_->at(gp));
-    add_to_pack(data, visrefmassdens_->at(gp));
-    add_to_pack(data, localprestretch_->at(gp));
-    add_to_pack(data, localhomstress_->at(gp));
+    add_to_pack(data, visrefmassdens_[gp]);
+    add_to_pack(data, localprestretch_[gp]);
+    add_to_pack(data, localhomstress_[gp]);
   }
   if (numgp > 0)
   {
@@ -198,39 +198,39 @@ void Mat::ConstraintMixture::unpack(Core::Communication::UnpackBuffer& buffer)
   }
 
   // unpack fiber internal variables
-  a1_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a2_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a3_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a4_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  vismassstress_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
+  a1_.resize(numgp);
+  a2_.resize(numgp);
+  a3_.resize(numgp);
+  a4_.resize(numgp);
+  vismassstress_.resize(numgp);
   refmassdens_ = std::make_shared<std::vector<double>>(numgp);
-  visrefmassdens_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  localprestretch_ = std::make_shared<std::vector<Core::LinAlg::Matrix<4, 1>>>(numgp);
-  localhomstress_ = std::make_shared<std::vector<Core::LinAlg::Matrix<4, 1>>>(numgp);
+  visrefmassdens_.resize(numgp);
+  localprestretch_.resize(numgp);
+  localhomstress_.resize(numgp);
 
   for (int gp = 0; gp < numgp; gp++)
   {
     Core::LinAlg::Matrix<3, 1> alin;
     extract_from_pack(buffer, alin);
-    a1_->at(gp) = alin;
+    a1_[gp] = alin;
     extract_from_pack(buffer, alin);
-    a2_->at(gp) = alin;
+    a2_[gp] = alin;
     extract_from_pack(buffer, alin);
-    a3_->at(gp) = alin;
+    a3_[gp] = alin;
     extract_from_pack(buffer, alin);
-    a4_->at(gp) = alin;
+    a4_[gp] = alin;
     extract_from_pack(buffer, alin);
-    vismassstress_->at(gp) = alin;
+    vismassstress_[gp] = alin;
     double a;
     extract_from_pack(buffer, a);
     refmassdens_->at(gp) = a;
     extract_from_pack(buffer, alin);
-    visrefmassdens_->at(gp) = alin;
+    visrefmassdens_[gp] = alin;
     Core::LinAlg::Matrix<4, 1> pre;
     extract_from_pack(buffer, pre);
-    localprestretch_->at(gp) = pre;
+    localprestretch_[gp] = pre;
     extract_from_pack(buffer, pre);
-    localhomstress_->at(gp) = pre;
+    localhomstress_[gp] = pre;
   }
   double basal;
   extract_from_pack(buffer, basal);
@@ -332,24 +332,24 @@ void Mat::ConstraintMixture::setup(int numgp, const Core::IO::InputParameterCont
     FOUR_C_THROW("unknown option for mass production function");
 
   // visualization
-  vismassstress_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
+  vismassstress_.resize(numgp);
   refmassdens_ = std::make_shared<std::vector<double>>(numgp);
-  visrefmassdens_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
+  visrefmassdens_.resize(numgp);
   // homeostatic prestretch of collagen fibers
-  localprestretch_ = std::make_shared<std::vector<Core::LinAlg::Matrix<4, 1>>>(numgp);
-  localhomstress_ = std::make_shared<std::vector<Core::LinAlg::Matrix<4, 1>>>(numgp);
+  localprestretch_.resize(numgp);
+  localhomstress_.resize(numgp);
 
   for (int gp = 0; gp < numgp; gp++)
   {
-    vismassstress_->at(gp)(0) = 0.0;
-    vismassstress_->at(gp)(1) = 0.0;
-    vismassstress_->at(gp)(2) = 0.0;
+    vismassstress_[gp](0) = 0.0;
+    vismassstress_[gp](1) = 0.0;
+    vismassstress_[gp](2) = 0.0;
     refmassdens_->at(gp) = params_->density_;
-    visrefmassdens_->at(gp)(0) =
+    visrefmassdens_[gp](0) =
         params_->density_ * (1.0 - params_->phielastin_ - params_->phimuscle_) / 4.0;
-    visrefmassdens_->at(gp)(1) =
+    visrefmassdens_[gp](1) =
         params_->density_ * (1.0 - params_->phielastin_ - params_->phimuscle_) / 4.0;
-    visrefmassdens_->at(gp)(2) =
+    visrefmassdens_[gp](2) =
         params_->density_ * (1.0 - params_->phielastin_ - params_->phimuscle_) / 4.0;
     //    visrefmassdens_->at(gp)(0) = params_->density_*(1.0 - params_->phielastin_ -
     //    params_->phimuscle_)/10.0; visrefmassdens_->at(gp)(1) = params_->density_*(1.0 -
@@ -363,10 +363,10 @@ void Mat::ConstraintMixture::setup(int numgp, const Core::IO::InputParameterCont
   reset_all(numgp);
 
   // fiber vectors
-  a1_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a2_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a3_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
-  a4_ = std::make_shared<std::vector<Core::LinAlg::Matrix<3, 1>>>(numgp);
+  a1_.resize(numgp);
+  a2_.resize(numgp);
+  a3_.resize(numgp);
+  a4_.resize(numgp);
 
   // read local (cylindrical) cosy-directions at current element
   auto rad_opt = container.get<std::optional<std::vector<double>>>("RAD");
@@ -407,13 +407,13 @@ void Mat::ConstraintMixture::setup(int numgp, const Core::IO::InputParameterCont
     for (int i = 0; i < 3; i++)
     {
       // a1 = e3, circumferential direction
-      a1_->at(gp)(i) = locsys(i, 2);
+      a1_[gp](i) = locsys(i, 2);
       // a2 = e2, axial direction
-      a2_->at(gp)(i) = locsys(i, 1);
+      a2_[gp](i) = locsys(i, 1);
       // a3 = cos gamma e3 + sin gamma e2
-      a3_->at(gp)(i) = cos(gamma) * locsys(i, 2) + sin(gamma) * locsys(i, 1);
+      a3_[gp](i) = cos(gamma) * locsys(i, 2) + sin(gamma) * locsys(i, 1);
       // a4 = cos gamma e3 - sin gamma e2
-      a4_->at(gp)(i) = cos(gamma) * locsys(i, 2) - sin(gamma) * locsys(i, 1);
+      a4_[gp](i) = cos(gamma) * locsys(i, 2) - sin(gamma) * locsys(i, 1);
     }
   }
 
@@ -430,19 +430,19 @@ void Mat::ConstraintMixture::reset_all(const int numgp)
   {
     if (params_->numhom_ == 1)
     {
-      localprestretch_->at(gp).put_scalar(params_->prestretchcollagen_[0]);
-      localhomstress_->at(gp).put_scalar(params_->homstress_[0]);
+      localprestretch_[gp].put_scalar(params_->prestretchcollagen_[0]);
+      localhomstress_[gp].put_scalar(params_->homstress_[0]);
     }
     else if (params_->numhom_ == 3)
     {
-      localprestretch_->at(gp)(0) = params_->prestretchcollagen_[0];
-      localprestretch_->at(gp)(1) = params_->prestretchcollagen_[1];
-      localprestretch_->at(gp)(2) = params_->prestretchcollagen_[2];
-      localprestretch_->at(gp)(3) = params_->prestretchcollagen_[2];
-      localhomstress_->at(gp)(0) = params_->homstress_[0];
-      localhomstress_->at(gp)(1) = params_->homstress_[1];
-      localhomstress_->at(gp)(2) = params_->homstress_[2];
-      localhomstress_->at(gp)(3) = params_->homstress_[2];
+      localprestretch_[gp](0) = params_->prestretchcollagen_[0];
+      localprestretch_[gp](1) = params_->prestretchcollagen_[1];
+      localprestretch_[gp](2) = params_->prestretchcollagen_[2];
+      localprestretch_[gp](3) = params_->prestretchcollagen_[2];
+      localhomstress_[gp](0) = params_->homstress_[0];
+      localhomstress_[gp](1) = params_->homstress_[1];
+      localhomstress_[gp](2) = params_->homstress_[2];
+      localhomstress_[gp](3) = params_->homstress_[2];
     }
     else
       FOUR_C_THROW("wrong number of homeostatic variables");
@@ -857,9 +857,9 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
             double homstrain = 0.0;
             double fac_cmat = 0.0;
             evaluate_single_fiber_scalars(
-                localprestretch_->at(gp)(idfiber) * localprestretch_->at(gp)(idfiber), fac_cmat,
+                localprestretch_[gp](idfiber) * localprestretch_[gp](idfiber), fac_cmat,
                 homstrain);
-            homstrain = homstrain * localprestretch_->at(gp)(idfiber);
+            homstrain = homstrain * localprestretch_[gp](idfiber);
             for (int idtime = minindex_; idtime < sizehistory - 2; idtime++)
             {
               Core::LinAlg::Matrix<4, 1> depstretch(true);
@@ -867,7 +867,7 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
               double strain = 0.0;
               double fac_cmat = 0.0;
               double stretch =
-                  localprestretch_->at(gp)(idfiber) * actstretch(idfiber) / depstretch(idfiber);
+                  localprestretch_[gp](idfiber) * actstretch(idfiber) / depstretch(idfiber);
               double I4 = stretch * stretch;
               evaluate_single_fiber_scalars(I4, fac_cmat, strain);
               strain = strain * stretch;
@@ -902,31 +902,31 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
     // compute actual collagen stretches
     Core::LinAlg::Matrix<4, 1> actstretch(true);
     double actcollagenstretch =
-        a1_->at(gp)(0) * a1_->at(gp)(0) * C(0) + a1_->at(gp)(1) * a1_->at(gp)(1) * C(1) +
-        a1_->at(gp)(2) * a1_->at(gp)(2) * C(2) + a1_->at(gp)(0) * a1_->at(gp)(1) * C(3) +
-        a1_->at(gp)(1) * a1_->at(gp)(2) * C(4) +
-        a1_->at(gp)(0) * a1_->at(gp)(2) * C(5);  // = trace(A1:C)
+        a1_[gp](0) * a1_[gp](0) * C(0) + a1_[gp](1) * a1_[gp](1) * C(1) +
+        a1_[gp](2) * a1_[gp](2) * C(2) + a1_[gp](0) * a1_[gp](1) * C(3) +
+        a1_[gp](1) * a1_[gp](2) * C(4) +
+        a1_[gp](0) * a1_[gp](2) * C(5);  // = trace(A1:C)
     actcollagenstretch = sqrt(actcollagenstretch);
     actstretch(0) = actcollagenstretch;
     actcollagenstretch =
-        a2_->at(gp)(0) * a2_->at(gp)(0) * C(0) + a2_->at(gp)(1) * a2_->at(gp)(1) * C(1) +
-        a2_->at(gp)(2) * a2_->at(gp)(2) * C(2) + a2_->at(gp)(0) * a2_->at(gp)(1) * C(3) +
-        a2_->at(gp)(1) * a2_->at(gp)(2) * C(4) +
-        a2_->at(gp)(0) * a2_->at(gp)(2) * C(5);  // = trace(A2:C)
+        a2_[gp](0) * a2_[gp](0) * C(0) + a2_[gp](1) * a2_[gp](1) * C(1) +
+        a2_[gp](2) * a2_[gp](2) * C(2) + a2_[gp](0) * a2_[gp](1) * C(3) +
+        a2_[gp](1) * a2_[gp](2) * C(4) +
+        a2_[gp](0) * a2_[gp](2) * C(5);  // = trace(A2:C)
     actcollagenstretch = sqrt(actcollagenstretch);
     actstretch(1) = actcollagenstretch;
     actcollagenstretch =
-        a3_->at(gp)(0) * a3_->at(gp)(0) * C(0) + a3_->at(gp)(1) * a3_->at(gp)(1) * C(1) +
-        a3_->at(gp)(2) * a3_->at(gp)(2) * C(2) + a3_->at(gp)(0) * a3_->at(gp)(1) * C(3) +
-        a3_->at(gp)(1) * a3_->at(gp)(2) * C(4) +
-        a3_->at(gp)(0) * a3_->at(gp)(2) * C(5);  // = trace(A3:C)
+        a3_[gp](0) * a3_[gp](0) * C(0) + a3_[gp](1) * a3_[gp](1) * C(1) +
+        a3_[gp](2) * a3_[gp](2) * C(2) + a3_[gp](0) * a3_[gp](1) * C(3) +
+        a3_[gp](1) * a3_[gp](2) * C(4) +
+        a3_[gp](0) * a3_[gp](2) * C(5);  // = trace(A3:C)
     actcollagenstretch = sqrt(actcollagenstretch);
     actstretch(2) = actcollagenstretch;
     actcollagenstretch =
-        a4_->at(gp)(0) * a4_->at(gp)(0) * C(0) + a4_->at(gp)(1) * a4_->at(gp)(1) * C(1) +
-        a4_->at(gp)(2) * a4_->at(gp)(2) * C(2) + a4_->at(gp)(0) * a4_->at(gp)(1) * C(3) +
-        a4_->at(gp)(1) * a4_->at(gp)(2) * C(4) +
-        a4_->at(gp)(0) * a4_->at(gp)(2) * C(5);  // = trace(A4:C)
+        a4_[gp](0) * a4_[gp](0) * C(0) + a4_[gp](1) * a4_[gp](1) * C(1) +
+        a4_[gp](2) * a4_[gp](2) * C(2) + a4_[gp](0) * a4_[gp](1) * C(3) +
+        a4_[gp](1) * a4_[gp](2) * C(4) +
+        a4_[gp](0) * a4_[gp](2) * C(5);  // = trace(A4:C)
     actcollagenstretch = sqrt(actcollagenstretch);
     actstretch(3) = actcollagenstretch;
 
@@ -977,30 +977,30 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
       if (params_->numhom_ == 1)
       {
         double prestretch = 1.0 + (params_->prestretchcollagen_[0] - 1.0) * curvefac;
-        localprestretch_->at(gp).put_scalar(prestretch);
+        localprestretch_[gp].put_scalar(prestretch);
       }
       else
       {
         double prestretch = 1.0 + (params_->prestretchcollagen_[0] - 1.0) * curvefac;
-        localprestretch_->at(gp)(0) = prestretch;
+        localprestretch_[gp](0) = prestretch;
         prestretch = 1.0 + (params_->prestretchcollagen_[1] - 1.0) * curvefac;
-        localprestretch_->at(gp)(1) = prestretch;
+        localprestretch_[gp](1) = prestretch;
         prestretch = 1.0 + (params_->prestretchcollagen_[2] - 1.0) * curvefac;
-        localprestretch_->at(gp)(2) = prestretch;
-        localprestretch_->at(gp)(3) = prestretch;
+        localprestretch_[gp](2) = prestretch;
+        localprestretch_[gp](3) = prestretch;
       }
     }
     else if (abs(time - params_->starttime_) < eps && params_->initstretch_ == "UpdatePrestretch")
     {
       // use current stretch as prestretch
       if (params_->numhom_ == 1)
-        localprestretch_->at(gp).update(params_->prestretchcollagen_[0], actstretch);
+        localprestretch_[gp].update(params_->prestretchcollagen_[0], actstretch);
       else
       {
-        localprestretch_->at(gp)(0) = params_->prestretchcollagen_[0] * actstretch(0);
-        localprestretch_->at(gp)(1) = params_->prestretchcollagen_[1] * actstretch(1);
-        localprestretch_->at(gp)(2) = params_->prestretchcollagen_[2] * actstretch(2);
-        localprestretch_->at(gp)(3) = params_->prestretchcollagen_[2] * actstretch(3);
+        localprestretch_[gp](0) = params_->prestretchcollagen_[0] * actstretch(0);
+        localprestretch_[gp](1) = params_->prestretchcollagen_[1] * actstretch(1);
+        localprestretch_[gp](2) = params_->prestretchcollagen_[2] * actstretch(2);
+        localprestretch_[gp](3) = params_->prestretchcollagen_[2] * actstretch(3);
       }
       // adopt deposition stretch
       int numsteps = history_->size();
@@ -1043,13 +1043,13 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
       // 2nd step: collagen
       //==========================
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a1_->at(gp), &masstemp, firstiter, time, 0);
+          C, gp, &cmattemp, &stresstemp, a1_[gp], &masstemp, firstiter, time, 0);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a2_->at(gp), &masstemp, firstiter, time, 1);
+          C, gp, &cmattemp, &stresstemp, a2_[gp], &masstemp, firstiter, time, 1);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a3_->at(gp), &masstemp, firstiter, time, 2);
+          C, gp, &cmattemp, &stresstemp, a3_[gp], &masstemp, firstiter, time, 2);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a4_->at(gp), &masstemp, firstiter, time, 3);
+          C, gp, &cmattemp, &stresstemp, a4_[gp], &masstemp, firstiter, time, 3);
 
       mass_production(
           gp, *defgrd, stresstemp, &massstress, inner_radius, &massprodcomp, growthfactor);
@@ -1062,30 +1062,30 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
       Core::LinAlg::Matrix<NUM_STRESS_3D, NUM_STRESS_3D> cmattemp(true);
       double masstemp = 0.0;
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a1_->at(gp), &masstemp, firstiter, time, 0);
+          C, gp, &cmattemp, &stresstemp, a1_[gp], &masstemp, firstiter, time, 0);
       mass_production_single_fiber(gp, *defgrd, stresstemp, &massstresstemp, inner_radius,
-          &massprodtemp, a1_->at(gp), 0, growthfactor);
+          &massprodtemp, a1_[gp], 0, growthfactor);
       massstress(0) = massstresstemp;
       massprodcomp(0) = massprodtemp;
       stresstemp.put_scalar(0.0);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a2_->at(gp), &masstemp, firstiter, time, 1);
+          C, gp, &cmattemp, &stresstemp, a2_[gp], &masstemp, firstiter, time, 1);
       mass_production_single_fiber(gp, *defgrd, stresstemp, &massstresstemp, inner_radius,
-          &massprodtemp, a2_->at(gp), 1, growthfactor);
+          &massprodtemp, a2_[gp], 1, growthfactor);
       massstress(1) = massstresstemp;
       massprodcomp(1) = massprodtemp;
       stresstemp.put_scalar(0.0);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a3_->at(gp), &masstemp, firstiter, time, 2);
+          C, gp, &cmattemp, &stresstemp, a3_[gp], &masstemp, firstiter, time, 2);
       mass_production_single_fiber(gp, *defgrd, stresstemp, &massstresstemp, inner_radius,
-          &massprodtemp, a3_->at(gp), 2, growthfactor);
+          &massprodtemp, a3_[gp], 2, growthfactor);
       massstress(2) = massstresstemp;
       massprodcomp(2) = massprodtemp;
       stresstemp.put_scalar(0.0);
       evaluate_fiber_family(
-          C, gp, &cmattemp, &stresstemp, a4_->at(gp), &masstemp, firstiter, time, 3);
+          C, gp, &cmattemp, &stresstemp, a4_[gp], &masstemp, firstiter, time, 3);
       mass_production_single_fiber(gp, *defgrd, stresstemp, &massstresstemp, inner_radius,
-          &massprodtemp, a4_->at(gp), 3, growthfactor);
+          &massprodtemp, a4_[gp], 3, growthfactor);
       massstress(3) = massstresstemp;
       massprodcomp(3) = massprodtemp;
     }
@@ -1093,7 +1093,7 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
     // set new homstress
     if (abs(time - params_->starttime_) < eps && params_->initstretch_ == "UpdatePrestretch")
     {
-      localhomstress_->at(gp).update(massstress);
+      localhomstress_[gp].update(massstress);
       // perhaps add time < params_->starttime_? correction factor actstretch needed?
     }
 
@@ -1105,9 +1105,9 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
       if (params_->integration_ == "Explicit")
       {
         history_->back().set_mass(gp, massprodcomp);
-        vismassstress_->at(gp)(0) = massstress(0);
-        vismassstress_->at(gp)(1) = massstress(1);
-        vismassstress_->at(gp)(2) = massstress(2);
+        vismassstress_[gp](0) = massstress(0);
+        vismassstress_[gp](1) = massstress(1);
+        vismassstress_[gp](2) = massstress(2);
       }
       else
       {
@@ -1135,9 +1135,9 @@ void Mat::ConstraintMixture::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
     else
     {
       // visualization of massstresss for the other cases
-      vismassstress_->at(gp)(0) = massstress(0);
-      vismassstress_->at(gp)(1) = massstress(1);
-      vismassstress_->at(gp)(2) = massstress(2);
+      vismassstress_[gp](0) = massstress(0);
+      vismassstress_[gp](1) = massstress(1);
+      vismassstress_[gp](2) = massstress(2);
       if ((params_->initstretch_ == "SetConstantHistory" ||
               params_->initstretch_ == "SetLinearHistory") &&
           time > (0.6 * params_->starttime_ + 1.0e-12) &&
@@ -1208,13 +1208,13 @@ void Mat::ConstraintMixture::evaluate_stress(const Core::LinAlg::Matrix<NUM_STRE
 
   // 2nd step: collagen
   //==========================
-  evaluate_fiber_family(C, gp, cmat, stress, a1_->at(gp), &currmassdens, firstiter, time, 0);
+  evaluate_fiber_family(C, gp, cmat, stress, a1_[gp], &currmassdens, firstiter, time, 0);
 
-  evaluate_fiber_family(C, gp, cmat, stress, a2_->at(gp), &currmassdens, firstiter, time, 1);
+  evaluate_fiber_family(C, gp, cmat, stress, a2_[gp], &currmassdens, firstiter, time, 1);
 
-  evaluate_fiber_family(C, gp, cmat, stress, a3_->at(gp), &currmassdens, firstiter, time, 2);
+  evaluate_fiber_family(C, gp, cmat, stress, a3_[gp], &currmassdens, firstiter, time, 2);
 
-  evaluate_fiber_family(C, gp, cmat, stress, a4_->at(gp), &currmassdens, firstiter, time, 3);
+  evaluate_fiber_family(C, gp, cmat, stress, a4_[gp], &currmassdens, firstiter, time, 3);
 
   // 3rd step: smooth muscle
   //==========================
@@ -1251,11 +1251,11 @@ void Mat::ConstraintMixture::evaluate_fiber_family(const Core::LinAlg::Matrix<NU
 {
   //--------------------------------------------------------------------------------------
   // some variables
-  double prestretchcollagen = localprestretch_->at(gp)(idfiber);
+  double prestretchcollagen = localprestretch_[gp](idfiber);
   double density = params_->density_;
   int sizehistory = history_->size();
   double eps = 1.0e-11;
-  if (idfiber != 3) visrefmassdens_->at(gp)(idfiber) = 0.0;
+  if (idfiber != 3) visrefmassdens_[gp](idfiber) = 0.0;
 
   //--------------------------------------------------------------------------------------
   // structural tensors in voigt notation
@@ -1368,7 +1368,7 @@ void Mat::ConstraintMixture::evaluate_fiber_family(const Core::LinAlg::Matrix<NU
     }
 
     (*currmassdens) += qdegrad * collmass(idfiber) * depdt;
-    if (idfiber != 3) visrefmassdens_->at(gp)(idfiber) += qdegrad * collmass(idfiber) * depdt;
+    if (idfiber != 3) visrefmassdens_[gp](idfiber) += qdegrad * collmass(idfiber) * depdt;
   }
 
   // matrices for stress and cmat
@@ -1520,7 +1520,7 @@ void Mat::ConstraintMixture::evaluate_muscle(const Core::LinAlg::Matrix<NUM_STRE
   //--------------------------------------------------------------------------------------
   // structural tensors in voigt notation
   // A = a x a
-  Core::LinAlg::Matrix<3, 1> a = a1_->at(gp);
+  Core::LinAlg::Matrix<3, 1> a = a1_.copy(gp);
   Core::LinAlg::Matrix<NUM_STRESS_3D, 1> A;
   for (int i = 0; i < 3; i++) A(i) = a(i) * a(i);
 
@@ -1699,17 +1699,17 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   // Fiber1
   Core::LinAlg::Matrix<3, 1> temp_vector(true);
   Core::LinAlg::Matrix<1, 1> temp_scalar(true);
-  temp_vector.multiply(Cmatrix, a1_->at(gp));
-  temp_scalar.multiply_tn(a1_->at(gp), temp_vector);
+  temp_vector.multiply(Cmatrix, a1_[gp]);
+  temp_scalar.multiply_tn(a1_[gp], temp_vector);
   double currentstretch = sqrt(temp_scalar(0));
-  temp_vector.multiply(temp2, a1_->at(gp));
-  temp_scalar.multiply_tn(a1_->at(gp), temp_vector);
+  temp_vector.multiply(temp2, a1_[gp]);
+  temp_scalar.multiply_tn(a1_[gp], temp_vector);
   double massstress1 = sqrt(temp_scalar(0)) / currentstretch;
   if (params_->massprodfunc_ == "Lin")
   {
-    if (localhomstress_->at(gp)(0) != 0.0)
+    if (localhomstress_[gp](0) != 0.0)
       (*massprodcomp)(0) =
-          massprodbasal_ * (1.0 + growthfactor * (massstress1 / localhomstress_->at(gp)(0) - 1.0) +
+          massprodbasal_ * (1.0 + growthfactor * (massstress1 / localhomstress_[gp](0) - 1.0) +
                                sheargrowthfactor * sheardiff);
     else
       (*massprodcomp)(0) =
@@ -1719,10 +1719,10 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
   else if (params_->massprodfunc_ == "CosCos")
   {
-    if (localhomstress_->at(gp)(0) != 0.0)
+    if (localhomstress_[gp](0) != 0.0)
     {
       double facstress = 0.0;
-      double deltastress = massstress1 / localhomstress_->at(gp)(0) - 1.0;
+      double deltastress = massstress1 / localhomstress_[gp](0) - 1.0;
       mass_function(growthfactor, deltastress, maxmassprodfac, facstress);
       double facshear = 0.0;
       mass_function(sheargrowthfactor, sheardiff, maxmassprodfac, facshear);
@@ -1745,17 +1745,17 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
 
   // Fiber2
-  temp_vector.multiply(Cmatrix, a2_->at(gp));
-  temp_scalar.multiply_tn(a2_->at(gp), temp_vector);
+  temp_vector.multiply(Cmatrix, a2_[gp]);
+  temp_scalar.multiply_tn(a2_[gp], temp_vector);
   currentstretch = sqrt(temp_scalar(0));
-  temp_vector.multiply(temp2, a2_->at(gp));
-  temp_scalar.multiply_tn(a2_->at(gp), temp_vector);
+  temp_vector.multiply(temp2, a2_[gp]);
+  temp_scalar.multiply_tn(a2_[gp], temp_vector);
   double massstress2 = sqrt(temp_scalar(0)) / currentstretch;
   if (params_->massprodfunc_ == "Lin")
   {
-    if (localhomstress_->at(gp)(1) != 0.0)
+    if (localhomstress_[gp](1) != 0.0)
       (*massprodcomp)(1) =
-          massprodbasal_ * (1.0 + growthfactor * (massstress2 / localhomstress_->at(gp)(1) - 1.0) +
+          massprodbasal_ * (1.0 + growthfactor * (massstress2 / localhomstress_[gp](1) - 1.0) +
                                sheargrowthfactor * sheardiff);
     else
       (*massprodcomp)(1) =
@@ -1765,10 +1765,10 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
   else if (params_->massprodfunc_ == "CosCos")
   {
-    if (localhomstress_->at(gp)(1) != 0.0)
+    if (localhomstress_[gp](1) != 0.0)
     {
       double facstress = 0.0;
-      double deltastress = massstress2 / localhomstress_->at(gp)(1) - 1.0;
+      double deltastress = massstress2 / localhomstress_[gp](1) - 1.0;
       mass_function(growthfactor, deltastress, maxmassprodfac, facstress);
       double facshear = 0.0;
       mass_function(sheargrowthfactor, sheardiff, maxmassprodfac, facshear);
@@ -1791,17 +1791,17 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
 
   // Fiber3
-  temp_vector.multiply(Cmatrix, a3_->at(gp));
-  temp_scalar.multiply_tn(a3_->at(gp), temp_vector);
+  temp_vector.multiply(Cmatrix, a3_[gp]);
+  temp_scalar.multiply_tn(a3_[gp], temp_vector);
   currentstretch = sqrt(temp_scalar(0));
-  temp_vector.multiply(temp2, a3_->at(gp));
-  temp_scalar.multiply_tn(a3_->at(gp), temp_vector);
+  temp_vector.multiply(temp2, a3_[gp]);
+  temp_scalar.multiply_tn(a3_[gp], temp_vector);
   double massstress3 = sqrt(temp_scalar(0)) / currentstretch;
   if (params_->massprodfunc_ == "Lin")
   {
-    if (localhomstress_->at(gp)(2) != 0.0)
+    if (localhomstress_[gp](2) != 0.0)
       (*massprodcomp)(2) =
-          massprodbasal_ * (1.0 + growthfactor * (massstress3 / localhomstress_->at(gp)(2) - 1.0) +
+          massprodbasal_ * (1.0 + growthfactor * (massstress3 / localhomstress_[gp](2) - 1.0) +
                                sheargrowthfactor * sheardiff);  // /4.0 massstress3
     else
       (*massprodcomp)(2) =
@@ -1811,10 +1811,10 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
   else if (params_->massprodfunc_ == "CosCos")
   {
-    if (localhomstress_->at(gp)(2) != 0.0)
+    if (localhomstress_[gp](2) != 0.0)
     {
       double facstress = 0.0;
-      double deltastress = massstress3 / localhomstress_->at(gp)(2) - 1.0;
+      double deltastress = massstress3 / localhomstress_[gp](2) - 1.0;
       mass_function(growthfactor, deltastress, maxmassprodfac, facstress);
       double facshear = 0.0;
       mass_function(sheargrowthfactor, sheardiff, maxmassprodfac, facshear);
@@ -1838,17 +1838,17 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
 
   // Fiber4
-  temp_vector.multiply(Cmatrix, a4_->at(gp));
-  temp_scalar.multiply_tn(a4_->at(gp), temp_vector);
+  temp_vector.multiply(Cmatrix, a4_[gp]);
+  temp_scalar.multiply_tn(a4_[gp], temp_vector);
   currentstretch = sqrt(temp_scalar(0));
-  temp_vector.multiply(temp2, a4_->at(gp));
-  temp_scalar.multiply_tn(a4_->at(gp), temp_vector);
+  temp_vector.multiply(temp2, a4_[gp]);
+  temp_scalar.multiply_tn(a4_[gp], temp_vector);
   double massstress4 = sqrt(temp_scalar(0)) / currentstretch;
   if (params_->massprodfunc_ == "Lin")
   {
-    if (localhomstress_->at(gp)(3) != 0.0)
+    if (localhomstress_[gp](3) != 0.0)
       (*massprodcomp)(3) =
-          massprodbasal_ * (1.0 + growthfactor * (massstress4 / localhomstress_->at(gp)(3) - 1.0) +
+          massprodbasal_ * (1.0 + growthfactor * (massstress4 / localhomstress_[gp](3) - 1.0) +
                                sheargrowthfactor * sheardiff);  // /4.0 massstress4
     else
       (*massprodcomp)(3) =
@@ -1858,10 +1858,10 @@ void Mat::ConstraintMixture::mass_production(const int gp, Core::LinAlg::Matrix<
   }
   else if (params_->massprodfunc_ == "CosCos")
   {
-    if (localhomstress_->at(gp)(3) != 0.0)
+    if (localhomstress_[gp](3) != 0.0)
     {
       double facstress = 0.0;
-      double deltastress = massstress4 / localhomstress_->at(gp)(3) - 1.0;
+      double deltastress = massstress4 / localhomstress_[gp](3) - 1.0;
       mass_function(growthfactor, deltastress, maxmassprodfac, facstress);
       double facshear = 0.0;
       mass_function(sheargrowthfactor, sheardiff, maxmassprodfac, facshear);
@@ -1941,7 +1941,7 @@ void Mat::ConstraintMixture::mass_production_single_fiber(const int gp,
   temp_scalar.multiply_tn(a, temp_vector);
   double currentstretch = sqrt(temp_scalar(0));
   (*massstress) = sqrt(*massstress) / currentstretch;
-  double homstress = localhomstress_->at(gp)(idfiber);
+  double homstress = localhomstress_[gp](idfiber);
   //  if (idfiber == 2 || idfiber == 3)
   //    homstress = 4. * homstress;
   if (params_->massprodfunc_ == "Lin")
@@ -2252,7 +2252,7 @@ void Mat::ConstraintMixture::evaluate_implicit_all(Core::LinAlg::Matrix<3, 3> de
   //--------------------------------------------------------------------------------------
   // some variables
   const int firstiter = 0;
-  Core::LinAlg::Matrix<4, 1> prestretchcollagen = localprestretch_->at(gp);
+  Core::LinAlg::Matrix<4, 1> prestretchcollagen = localprestretch_.copy(gp);
   // store actual collagen stretches, do not change anymore
   Core::LinAlg::Matrix<4, 1> actcollstretch(true);
   history_->back().get_stretches(gp, &actcollstretch);
@@ -2300,33 +2300,33 @@ void Mat::ConstraintMixture::evaluate_implicit_all(Core::LinAlg::Matrix<3, 3> de
     double stretch = prestretchcollagen(0) / actcollstretch(0);
     Core::LinAlg::Matrix<NUM_STRESS_3D, 1> dstressdmass(true);
     Core::LinAlg::Matrix<NUM_STRESS_3D, 1> dmassdstress(true);
-    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a1_->at(gp), stretch, J, dt, true);
-    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a1_->at(gp), J, massstress(0),
-        localhomstress_->at(gp)(0), actcollstretch(0), growthfactor);
+    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a1_[gp], stretch, J, dt, true);
+    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a1_[gp], J, massstress(0),
+        localhomstress_[gp](0), actcollstretch(0), growthfactor);
     DResidual.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
     stretch = prestretchcollagen(1) / actcollstretch(1);
     dstressdmass.put_scalar(0.0);
     dmassdstress.put_scalar(0.0);
-    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a2_->at(gp), stretch, J, dt, true);
-    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a2_->at(gp), J, massstress(1),
-        localhomstress_->at(gp)(1), actcollstretch(1), growthfactor);
+    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a2_[gp], stretch, J, dt, true);
+    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a2_[gp], J, massstress(1),
+        localhomstress_[gp](1), actcollstretch(1), growthfactor);
     DResidual.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
     stretch = prestretchcollagen(2) / actcollstretch(2);
     dstressdmass.put_scalar(0.0);
     dmassdstress.put_scalar(0.0);
-    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a3_->at(gp), stretch, J, dt, true);
-    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a3_->at(gp), J, massstress(2),
-        localhomstress_->at(gp)(2), actcollstretch(2), growthfactor);
+    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a3_[gp], stretch, J, dt, true);
+    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a3_[gp], J, massstress(2),
+        localhomstress_[gp](2), actcollstretch(2), growthfactor);
     DResidual.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
     stretch = prestretchcollagen(3) / actcollstretch(3);
     dstressdmass.put_scalar(0.0);
     dmassdstress.put_scalar(0.0);
-    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a4_->at(gp), stretch, J, dt, true);
-    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a4_->at(gp), J, massstress(3),
-        localhomstress_->at(gp)(3), actcollstretch(3), growthfactor);
+    grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a4_[gp], stretch, J, dt, true);
+    grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a4_[gp], J, massstress(3),
+        localhomstress_[gp](3), actcollstretch(3), growthfactor);
     DResidual.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
     //----------------------------------------------------
@@ -2409,41 +2409,41 @@ void Mat::ConstraintMixture::evaluate_implicit_all(Core::LinAlg::Matrix<3, 3> de
   Core::LinAlg::Matrix<NUM_STRESS_3D, 1> dmassdstress(true);
   Core::LinAlg::Matrix<NUM_STRESS_3D, 1> dmassdstretch(true);
   Core::LinAlg::Matrix<NUM_STRESS_3D, 1> dstressdmass(true);
-  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a1_->at(gp), J, massstress(0),
-      localhomstress_->at(gp)(0), actcollstretch(0), dt, growthfactor);
-  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a1_->at(gp), J, massstress(0),
-      localhomstress_->at(gp)(0), actcollstretch(0), growthfactor);
-  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a1_->at(gp), stretch, J, dt, true);
+  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a1_[gp], J, massstress(0),
+      localhomstress_[gp](0), actcollstretch(0), dt, growthfactor);
+  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a1_[gp], J, massstress(0),
+      localhomstress_[gp](0), actcollstretch(0), growthfactor);
+  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a1_[gp], stretch, J, dt, true);
   RHS.multiply_nt(2.0, dstressdmass, dmassdstretch, 1.0);
   LM.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
   // Fiber2
   stretch = prestretchcollagen(1) / actcollstretch(1);
-  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a2_->at(gp), J, massstress(1),
-      localhomstress_->at(gp)(1), actcollstretch(1), dt, growthfactor);
-  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a2_->at(gp), J, massstress(1),
-      localhomstress_->at(gp)(1), actcollstretch(1), growthfactor);
-  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a2_->at(gp), stretch, J, dt, true);
+  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a2_[gp], J, massstress(1),
+      localhomstress_[gp](1), actcollstretch(1), dt, growthfactor);
+  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a2_[gp], J, massstress(1),
+      localhomstress_[gp](1), actcollstretch(1), growthfactor);
+  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a2_[gp], stretch, J, dt, true);
   RHS.multiply_nt(2.0, dstressdmass, dmassdstretch, 1.0);
   LM.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
   // Fiber3
   stretch = prestretchcollagen(2) / actcollstretch(2);
-  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a3_->at(gp), J, massstress(2),
-      localhomstress_->at(gp)(2), actcollstretch(2), dt, growthfactor);
-  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a3_->at(gp), J, massstress(2),
-      localhomstress_->at(gp)(2), actcollstretch(2), growthfactor);
-  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a3_->at(gp), stretch, J, dt, true);
+  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a3_[gp], J, massstress(2),
+      localhomstress_[gp](2), actcollstretch(2), dt, growthfactor);
+  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a3_[gp], J, massstress(2),
+      localhomstress_[gp](2), actcollstretch(2), growthfactor);
+  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a3_[gp], stretch, J, dt, true);
   RHS.multiply_nt(2.0, dstressdmass, dmassdstretch, 1.0);
   LM.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
   // Fiber4
   stretch = prestretchcollagen(3) / actcollstretch(3);
-  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a4_->at(gp), J, massstress(3),
-      localhomstress_->at(gp)(3), actcollstretch(3), dt, growthfactor);
-  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a4_->at(gp), J, massstress(3),
-      localhomstress_->at(gp)(3), actcollstretch(3), growthfactor);
-  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a4_->at(gp), stretch, J, dt, true);
+  grad_mass_d_stretch(&dmassdstretch, defgrd, Smatrix, Cinv, a4_[gp], J, massstress(3),
+      localhomstress_[gp](3), actcollstretch(3), dt, growthfactor);
+  grad_mass_d_stress(&dmassdstress, defgrd, Smatrix, a4_[gp], J, massstress(3),
+      localhomstress_[gp](3), actcollstretch(3), growthfactor);
+  grad_stress_d_mass(glstrain, &dstressdmass, Cinv, a4_[gp], stretch, J, dt, true);
   RHS.multiply_nt(2.0, dstressdmass, dmassdstretch, 1.0);
   LM.multiply_nt(-1.0, dstressdmass, dmassdstress, 1.0);
 
@@ -2459,9 +2459,9 @@ void Mat::ConstraintMixture::evaluate_implicit_all(Core::LinAlg::Matrix<3, 3> de
   int err = solver.solve();                // X = A^-1 B
   if ((err != 0) || (err2 != 0)) FOUR_C_THROW("solving linear system for cmat failed");
 
-  vismassstress_->at(gp)(0) = massstress(0);
-  vismassstress_->at(gp)(1) = massstress(1);
-  vismassstress_->at(gp)(2) = massstress(2);
+  vismassstress_[gp](0) = massstress(0);
+  vismassstress_[gp](1) = massstress(1);
+  vismassstress_[gp](2) = massstress(2);
 }
 
 /*----------------------------------------------------------------------*
@@ -2539,16 +2539,16 @@ void Mat::ConstraintMixture::evaluate_implicit_single(Core::LinAlg::Matrix<3, 3>
   {
     Core::LinAlg::Matrix<3, 1> a(true);
     if (idfiber == 0)
-      a = a1_->at(gp);
+      a = a1_[gp];
     else if (idfiber == 1)
-      a = a2_->at(gp);
+      a = a2_[gp];
     else if (idfiber == 2)
-      a = a3_->at(gp);
+      a = a3_[gp];
     else
-      a = a4_->at(gp);
+      a = a4_[gp];
 
-    double homstress = localhomstress_->at(gp)(idfiber);
-    double prestretchcollagen = localprestretch_->at(gp)(idfiber);
+    double homstress = localhomstress_[gp](idfiber);
+    double prestretchcollagen = localprestretch_[gp](idfiber);
     double stretch = prestretchcollagen / actcollstretch(idfiber);
     Core::LinAlg::Matrix<NUM_STRESS_3D, 1> stressfiber(true);
     Core::LinAlg::Matrix<NUM_STRESS_3D, 1> stressresidual(true);
@@ -2744,9 +2744,9 @@ void Mat::ConstraintMixture::evaluate_implicit_single(Core::LinAlg::Matrix<3, 3>
   (*stress) += Svol;
   (*cmat) += cmatvol;
 
-  vismassstress_->at(gp)(0) = massstress(0);
-  vismassstress_->at(gp)(1) = massstress(1);
-  vismassstress_->at(gp)(2) = massstress(2);
+  vismassstress_[gp](0) = massstress(0);
+  vismassstress_[gp](1) = massstress(1);
+  vismassstress_[gp](2) = massstress(2);
   refmassdens_->at(gp) = currmassdens;
 }
 
@@ -2915,13 +2915,13 @@ void Mat::ConstraintMixture::evaluate_fiber_vecs(const int gp,
 
   // normalize vectors
   double a1_0norm = a1_0.norm2();
-  a1_->at(gp).update(1.0 / a1_0norm, a1_0);
+  a1_[gp].update(1.0 / a1_0norm, a1_0);
   double a2_0norm = a2_0.norm2();
-  a2_->at(gp).update(1.0 / a2_0norm, a2_0);
+  a2_[gp].update(1.0 / a2_0norm, a2_0);
   double a3_0norm = a3_0.norm2();
-  a3_->at(gp).update(1.0 / a3_0norm, a3_0);
+  a3_[gp].update(1.0 / a3_0norm, a3_0);
   double a4_0norm = a4_0.norm2();
-  a4_->at(gp).update(1.0 / a4_0norm, a4_0);
+  a4_[gp].update(1.0 / a4_0norm, a4_0);
 
   return;
 }
@@ -2963,7 +2963,7 @@ bool Mat::ConstraintMixture::vis_data(
   {
     if ((int)data.size() != 3) FOUR_C_THROW("size mismatch");
     Core::LinAlg::Matrix<3, 1> temp(true);
-    for (int iter = 0; iter < numgp; iter++) temp.update(1.0, vismassstress_->at(iter), 1.0);
+    for (int iter = 0; iter < numgp; iter++) temp.update(1.0, vismassstress_[iter], 1.0);
     data[0] = temp(0) / numgp;
     data[1] = temp(1) / numgp;
     data[2] = temp(2) / numgp;
@@ -2971,7 +2971,7 @@ bool Mat::ConstraintMixture::vis_data(
   else if (name == "Fiber1")
   {
     if ((int)data.size() != 3) FOUR_C_THROW("size mismatch");
-    Core::LinAlg::Matrix<3, 1> a1 = a1_->at(0);  // get a1 of first gp
+    Core::LinAlg::Matrix<3, 1> a1 = a1_.copy(0);  // get a1 of first gp
     data[0] = a1(0);
     data[1] = a1(1);
     data[2] = a1(2);
@@ -2979,7 +2979,7 @@ bool Mat::ConstraintMixture::vis_data(
   else if (name == "Fiber2")
   {
     if ((int)data.size() != 3) FOUR_C_THROW("size mismatch");
-    Core::LinAlg::Matrix<3, 1> a2 = a2_->at(0);  // get a2 of first gp
+    Core::LinAlg::Matrix<3, 1> a2 = a2_.copy(0);  // get a2 of first gp
     data[0] = a2(0);
     data[1] = a2(1);
     data[2] = a2(2);
@@ -2995,7 +2995,7 @@ bool Mat::ConstraintMixture::vis_data(
   {
     if ((int)data.size() != 3) FOUR_C_THROW("size mismatch");
     Core::LinAlg::Matrix<3, 1> temp(true);
-    for (int iter = 0; iter < numgp; iter++) temp.update(1.0, visrefmassdens_->at(iter), 1.0);
+    for (int iter = 0; iter < numgp; iter++) temp.update(1.0, visrefmassdens_[iter], 1.0);
     data[0] = temp(0) / numgp;
     data[1] = temp(1) / numgp;
     data[2] = temp(2) / numgp;
@@ -12,6 +12,7 @@
 #include "4C_config.hpp"
 
 #include "4C_comm_parobjectfactory.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_mat_so3_material.hpp"
 #include "4C_material_parameter_base.hpp"
 
@@ -256,36 +257,36 @@ namespace Mat
     Core::Mat::PAR::Parameter* parameter() const override { return params_; }
 
     /// Return variables for visualization
-    Core::LinAlg::Matrix<3, 1> get_vis(int gp) const { return vismassstress_->at(gp); }
+    Core::LinAlg::Matrix<3, 1> get_vis(int gp) const { return vismassstress_.copy(gp); }
     /// Return actual mass density in reference configuration
     double get_mass_density(int gp) const { return refmassdens_->at(gp); }
     /// Return actual mass density in reference configuration
     Core::LinAlg::Matrix<3, 1> get_mass_density_collagen(int gp) const
     {
-      return visrefmassdens_->at(gp);
+      return visrefmassdens_.copy(gp);
     }
     /// Return prestretch of collagen fibers
     Core::LinAlg::Matrix<3, 1> get_prestretch(int gp) const
     {
       Core::LinAlg::Matrix<3, 1> visprestretch(true);
-      visprestretch(0) = localprestretch_->at(gp)(0);
-      visprestretch(1) = localprestretch_->at(gp)(1);
-      visprestretch(2) = localprestretch_->at(gp)(2);
+      visprestretch(0) = localprestretch_[gp](0);
+      visprestretch(1) = localprestretch_[gp](1);
+      visprestretch(2) = localprestretch_[gp](2);
       return visprestretch;
     }
     /// Return prestretch of collagen fibers
     Core::LinAlg::Matrix<3, 1> get_homstress(int gp) const
     {
       Core::LinAlg::Matrix<3, 1> visprestretch(true);
-      visprestretch(0) = localhomstress_->at(gp)(0);
-      visprestretch(1) = localhomstress_->at(gp)(1);
-      visprestretch(2) = localhomstress_->at(gp)(2);
+      visprestretch(0) = localhomstress_[gp](0);
+      visprestretch(1) = localhomstress_[gp](1);
+      visprestretch(2) = localhomstress_[gp](2);
       return visprestretch;
     }
     /// Return circumferential fiber direction
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> geta1() const { return a1_; }
+    const GaussPointHistory<3>& geta1() const { return a1_; }
     /// Return axial fiber direction
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> geta2() const { return a2_; }
+    const GaussPointHistory<3>& geta2() const { return a2_; }
 
     /// evaluate fiber directions from locsys, pull back
     void evaluate_fiber_vecs(const int gp, const Core::LinAlg::Matrix<3, 3>& locsys,
@@ -303,26 +304,26 @@ namespace Mat
     Mat::PAR::ConstraintMixture* params_;
 
     /// temporary for visualization
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> vismassstress_;
+    GaussPointHistory<3> vismassstress_;
     /// actual mass density in reference configuration
     std::shared_ptr<std::vector<double>> refmassdens_;
     /// actual mass density in reference configuration for collagen fibers
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> visrefmassdens_;
+    GaussPointHistory<3> visrefmassdens_;
     /// basal rate of mass production
     double massprodbasal_;
 
     /// first fiber vector per gp (reference), circumferential
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> a1_;
+    GaussPointHistory<3> a1_;
     /// second fiber vector per gp (reference), axial
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> a2_;
+    GaussPointHistory<3> a2_;
     /// third fiber vector per gp (reference), diagonal
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> a3_;
+    GaussPointHistory<3> a3_;
     /// fourth fiber vector per gp (reference), diagonal
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<3, 1>>> a4_;
+    GaussPointHistory<3> a4_;
     /// homeostatic prestretch of collagen fibers
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<4, 1>>> localprestretch_;
+    GaussPointHistory<4> localprestretch_;
     /// homeostatic stress for growth
-    std::shared_ptr<std::vector<Core::LinAlg::Matrix<4, 1>>> localhomstress_;
+    GaussPointHistory<4> localhomstress_;
     /// homeostatic radius
     double homradius_;
     /// list of fibers which have been overstretched and are deleted at the end of the time step
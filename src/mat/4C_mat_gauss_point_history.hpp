@@ -0,0 +1,112 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_MAT_GAUSS_POINT_HISTORY_HPP
+#define FOUR_C_MAT_GAUSS_POINT_HISTORY_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_comm_pack_helpers.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+
+#include <algorithm>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Mat
+{
+  /*!
+   * \brief History variable of a material with a fixed size matrix at each Gauss point
+   *
+   * The values of all Gauss points are stored in one contiguous array instead of one
+   * Core::LinAlg::Matrix object per Gauss point. A single Gauss point is accessed by a view into
+   * this array. Copying the whole history (e.g., last converged state <-- current state) is done
+   * on the array as a whole.
+   *
+   * \note operator[] returns a view. Initializing a Core::LinAlg::Matrix with the result also
+   *       gives a view, use copy(gp) to get an independent copy of the values.
+   */
+  template <unsigned int rows, unsigned int cols = 1>
+  class GaussPointHistory
+  {
+   public:
+    //! number of values per Gauss point
+    static constexpr unsigned int size_per_gp = rows * cols;
+
+    //! Resize to @p numgp Gauss points, new Gauss points are set to zero
+    void resize(int numgp) { values_.resize(numgp * size_per_gp, 0.0); }
+
+    //! Resize to @p numgp Gauss points and set all of them to @p value
+    void assign(int numgp, const Core::LinAlg::Matrix<rows, cols>& value)
+    {
+      values_.resize(numgp * size_per_gp);
+      for (int gp = 0; gp < numgp; ++gp)
+        std::copy(value.data(), value.data() + size_per_gp, data(gp));
+    }
+
+    //! number of Gauss points
+    [[nodiscard]] int size() const { return values_.size() / size_per_gp; }
+
+    //! view of the values at Gauss point @p gp
+    Core::LinAlg::Matrix<rows, cols> operator[](int gp)
+    {
+      return Core::LinAlg::Matrix<rows, cols>(data(gp), true);
+    }
+
+    //! read-only view of the values at Gauss point @p gp
+    Core::LinAlg::Matrix<rows, cols> operator[](int gp) const
+    {
+      return Core::LinAlg::Matrix<rows, cols>(data(gp), true);
+    }
+
+    //! copy of the values at Gauss point @p gp
+    [[nodiscard]] Core::LinAlg::Matrix<rows, cols> copy(int gp) const
+    {
+      return Core::LinAlg::Matrix<rows, cols>(data(gp), false);
+    }
+
+    //! pointer to the (column-major) values at Gauss point @p gp
+    double* data(int gp) { return values_.data() + gp * size_per_gp; }
+
+    //! pointer to the (column-major) values at Gauss point @p gp
+    [[nodiscard]] const double* data(int gp) const { return values_.data() + gp * size_per_gp; }
+
+    /*!
+     * \brief Pack the values of all Gauss points
+     *
+     * The layout is the one of a packed std::vector<Core::LinAlg::Matrix<rows, cols>>, such that
+     * restart files written before the history was stored contiguously can still be read.
+     */
+    void pack(Core::Communication::PackBuffer& buffer) const
+    {
+      Core::Communication::add_to_pack(buffer, size());
+      for (int gp = 0; gp < size(); ++gp) Core::Communication::add_to_pack(buffer, (*this)[gp]);
+    }
+
+    //! Unpack the values of all Gauss points
+    void unpack(Core::Communication::UnpackBuffer& buffer)
+    {
+      int numgp = 0;
+      Core::Communication::extract_from_pack(buffer, numgp);
+      values_.resize(numgp * size_per_gp);
+      for (int gp = 0; gp < numgp; ++gp)
+      {
+        Core::LinAlg::Matrix<rows, cols> values = (*this)[gp];
+        Core::Communication::extract_from_pack(buffer, values);
+      }
+    }
+
+   private:
+    //! values of all Gauss points, one block of size_per_gp values after the other
+    std::vector<double> values_;
+  };
+}  // namespace Mat
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
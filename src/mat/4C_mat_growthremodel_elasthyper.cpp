@@ -409,7 +409,7 @@ void Mat::GrowthRemodelElastHyper::setup(
   gp_rad_.resize(numgp, 0.0);
   cur_rho_el_.resize(numgp);
   init_rho_el_.resize(numgp);
-  gm_.resize(numgp, Core::LinAlg::Matrix<3, 3>(true));
+  gm_.resize(numgp);
   setup_.resize(numgp, 1);
 
   for (int gp = 0; gp < numgp; ++gp)
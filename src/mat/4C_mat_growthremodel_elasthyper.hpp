@@ -14,6 +14,7 @@
 #include "4C_comm_parobjectfactory.hpp"
 #include "4C_linalg_FADmatrix_utils.hpp"
 #include "4C_mat_anisotropy.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_mat_membrane_material_interfaces.hpp"
 #include "4C_mat_so3_material.hpp"
 #include "4C_material_parameter_base.hpp"
@@ -495,7 +496,7 @@ namespace Mat
 
     /// Prestretch of elastin matrix in axial, circumferential and radial direction (used for
     /// prestressing)
-    std::vector<Core::LinAlg::Matrix<3, 3>> gm_;
+    GaussPointHistory<3, 3> gm_;
 
     /// Total simulation time
     double t_tot_;
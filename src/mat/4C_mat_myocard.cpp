@@ -18,6 +18,7 @@
 
 #include <Teuchos_ENull.hpp>
 
+#include <algorithm>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -35,6 +36,8 @@ Mat::PAR::Myocard::Myocard(const Core::Mat::PAR::Parameter::Data& matdata)
       model(matdata.parameters.get<std::string>("MODEL")),
       tissue(matdata.parameters.get<std::string>("TISSUE")),
       time_scale(matdata.parameters.get<double>("TIME_SCALE")),
+      gating_integrator(
+          matdata.parameters.get<Inpar::Mat::GatingIntegrator>("GATING_INTEGRATOR")),
       num_gp(0)
 {
 }
@@ -448,6 +451,46 @@ double Mat::Myocard::rea_coeff_deriv(const double phi, const double dt, int gp)
 }
 
 
+/*----------------------------------------------------------------------*/
+void Mat::Myocard::rea_coeff_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) const
+{
+  myocard_mat_->rea_coeff_all_gp(phi, dt * params_->time_scale, reacoeff);
+  for (double& val : reacoeff) val *= params_->time_scale;
+}
+
+
+/*----------------------------------------------------------------------*/
+void Mat::Myocard::rea_coeff_n_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) const
+{
+  myocard_mat_->rea_coeff_n_all_gp(phi, dt * params_->time_scale, reacoeff);
+  for (double& val : reacoeff) val *= params_->time_scale;
+}
+
+
+/*----------------------------------------------------------------------*/
+void Mat::Myocard::rea_coeff_deriv_all_gp(const std::vector<double>& phi, const double dt,
+    std::vector<double>& reacoeff, std::vector<double>& reacoeff_deriv) const
+{
+  if (params_->dt_deriv != 0.0)
+  {
+    // perturbed evaluation first, such that the internal state corresponds to phi afterwards
+    std::vector<double> phi_perturbed(phi);
+    for (double& val : phi_perturbed) val += params_->dt_deriv;
+    rea_coeff_all_gp(phi_perturbed, dt, reacoeff_deriv);
+    rea_coeff_all_gp(phi, dt, reacoeff);
+    for (unsigned gp = 0; gp < phi.size(); ++gp)
+      reacoeff_deriv[gp] = (reacoeff_deriv[gp] - reacoeff[gp]) / (params_->dt_deriv);
+  }
+  else
+  {
+    rea_coeff_all_gp(phi, dt, reacoeff);
+    std::fill(reacoeff_deriv.begin(), reacoeff_deriv.end(), 0.0);
+  }
+}
+
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables              cbert 08/13 |
  *----------------------------------------------------------------------*/
@@ -533,9 +576,13 @@ double Mat::Myocard::get_ionic_currents(const int k) const
  *----------------------------------------------------------------------*/
 void Mat::Myocard::initialize()
 {
+  const bool rush_larsen = (params_->gating_integrator == Inpar::Mat::gating_rush_larsen);
+  if (rush_larsen and params_->model != "MV")
+    FOUR_C_THROW("The Rush-Larsen integrator is only implemented for the MV model");
+
   if ((params_->model) == "MV")
-    myocard_mat_ =
-        std::make_shared<MyocardMinimal>(params_->dt_deriv, (params_->tissue), params_->num_gp);
+    myocard_mat_ = std::make_shared<MyocardMinimal>(params_->dt_deriv, (params_->tissue),
+        params_->num_gp, rush_larsen);
   else if ((params_->model) == "FHN")
     myocard_mat_ = std::make_shared<MyocardFitzhughNagumo>(
         params_->dt_deriv, (params_->tissue), params_->num_gp);
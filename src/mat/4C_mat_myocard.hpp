@@ -14,6 +14,7 @@
 #include "4C_config.hpp"
 
 #include "4C_comm_parobjectfactory.hpp"
+#include "4C_inpar_material.hpp"
 #include "4C_linalg_fixedsizematrix.hpp"
 #include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_serialdensevector.hpp"
@@ -60,6 +61,9 @@ namespace Mat
       /// Time factor to correct for different Model specific time units
       const double time_scale;
 
+      /// Time integration of the gating variables (Rush-Larsen only for "MV")
+      const Inpar::Mat::GatingIntegrator gating_integrator;
+
       /// Number of Gauss Points for evaluating the material, i.e. the nonlinear reaction term
       int num_gp;
       //@}
@@ -207,6 +211,18 @@ namespace Mat
     /// compute reaction coefficient derivative for multiple points per element
     double rea_coeff_deriv(const double phi, const double dt, int gp) const;
 
+    /// compute reaction coefficients of all points per element at once
+    void rea_coeff_all_gp(
+        const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) const;
+
+    /// compute reaction coefficients of all points per element at once at timestep n
+    void rea_coeff_n_all_gp(
+        const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) const;
+
+    /// compute reaction coefficients and their derivatives of all points per element at once
+    void rea_coeff_deriv_all_gp(const std::vector<double>& phi, const double dt,
+        std::vector<double>& reacoeff, std::vector<double>& reacoeff_deriv) const;
+
     /// compute Heaviside step function
     double gating_function(const double Gate1, const double Gate2, const double p, const double var,
         const double thresh) const;
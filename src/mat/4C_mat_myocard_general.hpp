@@ -13,6 +13,7 @@
 #include "4C_utils_exceptions.hpp"
 
 #include <string>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -47,6 +48,21 @@ class MyocardGeneral
   /// compute reaction coefficient at timestep n
   virtual double rea_coeff_n(const double phi, const double dt) { return 0; };
 
+  /// compute reaction coefficients of all Gauss points at once (phi and reacoeff are indexed by
+  /// Gauss point)
+  virtual void rea_coeff_all_gp(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+  {
+    for (unsigned gp = 0; gp < phi.size(); ++gp) reacoeff[gp] = rea_coeff(phi[gp], dt, gp);
+  };
+
+  /// compute reaction coefficients of all Gauss points at once at timestep n
+  virtual void rea_coeff_n_all_gp(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+  {
+    for (unsigned gp = 0; gp < phi.size(); ++gp) reacoeff[gp] = rea_coeff_n(phi[gp], dt, gp);
+  };
+
   /// compute reaction coefficient for multiple Gauss points at timestep n
   virtual double rea_coeff_n(const double phi, const double dt, int gp)
   {
@@ -11,6 +11,7 @@
 #include "4C_global_data.hpp"
 #include "4C_mat_par_bundle.hpp"
 
+#include <cmath>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -24,8 +25,10 @@ MyocardMinimal::MyocardMinimal() {}
 /*----------------------------------------------------------------------*
  |  Constructor                                    (public)  cbert 08/13 |
  *----------------------------------------------------------------------*/
-MyocardMinimal::MyocardMinimal(const double eps_deriv_myocard, const std::string tissue, int num_gp)
+MyocardMinimal::MyocardMinimal(
+    const double eps_deriv_myocard, const std::string tissue, int num_gp, const bool rush_larsen)
     : tools_(),
+      rush_larsen_(rush_larsen),
       v0_(num_gp),
       w0_(num_gp),
       s0_(num_gp),
@@ -308,14 +311,14 @@ double MyocardMinimal::rea_coeff(const double phi, const double dt, int gp)
   // calculate gating variables according to [8]
   double Tau_v = tools_.gating_function(Tau_vm, tau_vp_, p, phi, theta_v_);
   double v_inf_GF = tools_.gating_function(v_inf, 0.0, p, phi, theta_v_);
-  v_[gp] = tools_.gating_var_calc(dt, v0_[gp], v_inf_GF, Tau_v);
+  v_[gp] = gating_var_calc(dt, v0_[gp], v_inf_GF, Tau_v);
 
   double Tau_w = tools_.gating_function(Tau_wm, tau_wp_, p, phi, theta_w_);
   double w_inf_GF = tools_.gating_function(w_inf, 0.0, p, phi, theta_w_);
-  w_[gp] = tools_.gating_var_calc(dt, w0_[gp], w_inf_GF, Tau_w);
+  w_[gp] = gating_var_calc(dt, w0_[gp], w_inf_GF, Tau_w);
 
   const double s_inf = tools_.gating_function(0.0, 1.0, k_s_, phi, u_s_);
-  s_[gp] = tools_.gating_var_calc(dt, s0_[gp], s_inf, Tau_s);
+  s_[gp] = gating_var_calc(dt, s0_[gp], s_inf, Tau_s);
 
   // calculate currents J_fi, J_so and J_si ([7] page 545)
   jfi_[gp] =
@@ -363,6 +366,112 @@ double MyocardMinimal::rea_coeff_n(const double phi, const double dt, int gp)
   return reacoeff;
 }
 
+/*----------------------------------------------------------------------*
+ |  evaluate step functions for all Gauss points                         |
+ *----------------------------------------------------------------------*/
+void MyocardMinimal::evaluate_step_functions(const std::vector<double>& phi)
+{
+  const double p = 1000.0;
+  const std::array<std::array<double, 2>, num_step_functions> slope_and_threshold{{{p, theta_v_},
+      {p, theta_w_}, {p, theta_vm_}, {p, theta_o_}, {k_wm_, u_wm_}, {k_so_, u_so_}, {k_s_, u_s_}}};
+
+  // the transcendental functions are evaluated in separate loops over contiguous arrays, which
+  // allows the compiler to use vectorized implementations
+  for (int k = 0; k < num_step_functions; ++k)
+  {
+    const double slope = slope_and_threshold[k][0];
+    const double threshold = slope_and_threshold[k][1];
+    std::vector<double>& step = step_[k];
+    step.resize(phi.size());
+    for (unsigned gp = 0; gp < phi.size(); ++gp)
+      step[gp] = (1.0 + std::tanh(slope * (phi[gp] - threshold))) / 2;
+  }
+}
+
+/*----------------------------------------------------------------------*
+ |  reaction coefficient for all Gauss points at once                   |
+ *----------------------------------------------------------------------*/
+void MyocardMinimal::rea_coeff_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  FOUR_C_ASSERT(
+      phi.size() == v_.size() and reacoeff.size() == v_.size(), "Number of gp does not match");
+  evaluate_step_functions(phi);
+
+  // same operations as in rea_coeff(), which are only arithmetic operations on the state arrays
+  // given the step functions
+  for (unsigned gp = 0; gp < phi.size(); ++gp)
+  {
+    const double u = phi[gp];
+    const double H_v = step_[step_v][gp];
+    const double H_w = step_[step_w][gp];
+    const double H_vm = step_[step_vm][gp];
+    const double H_o = step_[step_o][gp];
+
+    // calculate voltage dependent time constants ([7] page 545)
+    const double Tau_vm = blend(tau_v1m_, tau_v2m_, H_vm);
+    const double Tau_wm = blend(tau_w1m_, tau_w2m_, step_[step_wm][gp]);
+    const double Tau_so = blend(tau_so1_, tau_so2_, step_[step_so][gp]);
+    const double Tau_s = blend(tau_s1_, tau_s2_, H_w);
+    const double Tau_o = blend(tau_o1_, tau_o2_, H_o);
+
+    // calculate infinity values ([7] page 545)
+    const double v_inf = blend(1.0, 0.0, H_vm);
+    const double w_inf = blend(1.0 - u / tau_winf_, w_infs_, H_o);
+
+    // calculate gating variables according to [8]
+    const double Tau_v = blend(Tau_vm, tau_vp_, H_v);
+    v_[gp] = gating_var_calc(dt, v0_[gp], blend(v_inf, 0.0, H_v), Tau_v);
+
+    const double Tau_w = blend(Tau_wm, tau_wp_, H_w);
+    w_[gp] = gating_var_calc(dt, w0_[gp], blend(w_inf, 0.0, H_w), Tau_w);
+
+    s_[gp] = gating_var_calc(dt, s0_[gp], blend(0.0, 1.0, step_[step_s][gp]), Tau_s);
+
+    // calculate currents J_fi, J_so and J_si ([7] page 545)
+    jfi_[gp] = -blend(0.0, v_[gp] * (u - theta_v_) * (u_u_ - u) / tau_fi_, H_v);
+    jso_[gp] = blend((u - u_o_) / Tau_o, 1.0 / Tau_so, H_w);
+    jsi_[gp] = -blend(0.0, w_[gp] * s_[gp] / tau_si_, H_w);
+
+    reacoeff[gp] = (jfi_[gp] + jso_[gp] + jsi_[gp]);
+  }
+
+  // Store necessary variables for mechanical activation and electromechanical coupling
+  if (!phi.empty()) mechanical_activation_ = phi.back();
+}
+
+/*----------------------------------------------------------------------*
+ |  reaction coefficient for all Gauss points at once at timestep n     |
+ *----------------------------------------------------------------------*/
+void MyocardMinimal::rea_coeff_n_all_gp(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  FOUR_C_ASSERT(
+      phi.size() == v_.size() and reacoeff.size() == v_.size(), "Number of gp does not match");
+  evaluate_step_functions(phi);
+
+  for (unsigned gp = 0; gp < phi.size(); ++gp)
+  {
+    const double u = phi[gp];
+    const double H_v = step_[step_v][gp];
+    const double H_w = step_[step_w][gp];
+
+    // calculate voltage dependent time constants ([7] page 545)
+    const double Tau_so = blend(tau_so1_, tau_so2_, step_[step_so][gp]);
+    const double Tau_o = blend(tau_o1_, tau_o2_, step_[step_o][gp]);
+
+    // calculate currents J_fi, J_so and J_si ([7] page 545)
+    jfi_[gp] = -blend(0.0, v0_[gp] * (u - theta_v_) * (u_u_ - u) / tau_fi_, H_v);
+    jso_[gp] = blend((u - u_o_) / Tau_o, 1.0 / Tau_so, H_w);
+    jsi_[gp] = -blend(0.0, w0_[gp] * s0_[gp] / tau_si_, H_w);
+
+    reacoeff[gp] = (jfi_[gp] + jso_[gp] + jsi_[gp]);
+  }
+
+  // Store necessary variables for mechanical activation and electromechanical coupling
+  if (!phi.empty()) mechanical_activation_ = phi.back();
+}
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables of the material  cbert 08/13 |
  *----------------------------------------------------------------------*/
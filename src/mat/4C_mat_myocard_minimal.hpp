@@ -22,6 +22,9 @@
 #include "4C_material_base.hpp"
 #include "4C_material_parameter_base.hpp"
 
+#include <array>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*/
@@ -47,7 +50,8 @@ class MyocardMinimal : public MyocardGeneral
   MyocardMinimal();
 
   /// construct empty material object
-  explicit MyocardMinimal(const double eps_deriv_myocard, const std::string tissue, int num_gp);
+  explicit MyocardMinimal(const double eps_deriv_myocard, const std::string tissue, int num_gp,
+      const bool rush_larsen = false);
 
   /// compute reaction coefficient
   double rea_coeff(const double phi, const double dt) override;
@@ -58,6 +62,14 @@ class MyocardMinimal : public MyocardGeneral
   /// compute reaction coefficient for multiple points per element at timestep n
   double rea_coeff_n(const double phi, const double dt, int gp) override;
 
+  /// compute reaction coefficients of all points per element at once
+  void rea_coeff_all_gp(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) override;
+
+  /// compute reaction coefficients of all points per element at once at timestep n
+  void rea_coeff_n_all_gp(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) override;
+
   ///  returns number of internal state variables of the material
   int get_number_of_internal_state_variables() const override;
 
@@ -93,8 +105,43 @@ class MyocardMinimal : public MyocardGeneral
 
 
  private:
+  /// voltage dependent step functions of the model, i.e. (1 + tanh(p*(phi - threshold)))/2
+  enum StepFunction
+  {
+    step_v,   // threshold theta_v
+    step_w,   // threshold theta_w
+    step_vm,  // threshold theta_vm
+    step_o,   // threshold theta_o
+    step_wm,  // threshold u_wm
+    step_so,  // threshold u_so
+    step_s,   // threshold u_s
+    num_step_functions
+  };
+
+  /// evaluate all step functions for the potential at all points per element
+  void evaluate_step_functions(const std::vector<double>& phi);
+
+  /// gating function Gate1 + (Gate2 - Gate1)*step for an evaluated step function
+  static double blend(const double Gate1, const double Gate2, const double step)
+  {
+    return Gate1 + (Gate2 - Gate1) * step;
+  }
+
+  /// compute gating variable 'y' from dy/dt = (y_inf-y)/y_tau with the chosen integrator
+  double gating_var_calc(const double dt, double y_0, const double y_inf, const double y_tau) const
+  {
+    return rush_larsen_ ? tools_.gating_var_calc_rush_larsen(dt, y_0, y_inf, y_tau)
+                        : tools_.gating_var_calc(dt, y_0, y_inf, y_tau);
+  }
+
   MyocardTools tools_;
 
+  /// integrate the gating variables with the Rush-Larsen scheme instead of implicit Euler
+  bool rush_larsen_ = false;
+
+  /// step functions of all points per element (one array per step function)
+  std::array<std::vector<double>, num_step_functions> step_;
+
   /// perturbation for numerical approximation of the derivative
   double eps_deriv_;
 
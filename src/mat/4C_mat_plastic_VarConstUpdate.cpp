@@ -433,7 +433,8 @@ void Mat::PlasticElastHyperVCU::evaluate(const Core::LinAlg::Matrix<3, 3>* defgr
     PlasticElastHyper::evaluate_elast(defgrd, &dLp, stress, &tangent_elast, gp, eleGID);
 
     Core::LinAlg::Matrix<6, 9> dPK2dFpinvIsoprinc;
-    dpk2d_fpi(gp, eleGID, defgrd, &plastic_defgrd_inverse_[gp], dPK2dFpinvIsoprinc);
+    const Core::LinAlg::Matrix<3, 3> fpi = plastic_defgrd_inverse_[gp];
+    dpk2d_fpi(gp, eleGID, defgrd, &fpi, dPK2dFpinvIsoprinc);
 
     Core::LinAlg::Matrix<6, 6> mixedDeriv;
     mixedDeriv.multiply(dPK2dFpinvIsoprinc, dFpiDdeltaDp);
@@ -461,12 +462,9 @@ void Mat::PlasticElastHyperVCU::evaluate(const Core::LinAlg::Matrix<3, 3>* defgr
 void Mat::PlasticElastHyperVCU::update()
 {
   // update local history data F_n <-- F_{n+1}
-  for (unsigned gp = 0; gp < last_plastic_defgrd_inverse_.size(); ++gp)
-  {
-    // for a real plastic update, update the plastic history here
-    last_plastic_defgrd_inverse_[gp] = plastic_defgrd_inverse_[gp];
+  last_plastic_defgrd_inverse_ = plastic_defgrd_inverse_;
+  for (unsigned gp = 0; gp < last_alpha_isotropic_.size(); ++gp)
     last_alpha_isotropic_[gp] += delta_alpha_i_[gp];
-  }
 
   return;
 };
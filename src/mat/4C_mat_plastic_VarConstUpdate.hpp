@@ -382,7 +382,7 @@ namespace Mat
     Inpar::TSI::DissipationMode dis_mode() const override { return Inpar::TSI::pl_flow; }
 
     /// inverse plastic deformation gradient for each Gauss point at current state
-    std::vector<Core::LinAlg::Matrix<3, 3>> plastic_defgrd_inverse_;
+    GaussPointHistory<3, 3> plastic_defgrd_inverse_;
 
     /// my material parameters
     Mat::PAR::PlasticElastHyperVCU* params_;
@@ -357,9 +357,9 @@ void Mat::PlasticElastHyper::setup(int numgp, const Core::IO::InputParameterCont
   // setup plastic history variables
   Core::LinAlg::Matrix<3, 3> tmp(true);
   last_alpha_isotropic_.resize(numgp, 0.);
-  last_alpha_kinematic_.resize(numgp, tmp);
+  last_alpha_kinematic_.assign(numgp, tmp);
   for (int i = 0; i < 3; i++) tmp(i, i) = 1.;
-  last_plastic_defgrd_inverse_.resize(numgp, tmp);
+  last_plastic_defgrd_inverse_.assign(numgp, tmp);
   activity_state_.resize(numgp, false);
   delta_alpha_i_.resize(numgp, 0.);
 }
@@ -1960,7 +1960,7 @@ void Mat::PlasticElastHyper::update_gp(const int gp, const Core::LinAlg::Matrix<
     Core::LinAlg::Matrix<3, 3> tmp;
     tmp.update(-1., *deltaDp);
     Core::LinAlg::Matrix<3, 3> exp_tmp = Core::LinAlg::matrix_exp(tmp);
-    Core::LinAlg::Matrix<3, 3> fpi_last = last_plastic_defgrd_inverse_[gp];
+    Core::LinAlg::Matrix<3, 3> fpi_last = last_plastic_defgrd_inverse_.copy(gp);
     last_plastic_defgrd_inverse_[gp].multiply(fpi_last, exp_tmp);
     // update isotropic hardening
     last_alpha_isotropic_[gp] += delta_alpha_i_[gp];
@@ -1982,7 +1982,7 @@ void Mat::PlasticElastHyper::evaluate_kin_quant_elast(const Core::LinAlg::Matrix
 {
   Core::LinAlg::Matrix<3, 3> tmp;
   Core::LinAlg::Matrix<3, 3> invpldefgrd;
-  Core::LinAlg::Matrix<3, 3>& InvPlasticDefgrdLast = last_plastic_defgrd_inverse_[gp];
+  const Core::LinAlg::Matrix<3, 3> InvPlasticDefgrdLast = last_plastic_defgrd_inverse_[gp];
   tmp.update(-1., *deltaLp);
   Core::LinAlg::Matrix<3, 3> exp_tmp = Core::LinAlg::matrix_exp(tmp);
   invpldefgrd.multiply(InvPlasticDefgrdLast, exp_tmp);
@@ -2048,7 +2048,7 @@ int Mat::PlasticElastHyper::evaluate_kin_quant_plast(const Core::LinAlg::Matrix<
   }
   Core::LinAlg::Matrix<3, 3> tmp;
   Core::LinAlg::Matrix<3, 3> tmp33;
-  Core::LinAlg::Matrix<3, 3>& InvPlasticDefgrdLast = last_plastic_defgrd_inverse_[gp];
+  const Core::LinAlg::Matrix<3, 3> InvPlasticDefgrdLast = last_plastic_defgrd_inverse_[gp];
   tmp.update(-1., *deltaLp);
   Core::LinAlg::Matrix<3, 3> exp_tmp = Core::LinAlg::matrix_exp(tmp);
   invpldefgrd_.multiply(InvPlasticDefgrdLast, exp_tmp);
@@ -2340,7 +2340,7 @@ bool Mat::PlasticElastHyper::vis_data(
     std::vector<double> tmp(9, 0.);
     for (std::size_t gp = 0; gp < last_alpha_kinematic_.size(); ++gp)
     {
-      const double* values = last_alpha_kinematic_[gp].data();
+      const double* values = last_alpha_kinematic_.data(gp);
       for (std::size_t i = 0; i < 9; ++i)
       {
         tmp[i] += values[i];
@@ -2404,7 +2404,7 @@ bool Mat::PlasticElastHyper::evaluate_output_data(
   {
     for (std::size_t gp = 0; gp < last_alpha_kinematic_.size(); ++gp)
     {
-      const double* values = last_alpha_kinematic_[gp].data();
+      const double* values = last_alpha_kinematic_.data(gp);
       for (std::size_t i = 0; i < 9; ++i)
       {
         data(gp, i) = values[i];
@@ -15,6 +15,7 @@
 #include "4C_comm_parobjectfactory.hpp"
 #include "4C_inpar_tsi.hpp"
 #include "4C_mat_elasthyper.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_mat_so3_material.hpp"
 #include "4C_material_parameter_base.hpp"
 
@@ -572,13 +573,13 @@ namespace Mat
     Core::LinAlg::Matrix<6, 6> InvPlAniso_full_;
 
     /// inverse plastic deformation gradient for each Gauss point at last converged state
-    std::vector<Core::LinAlg::Matrix<3, 3>> last_plastic_defgrd_inverse_;
+    GaussPointHistory<3, 3> last_plastic_defgrd_inverse_;
 
     /// accumulated plastic strain for each Gauss point at last converged state
     std::vector<double> last_alpha_isotropic_;
 
     /// accumulated plastic strain for each Gauss point at last converged state
-    std::vector<Core::LinAlg::Matrix<3, 3>> last_alpha_kinematic_;
+    GaussPointHistory<3, 3> last_alpha_kinematic_;
 
     /// classification, if the Gauss point is currently in the active (true) or inactive (false) set
     std::vector<bool> activity_state_;
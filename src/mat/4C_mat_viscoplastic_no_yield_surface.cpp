@@ -145,11 +145,11 @@ void Mat::ViscoPlasticNoYieldSurface::setup(
   // initialize last inverse plastic deformation gradient as identity
   Core::LinAlg::Matrix<3, 3> id2(true);
   for (int i = 0; i < 3; ++i) id2(i, i) = 1.0;
-  last_plastic_defgrd_inverse_.resize(numgp, id2);
+  last_plastic_defgrd_inverse_.assign(numgp, id2);
 
   // initialize current history variables (values do not matter)
   current_flowres_isotropic_.resize(numgp, 0.0);
-  current_plastic_defgrd_inverse_.resize(numgp, id2);
+  current_plastic_defgrd_inverse_.assign(numgp, id2);
 }
 
 /*----------------------------------------------------------------------*
@@ -170,7 +170,7 @@ void Mat::ViscoPlasticNoYieldSurface::evaluate(const Core::LinAlg::Matrix<3, 3>*
 {
   // read input and history variables
   const double dt = params.get<double>("delta time");
-  const Core::LinAlg::Matrix<3, 3>& last_iFv = last_plastic_defgrd_inverse_[gp];
+  const Core::LinAlg::Matrix<3, 3> last_iFv = last_plastic_defgrd_inverse_[gp];
 
   // trial (purely elastic) deformation gradient
   static Core::LinAlg::Matrix<3, 3> Fe_trial;
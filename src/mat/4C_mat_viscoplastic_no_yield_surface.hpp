@@ -11,6 +11,7 @@
 #include "4C_config.hpp"
 
 #include "4C_comm_parobjectfactory.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_mat_so3_material.hpp"
 #include "4C_material_parameter_base.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
@@ -318,10 +319,10 @@ namespace Mat
     Mat::PAR::ViscoPlasticNoYieldSurface* params_;
 
     //! inverse plastic deformation gradient for each Gauss point at last converged state
-    std::vector<Core::LinAlg::Matrix<3, 3>> last_plastic_defgrd_inverse_;
+    GaussPointHistory<3, 3> last_plastic_defgrd_inverse_;
 
     //! current inverse plastic deformation gradient for each Gauss point
-    std::vector<Core::LinAlg::Matrix<3, 3>> current_plastic_defgrd_inverse_;
+    GaussPointHistory<3, 3> current_plastic_defgrd_inverse_;
 
     //! flow resistance 'S' for each Gauss point at last converged state
     std::vector<double> last_flowres_isotropic_;
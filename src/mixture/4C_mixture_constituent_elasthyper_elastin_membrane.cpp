@@ -62,18 +62,19 @@ void Mixture::ElastinMembraneAnisotropyExtension::on_global_data_initialized()
         "elastin material needs at least one.");
   }
 
-  for (unsigned gp = 0; gp < orthogonal_structural_tensor_.size(); ++gp)
+  for (int gp = 0; gp < orthogonal_structural_tensor_.size(); ++gp)
   {
-    orthogonal_structural_tensor_[gp] = Core::LinAlg::identity_matrix<3>();
+    Core::LinAlg::Matrix<3, 3> orthogonal_structural_tensor = orthogonal_structural_tensor_[gp];
+    orthogonal_structural_tensor = Core::LinAlg::identity_matrix<3>();
 
-    orthogonal_structural_tensor_[gp].update(-1.0, get_structural_tensor(gp, 0), 1.0);
+    orthogonal_structural_tensor.update(-1.0, get_structural_tensor(gp, 0), 1.0);
   }
 }
 
-const Core::LinAlg::Matrix<3, 3>&
+Core::LinAlg::Matrix<3, 3>
 Mixture::ElastinMembraneAnisotropyExtension::get_orthogonal_structural_tensor(int gp)
 {
-  if (orthogonal_structural_tensor_.empty())
+  if (orthogonal_structural_tensor_.size() == 0)
   {
     FOUR_C_THROW("The coordinate system hast not been initialized yet.");
 
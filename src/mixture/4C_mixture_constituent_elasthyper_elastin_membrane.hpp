@@ -11,6 +11,7 @@
 #include "4C_config.hpp"
 
 #include "4C_mat_anisotropy_extension.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_mixture_constituent_elasthyperbase.hpp"
 #include "4C_mixture_elastin_membrane_prestress_strategy.hpp"
 
@@ -58,14 +59,13 @@ namespace Mixture
      * \brief Returns the structural tensor of the membrane plane at the Gauss point
      *
      * \param gp (in) : Gauss point
-     * \return const Core::LinAlg::Matrix<3, 3>& Reference to the structural tensor of the membrane
-     * plane
+     * \return Core::LinAlg::Matrix<3, 3> View of the structural tensor of the membrane plane
      */
-    const Core::LinAlg::Matrix<3, 3>& get_orthogonal_structural_tensor(int gp);
+    Core::LinAlg::Matrix<3, 3> get_orthogonal_structural_tensor(int gp);
 
    private:
     /// Holder of the internal structural tensors
-    std::vector<Core::LinAlg::Matrix<3, 3>> orthogonal_structural_tensor_;
+    Mat::GaussPointHistory<3, 3> orthogonal_structural_tensor_;
   };
 
   namespace PAR
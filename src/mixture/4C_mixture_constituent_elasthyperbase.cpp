@@ -194,8 +194,9 @@ void Mixture::MixtureConstituentElastHyperBase::update(Core::LinAlg::Matrix<3, 3
   // do nothing in the default case
   if (params_->get_prestressing_mat_id() > 0)
   {
+    Core::LinAlg::Matrix<3, 3> prestretch = prestretch_[gp];
     prestress_strategy_->update(cosy_anisotropy_extension_.get_coordinate_system_provider(gp),
-        *this, defgrd, prestretch_[gp], params, gp, eleGID);
+        *this, defgrd, prestretch, params, gp, eleGID);
   }
 }
 
@@ -217,9 +218,10 @@ void Mixture::MixtureConstituentElastHyperBase::pre_evaluate(
   // do nothing in the default case
   if (params_->get_prestressing_mat_id() > 0)
   {
+    Core::LinAlg::Matrix<3, 3> prestretch = prestretch_[gp];
     prestress_strategy_->evaluate_prestress(mixtureRule,
-        cosy_anisotropy_extension_.get_coordinate_system_provider(gp), *this, prestretch_[gp],
-        params, gp, eleGID);
+        cosy_anisotropy_extension_.get_coordinate_system_provider(gp), *this, prestretch, params,
+        gp, eleGID);
   }
 }
 
@@ -12,6 +12,7 @@
 
 #include "4C_mat_anisotropy_extension_cylinder_cosy.hpp"
 #include "4C_mat_elasthyper_service.hpp"
+#include "4C_mat_gauss_point_history.hpp"
 #include "4C_material_parameter_base.hpp"
 #include "4C_mixture_constituent.hpp"
 #include "4C_mixture_prestress_strategy.hpp"
@@ -159,12 +160,12 @@ namespace Mixture
 
    protected:
     /*!
-     * \brief Returns a reference to the prestretch tensor at the Gauss point
+     * \brief Returns a view of the prestretch tensor at the Gauss point
      *
      * \param gp Gauss point
-     * \return const Core::LinAlg::Matrix<3, 3>& Reference to the prestretch tensor
+     * \return Core::LinAlg::Matrix<3, 3> Read-only view of the prestretch tensor
      */
-    [[nodiscard]] const Core::LinAlg::Matrix<3, 3>& prestretch_tensor(const int gp) const
+    [[nodiscard]] Core::LinAlg::Matrix<3, 3> prestretch_tensor(const int gp) const
     {
       return prestretch_[gp];
     }
@@ -195,7 +196,7 @@ namespace Mixture
     std::vector<std::shared_ptr<Mat::Elastic::Summand>> potsum_;
 
     /// Prestretch of the constituent
-    std::vector<Core::LinAlg::Matrix<3, 3>> prestretch_;
+    Mat::GaussPointHistory<3, 3> prestretch_;
 
     /// AnisotropyExtension that handles the management of cylinder coordinate systems
     Mat::CylinderCoordinateSystemAnisotropyExtension cosy_anisotropy_extension_;
@@ -35,6 +35,8 @@
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -165,6 +167,9 @@ void PARTICLEALGORITHM::ParticleAlgorithm::read_restart(const int restartstep)
   // read restart of particle engine
   particleengine_->read_restart(reader, particlestodistribute_);
 
+  // read restart of particle time integration
+  particletimint_->read_restart(reader);
+
   // read restart of rigid body handler
   if (particlerigidbody_) particlerigidbody_->read_restart(reader);
 
@@ -213,6 +218,9 @@ void PARTICLEALGORITHM::ParticleAlgorithm::timeloop()
 
 void PARTICLEALGORITHM::ParticleAlgorithm::prepare_time_step(bool do_print_header)
 {
+  // adapt step size
+  if (particletimint_->is_adaptive_time_step()) adapt_step_size();
+
   // increment time and step
   increment_time_and_step();
 
@@ -310,6 +318,9 @@ void PARTICLEALGORITHM::ParticleAlgorithm::write_restart() const
     // write restart of particle engine
     particleengine_->write_restart(step(), time());
 
+    // write restart of particle time integration
+    particletimint_->write_restart();
+
     // write restart of rigid body handler
     if (particlerigidbody_) particlerigidbody_->write_restart();
 
@@ -729,15 +740,6 @@ bool PARTICLEALGORITHM::ParticleAlgorithm::check_load_transfer_needed()
 
 bool PARTICLEALGORITHM::ParticleAlgorithm::check_max_position_increment()
 {
-  // get maximum particle interaction distance
-  double allprocmaxinteractiondistance = 0.0;
-  if (particleinteraction_)
-  {
-    double maxinteractiondistance = particleinteraction_->max_interaction_distance();
-    Core::Communication::max_all(
-        &maxinteractiondistance, &allprocmaxinteractiondistance, 1, get_comm());
-  }
-
   // get max particle position increment since last transfer
   double maxparticlepositionincrement = 0.0;
   get_max_particle_position_increment(maxparticlepositionincrement);
@@ -750,13 +752,24 @@ bool PARTICLEALGORITHM::ParticleAlgorithm::check_max_position_increment()
   const double maxpositionincrement =
       std::max(maxparticlepositionincrement, maxwallpositionincrement);
 
-  // get allowed position increment
-  const double allowedpositionincrement =
-      0.5 * (particleengine_->min_bin_size() - allprocmaxinteractiondistance);
+  // check if a particle transfer is needed
+  return (maxpositionincrement > get_allowed_position_increment());
+}
 
-  // check if a particle transfer is needed based on a worst case scenario:
+double PARTICLEALGORITHM::ParticleAlgorithm::get_allowed_position_increment() const
+{
+  // get maximum particle interaction distance
+  double allprocmaxinteractiondistance = 0.0;
+  if (particleinteraction_)
+  {
+    double maxinteractiondistance = particleinteraction_->max_interaction_distance();
+    Core::Communication::max_all(
+        &maxinteractiondistance, &allprocmaxinteractiondistance, 1, get_comm());
+  }
+
+  // allowed position increment based on a worst case scenario:
   // two particles approach each other with maximum position increment in one spatial dimension
-  return (maxpositionincrement > allowedpositionincrement);
+  return 0.5 * (particleengine_->min_bin_size() - allprocmaxinteractiondistance);
 }
 
 void PARTICLEALGORITHM::ParticleAlgorithm::get_max_particle_position_increment(
@@ -939,10 +952,38 @@ void PARTICLEALGORITHM::ParticleAlgorithm::set_current_time()
 
 void PARTICLEALGORITHM::ParticleAlgorithm::set_current_step_size()
 {
+  // set current step size in particle time integration
+  particletimint_->set_current_step_size(dt());
+
   // set current step size in particle interaction
   if (particleinteraction_) particleinteraction_->set_current_step_size(dt());
 }
 
+void PARTICLEALGORITHM::ParticleAlgorithm::adapt_step_size()
+{
+  // get critical time step size of particle interaction
+  const double criticaltimestep = particleinteraction_
+                                      ? particleinteraction_->critical_time_step()
+                                      : std::numeric_limits<double>::max();
+
+  // get admissible time step size on this processor
+  double admissibletimestep =
+      particletimint_->admissible_time_step(criticaltimestep, get_allowed_position_increment());
+
+  // get minimum admissible time step size on all processors
+  double allprocadmissibletimestep = 0.0;
+  Core::Communication::min_all(&admissibletimestep, &allprocadmissibletimestep, 1, get_comm());
+
+  // adapt time step size
+  double timestep = particletimint_->adapt_time_step(allprocadmissibletimestep);
+
+  // do not step beyond maximum time
+  timestep = std::min(timestep, max_time() - time());
+
+  // set adapted time step size
+  set_dt(timestep);
+}
+
 void PARTICLEALGORITHM::ParticleAlgorithm::set_current_write_result_flag()
 {
   // set current write result flag in particle interaction
@@ -315,6 +315,17 @@ namespace PARTICLEALGORITHM
      */
     bool check_max_position_increment();
 
+    /*!
+     * \brief get allowed position increment since last transfer
+     *
+     * The allowed position increment is based on a worst case scenario: two particles approach
+     * each other with maximum position increment in one spatial dimension.
+     *
+     *
+     * \return allowed position increment
+     */
+    double get_allowed_position_increment() const;
+
     /*!
      * \brief get maximum particle position increment since last transfer
      *
@@ -370,6 +381,15 @@ namespace PARTICLEALGORITHM
      */
     void set_current_step_size();
 
+    /*!
+     * \brief adapt step size
+     *
+     * The step size is adapted based on the critical time step size of the particle interaction and
+     * the allowed position increment of particles.
+     *
+     */
+    void adapt_step_size();
+
     /*!
      * \brief set current write result flag
      *
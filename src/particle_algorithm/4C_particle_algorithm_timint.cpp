@@ -26,7 +26,15 @@ FOUR_C_NAMESPACE_OPEN
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
 PARTICLEALGORITHM::TimInt::TimInt(const Teuchos::ParameterList& params)
-    : params_(params), time_(0.0), dt_(params.get<double>("TIMESTEP"))
+    : params_(params),
+      time_(0.0),
+      dt_(params.get<double>("TIMESTEP")),
+      adaptivetimestep_(params.get<bool>("ADAPTIVE_TIMESTEP")),
+      dtsafetyfactor_(params.get<double>("TIMESTEP_SAFETY_FACTOR")),
+      dtmin_(params.get<double>("TIMESTEP_MIN")),
+      dtmax_((params.get<double>("TIMESTEP_MAX") > 0.0) ? params.get<double>("TIMESTEP_MAX")
+                                                         : params.get<double>("TIMESTEP")),
+      dtmaxgrowth_(params.get<double>("TIMESTEP_MAX_GROWTH"))
 {
   // empty constructor
 }
@@ -35,6 +43,18 @@ PARTICLEALGORITHM::TimInt::~TimInt() = default;
 
 void PARTICLEALGORITHM::TimInt::init()
 {
+  if (adaptivetimestep_)
+  {
+    // safety checks
+    if (dtsafetyfactor_ <= 0.0 or dtsafetyfactor_ > 1.0)
+      FOUR_C_THROW("safety factor of adaptive time step size not in interval (0, 1]!");
+
+    if (dtmin_ < 0.0 or dtmin_ > dtmax_)
+      FOUR_C_THROW("minimum time step size not in interval [0, TIMESTEP_MAX]!");
+
+    if (dtmaxgrowth_ < 1.0) FOUR_C_THROW("maximum growth factor of time step size smaller one!");
+  }
+
   // init dirichlet boundary condition handler
   init_dirichlet_boundary_condition();
 
@@ -121,6 +141,97 @@ void PARTICLEALGORITHM::TimInt::set_initial_states()
 
 void PARTICLEALGORITHM::TimInt::set_current_time(const double currenttime) { time_ = currenttime; }
 
+void PARTICLEALGORITHM::TimInt::set_current_step_size(const double currentstepsize)
+{
+  dt_ = currentstepsize;
+}
+
+double PARTICLEALGORITHM::TimInt::admissible_time_step(
+    const double criticaltimestep, const double allowedpositionincrement) const
+{
+  // maximum velocity magnitude of particles
+  double maxvelocity = 0.0;
+
+  // get particle container bundle
+  PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle =
+      particleengineinterface_->get_particle_container_bundle();
+
+  // iterate over particle types
+  for (auto& typeEnum : particlecontainerbundle->get_particle_types())
+  {
+    // get container of owned particles of current particle type
+    PARTICLEENGINE::ParticleContainer* container =
+        particlecontainerbundle->get_specific_container(typeEnum, PARTICLEENGINE::Owned);
+
+    // get number of particles stored in container
+    const int particlestored = container->particles_stored();
+
+    // no owned particles of current particle type
+    if (particlestored <= 0) continue;
+
+    // get particle state dimension
+    const int statedim = container->get_state_dim(PARTICLEENGINE::Velocity);
+
+    // get pointer to particle state
+    const double* vel = container->get_ptr_to_state(PARTICLEENGINE::Velocity, 0);
+
+    // iterate over owned particles of current type
+    for (int i = 0; i < particlestored; ++i)
+    {
+      double temp = 0.0;
+      for (int dim = 0; dim < statedim; ++dim)
+        temp += vel[statedim * i + dim] * vel[statedim * i + dim];
+
+      maxvelocity = std::max(maxvelocity, std::sqrt(temp));
+    }
+  }
+
+  // admissible time step size limited by critical time step size of particle interaction
+  double admissibletimestep = criticaltimestep;
+
+  // admissible time step size limited by allowed position increment of particles
+  if (maxvelocity > 0.0)
+    admissibletimestep = std::min(admissibletimestep, allowedpositionincrement / maxvelocity);
+
+  return admissibletimestep;
+}
+
+double PARTICLEALGORITHM::TimInt::adapt_time_step(const double admissibletimestep) const
+{
+  // scale admissible time step size with safety factor
+  double timestep = dtsafetyfactor_ * admissibletimestep;
+
+  // limit growth of time step size
+  timestep = std::min(timestep, dtmaxgrowth_ * dt_);
+
+  // bound time step size
+  timestep = std::min(timestep, dtmax_);
+
+  // safety check
+  if (timestep < dtmin_)
+    FOUR_C_THROW("adapted time step size %e smaller than minimum time step size %e!", timestep,
+        dtmin_);
+
+  return timestep;
+}
+
+void PARTICLEALGORITHM::TimInt::write_restart() const
+{
+  // get bin discretization writer
+  std::shared_ptr<Core::IO::DiscretizationWriter> binwriter =
+      particleengineinterface_->get_bin_discretization_writer();
+
+  // write current step size
+  binwriter->write_double("particletimestep", dt_);
+}
+
+void PARTICLEALGORITHM::TimInt::read_restart(
+    const std::shared_ptr<Core::IO::DiscretizationReader> reader)
+{
+  // read current step size as reference for growth of adaptive time step size
+  if (adaptivetimestep_) set_current_step_size(reader->read_double("particletimestep"));
+}
+
 void PARTICLEALGORITHM::TimInt::init_dirichlet_boundary_condition()
 {
   // create dirichlet boundary condition handler
@@ -359,6 +470,15 @@ void PARTICLEALGORITHM::TimIntVelocityVerlet::set_initial_states()
   }
 }
 
+void PARTICLEALGORITHM::TimIntVelocityVerlet::set_current_step_size(const double currentstepsize)
+{
+  // call base class method
+  TimInt::set_current_step_size(currentstepsize);
+
+  // set half time step size
+  dthalf_ = 0.5 * dt_;
+}
+
 void PARTICLEALGORITHM::TimIntVelocityVerlet::pre_interaction_routine()
 {
   TEUCHOS_FUNC_TIME_MONITOR("PARTICLEALGORITHM::TimIntVelocityVerlet::pre_interaction_routine");
@@ -37,6 +37,11 @@ namespace ParticleRigidBody
   class RigidBodyHandlerInterface;
 }
 
+namespace Core::IO
+{
+  class DiscretizationReader;
+}
+
 /*---------------------------------------------------------------------------*
  | class declarations                                                        |
  *---------------------------------------------------------------------------*/
@@ -105,6 +110,67 @@ namespace PARTICLEALGORITHM
      */
     virtual void set_current_time(const double currenttime) final;
 
+    /*!
+     * \brief set current step size
+     *
+     *
+     * \param[in] currentstepsize current step size
+     */
+    virtual void set_current_step_size(const double currentstepsize);
+
+    /*!
+     * \brief check if time step size is adapted in each time step
+     *
+     *
+     * \return flag indicating adaptive time step size
+     */
+    bool is_adaptive_time_step() const { return adaptivetimestep_; }
+
+    /*!
+     * \brief determine admissible time step size (on this processor)
+     *
+     * The admissible time step size is limited by the critical time step size of the particle
+     * interaction and by the allowed position increment of particles per time step with respect to
+     * the current maximum particle velocity. The latter ensures that no particle moves further in
+     * one time step than the validity check of the potential neighbor relation allows.
+     *
+     *
+     * \param[in] criticaltimestep          critical time step size of particle interaction
+     * \param[in] allowedpositionincrement  allowed position increment of particles
+     *
+     * \return admissible time step size
+     */
+    double admissible_time_step(
+        const double criticaltimestep, const double allowedpositionincrement) const;
+
+    /*!
+     * \brief adapt time step size
+     *
+     * The admissible time step size is scaled with a safety factor, the growth compared to the
+     * current step size is limited, and the result is bounded by the maximum time step size. An
+     * admissible time step size below the minimum time step size is treated as an error.
+     *
+     *
+     * \param[in] admissibletimestep admissible time step size (on all processors)
+     *
+     * \return adapted time step size
+     */
+    double adapt_time_step(const double admissibletimestep) const;
+
+    /*!
+     * \brief write restart of particle time integration
+     *
+     */
+    void write_restart() const;
+
+    /*!
+     * \brief read restart of particle time integration
+     *
+     *
+     * \param[in] reader discretization reader
+     */
+    void read_restart(const std::shared_ptr<Core::IO::DiscretizationReader> reader);
+
     /*!
      * \brief time integration scheme specific pre-interaction routine
      *
@@ -162,6 +228,21 @@ namespace PARTICLEALGORITHM
 
     //! time step size
     double dt_;
+
+    //! flag indicating adaptive time step size
+    const bool adaptivetimestep_;
+
+    //! safety factor applied to admissible time step size
+    const double dtsafetyfactor_;
+
+    //! minimum time step size
+    const double dtmin_;
+
+    //! maximum time step size
+    const double dtmax_;
+
+    //! maximum growth factor of time step size between two time steps
+    const double dtmaxgrowth_;
   };
 
   /*!
@@ -235,6 +316,14 @@ namespace PARTICLEALGORITHM
      */
     void set_initial_states() override;
 
+    /*!
+     * \brief set current step size
+     *
+     *
+     * \param[in] currentstepsize current step size
+     */
+    void set_current_step_size(const double currentstepsize) override;
+
     /*!
      * \brief time integration scheme specific pre-interaction routine
      *
@@ -13,6 +13,8 @@
 #include "4C_particle_interaction_material_handler.hpp"
 #include "4C_particle_interaction_runtime_writer.hpp"
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -105,6 +107,12 @@ void ParticleInteraction::ParticleInteractionBase::
   }
 }
 
+double ParticleInteraction::ParticleInteractionBase::critical_time_step() const
+{
+  // no restriction of time step size
+  return std::numeric_limits<double>::max();
+}
+
 void ParticleInteraction::ParticleInteractionBase::set_current_time(const double currenttime)
 {
   time_ = currenttime;
@@ -103,6 +103,15 @@ namespace ParticleInteraction
     //! maximum interaction distance (on this processor)
     virtual double max_interaction_distance() const = 0;
 
+    /*!
+     * \brief critical time step size (on this processor)
+     *
+     * The critical time step size is the stability limit of the interaction formulation without
+     * any safety factor. The safety factor is applied by the adaptive time step size control of
+     * the particle time integration.
+     */
+    virtual double critical_time_step() const;
+
     //! distribute interaction history
     virtual void distribute_interaction_history() const = 0;
 
@@ -188,6 +188,12 @@ double ParticleInteraction::ParticleInteractionDEM::max_interaction_distance() c
   return interactiondistance;
 }
 
+double ParticleInteraction::ParticleInteractionDEM::critical_time_step() const
+{
+  // critical time step size based on particle contact
+  return contact_->critical_time_step();
+}
+
 void ParticleInteraction::ParticleInteractionDEM::distribute_interaction_history() const
 {
   // distribute history pairs
@@ -89,6 +89,9 @@ namespace ParticleInteraction
     //! maximum interaction distance (on this processor)
     double max_interaction_distance() const override;
 
+    //! critical time step size (on this processor)
+    double critical_time_step() const override;
+
     //! distribute interaction history
     void distribute_interaction_history() const override;
 
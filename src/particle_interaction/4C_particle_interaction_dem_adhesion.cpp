@@ -238,7 +238,7 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_adhesion()
 
     // get reference to touched adhesion history
     TouchedDEMHistoryPairAdhesion& touchedadhesionhistory_ij =
-        adhesionhistorydata[globalid_i[0]][globalid_j[0]];
+        adhesionhistorydata(globalid_i[0], globalid_j[0]);
 
     // mark adhesion history as touched
     touchedadhesionhistory_ij.first = true;
@@ -255,12 +255,20 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_adhesion()
     adhesionlaw_->adhesion_force(particlepair.gap_, adhesionhistory_ij.surface_energy_, r_eff,
         vel_rel_normal, particlepair.m_eff_, adhesionhistory_ij.adhesion_force_);
 
+    // add adhesion force contribution
+    Utils::vec_add_scale(force_i, adhesionhistory_ij.adhesion_force_, particlepair.e_ji_);
+    if (status_j == PARTICLEENGINE::Owned)
+      Utils::vec_add_scale(force_j, -adhesionhistory_ij.adhesion_force_, particlepair.e_ji_);
+
     // copy history from interaction pair ij to ji
     if (status_j == PARTICLEENGINE::Owned)
     {
+      // copy adhesion history as reference is invalidated by insertion of history pair ji
+      const DEMHistoryPairAdhesion adhesionhistory = adhesionhistory_ij;
+
       // get reference to touched adhesion history
       TouchedDEMHistoryPairAdhesion& touchedadhesionhistory_ji =
-          adhesionhistorydata[globalid_j[0]][globalid_i[0]];
+          adhesionhistorydata(globalid_j[0], globalid_i[0]);
 
       // mark adhesion history as touched
       touchedadhesionhistory_ji.first = true;
@@ -269,14 +277,9 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_adhesion()
       DEMHistoryPairAdhesion& adhesionhistory_ji = touchedadhesionhistory_ji.second;
 
       // set adhesion surface energy and adhesion force
-      adhesionhistory_ji.surface_energy_ = adhesionhistory_ij.surface_energy_;
-      adhesionhistory_ji.adhesion_force_ = adhesionhistory_ij.adhesion_force_;
+      adhesionhistory_ji.surface_energy_ = adhesionhistory.surface_energy_;
+      adhesionhistory_ji.adhesion_force_ = adhesionhistory.adhesion_force_;
     }
-
-    // add adhesion force contribution
-    Utils::vec_add_scale(force_i, adhesionhistory_ij.adhesion_force_, particlepair.e_ji_);
-    if (status_j == PARTICLEENGINE::Owned)
-      Utils::vec_add_scale(force_j, -adhesionhistory_ij.adhesion_force_, particlepair.e_ji_);
   }
 }
 
@@ -406,7 +409,7 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion()
 
     // get reference to touched adhesion history
     TouchedDEMHistoryPairAdhesion& touchedadhesionhistory_ij =
-        adhesionhistorydata[globalid_i[0]][ele->id()];
+        adhesionhistorydata(globalid_i[0], ele->id());
 
     // mark adhesion history as touched
     touchedadhesionhistory_ij.first = true;
@@ -426,16 +429,20 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion()
     // add adhesion force contribution
     Utils::vec_add_scale(force_i, adhesionhistory_ij.adhesion_force_, particlewallpair.e_ji_);
 
+    // copy touched adhesion history as reference is invalidated by insertion of history pairs
+    const TouchedDEMHistoryPairAdhesion touchedadhesionhistory = touchedadhesionhistory_ij;
+    const DEMHistoryPairAdhesion& adhesionhistory = touchedadhesionhistory.second;
+
     // copy history to relevant wall elements in penetration volume
     for (int histele : particlewallpair.histeles_)
-      adhesionhistorydata[globalid_i[0]][histele] = touchedadhesionhistory_ij;
+      adhesionhistorydata(globalid_i[0], histele) = touchedadhesionhistory;
 
     // calculation of wall adhesion force
     double walladhesionforce[3] = {0.0, 0.0, 0.0};
     if (writeinteractionoutput or walldatastate->get_force_col() != nullptr)
     {
       Utils::vec_set_scale(
-          walladhesionforce, -adhesionhistory_ij.adhesion_force_, particlewallpair.e_ji_);
+          walladhesionforce, -adhesionhistory.adhesion_force_, particlewallpair.e_ji_);
     }
 
     // write interaction output
@@ -454,7 +461,7 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion()
       for (int dim = 0; dim < 3; ++dim) attackpoints.push_back(wallcontactpoint[dim]);
       for (int dim = 0; dim < 3; ++dim) adhesionforces.push_back(walladhesionforce[dim]);
       for (int dim = 0; dim < 3; ++dim) normaldirection.push_back(-particlewallpair.e_ji_[dim]);
-      surfaceenergy.push_back(adhesionhistory_ij.surface_energy_);
+      surfaceenergy.push_back(adhesionhistory.surface_energy_);
     }
 
     // assemble adhesion force acting on wall element
@@ -30,6 +30,8 @@
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -148,9 +150,8 @@ double ParticleInteraction::DEMContact::get_normal_contact_stiffness() const
   return contactnormal_->get_normal_contact_stiffness();
 }
 
-void ParticleInteraction::DEMContact::check_critical_time_step() const
+double ParticleInteraction::DEMContact::critical_time_step() const
 {
-  if (particleengineinterface_->get_number_of_particles() == 0) return;
   // init value of minimum mass
   double minmass = std::numeric_limits<double>::max();
 
@@ -174,13 +175,24 @@ void ParticleInteraction::DEMContact::check_critical_time_step() const
     minmass = std::min(minmass, currminmass);
   }
 
+  // no owned particles on this processor
+  if (minmass == std::numeric_limits<double>::max()) return minmass;
+
   // get critical normal contact stiffness
   const double k_normal_crit = contactnormal_->get_critical_normal_contact_stiffness();
 
   // critical time step size based on particle-particle contact
-  const double safety = 0.75;
   const double factor = contacttangential_ ? 0.22 : 0.34;
-  const double dt_crit = safety * factor * std::sqrt(minmass / k_normal_crit);
+  return factor * std::sqrt(minmass / k_normal_crit);
+}
+
+void ParticleInteraction::DEMContact::check_critical_time_step() const
+{
+  if (particleengineinterface_->get_number_of_particles() == 0) return;
+
+  // critical time step size based on particle-particle contact
+  const double safety = 0.75;
+  const double dt_crit = safety * critical_time_step();
 
   // checks time step
   if (dt_ > dt_crit)
@@ -472,7 +484,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
     {
       // get reference to touched tangential history
       TouchedDEMHistoryPairTangential& touchedtangentialhistory_ij =
-          tangentialhistorydata[globalid_i[0]][globalid_j[0]];
+          tangentialhistorydata(globalid_i[0], globalid_j[0]);
 
       // mark tangential history as touched
       touchedtangentialhistory_ij.first = true;
@@ -494,9 +506,12 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
       // copy history from interaction pair ij to ji
       if (status_j == PARTICLEENGINE::Owned)
       {
+        // copy tangential history as reference is invalidated by insertion of history pair ji
+        const DEMHistoryPairTangential tangentialhistory = tangentialhistory_ij;
+
         // get reference to touched tangential history
         TouchedDEMHistoryPairTangential& touchedtangentialhistory_ji =
-            tangentialhistorydata[globalid_j[0]][globalid_i[0]];
+            tangentialhistorydata(globalid_j[0], globalid_i[0]);
 
         // mark tangential history as touched
         touchedtangentialhistory_ji.first = true;
@@ -505,8 +520,8 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
         DEMHistoryPairTangential& tangentialhistory_ji = touchedtangentialhistory_ji.second;
 
         // set tangential gap and tangential stick flag
-        Utils::vec_set_scale(tangentialhistory_ji.gap_t_, -1.0, tangentialhistory_ij.gap_t_);
-        tangentialhistory_ji.stick_ = tangentialhistory_ij.stick_;
+        Utils::vec_set_scale(tangentialhistory_ji.gap_t_, -1.0, tangentialhistory.gap_t_);
+        tangentialhistory_ji.stick_ = tangentialhistory.stick_;
       }
 
       // add tangential contact force contribution
@@ -524,7 +539,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
     {
       // get reference to touched rolling history
       TouchedDEMHistoryPairRolling& touchedrollinghistory_ij =
-          rollinghistorydata[globalid_i[0]][globalid_j[0]];
+          rollinghistorydata(globalid_i[0], globalid_j[0]);
 
       // mark rolling history as touched
       touchedrollinghistory_ij.first = true;
@@ -550,9 +565,12 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
       // copy history from interaction pair ij to ji
       if (status_j == PARTICLEENGINE::Owned)
       {
+        // copy rolling history as reference is invalidated by insertion of history pair ji
+        const DEMHistoryPairRolling rollinghistory = rollinghistory_ij;
+
         // get reference to touched rolling history
         TouchedDEMHistoryPairRolling& touchedrollinghistory_ji =
-            rollinghistorydata[globalid_j[0]][globalid_i[0]];
+            rollinghistorydata(globalid_j[0], globalid_i[0]);
 
         // mark rolling history as touched
         touchedrollinghistory_ji.first = true;
@@ -561,8 +579,8 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
         DEMHistoryPairRolling& rollinghistory_ji = touchedrollinghistory_ji.second;
 
         // set rolling gap and rolling stick flag
-        Utils::vec_set_scale(rollinghistory_ji.gap_r_, -1.0, rollinghistory_ij.gap_r_);
-        rollinghistory_ji.stick_ = rollinghistory_ij.stick_;
+        Utils::vec_set_scale(rollinghistory_ji.gap_r_, -1.0, rollinghistory.gap_r_);
+        rollinghistory_ji.stick_ = rollinghistory.stick_;
       }
 
       // add rolling contact moment contribution
@@ -733,7 +751,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
     {
       // get reference to touched tangential history
       TouchedDEMHistoryPairTangential& touchedtangentialhistory_ij =
-          tangentialhistorydata[globalid_i[0]][ele->id()];
+          tangentialhistorydata(globalid_i[0], ele->id());
 
       // mark tangential history as touched
       touchedtangentialhistory_ij.first = true;
@@ -757,9 +775,12 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
       // add tangential contact moment contribution
       Utils::vec_add_cross(moment_i, r_ji, tangentialcontactforce);
 
+      // copy touched tangential history as reference is invalidated by insertion of history pairs
+      const TouchedDEMHistoryPairTangential touchedtangentialhistory = touchedtangentialhistory_ij;
+
       // copy history to relevant wall elements in penetration volume
       for (int histele : particlewallpair.histeles_)
-        tangentialhistorydata[globalid_i[0]][histele] = touchedtangentialhistory_ij;
+        tangentialhistorydata(globalid_i[0], histele) = touchedtangentialhistory;
     }
 
     // calculation of rolling contact moment
@@ -768,7 +789,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
     {
       // get reference to touched rolling history
       TouchedDEMHistoryPairRolling& touchedrollinghistory_ij =
-          rollinghistorydata[globalid_i[0]][ele->id()];
+          rollinghistorydata(globalid_i[0], ele->id());
 
       // mark rolling history as touched
       touchedrollinghistory_ij.first = true;
@@ -793,9 +814,12 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
       // add rolling contact moment contribution
       Utils::vec_add(moment_i, rollingcontactmoment);
 
+      // copy touched rolling history as reference is invalidated by insertion of history pairs
+      const TouchedDEMHistoryPairRolling touchedrollinghistory = touchedrollinghistory_ij;
+
       // copy history to relevant wall elements in penetration volume
       for (int histele : particlewallpair.histeles_)
-        rollinghistorydata[globalid_i[0]][histele] = touchedrollinghistory_ij;
+        rollinghistorydata(globalid_i[0], histele) = touchedrollinghistory;
     }
 
     // calculation of wall contact force
@@ -904,7 +928,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_elastic_potential_energy
     {
       // get reference to touched tangential history
       TouchedDEMHistoryPairTangential& touchedtangentialhistory_ij =
-          tangentialhistorydata[globalid_i[0]][globalid_j[0]];
+          tangentialhistorydata(globalid_i[0], globalid_j[0]);
 
       // get reference to tangential history
       DEMHistoryPairTangential& tangentialhistory_ij = touchedtangentialhistory_ij.second;
@@ -925,7 +949,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_elastic_potential_energy
     {
       // get reference to touched rolling history
       TouchedDEMHistoryPairRolling& touchedrollinghistory_ij =
-          rollinghistorydata[globalid_i[0]][globalid_j[0]];
+          rollinghistorydata(globalid_i[0], globalid_j[0]);
 
       // get reference to rolling history
       DEMHistoryPairRolling& rollinghistory_ij = touchedrollinghistory_ij.second;
@@ -986,7 +1010,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_elastic_potential_e
     {
       // get reference to touched tangential history
       TouchedDEMHistoryPairTangential& touchedtangentialhistory_ij =
-          tangentialhistorydata[globalid_i[0]][ele->id()];
+          tangentialhistorydata(globalid_i[0], ele->id());
 
       // get reference to tangential history
       DEMHistoryPairTangential& tangentialhistory_ij = touchedtangentialhistory_ij.second;
@@ -1005,7 +1029,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_elastic_potential_e
     {
       // get reference to touched rolling history
       TouchedDEMHistoryPairRolling& touchedrollinghistory_ij =
-          rollinghistorydata[globalid_i[0]][ele->id()];
+          rollinghistorydata(globalid_i[0], ele->id());
 
       // get reference to rolling history
       DEMHistoryPairRolling& rollinghistory_ij = touchedrollinghistory_ij.second;
@@ -88,6 +88,9 @@ namespace ParticleInteraction
     //! get normal contact stiffness
     double get_normal_contact_stiffness() const;
 
+    //! critical time step size based on particle contact without safety factor (on this processor)
+    double critical_time_step() const;
+
     //! check critical time step (on this processor)
     void check_critical_time_step() const;
 
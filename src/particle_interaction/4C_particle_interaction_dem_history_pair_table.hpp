@@ -0,0 +1,251 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_DEM_HISTORY_PAIR_TABLE_HPP
+#define FOUR_C_PARTICLE_INTERACTION_DEM_HISTORY_PAIR_TABLE_HPP
+
+/*---------------------------------------------------------------------------*
+ | headers                                                                   |
+ *---------------------------------------------------------------------------*/
+#include "4C_config.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | class declarations                                                        |
+ *---------------------------------------------------------------------------*/
+namespace ParticleInteraction
+{
+  /*!
+   * \brief flat hash table of history pairs keyed on the ordered pair of global ids
+   *
+   * History pairs are stored inline in a single array using open addressing with linear probing.
+   * Each history pair is stored together with a flag denoting whether the history pair was touched
+   * since the last call to erase_untouched(), which evicts all untouched history pairs in bulk.
+   *
+   * \note Similar to std::vector, references to history pairs are invalidated by an insertion.
+   *
+   * \tparam Historypairtype type of history pair (trivially copyable)
+   */
+  template <typename Historypairtype>
+  class DEMHistoryPairTable final
+  {
+    static_assert(std::is_trivially_copyable_v<Historypairtype>,
+        "history pair type must be trivially copyable!");
+
+   public:
+    //! history pair with flag denoting whether it was touched
+    using TouchedHistoryPair = std::pair<bool, Historypairtype>;
+
+    //! packed history pair as used for communication
+    struct PackedHistoryPair
+    {
+      int globalid_i;
+      int globalid_j;
+      Historypairtype historypair;
+    };
+
+    //! number of stored history pairs
+    [[nodiscard]] int size() const { return size_; }
+
+    //! check whether no history pairs are stored
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    //! remove all history pairs (capacity is kept)
+    void clear()
+    {
+      for (Slot& slot : slots_) slot.key_ = emptykey_;
+      size_ = 0;
+    }
+
+    //! get history pair of global ids i and j (inserted as untouched if not existing)
+    TouchedHistoryPair& operator()(const int globalid_i, const int globalid_j)
+    {
+      // grow table before exceeding the maximum load factor
+      if (2 * (size_ + 1) > static_cast<int>(slots_.size())) rehash(2 * (size_ + 1));
+
+      const std::uint64_t key = make_key(globalid_i, globalid_j);
+
+      Slot& slot = slots_[probe(key)];
+      if (slot.key_ == emptykey_)
+      {
+        slot.key_ = key;
+        slot.value_ = TouchedHistoryPair(false, Historypairtype());
+        ++size_;
+      }
+
+      return slot.value_;
+    }
+
+    //! find history pair of global ids i and j (nullptr if not existing)
+    TouchedHistoryPair* find(const int globalid_i, const int globalid_j)
+    {
+      if (slots_.empty()) return nullptr;
+
+      Slot& slot = slots_[probe(make_key(globalid_i, globalid_j))];
+      return (slot.key_ == emptykey_) ? nullptr : &slot.value_;
+    }
+
+    //! check whether history pair of global ids i and j exists
+    [[nodiscard]] bool contains(const int globalid_i, const int globalid_j) const
+    {
+      if (slots_.empty()) return false;
+
+      return slots_[probe(make_key(globalid_i, globalid_j))].key_ != emptykey_;
+    }
+
+    //! call function with global ids and touched history pair for all stored history pairs
+    template <typename Function>
+    void for_each(Function&& function) const
+    {
+      for (const Slot& slot : slots_)
+        if (slot.key_ != emptykey_)
+          function(global_id_i(slot.key_), global_id_j(slot.key_), slot.value_);
+    }
+
+    /*!
+     * \brief erase untouched history pairs and reset touched flag of remaining history pairs
+     *
+     * All remaining history pairs are reinserted into a table of suitable capacity in one sweep,
+     * such that no tombstones are required.
+     */
+    void erase_untouched()
+    {
+      buffer_.swap(slots_);
+
+      int numtouched = 0;
+      for (const Slot& slot : buffer_)
+        if (slot.key_ != emptykey_ and slot.value_.first) ++numtouched;
+
+      slots_.assign(capacity_for(numtouched), Slot());
+      size_ = 0;
+
+      for (const Slot& slot : buffer_)
+      {
+        if (slot.key_ == emptykey_ or (not slot.value_.first)) continue;
+
+        Slot& newslot = slots_[probe(slot.key_)];
+        newslot.key_ = slot.key_;
+        newslot.value_ = TouchedHistoryPair(false, slot.value_.second);
+        ++size_;
+      }
+
+      buffer_.clear();
+    }
+
+    //! append history pair to buffer in packed array format
+    static void pack_history_pair(std::vector<char>& buffer, const int globalid_i,
+        const int globalid_j, const Historypairtype& historypair)
+    {
+      const PackedHistoryPair packed = {globalid_i, globalid_j, historypair};
+
+      const std::size_t offset = buffer.size();
+      buffer.resize(offset + sizeof(PackedHistoryPair));
+      std::memcpy(buffer.data() + offset, &packed, sizeof(PackedHistoryPair));
+    }
+
+    //! insert history pairs from buffer in packed array format (marked as touched)
+    void unpack_history_pairs(const std::vector<char>& buffer)
+    {
+      const std::size_t numpacked = buffer.size() / sizeof(PackedHistoryPair);
+
+      for (std::size_t i = 0; i < numpacked; ++i)
+      {
+        PackedHistoryPair packed;
+        std::memcpy(&packed, buffer.data() + i * sizeof(PackedHistoryPair),
+            sizeof(PackedHistoryPair));
+
+        (*this)(packed.globalid_i, packed.globalid_j) =
+            TouchedHistoryPair(true, packed.historypair);
+      }
+    }
+
+   private:
+    //! slot of hash table
+    struct Slot
+    {
+      std::uint64_t key_ = emptykey_;
+      TouchedHistoryPair value_;
+    };
+
+    //! key of empty slot
+    static constexpr std::uint64_t emptykey_ = ~std::uint64_t(0);
+
+    //! combine global ids i and j to key
+    static std::uint64_t make_key(const int globalid_i, const int globalid_j)
+    {
+      return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(globalid_i)) << 32) |
+             static_cast<std::uint64_t>(static_cast<std::uint32_t>(globalid_j));
+    }
+
+    //! get global id i from key
+    static int global_id_i(const std::uint64_t key) { return static_cast<int>(key >> 32); }
+
+    //! get global id j from key
+    static int global_id_j(const std::uint64_t key) { return static_cast<int>(key & 0xffffffffu); }
+
+    //! mix bits of key (finalizer of splitmix64)
+    static std::uint64_t hash(std::uint64_t key)
+    {
+      key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9u;
+      key = (key ^ (key >> 27)) * 0x94d049bb133111ebu;
+      return key ^ (key >> 31);
+    }
+
+    //! capacity (power of two) to store number of history pairs with load factor below one half
+    static std::size_t capacity_for(const int num)
+    {
+      std::size_t capacity = 16;
+      while (capacity < 2 * static_cast<std::size_t>(num)) capacity *= 2;
+      return capacity;
+    }
+
+    //! get index of slot holding key or of first empty slot in probe sequence
+    [[nodiscard]] std::size_t probe(const std::uint64_t key) const
+    {
+      const std::size_t mask = slots_.size() - 1;
+
+      std::size_t index = hash(key) & mask;
+      while (slots_[index].key_ != key and slots_[index].key_ != emptykey_)
+        index = (index + 1) & mask;
+
+      return index;
+    }
+
+    //! rehash table to hold at least given number of history pairs
+    void rehash(const int num)
+    {
+      buffer_.swap(slots_);
+      slots_.assign(capacity_for(num), Slot());
+
+      for (const Slot& slot : buffer_)
+        if (slot.key_ != emptykey_) slots_[probe(slot.key_)] = slot;
+
+      buffer_.clear();
+    }
+
+    //! slots of hash table
+    std::vector<Slot> slots_;
+
+    //! buffer of slots reused for rehashing
+    std::vector<Slot> buffer_;
+
+    //! number of stored history pairs
+    int size_ = 0;
+  };
+}  // namespace ParticleInteraction
+
+/*---------------------------------------------------------------------------*/
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
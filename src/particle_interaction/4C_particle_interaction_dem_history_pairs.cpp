@@ -15,6 +15,8 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -193,15 +195,19 @@ void ParticleInteraction::DEMHistoryPairs::distribute_history_pairs()
     particletargets[currproc].push_back(gid);
   }
 
+  // relate particle global ids to target processors
+  std::vector<std::pair<int, int>> globalidstotargets;
+  relate_global_ids_to_targets(particletargets, globalidstotargets);
+
   // communicate specific history pairs
-  communicate_specific_history_pairs(particletargets, particletangentialhistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewalltangentialhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particletangentialhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewalltangentialhistorydata_);
 
-  communicate_specific_history_pairs(particletargets, particlerollinghistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewallrollinghistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlerollinghistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewallrollinghistorydata_);
 
-  communicate_specific_history_pairs(particletargets, particleadhesionhistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewalladhesionhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particleadhesionhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewalladhesionhistorydata_);
 }
 
 void ParticleInteraction::DEMHistoryPairs::communicate_history_pairs()
@@ -212,15 +218,19 @@ void ParticleInteraction::DEMHistoryPairs::communicate_history_pairs()
   const std::vector<std::vector<int>>& particletargets =
       particleengineinterface_->get_communicated_particle_targets();
 
+  // relate particle global ids to target processors
+  std::vector<std::pair<int, int>> globalidstotargets;
+  relate_global_ids_to_targets(particletargets, globalidstotargets);
+
   // communicate specific history pairs
-  communicate_specific_history_pairs(particletargets, particletangentialhistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewalltangentialhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particletangentialhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewalltangentialhistorydata_);
 
-  communicate_specific_history_pairs(particletargets, particlerollinghistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewallrollinghistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlerollinghistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewallrollinghistorydata_);
 
-  communicate_specific_history_pairs(particletargets, particleadhesionhistorydata_);
-  communicate_specific_history_pairs(particletargets, particlewalladhesionhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particleadhesionhistorydata_);
+  communicate_specific_history_pairs(globalidstotargets, particlewalladhesionhistorydata_);
 }
 
 void ParticleInteraction::DEMHistoryPairs::update_history_pairs()
@@ -229,107 +239,90 @@ void ParticleInteraction::DEMHistoryPairs::update_history_pairs()
 
   // erase untouched history pairs
   if (not particletangentialhistorydata_.empty())
-    erase_untouched_history_pairs(particletangentialhistorydata_);
+    particletangentialhistorydata_.erase_untouched();
 
   if (not particlewalltangentialhistorydata_.empty())
-    erase_untouched_history_pairs(particlewalltangentialhistorydata_);
+    particlewalltangentialhistorydata_.erase_untouched();
 
   if (not particlerollinghistorydata_.empty())
-    erase_untouched_history_pairs(particlerollinghistorydata_);
+    particlerollinghistorydata_.erase_untouched();
 
   if (not particlewallrollinghistorydata_.empty())
-    erase_untouched_history_pairs(particlewallrollinghistorydata_);
+    particlewallrollinghistorydata_.erase_untouched();
 
   if (not particleadhesionhistorydata_.empty())
-    erase_untouched_history_pairs(particleadhesionhistorydata_);
+    particleadhesionhistorydata_.erase_untouched();
 
   if (not particlewalladhesionhistorydata_.empty())
-    erase_untouched_history_pairs(particlewalladhesionhistorydata_);
+    particlewalladhesionhistorydata_.erase_untouched();
+}
+
+void ParticleInteraction::DEMHistoryPairs::relate_global_ids_to_targets(
+    const std::vector<std::vector<int>>& particletargets,
+    std::vector<std::pair<int, int>>& globalidstotargets) const
+{
+  globalidstotargets.clear();
+
+  for (int torank = 0; torank < static_cast<int>(particletargets.size()); ++torank)
+    for (int globalid : particletargets[torank]) globalidstotargets.emplace_back(globalid, torank);
+
+  std::sort(globalidstotargets.begin(), globalidstotargets.end());
 }
 
 template <typename Historypairtype>
 void ParticleInteraction::DEMHistoryPairs::communicate_specific_history_pairs(
-    const std::vector<std::vector<int>>& particletargets,
-    std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>& historydata)
+    const std::vector<std::pair<int, int>>& globalidstotargets,
+    DEMHistoryPairTable<Historypairtype>& historydata)
 {
   // prepare buffer for sending and receiving
   std::map<int, std::vector<char>> sdata;
   std::map<int, std::vector<char>> rdata;
 
-  // pack history pairs
-  for (int torank = 0; torank < Core::Communication::num_mpi_ranks(comm_); ++torank)
-  {
-    if (particletargets[torank].empty()) continue;
-
-    for (int globalid : particletargets[torank])
-    {
-      // no history pairs for current global id
-      if (not historydata.count(globalid)) continue;
+  // compare global ids only
+  auto compareglobalids = [](const std::pair<int, int>& a, const std::pair<int, int>& b)
+  { return a.first < b.first; };
 
-      for (auto& it_j : historydata[globalid])
-      {
-        // get reference to history pair
-        const Historypairtype& historypair = (it_j.second).second;
-
-        // add history pair to buffer
-        add_history_pair_to_buffer(sdata[torank], globalid, it_j.first, historypair);
-      }
-    }
+  // pack history pairs in packed array format in one sweep over all history pairs
+  if (not(historydata.empty() or globalidstotargets.empty()))
+  {
+    historydata.for_each(
+        [&](const int globalid_i, const int globalid_j,
+            const std::pair<bool, Historypairtype>& touchedhistorypair)
+        {
+          // get target processors of particle i
+          auto range = std::equal_range(globalidstotargets.begin(), globalidstotargets.end(),
+              std::make_pair(globalid_i, 0), compareglobalids);
+
+          for (auto it = range.first; it != range.second; ++it)
+            DEMHistoryPairTable<Historypairtype>::pack_history_pair(
+                sdata[it->second], globalid_i, globalid_j, touchedhistorypair.second);
+        });
   }
 
   // communicate data via non-buffered send from proc to proc
   PARTICLEENGINE::COMMUNICATION::immediate_recv_blocking_send(comm_, sdata, rdata);
 
   // unpack history pairs
-  for (auto& p : rdata) unpack_history_pairs(p.second, historydata);
-}
-
-template <typename Historypairtype>
-void ParticleInteraction::DEMHistoryPairs::erase_untouched_history_pairs(
-    std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>& historydata)
-{
-  // iterate over nested unordered maps of stored history pairs
-  for (auto it_i = historydata.begin(); it_i != historydata.end();)
-  {
-    for (auto it_j = (it_i->second).begin(); it_j != (it_i->second).end();)
-    {
-      // remove untouched history pair
-      if ((it_j->second).first == false) (it_i->second).erase(it_j++);
-      // invalidate touched history pair
-      else
-        ((it_j++)->second).first = false;
-    }
-
-    // no history pairs left: erase entry
-    if ((it_i->second).empty()) historydata.erase(it_i++);
-    // increment iterator
-    else
-      ++it_i;
-  }
+  for (auto& p : rdata) historydata.unpack_history_pairs(p.second);
 }
 
 template <typename Historypairtype>
-void ParticleInteraction::DEMHistoryPairs::pack_all_history_pairs(std::vector<char>& buffer,
-    const std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>&
-        historydata) const
+void ParticleInteraction::DEMHistoryPairs::pack_all_history_pairs(
+    std::vector<char>& buffer, const DEMHistoryPairTable<Historypairtype>& historydata) const
 {
-  // iterate over nested unordered maps of stored history pairs
-  for (auto& it_i : historydata)
-  {
-    for (auto& it_j : it_i.second)
-    {
-      // get reference to history pair
-      const Historypairtype& historypair = (it_j.second).second;
-
-      // add history pair to buffer
-      add_history_pair_to_buffer(buffer, it_i.first, it_j.first, historypair);
-    }
-  }
+  // iterate over stored history pairs
+  historydata.for_each(
+      [&](const int globalid_i, const int globalid_j,
+          const std::pair<bool, Historypairtype>& touchedhistorypair)
+      {
+        // add history pair to buffer
+        add_history_pair_to_buffer(buffer, globalid_i, globalid_j, touchedhistorypair.second);
+      });
 }
 
 template <typename Historypairtype>
-void ParticleInteraction::DEMHistoryPairs::unpack_history_pairs(const std::vector<char>& buffer,
-    std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>& historydata)
+void ParticleInteraction::DEMHistoryPairs::unpack_history_pairs(
+    const std::vector<char>& buffer, DEMHistoryPairTable<Historypairtype>& historydata)
 {
   Core::Communication::UnpackBuffer data(buffer);
   while (!data.at_end())
@@ -345,7 +338,7 @@ void ParticleInteraction::DEMHistoryPairs::unpack_history_pairs(const std::vecto
     historypair.unpack(data);
 
     // add history pair data
-    historydata[globalid_i][globalid_j] = std::make_pair(true, historypair);
+    historydata(globalid_i, globalid_j) = std::make_pair(true, historypair);
   }
 }
 
@@ -370,24 +363,15 @@ void ParticleInteraction::DEMHistoryPairs::add_history_pair_to_buffer(std::vecto
  *---------------------------------------------------------------------------*/
 template void ParticleInteraction::DEMHistoryPairs::communicate_specific_history_pairs<
     ParticleInteraction::DEMHistoryPairTangential>(
-    const std::vector<std::vector<int>>&, DEMHistoryPairTangentialData&);
+    const std::vector<std::pair<int, int>>&, DEMHistoryPairTangentialData&);
 
 template void ParticleInteraction::DEMHistoryPairs::communicate_specific_history_pairs<
     ParticleInteraction::DEMHistoryPairRolling>(
-    const std::vector<std::vector<int>>&, DEMHistoryPairRollingData&);
+    const std::vector<std::pair<int, int>>&, DEMHistoryPairRollingData&);
 
 template void ParticleInteraction::DEMHistoryPairs::communicate_specific_history_pairs<
     ParticleInteraction::DEMHistoryPairAdhesion>(
-    const std::vector<std::vector<int>>&, DEMHistoryPairAdhesionData&);
-
-template void ParticleInteraction::DEMHistoryPairs::erase_untouched_history_pairs<
-    ParticleInteraction::DEMHistoryPairTangential>(DEMHistoryPairTangentialData&);
-
-template void ParticleInteraction::DEMHistoryPairs::erase_untouched_history_pairs<
-    ParticleInteraction::DEMHistoryPairRolling>(DEMHistoryPairRollingData&);
-
-template void ParticleInteraction::DEMHistoryPairs::erase_untouched_history_pairs<
-    ParticleInteraction::DEMHistoryPairAdhesion>(DEMHistoryPairAdhesionData&);
+    const std::vector<std::pair<int, int>>&, DEMHistoryPairAdhesionData&);
 
 template void ParticleInteraction::DEMHistoryPairs::pack_all_history_pairs<
     ParticleInteraction::DEMHistoryPairTangential>(
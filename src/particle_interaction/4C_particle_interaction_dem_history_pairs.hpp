@@ -16,11 +16,10 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_dem_history_pair_struct.hpp"
+#include "4C_particle_interaction_dem_history_pair_table.hpp"
 
 #include <mpi.h>
 
-#include <unordered_map>
-
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -41,19 +40,17 @@ namespace PARTICLEENGINE
  *---------------------------------------------------------------------------*/
 namespace ParticleInteraction
 {
-  using TouchedDEMHistoryPairTangential =
-      std::pair<bool, ParticleInteraction::DEMHistoryPairTangential>;
   using DEMHistoryPairTangentialData =
-      std::unordered_map<int, std::unordered_map<int, TouchedDEMHistoryPairTangential>>;
+      ParticleInteraction::DEMHistoryPairTable<ParticleInteraction::DEMHistoryPairTangential>;
+  using TouchedDEMHistoryPairTangential = DEMHistoryPairTangentialData::TouchedHistoryPair;
 
-  using TouchedDEMHistoryPairRolling = std::pair<bool, ParticleInteraction::DEMHistoryPairRolling>;
   using DEMHistoryPairRollingData =
-      std::unordered_map<int, std::unordered_map<int, TouchedDEMHistoryPairRolling>>;
+      ParticleInteraction::DEMHistoryPairTable<ParticleInteraction::DEMHistoryPairRolling>;
+  using TouchedDEMHistoryPairRolling = DEMHistoryPairRollingData::TouchedHistoryPair;
 
-  using TouchedDEMHistoryPairAdhesion =
-      std::pair<bool, ParticleInteraction::DEMHistoryPairAdhesion>;
   using DEMHistoryPairAdhesionData =
-      std::unordered_map<int, std::unordered_map<int, TouchedDEMHistoryPairAdhesion>>;
+      ParticleInteraction::DEMHistoryPairTable<ParticleInteraction::DEMHistoryPairAdhesion>;
+  using TouchedDEMHistoryPairAdhesion = DEMHistoryPairAdhesionData::TouchedHistoryPair;
 }  // namespace ParticleInteraction
 
 /*---------------------------------------------------------------------------*
@@ -128,33 +125,29 @@ namespace ParticleInteraction
    private:
     //! communicate specific history pairs
     template <typename Historypairtype>
-    void communicate_specific_history_pairs(const std::vector<std::vector<int>>& particletargets,
-        std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>&
-            historydata);
-
-    //! erase untouched history pairs
-    template <typename Historypairtype>
-    void erase_untouched_history_pairs(
-        std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>&
-            historydata);
+    void communicate_specific_history_pairs(
+        const std::vector<std::pair<int, int>>& globalidstotargets,
+        DEMHistoryPairTable<Historypairtype>& historydata);
 
     //! pack all history pairs
     template <typename Historypairtype>
-    void pack_all_history_pairs(std::vector<char>& buffer,
-        const std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>&
-            historydata) const;
+    void pack_all_history_pairs(
+        std::vector<char>& buffer, const DEMHistoryPairTable<Historypairtype>& historydata) const;
 
     //! unpack history pairs
     template <typename Historypairtype>
-    void unpack_history_pairs(const std::vector<char>& buffer,
-        std::unordered_map<int, std::unordered_map<int, std::pair<bool, Historypairtype>>>&
-            historydata);
+    void unpack_history_pairs(
+        const std::vector<char>& buffer, DEMHistoryPairTable<Historypairtype>& historydata);
 
     //! add history pair to buffer
     template <typename Historypairtype>
     void add_history_pair_to_buffer(std::vector<char>& buffer, int globalid_i, int globalid_j,
         const Historypairtype& historypair) const;
 
+    //! relate particle global ids to target processors sorted by global id
+    void relate_global_ids_to_targets(const std::vector<std::vector<int>>& particletargets,
+        std::vector<std::pair<int, int>>& globalidstotargets) const;
+
     //! communication
     MPI_Comm comm_;
 
@@ -8,6 +8,7 @@
 #include "4C_particle_interaction_sph.hpp"
 
 #include "4C_io_pstream.hpp"
+#include "4C_mat_particle_sph_fluid.hpp"
 #include "4C_particle_engine_container.hpp"
 #include "4C_particle_engine_interface.hpp"
 #include "4C_particle_interaction_material_handler.hpp"
@@ -31,6 +32,8 @@
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -407,6 +410,58 @@ double ParticleInteraction::ParticleInteractionSPH::max_interaction_distance() c
   return max_particle_radius();
 }
 
+double ParticleInteraction::ParticleInteractionSPH::critical_time_step() const
+{
+  // init value of critical time step size
+  double dt_crit = std::numeric_limits<double>::max();
+
+  // iterate over particle types
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+  {
+    // no time step restriction for boundary or rigid particles
+    if (type_i == PARTICLEENGINE::BoundaryPhase or type_i == PARTICLEENGINE::RigidPhase) continue;
+
+    // get container of owned particles of current particle type
+    PARTICLEENGINE::ParticleContainer* container =
+        particlecontainerbundle_->get_specific_container(type_i, PARTICLEENGINE::Owned);
+
+    // get number of particles stored in container
+    const int particlestored = container->particles_stored();
+
+    // no owned particles of current particle type
+    if (particlestored <= 0) continue;
+
+    // get material for current particle type
+    const Mat::PAR::ParticleMaterialSPHFluid* material =
+        dynamic_cast<const Mat::PAR::ParticleMaterialSPHFluid*>(
+            particlematerial_->get_ptr_to_particle_mat_parameter(type_i));
+    FOUR_C_ASSERT(material != nullptr, "cast to Mat::PAR::ParticleMaterialSPHFluid failed!");
+
+    // get minimum smoothing length of current particle type
+    const double h =
+        kernel_->smoothing_length(container->get_min_value_of_state(PARTICLEENGINE::Radius));
+
+    // get maximum velocity magnitude of current particle type
+    double maxvel = 0.0;
+    for (int i = 0; i < particlestored; ++i)
+    {
+      const double* vel = container->get_ptr_to_state(PARTICLEENGINE::Velocity, i);
+      maxvel = std::max(maxvel, ParticleInteraction::Utils::vec_norm_two(vel));
+    }
+
+    // time step size based on CFL condition (with Courant number 0.25)
+    dt_crit = std::min(dt_crit, 0.25 * h / (material->speed_of_sound() + maxvel));
+
+    // kinematic viscosity
+    const double nu = material->dynamicViscosity_ / material->initDensity_;
+
+    // time step size based on viscous diffusion
+    if (nu > 0.0) dt_crit = std::min(dt_crit, 0.125 * h * h / nu);
+  }
+
+  return dt_crit;
+}
+
 void ParticleInteraction::ParticleInteractionSPH::distribute_interaction_history() const
 {
   // nothing to do
@@ -160,41 +160,41 @@ void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contributio
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+  // iterate over particle pairs bucket-wise thread-parallel
+  neighborpairs_->evaluate_particle_pair_buckets_by_color(
+      [&](const SPHParticlePairBucket& bucket)
+      {
+        // get corresponding particle containers (particle i is always owned)
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(bucket.type_i_, PARTICLEENGINE::Owned);
 
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(bucket.type_j_, bucket.status_j_);
 
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
+        // get particle states
+        const auto mass_i = get_particle_state(*container_i, PARTICLEENGINE::Mass);
+        const auto denssum_i = cond_get_particle_state(*container_i, PARTICLEENGINE::DensitySum);
 
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+        const auto mass_j = get_particle_state(*container_j, PARTICLEENGINE::Mass);
+        const auto denssum_j =
+            (bucket.status_j_ == PARTICLEENGINE::Owned)
+                ? cond_get_particle_state(*container_j, PARTICLEENGINE::DensitySum)
+                : SPHParticleState<double>();
 
-    // get pointer to particle states
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-    double* denssum_i = container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_i);
-
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
-    double* denssum_j = container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_j);
+        return [=](const SPHParticlePair& particlepair)
+        {
+          const int particle_i = std::get<2>(particlepair.tuple_i_);
+          const int particle_j = std::get<2>(particlepair.tuple_j_);
 
-    // sum contribution of neighboring particle j
-    if (denssum_i) denssum_i[0] += particlepair.Wij_ * mass_i[0];
+          // sum contribution of neighboring particle j
+          if (denssum_i.data_)
+            denssum_i(particle_i)[0] += particlepair.Wij_ * mass_i(particle_i)[0];
 
-    // sum contribution of neighboring particle i
-    if (denssum_j and status_j == PARTICLEENGINE::Owned)
-      denssum_j[0] += particlepair.Wji_ * mass_j[0];
-  }
+          // sum contribution of neighboring particle i
+          if (denssum_j.data_)
+            denssum_j(particle_j)[0] += particlepair.Wji_ * mass_j(particle_j)[0];
+        };
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_wall_contribution() const
@@ -327,60 +327,62 @@ void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution()
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
-
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+  // iterate over particle pairs bucket-wise thread-parallel
+  neighborpairs_->evaluate_particle_pair_buckets_by_color(
+      [&](const SPHParticlePairBucket& bucket)
+      {
+        // get corresponding particle containers (particle i is always owned)
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(bucket.type_i_, PARTICLEENGINE::Owned);
 
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(bucket.type_j_, bucket.status_j_);
 
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialBase* material_i =
+            particlematerial_->get_ptr_to_particle_mat_parameter(bucket.type_i_);
 
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialBase* material_i =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
+        const Mat::PAR::ParticleMaterialBase* material_j =
+            particlematerial_->get_ptr_to_particle_mat_parameter(bucket.type_j_);
 
-    const Mat::PAR::ParticleMaterialBase* material_j =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
+        // get particle states
+        const auto mass_i = get_particle_state(*container_i, PARTICLEENGINE::Mass);
 
-    // get pointer to particle states
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        const SPHParticleState<const double> dens_i =
+            container_i->have_stored_state(PARTICLEENGINE::Density)
+                ? get_particle_state(*container_i, PARTICLEENGINE::Density)
+                : get_uniform_particle_state(material_j->initDensity_);
 
-    const double* dens_i = container_i->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
-                               : &(material_j->initDensity_);
+        const auto colorfield_i = cond_get_particle_state(*container_i, PARTICLEENGINE::Colorfield);
 
-    double* colorfield_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_i);
+        const auto mass_j = get_particle_state(*container_j, PARTICLEENGINE::Mass);
 
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        const SPHParticleState<const double> dens_j =
+            container_j->have_stored_state(PARTICLEENGINE::Density)
+                ? get_particle_state(*container_j, PARTICLEENGINE::Density)
+                : get_uniform_particle_state(material_i->initDensity_);
 
-    const double* dens_j = container_j->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
-                               : &(material_i->initDensity_);
+        const auto colorfield_j =
+            (bucket.status_j_ == PARTICLEENGINE::Owned)
+                ? cond_get_particle_state(*container_j, PARTICLEENGINE::Colorfield)
+                : SPHParticleState<double>();
 
-    double* colorfield_j =
-        container_j->cond_get_ptr_to_state(PARTICLEENGINE::Colorfield, particle_j);
+        return [=](const SPHParticlePair& particlepair)
+        {
+          const int particle_i = std::get<2>(particlepair.tuple_i_);
+          const int particle_j = std::get<2>(particlepair.tuple_j_);
 
-    // sum contribution of neighboring particle j
-    if (colorfield_i) colorfield_i[0] += (particlepair.Wij_ / dens_j[0]) * mass_j[0];
+          // sum contribution of neighboring particle j
+          if (colorfield_i.data_)
+            colorfield_i(particle_i)[0] +=
+                (particlepair.Wij_ / dens_j(particle_j)[0]) * mass_j(particle_j)[0];
 
-    // sum contribution of neighboring particle i
-    if (colorfield_j and status_j == PARTICLEENGINE::Owned)
-      colorfield_j[0] += (particlepair.Wji_ / dens_i[0]) * mass_i[0];
-  }
+          // sum contribution of neighboring particle i
+          if (colorfield_j.data_)
+            colorfield_j(particle_j)[0] +=
+                (particlepair.Wji_ / dens_i(particle_i)[0]) * mass_i(particle_i)[0];
+        };
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_wall_contribution() const
@@ -490,76 +492,81 @@ void ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribut
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
-  {
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
-
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
-
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
-
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
-
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialBase* material_i =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_i);
-
-    const Mat::PAR::ParticleMaterialBase* material_j =
-        particlematerial_->get_ptr_to_particle_mat_parameter(type_j);
+  // iterate over particle pairs bucket-wise thread-parallel
+  neighborpairs_->evaluate_particle_pair_buckets_by_color(
+      [&](const SPHParticlePairBucket& bucket)
+      {
+        // get corresponding particle containers (particle i is always owned)
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(bucket.type_i_, PARTICLEENGINE::Owned);
 
-    // get pointer to particle states
-    const double* vel_i =
-        container_i->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
-            ? container_i->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i)
-            : container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(bucket.type_j_, bucket.status_j_);
 
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialBase* material_i =
+            particlematerial_->get_ptr_to_particle_mat_parameter(bucket.type_i_);
 
-    const double* dens_i = container_i->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i)
-                               : &(material_j->initDensity_);
+        const Mat::PAR::ParticleMaterialBase* material_j =
+            particlematerial_->get_ptr_to_particle_mat_parameter(bucket.type_j_);
 
-    double* densdot_i = container_i->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_i);
+        // get particle states
+        const auto vel_i =
+            container_i->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
+                ? get_particle_state(*container_i, PARTICLEENGINE::ModifiedVelocity)
+                : get_particle_state(*container_i, PARTICLEENGINE::Velocity);
 
-    const double* vel_j =
-        container_j->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
-            ? container_j->get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j)
-            : container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
+        const auto mass_i = get_particle_state(*container_i, PARTICLEENGINE::Mass);
 
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
+        const SPHParticleState<const double> dens_i =
+            container_i->have_stored_state(PARTICLEENGINE::Density)
+                ? get_particle_state(*container_i, PARTICLEENGINE::Density)
+                : get_uniform_particle_state(material_j->initDensity_);
 
-    const double* dens_j = container_j->have_stored_state(PARTICLEENGINE::Density)
-                               ? container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j)
-                               : &(material_i->initDensity_);
+        const auto densdot_i = cond_get_particle_state(*container_i, PARTICLEENGINE::DensityDot);
 
-    double* densdot_j = container_j->cond_get_ptr_to_state(PARTICLEENGINE::DensityDot, particle_j);
+        const auto vel_j =
+            container_j->have_stored_state(PARTICLEENGINE::ModifiedVelocity)
+                ? get_particle_state(*container_j, PARTICLEENGINE::ModifiedVelocity)
+                : get_particle_state(*container_j, PARTICLEENGINE::Velocity);
 
-    // relative velocity (use modified velocities in case of transport velocity formulation)
-    double vel_ij[3];
-    Utils::vec_set(vel_ij, vel_i);
-    Utils::vec_sub(vel_ij, vel_j);
+        const auto mass_j = get_particle_state(*container_j, PARTICLEENGINE::Mass);
 
-    const double e_ij_vel_ij = Utils::vec_dot(particlepair.e_ij_, vel_ij);
+        const SPHParticleState<const double> dens_j =
+            container_j->have_stored_state(PARTICLEENGINE::Density)
+                ? get_particle_state(*container_j, PARTICLEENGINE::Density)
+                : get_uniform_particle_state(material_i->initDensity_);
 
-    // sum contribution of neighboring particle j
-    if (densdot_i)
-      densdot_i[0] += dens_i[0] * (mass_j[0] / dens_j[0]) * particlepair.dWdrij_ * e_ij_vel_ij;
+        const auto densdot_j =
+            (bucket.status_j_ == PARTICLEENGINE::Owned)
+                ? cond_get_particle_state(*container_j, PARTICLEENGINE::DensityDot)
+                : SPHParticleState<double>();
 
-    // sum contribution of neighboring particle i
-    if (densdot_j and status_j == PARTICLEENGINE::Owned)
-      densdot_j[0] += dens_j[0] * (mass_i[0] / dens_i[0]) * particlepair.dWdrji_ * e_ij_vel_ij;
-  }
+        return [=](const SPHParticlePair& particlepair)
+        {
+          const int particle_i = std::get<2>(particlepair.tuple_i_);
+          const int particle_j = std::get<2>(particlepair.tuple_j_);
+
+          // relative velocity (use modified velocities in case of transport velocity formulation)
+          double vel_ij[3];
+          Utils::vec_set(vel_ij, vel_i(particle_i));
+          Utils::vec_sub(vel_ij, vel_j(particle_j));
+
+          const double e_ij_vel_ij = Utils::vec_dot(particlepair.e_ij_, vel_ij);
+
+          // sum contribution of neighboring particle j
+          if (densdot_i.data_)
+            densdot_i(particle_i)[0] += dens_i(particle_i)[0] *
+                                        (mass_j(particle_j)[0] / dens_j(particle_j)[0]) *
+                                        particlepair.dWdrij_ * e_ij_vel_ij;
+
+          // sum contribution of neighboring particle i
+          if (densdot_j.data_)
+            densdot_j(particle_j)[0] += dens_j(particle_j)[0] *
+                                        (mass_i(particle_i)[0] / dens_i(particle_i)[0]) *
+                                        particlepair.dWdrji_ * e_ij_vel_ij;
+        };
+      });
 }
 
 void ParticleInteraction::SPHDensityBase::continuity_equation_particle_wall_contribution() const
@@ -14,6 +14,7 @@
 #include "4C_config.hpp"
 
 #include "4C_inpar_particle.hpp"
+#include "4C_utils_exceptions.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
 #include <memory>
@@ -120,6 +121,23 @@ namespace ParticleInteraction
     double d2_wdrij2(const double& rij, const double& support) const override;
   };
 
+  /*!
+   * \brief call function with kernel handler of concrete type
+   *
+   * The kernel handler is passed to the function with its concrete (final) type such that calls to
+   * the kernel within performance critical particle pair loops are resolved at compile-time.
+   */
+  template <typename Function>
+  void dispatch_kernel(const SPHKernelBase& kernel, Function&& function)
+  {
+    if (const auto* cubicspline = dynamic_cast<const SPHKernelCubicSpline*>(&kernel))
+      function(*cubicspline);
+    else if (const auto* quinticspline = dynamic_cast<const SPHKernelQuinticSpline*>(&kernel))
+      function(*quinticspline);
+    else
+      FOUR_C_THROW("unknown kernel type!");
+  }
+
 }  // namespace ParticleInteraction
 
 /*---------------------------------------------------------------------------*/
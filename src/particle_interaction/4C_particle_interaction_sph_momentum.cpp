@@ -143,6 +143,10 @@ void ParticleInteraction::SPHMomentum::setup(
   // allocate memory to hold particle types
   fluidmaterial_.resize(typevectorsize);
 
+  // allocate memory to hold flag of integrated fluid particle types
+  isintfluidtype_.assign(typevectorsize, false);
+  for (const auto& type_i : intfluidtypes_) isintfluidtype_[type_i] = true;
+
   // iterate over all fluid particle types
   for (const auto& type_i : allfluidtypes_)
   {
@@ -244,164 +248,187 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution()
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution");
 
-  // get relevant particle pair indices
-  std::vector<int> relindices;
-  neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(
-      allfluidtypes_, relindices);
-
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
-  {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
-    // access values of local index tuples of particle i and j
-    PARTICLEENGINE::TypeEnum type_i;
-    PARTICLEENGINE::StatusEnum status_i;
-    int particle_i;
-    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
-
-    PARTICLEENGINE::TypeEnum type_j;
-    PARTICLEENGINE::StatusEnum status_j;
-    int particle_j;
-    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
-
-    // get corresponding particle containers
-    PARTICLEENGINE::ParticleContainer* container_i =
-        particlecontainerbundle_->get_specific_container(type_i, status_i);
-
-    PARTICLEENGINE::ParticleContainer* container_j =
-        particlecontainerbundle_->get_specific_container(type_j, status_j);
+  // get relevant buckets of particle pairs grouped by conflict-free colors
+  neighborpairs_->get_relevant_particle_pair_buckets_for_equal_combination(
+      allfluidtypes_, relbuckets_, relcoloroffsets_);
 
-    // get material for particle types
-    const Mat::PAR::ParticleMaterialSPHFluid* material_i = fluidmaterial_[type_i];
-    const Mat::PAR::ParticleMaterialSPHFluid* material_j = fluidmaterial_[type_j];
-
-    // get pointer to particle states
-    const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
-    const double* mass_i = container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i);
-    const double* dens_i = container_i->get_ptr_to_state(PARTICLEENGINE::Density, particle_i);
-    const double* press_i = container_i->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_i);
-    const double* vel_i = container_i->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_i);
-
-    double* acc_i = nullptr;
-    if (intfluidtypes_.count(type_i))
-      acc_i = container_i->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_i);
-
-    const double* mod_vel_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_i);
-    double* mod_acc_i =
-        container_i->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_i);
-
-    // get pointer to particle states
-    const double* rad_j = container_j->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
-    const double* mass_j = container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j);
-    const double* dens_j = container_j->get_ptr_to_state(PARTICLEENGINE::Density, particle_j);
-    const double* press_j = container_j->get_ptr_to_state(PARTICLEENGINE::Pressure, particle_j);
-    const double* vel_j = container_j->get_ptr_to_state(PARTICLEENGINE::Velocity, particle_j);
-
-    double* acc_j = nullptr;
-    if (intfluidtypes_.count(type_j) and status_j == PARTICLEENGINE::Owned)
-      acc_j = container_j->get_ptr_to_state(PARTICLEENGINE::Acceleration, particle_j);
-
-    const double* mod_vel_j =
-        container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedVelocity, particle_j);
-
-    double* mod_acc_j = nullptr;
-    if (status_j == PARTICLEENGINE::Owned)
-      mod_acc_j =
-          container_j->cond_get_ptr_to_state(PARTICLEENGINE::ModifiedAcceleration, particle_j);
-
-    // evaluate specific coefficient
-    double speccoeff_ij(0.0);
-    double speccoeff_ji(0.0);
-    momentumformulation_->specific_coefficient(dens_i, dens_j, mass_i, mass_j, particlepair.dWdrij_,
-        particlepair.dWdrji_, &speccoeff_ij, &speccoeff_ji);
-
-    // evaluate pressure gradient
-    momentumformulation_->pressure_gradient(dens_i, dens_j, press_i, press_j, speccoeff_ij,
-        speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
-
-    // evaluate shear forces
-    {
-      // get factor from kernel space dimension
-      int kernelfac = 0;
-      kernel_->kernel_space_dimension(kernelfac);
-      kernelfac += 2;
-
-      // evaluate shear forces
-      momentumformulation_->shear_forces(dens_i, dens_j, vel_i, vel_j, kernelfac,
-          material_i->dynamicViscosity_, material_j->dynamicViscosity_, material_i->bulkViscosity_,
-          material_j->bulkViscosity_, particlepair.absdist_, speccoeff_ij, speccoeff_ji,
-          particlepair.e_ij_, acc_i, acc_j);
-    }
-
-    // apply transport velocity formulation
-    if (transportvelocityformulation_ ==
-        Inpar::PARTICLE::TransportVelocityFormulation::StandardTransportVelocity)
-    {
-      // evaluate background pressure (standard formulation)
-      momentumformulation_->standard_background_pressure(dens_i, dens_j,
-          material_i->backgroundPressure_, material_j->backgroundPressure_, speccoeff_ij,
-          speccoeff_ji, particlepair.e_ij_, mod_acc_i, mod_acc_j);
+  // evaluate with kernel and momentum formulation handler of concrete type
+  dispatch_kernel(*kernel_, [&](const auto& kernel)
+      {
+        dispatch_momentum_formulation(*momentumformulation_,
+            [&](const auto& momentumformulation)
+            { momentum_equation_particle_contribution(kernel, momentumformulation); });
+      });
+}
 
-      // evaluate convection of momentum with relative velocity
-      momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j, mod_vel_i,
-          mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
-    }
-    else if (transportvelocityformulation_ ==
-             Inpar::PARTICLE::TransportVelocityFormulation::GeneralizedTransportVelocity)
-    {
-      // modified first derivative of kernel
-      const double mod_dWdrij =
-          (mod_acc_i) ? kernel_->d_wdrij(particlepair.absdist_, kernel_->smoothing_length(rad_i[0]))
-                      : 0.0;
-      const double mod_dWdrji =
-          (mod_acc_j) ? kernel_->d_wdrij(particlepair.absdist_, kernel_->smoothing_length(rad_j[0]))
-                      : 0.0;
+template <typename Kernel, typename MomentumFormulation>
+void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution(
+    const Kernel& kernel, const MomentumFormulation& momentumformulation) const
+{
+  // get factor from kernel space dimension
+  int kernelfac = 0;
+  kernel.kernel_space_dimension(kernelfac);
+  kernelfac += 2;
+
+  // iterate over relevant particle pairs bucket-wise
+  neighborpairs_->evaluate_particle_pair_buckets_by_color(relbuckets_, relcoloroffsets_,
+      [&](const SPHParticlePairBucket& bucket)
+      {
+        // get corresponding particle containers (particle i is always owned)
+        PARTICLEENGINE::ParticleContainer* container_i =
+            particlecontainerbundle_->get_specific_container(bucket.type_i_, PARTICLEENGINE::Owned);
 
-      // modified background pressure
-      const double mod_bg_press_i =
-          (mod_acc_i) ? std::min(std::abs(10.0 * press_i[0]), material_i->backgroundPressure_)
-                      : 0.0;
-      const double mod_bg_press_j =
-          (mod_acc_j) ? std::min(std::abs(10.0 * press_j[0]), material_j->backgroundPressure_)
-                      : 0.0;
+        PARTICLEENGINE::ParticleContainer* container_j =
+            particlecontainerbundle_->get_specific_container(bucket.type_j_, bucket.status_j_);
 
-      // evaluate background pressure (generalized formulation)
-      momentumformulation_->generalized_background_pressure(dens_i, dens_j, mass_i, mass_j,
-          mod_bg_press_i, mod_bg_press_j, mod_dWdrij, mod_dWdrji, particlepair.e_ij_, mod_acc_i,
-          mod_acc_j);
+        // get material for particle types
+        const Mat::PAR::ParticleMaterialSPHFluid* material_i = fluidmaterial_[bucket.type_i_];
+        const Mat::PAR::ParticleMaterialSPHFluid* material_j = fluidmaterial_[bucket.type_j_];
 
-      // evaluate convection of momentum with relative velocity
-      momentumformulation_->modified_velocity_contribution(dens_i, dens_j, vel_i, vel_j, mod_vel_i,
-          mod_vel_j, speccoeff_ij, speccoeff_ji, particlepair.e_ij_, acc_i, acc_j);
-    }
+        // get speed of sound
+        const double c_i = material_i->speed_of_sound();
+        const double c_j =
+            (bucket.type_i_ == bucket.type_j_) ? c_i : material_j->speed_of_sound();
 
-    // evaluate artificial viscosity
-    if (material_i->artificialViscosity_ > 0.0 or material_j->artificialViscosity_ > 0.0)
-    {
-      // particle averaged smoothing length
-      const double h_ij =
-          0.5 * (kernel_->smoothing_length(rad_i[0]) + kernel_->smoothing_length(rad_j[0]));
+        // evaluate artificial viscosity
+        const bool artificialviscosity =
+            (material_i->artificialViscosity_ > 0.0 or material_j->artificialViscosity_ > 0.0);
+
+        // get particle states
+        const auto rad_i = get_particle_state(*container_i, PARTICLEENGINE::Radius);
+        const auto mass_i = get_particle_state(*container_i, PARTICLEENGINE::Mass);
+        const auto dens_i = get_particle_state(*container_i, PARTICLEENGINE::Density);
+        const auto press_i = get_particle_state(*container_i, PARTICLEENGINE::Pressure);
+        const auto vel_i = get_particle_state(*container_i, PARTICLEENGINE::Velocity);
+
+        const auto acc_i = isintfluidtype_[bucket.type_i_]
+                               ? get_particle_state(*container_i, PARTICLEENGINE::Acceleration)
+                               : SPHParticleState<double>();
+
+        const auto mod_vel_i =
+            cond_get_particle_state(*container_i, PARTICLEENGINE::ModifiedVelocity);
+        const auto mod_acc_i =
+            cond_get_particle_state(*container_i, PARTICLEENGINE::ModifiedAcceleration);
+
+        const auto rad_j = get_particle_state(*container_j, PARTICLEENGINE::Radius);
+        const auto mass_j = get_particle_state(*container_j, PARTICLEENGINE::Mass);
+        const auto dens_j = get_particle_state(*container_j, PARTICLEENGINE::Density);
+        const auto press_j = get_particle_state(*container_j, PARTICLEENGINE::Pressure);
+        const auto vel_j = get_particle_state(*container_j, PARTICLEENGINE::Velocity);
+
+        const auto acc_j =
+            (isintfluidtype_[bucket.type_j_] and bucket.status_j_ == PARTICLEENGINE::Owned)
+                ? get_particle_state(*container_j, PARTICLEENGINE::Acceleration)
+                : SPHParticleState<double>();
+
+        const auto mod_vel_j =
+            cond_get_particle_state(*container_j, PARTICLEENGINE::ModifiedVelocity);
+
+        const auto mod_acc_j =
+            (bucket.status_j_ == PARTICLEENGINE::Owned)
+                ? cond_get_particle_state(*container_j, PARTICLEENGINE::ModifiedAcceleration)
+                : SPHParticleState<double>();
+
+        return [=, this, &kernel, &momentumformulation](const SPHParticlePair& particlepair)
+        {
+          const int particle_i = std::get<2>(particlepair.tuple_i_);
+          const int particle_j = std::get<2>(particlepair.tuple_j_);
 
-      // get speed of sound
-      const double c_i = material_i->speed_of_sound();
-      const double c_j = (type_i == type_j) ? c_i : material_j->speed_of_sound();
+          // evaluate specific coefficient
+          double speccoeff_ij(0.0);
+          double speccoeff_ji(0.0);
+          momentumformulation.specific_coefficient(dens_i(particle_i), dens_j(particle_j),
+              mass_i(particle_i), mass_j(particle_j), particlepair.dWdrij_, particlepair.dWdrji_,
+              &speccoeff_ij, &speccoeff_ji);
 
-      // particle averaged speed of sound
-      const double c_ij = 0.5 * (c_i + c_j);
+          // evaluate pressure gradient
+          momentumformulation.pressure_gradient(dens_i(particle_i), dens_j(particle_j),
+              press_i(particle_i), press_j(particle_j), speccoeff_ij, speccoeff_ji,
+              particlepair.e_ij_, acc_i(particle_i), acc_j(particle_j));
 
-      // particle averaged density
-      const double dens_ij = 0.5 * (dens_i[0] + dens_j[0]);
+          // evaluate shear forces
+          momentumformulation.shear_forces(dens_i(particle_i), dens_j(particle_j),
+              vel_i(particle_i), vel_j(particle_j), kernelfac, material_i->dynamicViscosity_,
+              material_j->dynamicViscosity_, material_i->bulkViscosity_,
+              material_j->bulkViscosity_, particlepair.absdist_, speccoeff_ij, speccoeff_ji,
+              particlepair.e_ij_, acc_i(particle_i), acc_j(particle_j));
+
+          // apply transport velocity formulation
+          if (transportvelocityformulation_ ==
+              Inpar::PARTICLE::TransportVelocityFormulation::StandardTransportVelocity)
+          {
+            // evaluate background pressure (standard formulation)
+            momentumformulation.standard_background_pressure(dens_i(particle_i),
+                dens_j(particle_j), material_i->backgroundPressure_,
+                material_j->backgroundPressure_, speccoeff_ij, speccoeff_ji, particlepair.e_ij_,
+                mod_acc_i(particle_i), mod_acc_j(particle_j));
+
+            // evaluate convection of momentum with relative velocity
+            momentumformulation.modified_velocity_contribution(dens_i(particle_i),
+                dens_j(particle_j), vel_i(particle_i), vel_j(particle_j), mod_vel_i(particle_i),
+                mod_vel_j(particle_j), speccoeff_ij, speccoeff_ji, particlepair.e_ij_,
+                acc_i(particle_i), acc_j(particle_j));
+          }
+          else if (transportvelocityformulation_ ==
+                   Inpar::PARTICLE::TransportVelocityFormulation::GeneralizedTransportVelocity)
+          {
+            // modified first derivative of kernel
+            const double mod_dWdrij =
+                (mod_acc_i.data_)
+                    ? kernel.d_wdrij(
+                          particlepair.absdist_, kernel.smoothing_length(rad_i(particle_i)[0]))
+                    : 0.0;
+            const double mod_dWdrji =
+                (mod_acc_j.data_)
+                    ? kernel.d_wdrij(
+                          particlepair.absdist_, kernel.smoothing_length(rad_j(particle_j)[0]))
+                    : 0.0;
+
+            // modified background pressure
+            const double mod_bg_press_i =
+                (mod_acc_i.data_) ? std::min(std::abs(10.0 * press_i(particle_i)[0]),
+                                        material_i->backgroundPressure_)
+                                  : 0.0;
+            const double mod_bg_press_j =
+                (mod_acc_j.data_) ? std::min(std::abs(10.0 * press_j(particle_j)[0]),
+                                        material_j->backgroundPressure_)
+                                  : 0.0;
+
+            // evaluate background pressure (generalized formulation)
+            momentumformulation.generalized_background_pressure(dens_i(particle_i),
+                dens_j(particle_j), mass_i(particle_i), mass_j(particle_j), mod_bg_press_i,
+                mod_bg_press_j, mod_dWdrij, mod_dWdrji, particlepair.e_ij_, mod_acc_i(particle_i),
+                mod_acc_j(particle_j));
+
+            // evaluate convection of momentum with relative velocity
+            momentumformulation.modified_velocity_contribution(dens_i(particle_i),
+                dens_j(particle_j), vel_i(particle_i), vel_j(particle_j), mod_vel_i(particle_i),
+                mod_vel_j(particle_j), speccoeff_ij, speccoeff_ji, particlepair.e_ij_,
+                acc_i(particle_i), acc_j(particle_j));
+          }
 
-      // evaluate artificial viscosity
-      artificialviscosity_->artificial_viscosity(vel_i, vel_j, mass_i, mass_j,
-          material_i->artificialViscosity_, material_j->artificialViscosity_, particlepair.dWdrij_,
-          particlepair.dWdrji_, dens_ij, h_ij, c_ij, particlepair.absdist_, particlepair.e_ij_,
-          acc_i, acc_j);
-    }
-  }
+          // evaluate artificial viscosity
+          if (artificialviscosity)
+          {
+            // particle averaged smoothing length
+            const double h_ij = 0.5 * (kernel.smoothing_length(rad_i(particle_i)[0]) +
+                                          kernel.smoothing_length(rad_j(particle_j)[0]));
+
+            // particle averaged speed of sound
+            const double c_ij = 0.5 * (c_i + c_j);
+
+            // particle averaged density
+            const double dens_ij = 0.5 * (dens_i(particle_i)[0] + dens_j(particle_j)[0]);
+
+            // evaluate artificial viscosity
+            artificialviscosity_->artificial_viscosity(vel_i(particle_i), vel_j(particle_j),
+                mass_i(particle_i), mass_j(particle_j), material_i->artificialViscosity_,
+                material_j->artificialViscosity_, particlepair.dWdrij_, particlepair.dWdrji_,
+                dens_ij, h_ij, c_ij, particlepair.absdist_, particlepair.e_ij_, acc_i(particle_i),
+                acc_j(particle_j));
+          }
+        };
+      });
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution() const
@@ -16,6 +16,7 @@
 #include "4C_inpar_particle.hpp"
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
+#include "4C_particle_interaction_sph_neighbor_pair_struct.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
 FOUR_C_NAMESPACE_OPEN
@@ -109,6 +110,11 @@ namespace ParticleInteraction
     //! momentum equation (particle contribution)
     void momentum_equation_particle_contribution() const;
 
+    //! momentum equation (particle contribution) with handlers of concrete type
+    template <typename Kernel, typename MomentumFormulation>
+    void momentum_equation_particle_contribution(
+        const Kernel& kernel, const MomentumFormulation& momentumformulation) const;
+
     //! momentum equation (particle-boundary contribution)
     void momentum_equation_particle_boundary_contribution() const;
 
@@ -174,6 +180,15 @@ namespace ParticleInteraction
 
     //! set of boundary particle types
     std::set<PARTICLEENGINE::TypeEnum> boundarytypes_;
+
+    //! flag indicating integrated fluid particle types
+    std::vector<bool> isintfluidtype_;
+
+    //! buffer for relevant buckets of particle pairs grouped by color
+    mutable std::vector<SPHParticlePairBucket> relbuckets_;
+
+    //! buffer for offsets of colors of relevant buckets of particle pairs
+    mutable std::vector<int> relcoloroffsets_;
   };
 
 }  // namespace ParticleInteraction
@@ -13,6 +13,8 @@
  *---------------------------------------------------------------------------*/
 #include "4C_config.hpp"
 
+#include "4C_utils_exceptions.hpp"
+
 #include <memory>
 
 FOUR_C_NAMESPACE_OPEN
@@ -157,6 +159,25 @@ namespace ParticleInteraction
         double* acc_j) const override;
   };
 
+  /*!
+   * \brief call function with momentum formulation handler of concrete type
+   *
+   * The momentum formulation handler is passed to the function with its concrete (final) type such
+   * that calls within performance critical particle pair loops are resolved at compile-time.
+   */
+  template <typename Function>
+  void dispatch_momentum_formulation(
+      const SPHMomentumFormulationBase& momentumformulation, Function&& function)
+  {
+    if (const auto* adami = dynamic_cast<const SPHMomentumFormulationAdami*>(&momentumformulation))
+      function(*adami);
+    else if (const auto* monaghan =
+                 dynamic_cast<const SPHMomentumFormulationMonaghan*>(&momentumformulation))
+      function(*monaghan);
+    else
+      FOUR_C_THROW("unknown momentum formulation type!");
+  }
+
 }  // namespace ParticleInteraction
 
 /*---------------------------------------------------------------------------*/
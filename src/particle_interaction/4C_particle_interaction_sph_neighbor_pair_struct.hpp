@@ -12,6 +12,8 @@
 
 #include "4C_particle_engine_typedefs.hpp"
 
+#include <type_traits>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::Elements
@@ -46,6 +48,56 @@ namespace ParticleInteraction
     double dWdrji_;
   };
 
+  /*!
+   * \brief struct to store a range of particle pairs with equal particle types and status
+   *
+   * \note Particle i of a particle pair is always owned, thus only the status of particle j is
+   *       distinguished.
+   */
+  struct SPHParticlePairBucket final
+  {
+    //! particle types of particles i and j
+    PARTICLEENGINE::TypeEnum type_i_;
+    PARTICLEENGINE::TypeEnum type_j_;
+
+    //! particle status of particle j
+    PARTICLEENGINE::StatusEnum status_j_;
+
+    //! range of particle pairs in particle pair data
+    int begin_;
+    int end_;
+  };
+
+  /*!
+   * \brief struct to access a particle state of all particles in a container
+   *
+   * The pointer to the state of a particle is obtained via the index of the particle in the
+   * container. A dimension of zero refers to a value shared by all particles, and an unset data
+   * pointer refers to a state not stored in the container.
+   */
+  template <typename T>
+  struct SPHParticleState final
+  {
+    //! get pointer to state of particle (nullptr if state is not stored)
+    inline T* operator()(const int particle) const
+    {
+      return (data_ != nullptr) ? data_ + dim_ * particle : nullptr;
+    }
+
+    //! convert to read-only access of particle state
+    operator SPHParticleState<const T>() const
+      requires(!std::is_const_v<T>)
+    {
+      return {data_, dim_};
+    }
+
+    //! pointer to state of first particle in container
+    T* data_ = nullptr;
+
+    //! dimension of particle state
+    int dim_ = 0;
+  };
+
   //! struct to store quantities of interacting particles and wall elements
   struct SPHParticleWallPair final
   {
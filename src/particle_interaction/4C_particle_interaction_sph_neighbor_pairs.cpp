@@ -18,6 +18,9 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+#include <bit>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -58,6 +61,9 @@ void ParticleInteraction::SPHNeighborPairs::setup(
 
   // allocate memory to hold index of particle wall pairs for each type
   indexofparticlewallpairs_.resize(typevectorsize);
+
+  // allocate memory to hold colors used by owned particles of each type
+  usedparticlepaircolors_.resize(typevectorsize);
 }
 
 void ParticleInteraction::SPHNeighborPairs::
@@ -96,6 +102,32 @@ void ParticleInteraction::SPHNeighborPairs::
           indexofparticlepairs_[type_i][type_j].end());
 }
 
+void ParticleInteraction::SPHNeighborPairs::
+    get_relevant_particle_pair_buckets_for_equal_combination(
+        const std::set<PARTICLEENGINE::TypeEnum>& types_a,
+        std::vector<SPHParticlePairBucket>& relbuckets, std::vector<int>& relcoloroffsets) const
+{
+  relbuckets.clear();
+  relcoloroffsets.assign(1, 0);
+
+  const int numcolors = static_cast<int>(particlepairbucketcoloroffsets_.size()) - 1;
+
+  // iterate over colors
+  for (int color = 0; color < numcolors; ++color)
+  {
+    for (int bucketindex = particlepairbucketcoloroffsets_[color];
+        bucketindex < particlepairbucketcoloroffsets_[color + 1]; ++bucketindex)
+    {
+      const SPHParticlePairBucket& bucket = particlepairbuckets_[bucketindex];
+
+      if (types_a.count(bucket.type_i_) and types_a.count(bucket.type_j_))
+        relbuckets.push_back(bucket);
+    }
+
+    relcoloroffsets.push_back(relbuckets.size());
+  }
+}
+
 void ParticleInteraction::SPHNeighborPairs::get_relevant_particle_wall_pair_indices(
     const std::set<PARTICLEENGINE::TypeEnum>& types_a, std::vector<int>& relindices) const
 {
@@ -118,14 +150,34 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs");
 
-  // clear particle pair data
-  particlepairdata_.clear();
+  // evaluate particle pairs with kernel handler of concrete type
+  dispatch_kernel(*kernel_, [&](const auto& kernel) { evaluate_particle_pairs(kernel); });
+
+  // sort particle pairs by conflict-free colors and buckets
+  color_particle_pairs();
 
   // clear index of particle pairs for each type
   for (const auto& type_i : particlecontainerbundle_->get_particle_types())
     for (const auto& type_j : particlecontainerbundle_->get_particle_types())
       indexofparticlepairs_[type_i][type_j].clear();
 
+  // store index of particle pairs for each type (sorted by color)
+  for (int particlepairindex = 0; particlepairindex < static_cast<int>(particlepairdata_.size());
+      ++particlepairindex)
+  {
+    const SPHParticlePair& particlepair = particlepairdata_[particlepairindex];
+
+    indexofparticlepairs_[std::get<0>(particlepair.tuple_i_)][std::get<0>(particlepair.tuple_j_)]
+        .push_back(particlepairindex);
+  }
+}
+
+template <typename Kernel>
+void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs(const Kernel& kernel)
+{
+  // clear particle pair data
+  particlepairdata_.clear();
+
   // index of particle pairs
   int particlepairindex = 0;
 
@@ -183,9 +235,6 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
       // get reference to current particle pair
       SPHParticlePair& particlepair = particlepairdata_[particlepairindex];
 
-      // store index of particle pairs for each type
-      indexofparticlepairs_[type_i][type_j].push_back(particlepairindex);
-
       // increase index
       ++particlepairindex;
 
@@ -203,10 +252,10 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
       if (absdist < rad_i[0])
       {
         // evaluate kernel
-        particlepair.Wij_ = kernel_->w(absdist, rad_i[0]);
+        particlepair.Wij_ = kernel.w(absdist, rad_i[0]);
 
         // evaluate first derivative of kernel
-        particlepair.dWdrij_ = kernel_->d_wdrij(absdist, rad_i[0]);
+        particlepair.dWdrij_ = kernel.d_wdrij(absdist, rad_i[0]);
       }
 
       // particle i within support radius of owned particle j
@@ -224,16 +273,134 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
         else
         {
           // evaluate kernel
-          particlepair.Wji_ = kernel_->w(absdist, rad_j[0]);
+          particlepair.Wji_ = kernel.w(absdist, rad_j[0]);
 
           // evaluate first derivative of kernel
-          particlepair.dWdrji_ = kernel_->d_wdrij(absdist, rad_j[0]);
+          particlepair.dWdrji_ = kernel.d_wdrij(absdist, rad_j[0]);
         }
       }
     }
   }
 }
 
+void ParticleInteraction::SPHNeighborPairs::color_particle_pairs()
+{
+  const int numparticlepairs = particlepairdata_.size();
+
+  // reset colors used by owned particles of each type
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+  {
+    const int particlestored =
+        particlecontainerbundle_->get_specific_container(type_i, PARTICLEENGINE::Owned)
+            ->particles_stored();
+
+    usedparticlepaircolors_[type_i].assign(particlestored, SPHParticlePairColorMask{});
+  }
+
+  // greedy coloring of particle pairs in the order of evaluation to obtain deterministic results
+  particlepaircolor_.resize(numparticlepairs);
+  for (int particlepairindex = 0; particlepairindex < numparticlepairs; ++particlepairindex)
+  {
+    const SPHParticlePair& particlepair = particlepairdata_[particlepairindex];
+
+    // access values of local index tuples of particle i and j
+    PARTICLEENGINE::TypeEnum type_i;
+    PARTICLEENGINE::StatusEnum status_i;
+    int particle_i;
+    std::tie(type_i, status_i, particle_i) = particlepair.tuple_i_;
+
+    PARTICLEENGINE::TypeEnum type_j;
+    PARTICLEENGINE::StatusEnum status_j;
+    int particle_j;
+    std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
+
+    // only owned particles are modified in particle pair loops
+    SPHParticlePairColorMask& usedcolors_i = usedparticlepaircolors_[type_i][particle_i];
+    SPHParticlePairColorMask* usedcolors_j = (status_j == PARTICLEENGINE::Owned)
+                                                 ? &usedparticlepaircolors_[type_j][particle_j]
+                                                 : nullptr;
+
+    // determine first color not used by particle i and j
+    int color = maxnumparticlepaircolors_;
+    for (int word = 0; word < static_cast<int>(usedcolors_i.size()); ++word)
+    {
+      const std::uint64_t usedcolors =
+          usedcolors_i[word] | ((usedcolors_j) ? (*usedcolors_j)[word] : 0);
+
+      if (usedcolors != ~std::uint64_t(0))
+      {
+        const int bit = std::countr_one(usedcolors);
+        color = 64 * word + bit;
+
+        // mark color as used by particle i and j
+        usedcolors_i[word] |= std::uint64_t(1) << bit;
+        if (usedcolors_j) (*usedcolors_j)[word] |= std::uint64_t(1) << bit;
+
+        break;
+      }
+    }
+
+    particlepaircolor_[particlepairindex] = color;
+  }
+
+  // number of particle types and status
+  const int numtypes = usedparticlepaircolors_.size();
+  constexpr int numstatus = 2;
+
+  // sort key of particle pair composed of color, particle types and status
+  auto key = [&](const int particlepairindex)
+  {
+    const SPHParticlePair& particlepair = particlepairdata_[particlepairindex];
+
+    const int type_i = std::get<0>(particlepair.tuple_i_);
+    const int type_j = std::get<0>(particlepair.tuple_j_);
+    const int status_j = std::get<1>(particlepair.tuple_j_);
+
+    return ((particlepaircolor_[particlepairindex] * numtypes + type_i) * numtypes + type_j) *
+               numstatus +
+           status_j;
+  };
+
+  // number of particle pairs of each key
+  const int numkeys = (maxnumparticlepaircolors_ + 1) * numtypes * numtypes * numstatus;
+  std::vector<int> keyoffsets(numkeys + 1, 0);
+  for (int particlepairindex = 0; particlepairindex < numparticlepairs; ++particlepairindex)
+    ++keyoffsets[key(particlepairindex) + 1];
+
+  // determine offsets of particle pairs of each key
+  for (int k = 0; k < numkeys; ++k) keyoffsets[k + 1] += keyoffsets[k];
+
+  // determine buckets of particle pairs and offsets of buckets of each color
+  particlepairbuckets_.clear();
+  particlepairbucketcoloroffsets_.assign(1, 0);
+  for (int color = 0; color <= maxnumparticlepaircolors_; ++color)
+  {
+    for (int type_i = 0; type_i < numtypes; ++type_i)
+      for (int type_j = 0; type_j < numtypes; ++type_j)
+        for (int status_j = 0; status_j < numstatus; ++status_j)
+        {
+          const int k = ((color * numtypes + type_i) * numtypes + type_j) * numstatus + status_j;
+
+          if (keyoffsets[k] == keyoffsets[k + 1]) continue;
+
+          particlepairbuckets_.push_back({static_cast<PARTICLEENGINE::TypeEnum>(type_i),
+              static_cast<PARTICLEENGINE::TypeEnum>(type_j),
+              static_cast<PARTICLEENGINE::StatusEnum>(status_j), keyoffsets[k],
+              keyoffsets[k + 1]});
+        }
+
+    particlepairbucketcoloroffsets_.push_back(particlepairbuckets_.size());
+  }
+
+  // sort particle pairs by key (stable to keep the order of evaluation within a bucket)
+  particlepairdatabuffer_.resize(numparticlepairs);
+  for (int particlepairindex = 0; particlepairindex < numparticlepairs; ++particlepairindex)
+    particlepairdatabuffer_[keyoffsets[key(particlepairindex)]++] =
+        particlepairdata_[particlepairindex];
+
+  particlepairdata_.swap(particlepairdatabuffer_);
+}
+
 void ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs");
@@ -458,4 +625,18 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs()
   }
 }
 
+ParticleInteraction::SPHParticleState<double> ParticleInteraction::get_particle_state(
+    PARTICLEENGINE::ParticleContainer& container, PARTICLEENGINE::StateEnum state)
+{
+  return {container.get_ptr_to_state(state, 0), container.get_state_dim(state)};
+}
+
+ParticleInteraction::SPHParticleState<double> ParticleInteraction::cond_get_particle_state(
+    PARTICLEENGINE::ParticleContainer& container, PARTICLEENGINE::StateEnum state)
+{
+  if (not container.have_stored_state(state)) return {};
+
+  return get_particle_state(container, state);
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -17,6 +17,11 @@
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_sph_neighbor_pair_struct.hpp"
 
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <cstdint>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -26,6 +31,7 @@ namespace PARTICLEENGINE
 {
   class ParticleEngineInterface;
   class ParticleContainerBundle;
+  class ParticleContainer;
 }  // namespace PARTICLEENGINE
 
 namespace PARTICLEWALL
@@ -47,6 +53,27 @@ namespace ParticleInteraction
   using SPHParticleWallPairData = std::vector<ParticleInteraction::SPHParticleWallPair>;
   using SPHIndexOfParticlePairs = std::vector<std::vector<std::vector<int>>>;
   using SPHIndexOfParticleWallPairs = std::vector<std::vector<int>>;
+  using SPHParticlePairColorMask = std::array<std::uint64_t, 4>;
+}  // namespace ParticleInteraction
+
+/*---------------------------------------------------------------------------*
+ | function declarations                                                     |
+ *---------------------------------------------------------------------------*/
+namespace ParticleInteraction
+{
+  //! get particle state of all particles in container
+  SPHParticleState<double> get_particle_state(
+      PARTICLEENGINE::ParticleContainer& container, PARTICLEENGINE::StateEnum state);
+
+  //! get particle state of all particles in container (unset if state is not stored)
+  SPHParticleState<double> cond_get_particle_state(
+      PARTICLEENGINE::ParticleContainer& container, PARTICLEENGINE::StateEnum state);
+
+  //! get value shared by all particles as particle state
+  inline SPHParticleState<const double> get_uniform_particle_state(const double& value)
+  {
+    return {&value, 0};
+  }
 }  // namespace ParticleInteraction
 
 /*---------------------------------------------------------------------------*
@@ -90,6 +117,78 @@ namespace ParticleInteraction
     void get_relevant_particle_pair_indices_for_equal_combination(
         const std::set<PARTICLEENGINE::TypeEnum>& types_a, std::vector<int>& relindices) const;
 
+    /*!
+     * \brief get relevant buckets of particle pairs for equal combination of particle types grouped
+     *        by color
+     *
+     * The buckets of all particle types are grouped by conflict-free colors and the offsets of each
+     * color are returned. Within one color no owned particle is part of more than one particle
+     * pair, except for the last color holding all particle pairs that could not be colored.
+     *
+     * \note The vectors are cleared but keep their capacity, thus they are meant to be reused as
+     *       buffers by the caller.
+     */
+    void get_relevant_particle_pair_buckets_for_equal_combination(
+        const std::set<PARTICLEENGINE::TypeEnum>& types_a,
+        std::vector<SPHParticlePairBucket>& relbuckets, std::vector<int>& relcoloroffsets) const;
+
+    /*!
+     * \brief evaluate function for particle pairs of buckets thread-parallel
+     *
+     * The bucket function is called once per bucket and returns the function evaluated for each
+     * particle pair of the bucket, such that quantities equal for all particle pairs of a bucket,
+     * e.g., particle containers and pointers to particle states, are resolved only once. All
+     * particle pairs of one color are evaluated concurrently, while the colors are processed one
+     * after another. The particle pairs of the last color are evaluated sequentially.
+     */
+    template <typename BucketFunction>
+    void evaluate_particle_pair_buckets_by_color(const std::vector<SPHParticlePairBucket>& buckets,
+        const std::vector<int>& coloroffsets, BucketFunction&& bucketfunction) const
+    {
+      const int numcolors = static_cast<int>(coloroffsets.size()) - 1;
+
+      // iterate over conflict-free colors
+      for (int color = 0; color < numcolors - 1; ++color)
+      {
+        if (coloroffsets[color] == coloroffsets[color + 1]) continue;
+
+        for (int bucketindex = coloroffsets[color]; bucketindex < coloroffsets[color + 1];
+            ++bucketindex)
+        {
+          const SPHParticlePairBucket& bucket = buckets[bucketindex];
+
+          Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+                                   bucket.begin_, bucket.end_),
+              [particlepairdata = particlepairdata_.data(), function = bucketfunction(bucket)](
+                  const int k) { function(particlepairdata[k]); });
+        }
+
+        // particle pairs of different buckets of one color are conflict-free as well
+        Kokkos::DefaultHostExecutionSpace().fence();
+      }
+
+      // sequentially evaluate particle pairs that could not be colored
+      if (numcolors > 0)
+      {
+        for (int bucketindex = coloroffsets[numcolors - 1];
+            bucketindex < coloroffsets[numcolors]; ++bucketindex)
+        {
+          const SPHParticlePairBucket& bucket = buckets[bucketindex];
+
+          const auto function = bucketfunction(bucket);
+          for (int k = bucket.begin_; k < bucket.end_; ++k) function(particlepairdata_[k]);
+        }
+      }
+    }
+
+    //! evaluate function for particle pairs of all buckets thread-parallel (see above)
+    template <typename BucketFunction>
+    void evaluate_particle_pair_buckets_by_color(BucketFunction&& bucketfunction) const
+    {
+      evaluate_particle_pair_buckets_by_color(particlepairbuckets_,
+          particlepairbucketcoloroffsets_, std::forward<BucketFunction>(bucketfunction));
+    }
+
     //! get relevant particle wall pair indices for specific particle types
     void get_relevant_particle_wall_pair_indices(
         const std::set<PARTICLEENGINE::TypeEnum>& types_a, std::vector<int>& relindices) const;
@@ -101,6 +200,13 @@ namespace ParticleInteraction
     //! evaluate particle pairs
     void evaluate_particle_pairs();
 
+    //! evaluate particle pairs with kernel handler of concrete type
+    template <typename Kernel>
+    void evaluate_particle_pairs(const Kernel& kernel);
+
+    //! sort particle pairs by conflict-free colors and buckets
+    void color_particle_pairs();
+
     //! evaluate particle-wall pairs
     void evaluate_particle_wall_pairs();
 
@@ -116,6 +222,25 @@ namespace ParticleInteraction
     //! index of particle-wall pairs for each type
     SPHIndexOfParticleWallPairs indexofparticlewallpairs_;
 
+    //! maximum number of conflict-free colors of particle pairs
+    static constexpr int maxnumparticlepaircolors_ =
+        64 * std::tuple_size_v<SPHParticlePairColorMask>;
+
+    //! color of each particle pair
+    std::vector<int> particlepaircolor_;
+
+    //! buckets of particle pairs sorted by color
+    std::vector<SPHParticlePairBucket> particlepairbuckets_;
+
+    //! offsets of buckets of each color (with last color holding uncolored particle pairs)
+    std::vector<int> particlepairbucketcoloroffsets_;
+
+    //! colors used by owned particles of each type
+    std::vector<std::vector<SPHParticlePairColorMask>> usedparticlepaircolors_;
+
+    //! buffer for particle pair data during sorting by color
+    SPHParticlePairData particlepairdatabuffer_;
+
     //! interface to particle engine
     std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
 
@@ -14,6 +14,7 @@
 #include "4C_particle_interaction_sph_equationofstate_bundle.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <Kokkos_Core.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
 FOUR_C_NAMESPACE_OPEN
@@ -92,9 +93,12 @@ void ParticleInteraction::SPHPressure::compute_pressure() const
     const ParticleInteraction::SPHEquationOfStateBase* equationofstate =
         equationofstatebundle_->get_ptr_to_specific_equation_of_state(type_i);
 
-    // iterate over owned particles of current type
-    for (int i = 0; i < particlestored; ++i)
-      press[i] = equationofstate->density_to_pressure(dens[i], material->initDensity_);
+    // iterate over owned particles of current type thread-parallel
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, particlestored),
+        [&](const int i)
+        { press[i] = equationofstate->density_to_pressure(dens[i], material->initDensity_); });
+    Kokkos::DefaultHostExecutionSpace().fence();
   }
 
   // refresh pressure of ghosted particles
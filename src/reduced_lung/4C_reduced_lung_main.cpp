@@ -18,6 +18,7 @@
 #include "4C_mat_maxwell_0d_acinus_NeoHookean.hpp"
 #include "4C_red_airways_elementbase.hpp"
 #include "4C_reduced_lung_helpers.hpp"
+#include "4C_reduced_lung_tree_solver.hpp"
 #include "4C_utils_function_of_time.hpp"
 
 #include <Teuchos_StandardParameterEntryValidators.hpp>
@@ -40,13 +41,19 @@ namespace ReducedLung
     }
     const Teuchos::ParameterList& rawdyn =
         Global::Problem::instance()->reduced_d_airway_dynamic_params();
-    const int linear_solver_number = rawdyn.get<int>("LINEAR_SOLVER");
-    std::unique_ptr<Core::LinAlg::Solver> solver = std::make_unique<Core::LinAlg::Solver>(
-        Global::Problem::instance()->solver_params(linear_solver_number), actdis->get_comm(),
-        Global::Problem::instance()->solver_params_callback(),
-        Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
-            Global::Problem::instance()->io_params(), "VERBOSITY"));
-    actdis->compute_null_space_if_necessary(solver->params());
+    // The tree solver replaces the generic linear solver, which is only set up if needed.
+    const bool use_tree_solver = rawdyn.get<bool>("TREE_SOLVER");
+    std::unique_ptr<Core::LinAlg::Solver> solver;
+    if (!use_tree_solver)
+    {
+      const int linear_solver_number = rawdyn.get<int>("LINEAR_SOLVER");
+      solver = std::make_unique<Core::LinAlg::Solver>(
+          Global::Problem::instance()->solver_params(linear_solver_number), actdis->get_comm(),
+          Global::Problem::instance()->solver_params_callback(),
+          Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
+              Global::Problem::instance()->io_params(), "VERBOSITY"));
+      actdis->compute_null_space_if_necessary(solver->params());
+    }
     // The existing mpi communicator is recycled for the new data layout.
     const auto& comm = actdis->get_comm();
 
@@ -466,6 +473,27 @@ namespace ReducedLung
       volume[terminal_unit_id] = volume_0[terminal_unit_id] = radius * radius * M_PI;
     }
 
+    // Time integration parameters.
+    const double dt = rawdyn.get<double>("TIMESTEP");
+    const int n_timesteps = rawdyn.get<int>("NUMSTEP");
+
+    // Resistance of the linearized terminal unit equations (E*dt + eta)/V0, constant in time.
+    std::vector<double> terminal_unit_resistance(n_terminal_units);
+    for (const TerminalUnit& terminal_unit : terminal_units)
+    {
+      const int terminal_unit_id = terminal_unit.local_terminal_unit_id;
+      terminal_unit_resistance[terminal_unit_id] =
+          (terminal_unit.E * dt + terminal_unit.eta) / volume_0[terminal_unit_id];
+    }
+
+    // Direct solver exploiting the tree topology of the network.
+    std::unique_ptr<TreeSolver> tree_solver;
+    if (use_tree_solver)
+    {
+      tree_solver = std::make_unique<TreeSolver>(airways, terminal_units, connections,
+          bifurcations, boundary_conditions, locally_owned_dof_map, comm);
+    }
+
     // Create system matrix and vectors:
     // Vector with all degrees of freedom (p1, p2, q, ...) associated to the elements.
     auto dofs = Core::LinAlg::Vector<double>(locally_owned_dof_map, true);
@@ -483,9 +511,6 @@ namespace ReducedLung
     // Jacobian of the system equations.
     auto sysmat = Epetra_CrsMatrix(Copy, row_map, locally_relevant_dof_map, 3);
 
-    // Time integration parameters.
-    const double dt = rawdyn.get<double>("TIMESTEP");
-    const int n_timesteps = rawdyn.get<int>("NUMSTEP");
     // Time loop
     if (Core::Communication::my_mpi_rank(comm) == 0)
     {
@@ -544,13 +569,12 @@ namespace ReducedLung
         const double& V_tu = volume[terminal_unit.local_terminal_unit_id];
         const double& V0_tu = volume_0[terminal_unit.local_terminal_unit_id];
         const double& E = terminal_unit.E;
-        const double& eta = terminal_unit.eta;
-        const std::array<double, 3> vals{1.0, -1.0, -(E * dt + eta) / V0_tu};
-        const double res =
-            -locally_relevant_dofs[terminal_unit.local_dof_ids[p_in]] +
-            locally_relevant_dofs[terminal_unit.local_dof_ids[p_out]] +
-            (E * dt + eta) / V0_tu * locally_relevant_dofs[terminal_unit.local_dof_ids[q_in]] +
-            E * (V_tu - V0_tu) / V0_tu;
+        const double& R_tu = terminal_unit_resistance[terminal_unit.local_terminal_unit_id];
+        const std::array<double, 3> vals{1.0, -1.0, -R_tu};
+        const double res = -locally_relevant_dofs[terminal_unit.local_dof_ids[p_in]] +
+                           locally_relevant_dofs[terminal_unit.local_dof_ids[p_out]] +
+                           R_tu * locally_relevant_dofs[terminal_unit.local_dof_ids[q_in]] +
+                           E * (V_tu - V0_tu) / V0_tu;
         if (!sysmat.Filled())
         {
           err = sysmat.InsertMyValues(terminal_unit.local_equation_id, vals.size(), vals.data(),
@@ -718,11 +742,19 @@ namespace ReducedLung
       }
 
       // Solve.
-      solver->solve(Core::Utils::shared_ptr_from_ref(sysmat), Core::Utils::shared_ptr_from_ref(x),
-          Core::Utils::shared_ptr_from_ref(rhs), {});
+      if (use_tree_solver)
+      {
+        tree_solver->solve(
+            poiseuille_resistance, terminal_unit_resistance, rhs, x_mapped_to_dofs);
+      }
+      else
+      {
+        solver->solve(Core::Utils::shared_ptr_from_ref(sysmat),
+            Core::Utils::shared_ptr_from_ref(x), Core::Utils::shared_ptr_from_ref(rhs), {});
+        export_to(x, x_mapped_to_dofs);
+      }
 
       // Update dofs with solution vector.
-      export_to(x, x_mapped_to_dofs);
       dofs.Update(1.0, x_mapped_to_dofs, 1.0);
       export_to(dofs, locally_relevant_dofs);
 
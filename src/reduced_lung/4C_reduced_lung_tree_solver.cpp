@@ -0,0 +1,540 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_reduced_lung_tree_solver.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace ReducedLung
+{
+  namespace
+  {
+    /*!
+     * @brief Order the nodes of a forest such that children come before their parents.
+     *
+     * @param roots Indices of the root nodes.
+     * @param children Function returning the child indices of a node (-1 for no child).
+     */
+    template <typename ChildrenFunction>
+    std::vector<int> children_before_parents(
+        const std::vector<int>& roots, const ChildrenFunction& children, const int n_nodes)
+    {
+      std::vector<int> order;
+      order.reserve(n_nodes);
+      std::vector<int> stack(roots.rbegin(), roots.rend());
+      while (!stack.empty())
+      {
+        const int node = stack.back();
+        stack.pop_back();
+        order.push_back(node);
+        for (const int child : children(node))
+        {
+          if (child >= 0) stack.push_back(child);
+        }
+      }
+      FOUR_C_ASSERT_ALWAYS(static_cast<int>(order.size()) == n_nodes,
+          "The reduced lung network is not a tree. Check the node ordering in the input file.");
+      std::reverse(order.begin(), order.end());
+      return order;
+    }
+  }  // namespace
+
+  TreeSolver::TreeSolver(const std::vector<Airway>& airways,
+      const std::vector<TerminalUnit>& terminal_units, const std::vector<Connection>& connections,
+      const std::vector<Bifurcation>& bifurcations,
+      const std::vector<BoundaryCondition>& boundary_conditions, const Epetra_Map& dof_map,
+      MPI_Comm comm)
+      : comm_(comm)
+  {
+    // Create the local nodes from airways and terminal units.
+    std::unordered_map<int, int> node_of_element;
+    const auto add_node = [&](const int global_element_id, const bool is_airway,
+                              const int local_id, const int equation_id,
+                              const std::vector<int>& global_dof_ids)
+    {
+      Node node{global_element_id, is_airway, local_id, equation_id,
+          {dof_map.LID(global_dof_ids[p_in]), dof_map.LID(global_dof_ids[p_out]),
+              dof_map.LID(global_dof_ids[q_in])}};
+      FOUR_C_ASSERT(std::ranges::all_of(node.dof_ids, [](int lid) { return lid >= 0; }),
+          "Internal error: Dof of element %d is not locally owned.", global_element_id);
+      node_of_element[global_element_id] = nodes_.size();
+      nodes_.push_back(node);
+    };
+    for (const Airway& airway : airways)
+    {
+      FOUR_C_ASSERT_ALWAYS(airway.airway_type == AirwayType::resistive,
+          "The tree solver only supports resistive airways.");
+      add_node(airway.global_equation_id, true, airway.local_airway_id, airway.local_equation_id,
+          airway.global_dof_ids);
+    }
+    for (const TerminalUnit& terminal_unit : terminal_units)
+    {
+      add_node(terminal_unit.global_equation_id, false, terminal_unit.local_terminal_unit_id,
+          terminal_unit.local_equation_id, terminal_unit.global_dof_ids);
+    }
+
+    // Add the outlet couplings. They are always owned by the rank owning the parent element.
+    const auto local_node = [&](const int global_element_id)
+    {
+      const auto it = node_of_element.find(global_element_id);
+      return it == node_of_element.end() ? -1 : it->second;
+    };
+    const auto set_outlet = [&](const int global_parent_element_id, const Outlet outlet,
+                                const int first_equation_id,
+                                const std::array<int, 2>& child_global_ids)
+    {
+      const int parent = local_node(global_parent_element_id);
+      FOUR_C_ASSERT_ALWAYS(parent >= 0,
+          "Internal error: Coupling at the outlet of element %d is not owned by its rank.",
+          global_parent_element_id);
+      FOUR_C_ASSERT_ALWAYS(nodes_[parent].outlet_equation_id < 0,
+          "Element %d has more than one coupling at its outlet.", global_parent_element_id);
+      nodes_[parent].outlet = outlet;
+      nodes_[parent].outlet_equation_id = first_equation_id;
+      nodes_[parent].child_global_ids = child_global_ids;
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        if (child_global_ids[i] < 0) continue;
+        const int child = local_node(child_global_ids[i]);
+        nodes_[parent].child_nodes[i] = child;
+        if (child >= 0) nodes_[child].parent_node = parent;
+      }
+    };
+    for (const Connection& conn : connections)
+    {
+      set_outlet(conn.global_parent_element_id, Outlet::connection, conn.first_local_equation_id,
+          {conn.global_child_element_id, -1});
+    }
+    for (const Bifurcation& bif : bifurcations)
+    {
+      set_outlet(bif.global_parent_element_id, Outlet::bifurcation, bif.first_local_equation_id,
+          {bif.global_child_1_element_id, bif.global_child_2_element_id});
+    }
+    for (const BoundaryCondition& bc : boundary_conditions)
+    {
+      switch (bc.bc_type)
+      {
+        case BoundaryConditionType::pressure_in:
+          nodes_[local_node(bc.global_element_id)].inlet_equation_id = bc.local_equation_id;
+          break;
+        case BoundaryConditionType::pressure_out:
+          set_outlet(bc.global_element_id, Outlet::pressure_bc, bc.local_equation_id, {-1, -1});
+          break;
+        default:
+          FOUR_C_THROW("The tree solver only supports pressure boundary conditions.");
+      }
+    }
+    for (const Node& node : nodes_)
+    {
+      FOUR_C_ASSERT_ALWAYS(node.outlet_equation_id >= 0,
+          "Element %d has neither a coupling nor a pressure boundary condition at its outlet, "
+          "which is required by the tree solver.",
+          node.global_element_id);
+    }
+
+    // Order the local subtrees and find the ones that are completely owned by this rank.
+    std::vector<int> local_roots;
+    for (unsigned i = 0; i < nodes_.size(); ++i)
+    {
+      if (nodes_[i].parent_node < 0) local_roots.push_back(i);
+    }
+    elimination_order_ = children_before_parents(
+        local_roots, [&](const int node) { return nodes_[node].child_nodes; }, nodes_.size());
+    for (const int i : elimination_order_)
+    {
+      Node& node = nodes_[i];
+      node.resolved = true;
+      for (unsigned c = 0; c < 2; ++c)
+      {
+        if (node.child_global_ids[c] >= 0 &&
+            (node.child_nodes[c] < 0 || !nodes_[node.child_nodes[c]].resolved))
+          node.resolved = false;
+      }
+    }
+
+    // Nodes contributing to the interface problem: unresolved nodes and resolved subtrees whose
+    // parent is not resolved on this rank. Subtrees with their root on this rank are only
+    // contributing if they are not resolved.
+    std::vector<int> interface_topology;
+    for (const int i : elimination_order_)
+    {
+      Node& node = nodes_[i];
+      if (node.resolved)
+      {
+        const bool local_root = node.parent_node < 0 && node.inlet_equation_id >= 0;
+        node.interface =
+            !local_root && (node.parent_node < 0 || !nodes_[node.parent_node].resolved);
+      }
+      else
+      {
+        node.interface = true;
+      }
+      if (!node.interface) continue;
+
+      interface_contributions_.push_back(i);
+      interface_topology.insert(interface_topology.end(),
+          {node.global_element_id, node.resolved, node.inlet_equation_id >= 0,
+              static_cast<int>(node.outlet), node.child_global_ids[0], node.child_global_ids[1]});
+    }
+
+    // The topology of the interface problem is gathered once on all ranks. The interface nodes
+    // are sorted by their global element id, hence their numbering does not depend on the order of
+    // the gathered contributions.
+    const std::vector<std::vector<int>> interface_topology_of_rank =
+        Core::Communication::all_gather(interface_topology, comm_);
+    for (const std::vector<int>& rank_topology : interface_topology_of_rank)
+    {
+      for (unsigned i = 0; i < rank_topology.size(); i += topology_stride)
+      {
+        interface_nodes_.push_back(InterfaceNode{rank_topology[i],
+            static_cast<bool>(rank_topology[i + 1]), static_cast<bool>(rank_topology[i + 2]),
+            static_cast<Outlet>(rank_topology[i + 3]),
+            {rank_topology[i + 4], rank_topology[i + 5]}});
+      }
+    }
+    std::ranges::sort(interface_nodes_, {}, &InterfaceNode::global_element_id);
+    std::unordered_map<int, int> interface_node_of_element;
+    for (unsigned i = 0; i < interface_nodes_.size(); ++i)
+    {
+      const bool inserted =
+          interface_node_of_element.emplace(interface_nodes_[i].global_element_id, i).second;
+      FOUR_C_ASSERT_ALWAYS(inserted,
+          "Internal error: Element %d contributes more than once to the interface problem.",
+          interface_nodes_[i].global_element_id);
+    }
+
+    // The values of the interface problem are gathered in the same order as the topology, i.e.,
+    // the k-th contribution of a rank belongs to the k-th topology entry of this rank.
+    interface_nodes_of_rank_.resize(interface_topology_of_rank.size());
+    for (unsigned rank = 0; rank < interface_topology_of_rank.size(); ++rank)
+    {
+      const std::vector<int>& rank_topology = interface_topology_of_rank[rank];
+      for (unsigned i = 0; i < rank_topology.size(); i += topology_stride)
+        interface_nodes_of_rank_[rank].push_back(interface_node_of_element.at(rank_topology[i]));
+    }
+    std::vector<bool> has_interface_parent(interface_nodes_.size(), false);
+    for (InterfaceNode& interface_node : interface_nodes_)
+    {
+      if (interface_node.resolved) continue;
+      for (unsigned c = 0; c < 2; ++c)
+      {
+        if (interface_node.child_global_ids[c] < 0) continue;
+        const auto it = interface_node_of_element.find(interface_node.child_global_ids[c]);
+        FOUR_C_ASSERT_ALWAYS(it != interface_node_of_element.end(),
+            "Internal error: Child %d of element %d is missing in the interface problem.",
+            interface_node.child_global_ids[c], interface_node.global_element_id);
+        interface_node.child_nodes[c] = it->second;
+        has_interface_parent[it->second] = true;
+      }
+    }
+    std::vector<int> interface_roots;
+    for (unsigned i = 0; i < interface_nodes_.size(); ++i)
+    {
+      if (has_interface_parent[i]) continue;
+      FOUR_C_ASSERT_ALWAYS(!interface_nodes_[i].resolved && interface_nodes_[i].has_inlet_bc,
+          "Root element %d has no pressure boundary condition at its inlet, which is required by "
+          "the tree solver.",
+          interface_nodes_[i].global_element_id);
+      interface_roots.push_back(i);
+    }
+    interface_elimination_order_ = children_before_parents(
+        interface_roots,
+        [&](const int node) {
+          return interface_nodes_[node].resolved ? std::array<int, 2>{-1, -1}
+                                                 : interface_nodes_[node].child_nodes;
+        },
+        interface_nodes_.size());
+    for (const int i : interface_contributions_)
+    {
+      interface_index_of_node_[i] = interface_node_of_element.at(nodes_[i].global_element_id);
+    }
+
+    a_.resize(nodes_.size());
+    z_.resize(nodes_.size());
+    inlet_increments_.resize(nodes_.size());
+  }
+
+  void TreeSolver::solve(const std::vector<double>& airway_resistances,
+      const std::vector<double>& terminal_unit_resistances,
+      const Core::LinAlg::Vector<double>& rhs,
+      Core::LinAlg::Vector<double>& x)
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("ReducedLung::TreeSolver::solve");
+
+    // Eliminate the subtrees owned by this rank from the leaves to the roots.
+    for (const int i : elimination_order_)
+    {
+      if (nodes_[i].resolved) eliminate(i, airway_resistances, terminal_unit_resistances, rhs);
+    }
+
+    // Collect the contributions to the interface problem. Resolved subtrees are represented by
+    // their inlet relation, unresolved elements by the residuals of their equations.
+    std::vector<double> interface_values;
+    interface_values.reserve(interface_contributions_.size() * interface_stride);
+    for (const int i : interface_contributions_)
+    {
+      const Node& node = nodes_[i];
+      if (node.resolved)
+      {
+        interface_values.insert(interface_values.end(), {a_[i], z_[i], 0.0, 0.0, 0.0, 0.0});
+      }
+      else
+      {
+        const std::array<double, 3> residuals = outlet_residuals(node, rhs);
+        interface_values.insert(interface_values.end(),
+            {resistance(node, airway_resistances, terminal_unit_resistances),
+                rhs[node.equation_id], residuals[0], residuals[1], residuals[2],
+                node.inlet_equation_id >= 0 ? rhs[node.inlet_equation_id] : 0.0});
+      }
+    }
+    const std::vector<std::array<double, 2>> interface_increments =
+        solve_interface_problem(gather_interface_values(interface_values));
+
+    // Back substitution from the roots to the leaves.
+    for (auto it = elimination_order_.rbegin(); it != elimination_order_.rend(); ++it)
+    {
+      const int i = *it;
+      const Node& node = nodes_[i];
+      if (node.interface)
+      {
+        inlet_increments_[i] = interface_increments[interface_index_of_node_.at(i)];
+      }
+      else if (node.parent_node < 0)
+      {
+        // root of a tree owned by this rank
+        const double dp_in = rhs[node.inlet_equation_id];
+        inlet_increments_[i] = {dp_in, (dp_in - a_[i]) / z_[i]};
+      }
+      back_substitute(i, inlet_increments_[i][0], inlet_increments_[i][1], airway_resistances,
+          terminal_unit_resistances, rhs, x);
+    }
+  }
+
+  void TreeSolver::eliminate(const int node_id, const std::vector<double>& airway_resistances,
+      const std::vector<double>& terminal_unit_resistances, const Core::LinAlg::Vector<double>& rhs)
+  {
+    const Node& node = nodes_[node_id];
+    std::array<double, 2> a_children{};
+    std::array<double, 2> z_children{};
+    for (unsigned c = 0; c < 2; ++c)
+    {
+      if (node.child_nodes[c] < 0) continue;
+      a_children[c] = a_[node.child_nodes[c]];
+      z_children[c] = z_[node.child_nodes[c]];
+    }
+    const std::array<double, 2> outlet =
+        outlet_relation(node.outlet, outlet_residuals(node, rhs), a_children, z_children);
+
+    // dp_in = r + dp_out + R*dq
+    a_[node_id] = rhs[node.equation_id] + outlet[0];
+    z_[node_id] = resistance(node, airway_resistances, terminal_unit_resistances) + outlet[1];
+    FOUR_C_ASSERT_ALWAYS(z_[node_id] > 0.0,
+        "The tree solver requires positive resistances. Found %f at element %d.", z_[node_id],
+        node.global_element_id);
+  }
+
+  std::vector<double> TreeSolver::gather_interface_values(
+      const std::vector<double>& interface_values) const
+  {
+    const std::vector<std::vector<double>> interface_values_of_rank =
+        Core::Communication::all_gather(interface_values, comm_);
+
+    // sort the contributions of all ranks by their interface node
+    std::vector<double> all_interface_values(interface_nodes_.size() * interface_stride);
+    for (unsigned rank = 0; rank < interface_values_of_rank.size(); ++rank)
+    {
+      const std::vector<double>& rank_values = interface_values_of_rank[rank];
+      const std::vector<int>& rank_nodes = interface_nodes_of_rank_[rank];
+      FOUR_C_ASSERT(rank_values.size() == rank_nodes.size() * interface_stride,
+          "Internal error: Rank %d contributes %d values to the interface problem, expected %d.",
+          rank, rank_values.size(), rank_nodes.size() * interface_stride);
+      for (unsigned k = 0; k < rank_nodes.size(); ++k)
+      {
+        std::copy_n(rank_values.begin() + k * interface_stride, interface_stride,
+            all_interface_values.begin() + rank_nodes[k] * interface_stride);
+      }
+    }
+    return all_interface_values;
+  }
+
+  std::vector<std::array<double, 2>> TreeSolver::solve_interface_problem(
+      const std::vector<double>& interface_values) const
+  {
+    const auto values = [&](const int i) { return &interface_values[i * interface_stride]; };
+
+    std::vector<double> a(interface_nodes_.size());
+    std::vector<double> z(interface_nodes_.size());
+    for (const int i : interface_elimination_order_)
+    {
+      const InterfaceNode& node = interface_nodes_[i];
+      const double* v = values(i);
+      if (node.resolved)
+      {
+        a[i] = v[0];
+        z[i] = v[1];
+        continue;
+      }
+      std::array<double, 2> a_children{};
+      std::array<double, 2> z_children{};
+      for (unsigned c = 0; c < 2; ++c)
+      {
+        if (node.child_nodes[c] < 0) continue;
+        a_children[c] = a[node.child_nodes[c]];
+        z_children[c] = z[node.child_nodes[c]];
+      }
+      const std::array<double, 2> outlet =
+          outlet_relation(node.outlet, {v[2], v[3], v[4]}, a_children, z_children);
+      a[i] = v[1] + outlet[0];
+      z[i] = v[0] + outlet[1];
+      FOUR_C_ASSERT_ALWAYS(z[i] > 0.0,
+          "The tree solver requires positive resistances. Found %f at element %d.", z[i],
+          node.global_element_id);
+    }
+
+    std::vector<std::array<double, 2>> increments(interface_nodes_.size());
+    std::vector<bool> is_set(interface_nodes_.size(), false);
+    for (auto it = interface_elimination_order_.rbegin(); it != interface_elimination_order_.rend();
+        ++it)
+    {
+      const int i = *it;
+      const InterfaceNode& node = interface_nodes_[i];
+      const double* v = values(i);
+      if (!is_set[i])
+      {
+        // root with prescribed inlet pressure
+        increments[i] = {v[5], (v[5] - a[i]) / z[i]};
+        is_set[i] = true;
+      }
+      if (node.resolved) continue;
+
+      const auto [dp_in, dq] = increments[i];
+      const double dp_out = dp_in - v[1] - v[0] * dq;
+      std::array<double, 2> a_children{};
+      std::array<double, 2> z_children{};
+      for (unsigned c = 0; c < 2; ++c)
+      {
+        if (node.child_nodes[c] < 0) continue;
+        a_children[c] = a[node.child_nodes[c]];
+        z_children[c] = z[node.child_nodes[c]];
+      }
+      const auto children = child_inlet_increments(
+          node.outlet, dp_out, dq, {v[2], v[3], v[4]}, a_children, z_children);
+      for (unsigned c = 0; c < 2; ++c)
+      {
+        if (node.child_nodes[c] < 0) continue;
+        increments[node.child_nodes[c]] = children[c];
+        is_set[node.child_nodes[c]] = true;
+      }
+    }
+    return increments;
+  }
+
+  void TreeSolver::back_substitute(const int node_id, const double dp_in, const double dq,
+      const std::vector<double>& airway_resistances,
+      const std::vector<double>& terminal_unit_resistances,
+      const Core::LinAlg::Vector<double>& rhs,
+      Core::LinAlg::Vector<double>& x)
+  {
+    const Node& node = nodes_[node_id];
+    const double dp_out =
+        dp_in - rhs[node.equation_id] -
+        resistance(node, airway_resistances, terminal_unit_resistances) * dq;
+    x[node.dof_ids[p_in]] = dp_in;
+    x[node.dof_ids[p_out]] = dp_out;
+    x[node.dof_ids[q_in]] = dq;
+
+    // The children of unresolved nodes are part of the interface problem.
+    if (!node.resolved || node.outlet == Outlet::pressure_bc) return;
+
+    std::array<double, 2> a_children{};
+    std::array<double, 2> z_children{};
+    for (unsigned c = 0; c < 2; ++c)
+    {
+      if (node.child_nodes[c] < 0) continue;
+      a_children[c] = a_[node.child_nodes[c]];
+      z_children[c] = z_[node.child_nodes[c]];
+    }
+    const auto children = child_inlet_increments(
+        node.outlet, dp_out, dq, outlet_residuals(node, rhs), a_children, z_children);
+    for (unsigned c = 0; c < 2; ++c)
+    {
+      if (node.child_nodes[c] >= 0) inlet_increments_[node.child_nodes[c]] = children[c];
+    }
+  }
+
+  std::array<double, 2> TreeSolver::outlet_relation(const Outlet outlet,
+      const std::array<double, 3>& residuals, const std::array<double, 2>& a_children,
+      const std::array<double, 2>& z_children)
+  {
+    switch (outlet)
+    {
+      case Outlet::pressure_bc:
+        // dp_out = r_bc
+        return {residuals[0], 0.0};
+      case Outlet::connection:
+        // dp_out = r_1 + dp_in_child, dq_child = dq - r_2
+        return {residuals[0] + a_children[0] - z_children[0] * residuals[1], z_children[0]};
+      case Outlet::bifurcation:
+      {
+        // dp_out = r_i + dp_in_child_i, dq = dq_child_1 + dq_child_2 + r_3, i.e. the children
+        // act as parallel resistances
+        const double z_parallel = 1.0 / (1.0 / z_children[0] + 1.0 / z_children[1]);
+        return {z_parallel * ((residuals[0] + a_children[0]) / z_children[0] +
+                                 (residuals[1] + a_children[1]) / z_children[1] - residuals[2]),
+            z_parallel};
+      }
+    }
+    FOUR_C_THROW("Unknown outlet type.");
+  }
+
+  std::array<std::array<double, 2>, 2> TreeSolver::child_inlet_increments(const Outlet outlet,
+      const double dp_out, const double dq, const std::array<double, 3>& residuals,
+      const std::array<double, 2>& a_children, const std::array<double, 2>& z_children)
+  {
+    std::array<std::array<double, 2>, 2> children{};
+    switch (outlet)
+    {
+      case Outlet::pressure_bc:
+        break;
+      case Outlet::connection:
+        children[0] = {dp_out - residuals[0], dq - residuals[1]};
+        break;
+      case Outlet::bifurcation:
+        for (unsigned c = 0; c < 2; ++c)
+        {
+          const double dp_in_child = dp_out - residuals[c];
+          children[c] = {dp_in_child, (dp_in_child - a_children[c]) / z_children[c]};
+        }
+        break;
+    }
+    return children;
+  }
+
+  std::array<double, 3> TreeSolver::outlet_residuals(
+      const Node& node, const Core::LinAlg::Vector<double>& rhs) const
+  {
+    const int eq = node.outlet_equation_id;
+    switch (node.outlet)
+    {
+      case Outlet::pressure_bc:
+        return {rhs[eq], 0.0, 0.0};
+      case Outlet::connection:
+        return {rhs[eq], rhs[eq + 1], 0.0};
+      case Outlet::bifurcation:
+        return {rhs[eq], rhs[eq + 1], rhs[eq + 2]};
+    }
+    FOUR_C_THROW("Unknown outlet type.");
+  }
+}  // namespace ReducedLung
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,206 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_REDUCED_LUNG_TREE_SOLVER_HPP
+#define FOUR_C_REDUCED_LUNG_TREE_SOLVER_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_vector.hpp"
+#include "4C_reduced_lung_helpers.hpp"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace ReducedLung
+{
+  /*!
+   * @brief Direct solver for the linearized reduced lung equations exploiting the tree topology
+   * of the airway network.
+   *
+   * Every element (airway or terminal unit) contributes the equation dp_in - dp_out - R*dq = r,
+   * the elements are coupled at their outlets by connections, bifurcations, or pressure boundary
+   * conditions. Hence, the inlet of every subtree obeys the affine relation dp_in = a + Z*dq,
+   * which is computed by eliminating the equations from the leaves to the root. After the
+   * pressure at the root inlet is known, the increments are recovered by back substitution from
+   * the root to the leaves. Both sweeps are linear in the number of elements.
+   *
+   * Subtrees that are completely owned by one rank are eliminated without communication. Only the
+   * elements whose subtree spans several ranks (usually few elements close to the trachea) are
+   * gathered on all ranks and solved redundantly before the local back substitution.
+   *
+   * Requirements: every root element has a pressure boundary condition at its inlet, every leaf
+   * element has a pressure boundary condition at its outlet, and all resistances are positive.
+   */
+  class TreeSolver
+  {
+   public:
+    /*!
+     * @brief Set up the (distributed) tree topology from the entities of the reduced lung model.
+     *
+     * @param airways Vector of locally owned airways.
+     * @param terminal_units Vector of locally owned terminal units.
+     * @param connections Vector of locally owned connections.
+     * @param bifurcations Vector of locally owned bifurcations.
+     * @param boundary_conditions Vector of locally owned boundary conditions.
+     * @param dof_map Map with the locally owned dofs (domain map of the system).
+     * @param comm Communicator of the reduced lung model.
+     */
+    TreeSolver(const std::vector<Airway>& airways, const std::vector<TerminalUnit>& terminal_units,
+        const std::vector<Connection>& connections, const std::vector<Bifurcation>& bifurcations,
+        const std::vector<BoundaryCondition>& boundary_conditions, const Epetra_Map& dof_map,
+        MPI_Comm comm);
+
+    /*!
+     * @brief Solve the linearized system for the increments of all dofs.
+     *
+     * @param airway_resistances Resistance R of every local airway (by local airway id).
+     * @param terminal_unit_resistances Resistance R of every local terminal unit (by local
+     * terminal unit id).
+     * @param rhs Residuals of the system equations (distributed as the rows of the system).
+     * @param x Increments of the locally owned dofs.
+     */
+    void solve(const std::vector<double>& airway_resistances,
+        const std::vector<double>& terminal_unit_resistances,
+        const Core::LinAlg::Vector<double>& rhs,
+        Core::LinAlg::Vector<double>& x);
+
+   private:
+    //! Coupling of an element at its outlet.
+    enum class Outlet
+    {
+      pressure_bc,
+      connection,
+      bifurcation
+    };
+
+    //! Local element with its outlet coupling.
+    struct Node
+    {
+      int global_element_id;
+      bool is_airway;
+      //! local airway id or local terminal unit id
+      int local_id;
+      //! row of the element equation
+      int equation_id;
+      //! locally owned dof ids of {p_in, p_out, q}
+      std::array<int, 3> dof_ids;
+      Outlet outlet = Outlet::pressure_bc;
+      //! first row of the outlet coupling equations (-1 if not given)
+      int outlet_equation_id = -1;
+      //! row of the pressure boundary condition at the inlet (-1 if not given)
+      int inlet_equation_id = -1;
+      //! global ids of the children (-1 if not present)
+      std::array<int, 2> child_global_ids{-1, -1};
+      //! local node indices of the children (-1 if not present or owned by another rank)
+      std::array<int, 2> child_nodes{-1, -1};
+      //! local node index of the parent (-1 if root or owned by another rank)
+      int parent_node = -1;
+      //! whether the whole subtree is owned by this rank
+      bool resolved = false;
+      //! whether the node takes part in the redundant solution of the interface problem
+      bool interface = false;
+    };
+
+    //! Element of the interface problem, which is solved redundantly on all ranks.
+    struct InterfaceNode
+    {
+      int global_element_id;
+      //! whether the subtree is eliminated already (then only a and Z are given)
+      bool resolved;
+      bool has_inlet_bc;
+      Outlet outlet;
+      std::array<int, 2> child_global_ids;
+      std::array<int, 2> child_nodes{-1, -1};
+    };
+
+    //! number of doubles describing a node of the interface problem
+    static constexpr int interface_stride = 6;
+
+    //! number of ints describing the topology of a node of the interface problem
+    static constexpr int topology_stride = 6;
+
+    //! Relation {b, Y} of the outlet dp_out = b + Y*dq given the residuals of the outlet
+    //! equations and the inlet relations of the children.
+    static std::array<double, 2> outlet_relation(Outlet outlet,
+        const std::array<double, 3>& residuals, const std::array<double, 2>& a_children,
+        const std::array<double, 2>& z_children);
+
+    //! Inlet increments {dp_in, dq} of the children given the outlet increments of the parent.
+    static std::array<std::array<double, 2>, 2> child_inlet_increments(Outlet outlet,
+        double dp_out, double dq, const std::array<double, 3>& residuals,
+        const std::array<double, 2>& a_children, const std::array<double, 2>& z_children);
+
+    //! residuals of the outlet coupling equations of a local node
+    [[nodiscard]] std::array<double, 3> outlet_residuals(
+        const Node& node, const Core::LinAlg::Vector<double>& rhs) const;
+
+    //! Eliminate the subtree of a node with eliminated children (leaves to root).
+    void eliminate(int node, const std::vector<double>& airway_resistances,
+        const std::vector<double>& terminal_unit_resistances,
+        const Core::LinAlg::Vector<double>& rhs);
+
+    //! Gather the contributions of all ranks to the interface problem ordered by interface node.
+    [[nodiscard]] std::vector<double> gather_interface_values(
+        const std::vector<double>& interface_values) const;
+
+    //! Solve the interface problem and return the inlet increments {dp_in, dq} of its nodes.
+    std::vector<std::array<double, 2>> solve_interface_problem(
+        const std::vector<double>& interface_values) const;
+
+    //! Recover the increments of a node and the inlets of its local children (root to leaves).
+    void back_substitute(int node, double dp_in, double dq,
+        const std::vector<double>& airway_resistances,
+        const std::vector<double>& terminal_unit_resistances,
+        const Core::LinAlg::Vector<double>& rhs, Core::LinAlg::Vector<double>& x);
+
+    //! resistance of the element of a local node
+    [[nodiscard]] double resistance(const Node& node, const std::vector<double>& airway_resistances,
+        const std::vector<double>& terminal_unit_resistances) const
+    {
+      return node.is_airway ? airway_resistances[node.local_id]
+                            : terminal_unit_resistances[node.local_id];
+    }
+
+    //! local elements of the tree
+    std::vector<Node> nodes_;
+
+    //! local node indices with children before their parents
+    std::vector<int> elimination_order_;
+
+    //! local node indices of the nodes contributing to the interface problem
+    std::vector<int> interface_contributions_;
+
+    //! nodes of the interface problem sorted by global element id (identical on all ranks)
+    std::vector<InterfaceNode> interface_nodes_;
+
+    //! interface node indices of the contributions of every rank (in the order of contribution)
+    std::vector<std::vector<int>> interface_nodes_of_rank_;
+
+    //! interface node indices with children before their parents
+    std::vector<int> interface_elimination_order_;
+
+    //! position of the local nodes in the interface problem
+    std::unordered_map<int, int> interface_index_of_node_;
+
+    //! inlet relation dp_in = a + Z*dq of the subtree of every local node
+    std::vector<double> a_;
+    std::vector<double> z_;
+
+    //! inlet increments {dp_in, dq} of the local nodes, set during back substitution
+    std::vector<std::array<double, 2>> inlet_increments_;
+
+    MPI_Comm comm_;
+  };
+}  // namespace ReducedLung
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -121,7 +121,31 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::mat_my
   // clear
   advreamanager->clear(my::numscal_);
 
-  if (my::scatrapara_->semi_implicit())
+  if (matgpevaluation_ == MatGPEvaluation::gather)
+  {
+    // only store the potential, the ionic model is evaluated for all gauss points at once
+    myocardmat_[k] = actmat;
+    phingp_[k][iquad] = my::scatravarmanager_->phin(k);
+    phinpgp_[k][iquad] = my::scatravarmanager_->phinp(k);
+  }
+  else if (matgpevaluation_ == MatGPEvaluation::batched)
+  {
+    // reaction coefficients were evaluated for all gauss points at once
+    if (my::scatrapara_->semi_implicit())
+    {
+      double react = -reacoeffngp_[k][iquad];
+      if (my::scatraparatimint_->is_gen_alpha())
+        react *= my::scatraparatimint_->dt() / my::scatraparatimint_->time_fac();
+      advreamanager->add_to_rea_body_force(react, k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(0.0, k, k);
+    }
+    else
+    {
+      advreamanager->add_to_rea_body_force(-reacoeffnpgp_[k][iquad], k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(-reacoeffnpderivgp_[k][iquad], k, k);
+    }
+  }
+  else if (my::scatrapara_->semi_implicit())
   {
     // get membrane potential at n at integration point
     const double phin = my::scatravarmanager_->phin(k);
@@ -189,6 +213,10 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
     const Core::FE::IntPointsAndWeights<nsd_ele_> intpoints(
         ScaTra::DisTypeToMatGaussRule<distype>::get_gauss_rule(deg));
 
+    // evaluate the ionic model at all integration points at once
+    evaluate_mat_myocard_all_gp(ele, intpoints, densn, densnp, densam, visc);
+    matgpevaluation_ = MatGPEvaluation::batched;
+
     // loop over integration points
     for (int iquad = 0; iquad < intpoints.ip().nquad; ++iquad)
     {
@@ -219,6 +247,8 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
         advreac::calc_mat_react(emat, k, timefacfac, 0., 0., densnp[k], dummy, dummy);
       }
     }
+
+    matgpevaluation_ = MatGPEvaluation::pointwise;
   }
 
   //----------------------------------------------------------------------
@@ -302,6 +332,63 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
 }
 
 
+/*----------------------------------------------------------------------*
+ |  evaluate reaction coefficients at all material gauss points         |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, int probdim>
+void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype,
+    probdim>::evaluate_mat_myocard_all_gp(Core::Elements::Element* ele,
+    const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints, std::vector<double>& densn,
+    std::vector<double>& densnp, std::vector<double>& densam, double& visc)
+{
+  const int nquad = intpoints.ip().nquad;
+
+  myocardmat_.assign(my::numscal_, nullptr);
+  phingp_.resize(my::numscal_);
+  phinpgp_.resize(my::numscal_);
+  reacoeffngp_.resize(my::numscal_);
+  reacoeffnpgp_.resize(my::numscal_);
+  reacoeffnpderivgp_.resize(my::numscal_);
+  for (int k = 0; k < my::numscal_; ++k)
+  {
+    phingp_[k].assign(nquad, 0.0);
+    phinpgp_[k].assign(nquad, 0.0);
+    reacoeffngp_[k].assign(nquad, 0.0);
+    reacoeffnpgp_[k].assign(nquad, 0.0);
+    reacoeffnpderivgp_[k].assign(nquad, 0.0);
+  }
+
+  // gather the potential at all integration points
+  matgpevaluation_ = MatGPEvaluation::gather;
+  for (int iquad = 0; iquad < nquad; ++iquad)
+  {
+    my::eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
+    my::set_internal_variables_for_mat_and_rhs();
+    advreac::get_material_params(ele, densn, densnp, densam, visc, iquad);
+  }
+  matgpevaluation_ = MatGPEvaluation::pointwise;
+
+  // evaluate the ionic model at all integration points at once (the evaluation at t_(n+1) comes
+  // last, since it determines the internal state of the material)
+  const double dt = my::scatraparatimint_->dt();
+  for (int k = 0; k < my::numscal_; ++k)
+  {
+    if (myocardmat_[k] == nullptr) continue;
+
+    if (my::scatrapara_->semi_implicit())
+    {
+      myocardmat_[k]->rea_coeff_n_all_gp(phingp_[k], dt, reacoeffngp_[k]);
+      myocardmat_[k]->rea_coeff_all_gp(phinpgp_[k], dt, reacoeffnpgp_[k]);
+    }
+    else
+    {
+      myocardmat_[k]->rea_coeff_deriv_all_gp(
+          phinpgp_[k], dt, reacoeffnpgp_[k], reacoeffnpderivgp_[k]);
+    }
+  }
+}
+
+
 /*----------------------------------------------------------------------*
  | extract element based or nodal values                 hoermann 06/16 |
  *----------------------------------------------------------------------*/
@@ -14,8 +14,16 @@
 #include "4C_scatra_ele_calc_advanced_reaction.hpp"
 #include "4C_scatra_ele_calc_aniso.hpp"
 
+#include <memory>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace Mat
+{
+  class Myocard;
+}
+
 namespace Discret
 {
   namespace Elements
@@ -91,6 +99,47 @@ namespace Discret
           Core::LinAlg::SerialDenseVector& erhs,      ///< element rhs to calculate
           Core::LinAlg::SerialDenseVector& subgrdiff  ///< subgrid-diff.-scaling vector
           ) override;
+
+      //! evaluate the reaction coefficients at all material gauss points at once
+      void evaluate_mat_myocard_all_gp(
+          Core::Elements::Element* ele,  ///< the element whose matrix is calculated
+          const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints,  ///< material gauss points
+          std::vector<double>& densn,   ///< density at t_(n)
+          std::vector<double>& densnp,  ///< density at t_(n+1) or t_(n+alpha_F)
+          std::vector<double>& densam,  ///< density at t_(n+alpha_M)
+          double& visc                  ///< fluid viscosity
+      );
+
+     private:
+      //! evaluation modes of the myocard material at material gauss points
+      enum class MatGPEvaluation
+      {
+        pointwise,  ///< evaluate the ionic model at each gauss point separately
+        gather,     ///< only gather the potential at the gauss points
+        batched     ///< use the reaction coefficients evaluated for all gauss points at once
+      };
+
+      //! current evaluation mode of the myocard material at material gauss points
+      MatGPEvaluation matgpevaluation_ = MatGPEvaluation::pointwise;
+
+      //! myocard material of each scalar
+      std::vector<std::shared_ptr<const Mat::Myocard>> myocardmat_;
+
+      //! potential at t_(n) at all material gauss points of each scalar
+      std::vector<std::vector<double>> phingp_;
+
+      //! potential at t_(n+1) or t_(n+alpha_F) at all material gauss points of each scalar
+      std::vector<std::vector<double>> phinpgp_;
+
+      //! reaction coefficient at t_(n) at all material gauss points of each scalar
+      std::vector<std::vector<double>> reacoeffngp_;
+
+      //! reaction coefficient at t_(n+1) or t_(n+alpha_F) at all material gauss points of each
+      //! scalar
+      std::vector<std::vector<double>> reacoeffnpgp_;
+
+      //! derivative of reaction coefficient at all material gauss points of each scalar
+      std::vector<std::vector<double>> reacoeffnpderivgp_;
     };
 
   }  // namespace Elements
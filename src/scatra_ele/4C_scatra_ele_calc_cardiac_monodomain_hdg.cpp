@@ -269,10 +269,6 @@ void Discret::Elements::ScaTraEleCalcHDGCardiacMonodomain<distype, probdim>::mat
   // values of shape function at material gauss points
   Core::LinAlg::SerialDenseVector values_mat_gp(this->shapes_->ndofs_);
 
-  double imatgpnpderiv(0.);
-  double imatgpnp(0.);
-  double imatgpn(0.);
-
   ivecn.putScalar(0.0);
   ivecnp.putScalar(0.0);
   ivecnpderiv.putScalar(0.0);
@@ -364,41 +360,45 @@ void Discret::Elements::ScaTraEleCalcHDGCardiacMonodomain<distype, probdim>::mat
   // Jacobian determinant
   double jacdet = this->shapes_->xjm.determinant();
 
+  // potential at all material gauss points
+  std::vector<double> phingp(nqpoints, 0.0);
+  std::vector<double> phinpgp(nqpoints, 0.0);
   for (int q = 0; q < nqpoints; ++q)
   {
-    double phinpgp = 0.0;
-    double phingp = 0.0;
-
     // loop over shape functions
     for (unsigned int i = 0; i < this->shapes_->ndofs_; ++i)
     {
-      phingp += values_mat_gp_all_[q](i) * this->interiorPhin_(i);
-      phinpgp += values_mat_gp_all_[q](i) * this->interiorPhinp_(i);
-    }
-
-    // Reaction term at material gauss points
-
-    if (!this->scatrapara_->semi_implicit())
-    {
-      imatgpnpderiv = actmat->rea_coeff_deriv(phinpgp, this->dt(), q);
+      phingp[q] += values_mat_gp_all_[q](i) * this->interiorPhin_(i);
+      phinpgp[q] += values_mat_gp_all_[q](i) * this->interiorPhinp_(i);
     }
+  }
 
-    imatgpn = actmat->rea_coeff_n(phingp, this->dt(), q);
-    imatgpnp = actmat->rea_coeff(phinpgp, this->dt(), q);
+  // Reaction term at all material gauss points at once (the evaluation at n+1 comes last, since
+  // it determines the internal state of the material)
+  std::vector<double> imatgpn(nqpoints);
+  std::vector<double> imatgpnp(nqpoints);
+  std::vector<double> imatgpnpderiv(nqpoints);
+  actmat->rea_coeff_n_all_gp(phingp, this->dt(), imatgpn);
+  if (!this->scatrapara_->semi_implicit())
+    actmat->rea_coeff_deriv_all_gp(phinpgp, this->dt(), imatgpnp, imatgpnpderiv);
+  else
+    actmat->rea_coeff_all_gp(phinpgp, this->dt(), imatgpnp);
 
+  for (int q = 0; q < nqpoints; ++q)
+  {
     // loop over shape functions
     for (unsigned int i = 0; i < this->shapes_->ndofs_; ++i)
     {
-      ivecn(i) += imatgpn * values_mat_gp_all_[q](i) * jacdet * gp_mat_alpha_[q];
+      ivecn(i) += imatgpn[q] * values_mat_gp_all_[q](i) * jacdet * gp_mat_alpha_[q];
     }
 
     if (!this->scatrapara_->semi_implicit())
       for (unsigned int i = 0; i < this->shapes_->ndofs_; ++i)
       {
         for (unsigned int j = 0; j < this->shapes_->ndofs_; ++j)
-          ivecnpderiv(i, j) += imatgpnpderiv * values_mat_gp_all_[q](i) * values_mat_gp_all_[q](j) *
-                               jacdet * gp_mat_alpha_[q];
-        ivecnp(i) += imatgpnp * values_mat_gp_all_[q](i) * jacdet * gp_mat_alpha_[q];
+          ivecnpderiv(i, j) += imatgpnpderiv[q] * values_mat_gp_all_[q](i) *
+                               values_mat_gp_all_[q](j) * jacdet * gp_mat_alpha_[q];
+        ivecnp(i) += imatgpnp[q] * values_mat_gp_all_[q](i) * jacdet * gp_mat_alpha_[q];
       }
   }
 
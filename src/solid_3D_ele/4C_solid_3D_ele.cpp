@@ -271,6 +271,15 @@ void Discret::Elements::Solid::set_params_interface_ptr(const Teuchos::Parameter
     interface_ptr_ = nullptr;
 }
 
+void Discret::Elements::Solid::ensure_material_post_setup()
+{
+  if (material_post_setup_) return;
+
+  std::visit([&](auto& interface) { interface->material_post_setup(*this, *solid_material()); },
+      solid_calc_variant_);
+  material_post_setup_ = true;
+}
+
 bool Discret::Elements::Solid::read_element(const std::string& eletype, const std::string& celltype,
     const Core::IO::InputParameterContainer& container)
 {
@@ -110,6 +110,11 @@ namespace Discret::Elements
 
     [[nodiscard]] const Core::FE::GaussIntegration& get_gauss_rule() const;
 
+    [[nodiscard]] const SolidElementProperties& get_solid_element_properties() const
+    {
+      return solid_ele_property_;
+    }
+
     [[nodiscard]] int num_dof_per_node(const Core::Nodes::Node& node) const override { return 3; }
 
     [[nodiscard]] int num_dof_per_element() const override { return 0; }
@@ -158,6 +163,9 @@ namespace Discret::Elements
 
     void set_params_interface_ptr(const Teuchos::ParameterList& p) override;
 
+    //! Call the post setup of the material before the first evaluation of the element
+    void ensure_material_post_setup();
+
     [[nodiscard]] bool have_eas() const
     {
       return solid_ele_property_.element_technology == ElementTechnology::eas_full ||
@@ -0,0 +1,490 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_solid_3D_ele_block_evaluator.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_extract_values.hpp"
+#include "4C_fem_general_utils_fem_shapefunctions.hpp"
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_inpar_structure.hpp"
+#include "4C_io_performance_telemetry.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_mat_so3_material.hpp"
+#include "4C_solid_3D_ele.hpp"
+#include "4C_solid_3D_ele_calc_lib.hpp"
+#include "4C_structure_new_elements_paramsinterface.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <utility>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  constexpr Core::FE::CellType celltype = Core::FE::CellType::hex8;
+  constexpr int num_nodes = Core::FE::num_nodes<celltype>;
+  constexpr int num_dim = Core::FE::dim<celltype>;
+  constexpr int num_dof_per_ele = num_nodes * num_dim;
+  constexpr int num_str = 6;
+  constexpr int block_size = Discret::Elements::SolidBlockEvaluator::block_size;
+
+  //! one value for each element of a block
+  using Lanes = std::array<double, block_size>;
+
+  //! elements of a block that are evaluated and assembled
+  using ActiveLanes = std::array<bool, block_size>;
+
+  template <int rows, int cols>
+  using LaneMatrix = std::array<std::array<Lanes, cols>, rows>;
+
+  //! interleaved quantities of the elements of a block
+  struct BlockData
+  {
+    LaneMatrix<num_nodes, num_dim> reference_coordinates;
+    LaneMatrix<num_nodes, num_dim> current_coordinates;
+
+    Lanes determinant;
+    LaneMatrix<num_dim, num_dim> inverse_jacobian;
+    LaneMatrix<num_dim, num_nodes> N_XYZ;
+    LaneMatrix<num_dim, num_dim> deformation_gradient;
+    LaneMatrix<num_str, num_dof_per_ele> Bop;
+
+    std::array<Lanes, num_str> pk2;
+    LaneMatrix<num_str, num_str> cmat;
+    LaneMatrix<num_str, num_dof_per_ele> cb;
+
+    std::array<Lanes, num_dof_per_ele> force;
+    LaneMatrix<num_dof_per_ele, num_dof_per_ele> stiffness;
+  };
+
+  // Evaluate the determinant and inverse of the jacobian and the derivatives of the shape functions
+  // w.r.t. the reference coordinates for all elements of the block.
+  void evaluate_jacobian_mapping(
+      const Core::LinAlg::Matrix<num_dim, num_nodes>& derivatives, BlockData& data)
+  {
+    LaneMatrix<num_dim, num_dim> jacobian{};
+    for (int i = 0; i < num_dim; ++i)
+      for (int n = 0; n < num_nodes; ++n)
+        for (int j = 0; j < num_dim; ++j)
+          for (int l = 0; l < block_size; ++l)
+            jacobian[i][j][l] += derivatives(i, n) * data.reference_coordinates[n][j][l];
+
+    auto& inv = data.inverse_jacobian;
+    for (int l = 0; l < block_size; ++l)
+    {
+      const double j00 = jacobian[0][0][l], j01 = jacobian[0][1][l], j02 = jacobian[0][2][l];
+      const double j10 = jacobian[1][0][l], j11 = jacobian[1][1][l], j12 = jacobian[1][2][l];
+      const double j20 = jacobian[2][0][l], j21 = jacobian[2][1][l], j22 = jacobian[2][2][l];
+
+      // adjugate of the jacobian
+      inv[0][0][l] = j11 * j22 - j12 * j21;
+      inv[0][1][l] = j02 * j21 - j01 * j22;
+      inv[0][2][l] = j01 * j12 - j02 * j11;
+      inv[1][0][l] = j12 * j20 - j10 * j22;
+      inv[1][1][l] = j00 * j22 - j02 * j20;
+      inv[1][2][l] = j02 * j10 - j00 * j12;
+      inv[2][0][l] = j10 * j21 - j11 * j20;
+      inv[2][1][l] = j01 * j20 - j00 * j21;
+      inv[2][2][l] = j00 * j11 - j01 * j10;
+
+      data.determinant[l] = j00 * inv[0][0][l] + j01 * inv[1][0][l] + j02 * inv[2][0][l];
+    }
+
+    for (int i = 0; i < num_dim; ++i)
+      for (int j = 0; j < num_dim; ++j)
+        for (int l = 0; l < block_size; ++l) inv[i][j][l] /= data.determinant[l];
+
+    for (int d = 0; d < num_dim; ++d)
+    {
+      for (int n = 0; n < num_nodes; ++n)
+      {
+        for (int l = 0; l < block_size; ++l)
+        {
+          data.N_XYZ[d][n][l] = inv[d][0][l] * derivatives(0, n) +
+                                inv[d][1][l] * derivatives(1, n) + inv[d][2][l] * derivatives(2, n);
+        }
+      }
+    }
+  }
+
+  // Evaluate the deformation gradient F = x^T dN/dX^T (as for single hex8 elements) and the
+  // nonlinear B-operator for all elements of the block.
+  void evaluate_deformation_gradient_and_strain_gradient(BlockData& data)
+  {
+    auto& F = data.deformation_gradient;
+    const auto& N_XYZ = data.N_XYZ;
+
+    F = {};
+    for (int i = 0; i < num_dim; ++i)
+      for (int j = 0; j < num_dim; ++j)
+        for (int n = 0; n < num_nodes; ++n)
+          for (int l = 0; l < block_size; ++l)
+            F[i][j][l] += data.current_coordinates[n][i][l] * N_XYZ[j][n][l];
+
+    for (int n = 0; n < num_nodes; ++n)
+    {
+      for (int e = 0; e < num_dim; ++e)
+      {
+        const int dof = num_dim * n + e;
+        for (int l = 0; l < block_size; ++l)
+        {
+          for (int d = 0; d < num_dim; ++d) data.Bop[d][dof][l] = F[e][d][l] * N_XYZ[d][n][l];
+
+          data.Bop[3][dof][l] = F[e][0][l] * N_XYZ[1][n][l] + F[e][1][l] * N_XYZ[0][n][l];
+          data.Bop[4][dof][l] = F[e][1][l] * N_XYZ[2][n][l] + F[e][2][l] * N_XYZ[1][n][l];
+          data.Bop[5][dof][l] = F[e][2][l] * N_XYZ[0][n][l] + F[e][0][l] * N_XYZ[2][n][l];
+        }
+      }
+    }
+  }
+
+  // Whether the element flags evaluation errors instead of throwing (as SoBase::error_handling).
+  bool is_tolerate_errors(const Discret::Elements::Solid& ele)
+  {
+    return ele.is_params_interface() and ele.get_solid_params_interface().is_tolerate_errors();
+  }
+
+  // Evaluate the materials element by element.
+  void evaluate_material_stress(const Discret::Elements::SolidBlockEvaluator::Block& block,
+      const std::array<Mat::So3Material*, block_size>& materials,
+      const Core::LinAlg::Matrix<num_nodes, 1>& shape_functions,
+      const std::array<Core::LinAlg::Matrix<num_dim, 1>, block_size>& centroids,
+      Teuchos::ParameterList& params, const int gp, ActiveLanes& active, BlockData& data)
+  {
+    for (int l = 0; l < block_size; ++l)
+    {
+      if (not active[l])
+      {
+        // padding lanes and invalid elements do not contribute
+        for (int s = 0; s < num_str; ++s)
+        {
+          data.pk2[s][l] = 0.0;
+          for (int t = 0; t < num_str; ++t) data.cmat[s][t][l] = 0.0;
+        }
+        continue;
+      }
+
+      Core::LinAlg::Matrix<num_dim, num_dim> defgrd(false);
+      for (int i = 0; i < num_dim; ++i)
+        for (int j = 0; j < num_dim; ++j) defgrd(i, j) = data.deformation_gradient[i][j][l];
+
+      Core::LinAlg::Matrix<num_dim, num_dim> cauchygreen(false);
+      cauchygreen.multiply_tn(defgrd, defgrd);
+      const Core::LinAlg::Matrix<num_str, 1> gl_strain =
+          Discret::Elements::evaluate_green_lagrange_strain(cauchygreen);
+
+      Core::LinAlg::Matrix<num_dim, 1> gp_coordinates(true);
+      for (int n = 0; n < num_nodes; ++n)
+        for (int d = 0; d < num_dim; ++d)
+          gp_coordinates(d) += shape_functions(n) * data.reference_coordinates[n][d][l];
+      params.set("gp_coords_ref", gp_coordinates);
+      params.set("elecenter_coords_ref", centroids[l]);
+
+      Core::LinAlg::Matrix<num_str, 1> pk2;
+      Core::LinAlg::Matrix<num_str, num_str> cmat;
+      const Discret::Elements::Solid& ele = *block.elements[l];
+      materials[l]->evaluate(&defgrd, &gl_strain, params, &pk2, &cmat, gp, ele.id());
+
+      // stop the evaluation of the element if the material evaluation fails
+      if (is_tolerate_errors(ele) and ele.get_solid_params_interface().get_ele_eval_error_flag() !=
+                                          Solid::Elements::ele_error_none)
+      {
+        active[l] = false;
+        pk2.clear();
+        cmat.clear();
+      }
+
+      for (int s = 0; s < num_str; ++s)
+      {
+        data.pk2[s][l] = pk2(s);
+        for (int t = 0; t < num_str; ++t) data.cmat[s][t][l] = cmat(s, t);
+      }
+    }
+  }
+
+  void add_internal_force_vector(const Lanes& integration_factor, BlockData& data)
+  {
+    for (int a = 0; a < num_dof_per_ele; ++a)
+      for (int s = 0; s < num_str; ++s)
+        for (int l = 0; l < block_size; ++l)
+          data.force[a][l] += integration_factor[l] * data.Bop[s][a][l] * data.pk2[s][l];
+  }
+
+  void add_stiffness_matrix(const Lanes& integration_factor, BlockData& data)
+  {
+    // elastic stiffness B^T C B
+    for (int s = 0; s < num_str; ++s)
+    {
+      for (int b = 0; b < num_dof_per_ele; ++b)
+      {
+        for (int l = 0; l < block_size; ++l)
+        {
+          double cb = 0.0;
+          for (int t = 0; t < num_str; ++t) cb += data.cmat[s][t][l] * data.Bop[t][b][l];
+          data.cb[s][b][l] = integration_factor[l] * cb;
+        }
+      }
+    }
+
+    for (int a = 0; a < num_dof_per_ele; ++a)
+      for (int b = 0; b < num_dof_per_ele; ++b)
+        for (int s = 0; s < num_str; ++s)
+          for (int l = 0; l < block_size; ++l)
+            data.stiffness[a][b][l] += data.Bop[s][a][l] * data.cb[s][b][l];
+
+    // geometric stiffness B_L^T S B_L
+    const auto& N_XYZ = data.N_XYZ;
+    const auto& S = data.pk2;
+    for (int inod = 0; inod < num_nodes; ++inod)
+    {
+      std::array<Lanes, num_dim> SmB_L;
+      for (int l = 0; l < block_size; ++l)
+      {
+        SmB_L[0][l] = S[0][l] * N_XYZ[0][inod][l] + S[3][l] * N_XYZ[1][inod][l] +
+                      S[5][l] * N_XYZ[2][inod][l];
+        SmB_L[1][l] = S[3][l] * N_XYZ[0][inod][l] + S[1][l] * N_XYZ[1][inod][l] +
+                      S[4][l] * N_XYZ[2][inod][l];
+        SmB_L[2][l] = S[5][l] * N_XYZ[0][inod][l] + S[4][l] * N_XYZ[1][inod][l] +
+                      S[2][l] * N_XYZ[2][inod][l];
+      }
+
+      for (int jnod = 0; jnod < num_nodes; ++jnod)
+      {
+        for (int l = 0; l < block_size; ++l)
+        {
+          const double bopstrbop =
+              integration_factor[l] *
+              (N_XYZ[0][jnod][l] * SmB_L[0][l] + N_XYZ[1][jnod][l] * SmB_L[1][l] +
+                  N_XYZ[2][jnod][l] * SmB_L[2][l]);
+          for (int d = 0; d < num_dim; ++d)
+            data.stiffness[num_dim * inod + d][num_dim * jnod + d][l] += bopstrbop;
+        }
+      }
+    }
+  }
+
+  // Check for negative Jacobian determinants at the element nodes. Invalid elements are
+  // deactivated if errors are tolerated.
+  void ensure_positive_jacobian_determinant_at_element_nodes(
+      const Discret::Elements::SolidBlockEvaluator::Block& block, ActiveLanes& active,
+      BlockData& data)
+  {
+    for (const auto& xi : Core::FE::get_element_nodes_in_parameter_space<celltype>())
+    {
+      Core::LinAlg::Matrix<num_dim, num_nodes> derivatives(false);
+      Core::FE::shape_function_deriv1<celltype>(
+          Core::LinAlg::Matrix<num_dim, 1>(xi.data(), true), derivatives);
+      evaluate_jacobian_mapping(derivatives, data);
+
+      for (int l = 0; l < block.num_elements; ++l)
+      {
+        if (not active[l] or data.determinant[l] > 0) continue;
+
+        const Discret::Elements::Solid& ele = *block.elements[l];
+        if (not is_tolerate_errors(ele))
+        {
+          FOUR_C_THROW("determinant of jacobian is %f <= 0 at one node of element %d.",
+              data.determinant[l], ele.id());
+        }
+        ele.get_solid_params_interface().set_ele_eval_error_flag(
+            Solid::Elements::ele_error_determinant_at_corner);
+        active[l] = false;
+      }
+    }
+  }
+}  // namespace
+
+Discret::Elements::SolidBlockEvaluator::SolidBlockEvaluator(
+    const Core::FE::Discretization& discretization)
+    : element_col_map_(*discretization.element_col_map())
+{
+  // group the supported elements by material and number of Gauss points
+  std::map<std::pair<int, int>, std::vector<Solid*>> supported_elements;
+  std::vector<int> remaining_element_gids;
+  for (auto* ele : discretization.my_col_element_range())
+  {
+    auto* solid_ele = dynamic_cast<Solid*>(ele);
+    if (solid_ele != nullptr and is_supported(*solid_ele))
+    {
+      const std::pair<int, int> key = {
+          solid_ele->material()->parameter()->id(), solid_ele->get_gauss_rule().num_points()};
+      supported_elements[key].emplace_back(solid_ele);
+    }
+    else
+      remaining_element_gids.emplace_back(ele->id());
+  }
+
+  for (const auto& [key, elements] : supported_elements)
+  {
+    for (std::size_t i = 0; i < elements.size(); i += block_size)
+    {
+      Block& block = blocks_.emplace_back();
+      block.num_elements = static_cast<int>(std::min<std::size_t>(block_size, elements.size() - i));
+      for (int l = 0; l < block_size; ++l)
+      {
+        // padding lanes repeat the first element to keep the arithmetic valid
+        block.elements[l] = elements[i + (l < block.num_elements ? l : 0)];
+      }
+    }
+  }
+
+  remaining_element_col_map_ = std::make_shared<Epetra_Map>(-1,
+      static_cast<int>(remaining_element_gids.size()), remaining_element_gids.data(), 0,
+      element_col_map_.Comm());
+}
+
+bool Discret::Elements::SolidBlockEvaluator::is_supported(const Solid& ele)
+{
+  const SolidElementProperties& properties = ele.get_solid_element_properties();
+  return ele.shape() == celltype and
+         properties.kintype == Inpar::Solid::KinemType::nonlinearTotLag and
+         properties.element_technology == ElementTechnology::none and
+         properties.prestress_technology == PrestressTechnology::none and
+         ele.num_material() == 1;
+}
+
+bool Discret::Elements::SolidBlockEvaluator::is_valid_for(
+    const Core::FE::Discretization& discretization) const
+{
+  return discretization.element_col_map()->PointSameAs(element_col_map_);
+}
+
+void Discret::Elements::SolidBlockEvaluator::evaluate(Teuchos::ParameterList& params,
+    const Core::FE::Discretization& discretization, Core::FE::AssembleStrategy& strategy) const
+{
+  const Core::LinAlg::Vector<double>& displacements = *discretization.get_state("displacement");
+
+  const int row = strategy.first_dof_set();
+  const int col = strategy.second_dof_set();
+  const bool evaluate_stiffness = strategy.assemblemat1();
+
+  const Core::LinAlg::Matrix<num_dim, 1> xi_centroid =
+      evaluate_parameter_coordinate_centroid<celltype>();
+  Core::LinAlg::Matrix<num_nodes, 1> shape_functions_centroid(false);
+  Core::FE::shape_function<celltype>(xi_centroid, shape_functions_centroid);
+
+  // the block data is too large for the stack
+  auto data = std::make_unique<BlockData>();
+
+  std::vector<Core::Elements::LocationArray> location_arrays(
+      block_size, Core::Elements::LocationArray(discretization.num_dof_sets()));
+
+  // time spent in the block kernels and in the assembly (recorded once after the loop)
+  std::chrono::duration<double> evaluation_time{0.0};
+  std::chrono::duration<double> assembly_time{0.0};
+  auto last_time = std::chrono::steady_clock::now();
+
+  for (const Block& block : blocks_)
+  {
+    // gather the nodal coordinates of the block
+    std::array<Mat::So3Material*, block_size> materials;
+    std::array<Core::LinAlg::Matrix<num_dim, 1>, block_size> centroids;
+    for (int l = 0; l < block_size; ++l)
+    {
+      Solid& ele = *block.elements[l];
+      if (l < block.num_elements)
+      {
+        ele.ensure_material_post_setup();
+        ele.set_params_interface_ptr(params);
+        ele.location_vector(discretization, location_arrays[l], false);
+      }
+      materials[l] = ele.solid_material().get();
+
+      const std::array<double, num_dof_per_ele> element_displacements =
+          Core::FE::extract_values_as_array<num_dof_per_ele>(
+              displacements, location_arrays[l < block.num_elements ? l : 0][row].lm_);
+
+      centroids[l].clear();
+      for (int n = 0; n < num_nodes; ++n)
+      {
+        for (int d = 0; d < num_dim; ++d)
+        {
+          const double x = ele.nodes()[n]->x()[d];
+          data->reference_coordinates[n][d][l] = x;
+          data->current_coordinates[n][d][l] = x + element_displacements[num_dim * n + d];
+          centroids[l](d) += shape_functions_centroid(n) * x;
+        }
+      }
+    }
+
+    ActiveLanes active;
+    for (int l = 0; l < block_size; ++l) active[l] = l < block.num_elements;
+    ensure_positive_jacobian_determinant_at_element_nodes(block, active, *data);
+
+    data->force = {};
+    if (evaluate_stiffness) data->stiffness = {};
+
+    const Core::FE::GaussIntegration& integration = block.elements[0]->get_gauss_rule();
+    for (int gp = 0; gp < integration.num_points(); ++gp)
+    {
+      const Core::LinAlg::Matrix<num_dim, 1> xi =
+          evaluate_parameter_coordinate<celltype>(integration, gp);
+      Core::LinAlg::Matrix<num_nodes, 1> shape_functions(false);
+      Core::LinAlg::Matrix<num_dim, num_nodes> derivatives(false);
+      Core::FE::shape_function<celltype>(xi, shape_functions);
+      Core::FE::shape_function_deriv1<celltype>(xi, derivatives);
+
+      evaluate_jacobian_mapping(derivatives, *data);
+      evaluate_deformation_gradient_and_strain_gradient(*data);
+      evaluate_material_stress(
+          block, materials, shape_functions, centroids, params, gp, active, *data);
+
+      Lanes integration_factor;
+      for (int l = 0; l < block_size; ++l)
+        integration_factor[l] = data->determinant[l] * integration.weight(gp);
+
+      add_internal_force_vector(integration_factor, *data);
+      if (evaluate_stiffness) add_stiffness_matrix(integration_factor, *data);
+    }
+
+    const auto evaluated_time = std::chrono::steady_clock::now();
+    evaluation_time += evaluated_time - last_time;
+
+    // scatter the element contributions into the global system
+    for (int l = 0; l < block.num_elements; ++l)
+    {
+      if (not active[l]) continue;
+
+      const Core::Elements::LocationArray& la = location_arrays[l];
+      strategy.clear_element_storage(la[row].size(), la[col].size());
+
+      if (evaluate_stiffness)
+      {
+        Core::LinAlg::SerialDenseMatrix& elemat = strategy.elematrix1();
+        for (int a = 0; a < num_dof_per_ele; ++a)
+          for (int b = 0; b < num_dof_per_ele; ++b) elemat(a, b) = data->stiffness[a][b][l];
+      }
+
+      if (strategy.assemblevec1())
+      {
+        Core::LinAlg::SerialDenseVector& elevec = strategy.elevector1();
+        for (int a = 0; a < num_dof_per_ele; ++a) elevec(a) = data->force[a][l];
+      }
+
+      const int eid = block.elements[l]->id();
+      strategy.assemble_matrix1(eid, la[row].lm_, la[col].lm_, la[row].lmowner_, la[col].stride_);
+      strategy.assemble_vector1(la[row].lm_, la[row].lmowner_);
+    }
+
+    last_time = std::chrono::steady_clock::now();
+    assembly_time += last_time - evaluated_time;
+  }
+
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::element_evaluation_time, evaluation_time.count());
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::assembly_time, assembly_time.count());
+}
+
+FOUR_C_NAMESPACE_CLOSE
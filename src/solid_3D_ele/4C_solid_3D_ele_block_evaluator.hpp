@@ -0,0 +1,119 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLID_3D_ELE_BLOCK_EVALUATOR_HPP
+#define FOUR_C_SOLID_3D_ELE_BLOCK_EVALUATOR_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Map.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#if defined(FOUR_C_ENABLE_NATIVE_OPTIMIZATIONS) && __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define FOUR_C_SOLID_3D_ELE_BLOCK_EVALUATOR_NATIVE_SIMD_WIDTH
+#endif
+
+namespace Teuchos
+{
+  class ParameterList;
+}
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE
+{
+  class AssembleStrategy;
+  class Discretization;
+}  // namespace Core::FE
+
+namespace Discret::Elements
+{
+  class Solid;
+
+  /*!
+   * @brief Evaluate the internal force vector and the stiffness matrix of blocks of solid elements
+   * at once
+   *
+   * The element matrices of hex8 elements are too small to keep the vector units of the processor
+   * busy. Instead, the elements are grouped into blocks of @p block_size elements with the same
+   * material and integration rule. The nodal coordinates and all kinematic quantities of a block
+   * are stored interleaved in plain arrays, i.e., the innermost index runs over the elements of
+   * the block. All loops over the elements of a block are innermost loops with unit stride and a
+   * trip count known at compile time, such that the compiler can vectorize them. No explicit SIMD
+   * types or intrinsics are used, std::experimental::simd (if available) only determines the block
+   * size. Only the evaluation of the material is done element by element. The element
+   * contributions are scattered into the global system afterwards.
+   *
+   * Invalid elements (negative Jacobian determinant at a node or failed material evaluation) are
+   * handled as in the element evaluation: if the structural time integration tolerates errors,
+   * the error flag is set and the element is not assembled, otherwise an error is thrown.
+   *
+   * Supported are hex8 elements with nonlinear total Lagrangian kinematics without element
+   * technology and prestressing. All other elements of the discretization are listed in
+   * remaining_element_col_map() and have to be evaluated by the usual element loop.
+   */
+  class SolidBlockEvaluator
+  {
+   public:
+    //! number of elements evaluated at once (the number of doubles in a native SIMD register)
+#ifdef FOUR_C_SOLID_3D_ELE_BLOCK_EVALUATOR_NATIVE_SIMD_WIDTH
+    static constexpr int block_size = std::experimental::native_simd<double>::size();
+#else
+    static constexpr int block_size = 4;
+#endif
+
+    //! elements of one block, the last block of a material might only be partially filled
+    struct Block
+    {
+      std::array<Solid*, block_size> elements{};
+      int num_elements = 0;
+    };
+
+    //! Group the supported column elements of @p discretization into blocks.
+    explicit SolidBlockEvaluator(const Core::FE::Discretization& discretization);
+
+    //! Whether the element @p ele can be evaluated within a block.
+    static bool is_supported(const Solid& ele);
+
+    //! Whether the blocks were set up for the current element column map of @p discretization.
+    [[nodiscard]] bool is_valid_for(const Core::FE::Discretization& discretization) const;
+
+    //! Column map of the elements that are not evaluated in blocks.
+    [[nodiscard]] const Epetra_Map& remaining_element_col_map() const
+    {
+      return *remaining_element_col_map_;
+    }
+
+    /*!
+     * @brief Evaluate the internal force vector and (if the strategy assembles the first system
+     * matrix) the stiffness matrix of all blocks and assemble them with @p strategy.
+     *
+     * The displacements are taken from the state "displacement" of @p discretization. The
+     * element evaluation and assembly times are recorded in the performance telemetry as in
+     * Core::FE::Discretization::evaluate(). The pre-evaluation of the element types is not called,
+     * this is left to the element loop over the remaining elements.
+     */
+    void evaluate(Teuchos::ParameterList& params, const Core::FE::Discretization& discretization,
+        Core::FE::AssembleStrategy& strategy) const;
+
+   private:
+    std::vector<Block> blocks_;
+
+    //! element column map the blocks were set up for
+    Epetra_Map element_col_map_;
+
+    std::shared_ptr<Epetra_Map> remaining_element_col_map_;
+  };
+}  // namespace Discret::Elements
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -60,12 +60,7 @@ int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
     Core::LinAlg::SerialDenseVector& elevec1, Core::LinAlg::SerialDenseVector& elevec2,
     Core::LinAlg::SerialDenseVector& elevec3)
 {
-  if (!material_post_setup_)
-  {
-    std::visit([&](auto& interface) { interface->material_post_setup(*this, *solid_material()); },
-        solid_calc_variant_);
-    material_post_setup_ = true;
-  }
+  ensure_material_post_setup();
 
   // get ptr to interface to time integration
   set_params_interface_ptr(params);
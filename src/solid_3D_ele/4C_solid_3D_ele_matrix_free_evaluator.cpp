@@ -0,0 +1,628 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_solid_3D_ele_matrix_free_evaluator.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_extract_values.hpp"
+#include "4C_fem_general_utils_fem_shapefunctions.hpp"
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_inpar_structure.hpp"
+#include "4C_mat_so3_material.hpp"
+#include "4C_solid_3D_ele.hpp"
+#include "4C_solid_3D_ele_calc_lib.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <cmath>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  using Evaluator = Discret::Elements::SolidMatrixFreeEvaluator;
+  using GaussPointLinearization = Evaluator::GaussPointLinearization;
+  using SubcellGaussPoint = Evaluator::SubcellGaussPoint;
+
+  constexpr Core::FE::CellType celltype = Core::FE::CellType::hex27;
+  constexpr Core::FE::CellType subcell_celltype = Core::FE::CellType::hex8;
+  constexpr int num_nodes = Evaluator::num_nodes;
+  constexpr int num_dof_per_ele = Evaluator::num_dof_per_ele;
+  constexpr int num_subcells = Evaluator::num_subcells;
+  constexpr int num_subcell_nodes = Core::FE::num_nodes<subcell_celltype>;
+  constexpr int num_dim = 3;
+  constexpr int num_str = 6;
+  constexpr int num_points_1d = 3;
+
+  //! one value at each lexicographically ordered node or Gauss point of a hex27 element
+  using TensorValues = std::array<double, num_nodes>;
+
+  //! values of the nodal displacements of a sub-cell
+  using SubcellValues = std::array<std::array<double, num_dim>, num_subcell_nodes>;
+
+  //! matrix of the 1D basis, the first index is the Gauss point, the second one the node
+  using Matrix1D = std::array<std::array<double, num_points_1d>, num_points_1d>;
+
+  constexpr int lexicographic_index(const int i, const int j, const int k)
+  {
+    return i + num_points_1d * j + num_points_1d * num_points_1d * k;
+  }
+
+  const std::array<double, num_points_1d> gauss_points_1d = {
+      -std::sqrt(0.6), 0.0, std::sqrt(0.6)};
+  constexpr std::array<double, num_points_1d> gauss_weights_1d = {5.0 / 9.0, 8.0 / 9.0, 5.0 / 9.0};
+
+  //! values and derivatives of the quadratic Lagrange polynomials at the Gauss points
+  struct Basis1D
+  {
+    Matrix1D values;
+    Matrix1D derivatives;
+  };
+
+  const Basis1D& basis_1d()
+  {
+    static const Basis1D basis = []()
+    {
+      Basis1D basis{};
+      for (int q = 0; q < num_points_1d; ++q)
+      {
+        const double x = gauss_points_1d[q];
+        basis.values[q] = {0.5 * x * (x - 1.0), 1.0 - x * x, 0.5 * x * (x + 1.0)};
+        basis.derivatives[q] = {x - 0.5, -2.0 * x, x + 0.5};
+      }
+      return basis;
+    }();
+    return basis;
+  }
+
+  double gauss_weight(const int gp)
+  {
+    return gauss_weights_1d[gp % num_points_1d] *
+           gauss_weights_1d[(gp / num_points_1d) % num_points_1d] *
+           gauss_weights_1d[gp / (num_points_1d * num_points_1d)];
+  }
+
+  // Apply the 1D matrix @p matrix (or its transpose) in direction @p dim to the tensor-product
+  // values @p in.
+  template <bool transposed>
+  void contract(const Matrix1D& matrix, const int dim, const TensorValues& in, TensorValues& out)
+  {
+    const int stride = dim == 0 ? 1 : (dim == 1 ? num_points_1d : num_points_1d * num_points_1d);
+    out.fill(0.0);
+    for (int idx = 0; idx < num_nodes; ++idx)
+    {
+      const int i = (idx / stride) % num_points_1d;
+      const int base = idx - i * stride;
+      for (int q = 0; q < num_points_1d; ++q)
+        out[base + q * stride] += (transposed ? matrix[i][q] : matrix[q][i]) * in[idx];
+    }
+  }
+
+  // Evaluate the field with the nodal values @p values at all Gauss points.
+  TensorValues interpolate(const TensorValues& values)
+  {
+    const Basis1D& basis = basis_1d();
+    TensorValues tmp1, tmp2, result;
+    contract<false>(basis.values, 0, values, tmp1);
+    contract<false>(basis.values, 1, tmp1, tmp2);
+    contract<false>(basis.values, 2, tmp2, result);
+    return result;
+  }
+
+  // Evaluate the derivatives w.r.t. the parameter coordinates of the field with the nodal values
+  // @p values at all Gauss points by sum factorization.
+  std::array<TensorValues, num_dim> evaluate_parameter_gradient(const TensorValues& values)
+  {
+    const Basis1D& basis = basis_1d();
+    TensorValues value_2, derivative_2, tmp;
+    contract<false>(basis.values, 2, values, value_2);
+    contract<false>(basis.derivatives, 2, values, derivative_2);
+
+    std::array<TensorValues, num_dim> gradient;
+    contract<false>(basis.values, 1, value_2, tmp);
+    contract<false>(basis.derivatives, 0, tmp, gradient[0]);
+    contract<false>(basis.derivatives, 1, value_2, tmp);
+    contract<false>(basis.values, 0, tmp, gradient[1]);
+    contract<false>(basis.values, 1, derivative_2, tmp);
+    contract<false>(basis.values, 0, tmp, gradient[2]);
+    return gradient;
+  }
+
+  // Add sum_gp sum_k integrand_k(gp) dN/dxi_k(gp) for all nodes to @p result, i.e., the transpose
+  // of evaluate_parameter_gradient().
+  void integrate_parameter_gradient(
+      const std::array<TensorValues, num_dim>& integrand, TensorValues& result)
+  {
+    const Basis1D& basis = basis_1d();
+    TensorValues value_2, derivative_2, tmp, tmp2;
+    contract<true>(basis.derivatives, 0, integrand[0], tmp);
+    contract<true>(basis.values, 1, tmp, value_2);
+    contract<true>(basis.values, 0, integrand[1], tmp);
+    contract<true>(basis.derivatives, 1, tmp, tmp2);
+    for (int idx = 0; idx < num_nodes; ++idx) value_2[idx] += tmp2[idx];
+    contract<true>(basis.values, 0, integrand[2], tmp);
+    contract<true>(basis.values, 1, tmp, derivative_2);
+
+    contract<true>(basis.values, 2, value_2, tmp);
+    for (int idx = 0; idx < num_nodes; ++idx) result[idx] += tmp[idx];
+    contract<true>(basis.derivatives, 2, derivative_2, tmp);
+    for (int idx = 0; idx < num_nodes; ++idx) result[idx] += tmp[idx];
+  }
+
+  //! connectivity of the hex8 sub-cells within the lexicographically ordered hex27 element
+  struct SubcellReference
+  {
+    //! lexicographic hex27 node of every sub-cell node
+    std::array<std::array<int, num_subcell_nodes>, num_subcells> nodes;
+
+    //! lexicographic hex27 Gauss point next to every sub-cell Gauss point
+    std::array<std::array<int, num_subcells>, num_subcells> nearest_gauss_point;
+
+    //! derivatives of the hex8 shape functions at the sub-cell Gauss points
+    std::array<Core::LinAlg::Matrix<num_dim, num_subcell_nodes>, num_subcells> derivatives;
+  };
+
+  const SubcellReference& subcell_reference()
+  {
+    static const SubcellReference reference = []()
+    {
+      SubcellReference reference{};
+      const auto subcell_nodes =
+          Core::FE::get_element_nodes_in_parameter_space<subcell_celltype>();
+      const double subcell_gauss_point = 1.0 / std::sqrt(3.0);
+      for (int s = 0; s < num_subcells; ++s)
+      {
+        const std::array<int, num_dim> offset = {s % 2, (s / 2) % 2, s / 4};
+        for (int n = 0; n < num_subcell_nodes; ++n)
+        {
+          reference.nodes[s][n] =
+              lexicographic_index(offset[0] + (subcell_nodes[n][0] > 0.0 ? 1 : 0),
+                  offset[1] + (subcell_nodes[n][1] > 0.0 ? 1 : 0),
+                  offset[2] + (subcell_nodes[n][2] > 0.0 ? 1 : 0));
+        }
+
+        // the 2x2x2 Gauss points of a sub-cell are next to the hex27 Gauss points in the same
+        // octant or on the mid planes
+        for (int g = 0; g < num_subcells; ++g)
+        {
+          reference.nearest_gauss_point[s][g] = lexicographic_index(
+              offset[0] + g % 2, offset[1] + (g / 2) % 2, offset[2] + g / 4);
+        }
+      }
+
+      for (int g = 0; g < num_subcells; ++g)
+      {
+        Core::LinAlg::Matrix<num_dim, 1> xi(false);
+        xi(0) = (g % 2 == 0 ? -1.0 : 1.0) * subcell_gauss_point;
+        xi(1) = ((g / 2) % 2 == 0 ? -1.0 : 1.0) * subcell_gauss_point;
+        xi(2) = (g / 4 == 0 ? -1.0 : 1.0) * subcell_gauss_point;
+        Core::FE::shape_function_deriv1<subcell_celltype>(xi, reference.derivatives[g]);
+      }
+      return reference;
+    }();
+    return reference;
+  }
+
+  Core::LinAlg::Matrix<num_dim, num_dim> stress_voigt_to_matrix(
+      const Core::LinAlg::Matrix<num_str, 1>& stress)
+  {
+    Core::LinAlg::Matrix<num_dim, num_dim> matrix(false);
+    matrix(0, 0) = stress(0);
+    matrix(1, 1) = stress(1);
+    matrix(2, 2) = stress(2);
+    matrix(0, 1) = matrix(1, 0) = stress(3);
+    matrix(1, 2) = matrix(2, 1) = stress(4);
+    matrix(0, 2) = matrix(2, 0) = stress(5);
+    return matrix;
+  }
+
+  // Evaluate the integrand fac * dP * J^-T of the linearized internal force for the derivatives
+  // @p dudxi of a displacement increment w.r.t. the parameter coordinates. The geometry is given
+  // by @p inverse_jacobian and @p integration_factor, the kinematics and the material by
+  // @p linearization.
+  Core::LinAlg::Matrix<num_dim, num_dim> linearized_stress_integrand(
+      const GaussPointLinearization& linearization,
+      const Core::LinAlg::Matrix<num_dim, num_dim>& dudxi,
+      const Core::LinAlg::Matrix<num_dim, num_dim>& inverse_jacobian,
+      const double integration_factor)
+  {
+    const Core::LinAlg::Matrix<num_dim, num_dim>& defgrd = linearization.deformation_gradient;
+
+    Core::LinAlg::Matrix<num_dim, num_dim> ddefgrd(false);
+    ddefgrd.multiply(dudxi, inverse_jacobian);
+
+    Core::LinAlg::Matrix<num_dim, num_dim> FtdF(false);
+    FtdF.multiply_tn(defgrd, ddefgrd);
+
+    Core::LinAlg::Matrix<num_str, 1> dgl_strain(false);
+    dgl_strain(0) = FtdF(0, 0);
+    dgl_strain(1) = FtdF(1, 1);
+    dgl_strain(2) = FtdF(2, 2);
+    dgl_strain(3) = FtdF(0, 1) + FtdF(1, 0);
+    dgl_strain(4) = FtdF(1, 2) + FtdF(2, 1);
+    dgl_strain(5) = FtdF(0, 2) + FtdF(2, 0);
+
+    Core::LinAlg::Matrix<num_str, 1> dpk2(false);
+    dpk2.multiply(linearization.cmat, dgl_strain);
+
+    Core::LinAlg::Matrix<num_dim, num_dim> dpk1(false);
+    dpk1.multiply(ddefgrd, stress_voigt_to_matrix(linearization.pk2));
+    dpk1.multiply(1.0, defgrd, stress_voigt_to_matrix(dpk2), 1.0);
+
+    Core::LinAlg::Matrix<num_dim, num_dim> integrand(false);
+    integrand.multiply_nt(integration_factor, dpk1, inverse_jacobian);
+    return integrand;
+  }
+
+  // Add the action of the hex27 stiffness matrix on the nodal values @p x to @p y.
+  void add_stiffness_action(const GaussPointLinearization* linearization,
+      const std::array<TensorValues, num_dim>& x, std::array<TensorValues, num_dim>& y)
+  {
+    std::array<std::array<TensorValues, num_dim>, num_dim> gradient;
+    for (int c = 0; c < num_dim; ++c) gradient[c] = evaluate_parameter_gradient(x[c]);
+
+    std::array<std::array<TensorValues, num_dim>, num_dim> integrand;
+    for (int gp = 0; gp < num_nodes; ++gp)
+    {
+      Core::LinAlg::Matrix<num_dim, num_dim> dudxi(false);
+      for (int c = 0; c < num_dim; ++c)
+        for (int k = 0; k < num_dim; ++k) dudxi(c, k) = gradient[c][k][gp];
+
+      const GaussPointLinearization& gp_linearization = linearization[gp];
+      const Core::LinAlg::Matrix<num_dim, num_dim> gp_integrand = linearized_stress_integrand(
+          gp_linearization, dudxi, gp_linearization.inverse_jacobian,
+          gp_linearization.integration_factor);
+
+      for (int c = 0; c < num_dim; ++c)
+        for (int k = 0; k < num_dim; ++k) integrand[c][k][gp] = gp_integrand(c, k);
+    }
+
+    for (int c = 0; c < num_dim; ++c) integrate_parameter_gradient(integrand[c], y[c]);
+  }
+
+  // Add the action of the stiffness matrix of sub-cell @p subcell on its nodal values @p x to @p y.
+  void add_subcell_stiffness_action(const int subcell,
+      const GaussPointLinearization* linearization, const SubcellGaussPoint* subcell_gauss_points,
+      const SubcellValues& x, SubcellValues& y)
+  {
+    const SubcellReference& reference = subcell_reference();
+    for (int g = 0; g < num_subcells; ++g)
+    {
+      const Core::LinAlg::Matrix<num_dim, num_subcell_nodes>& derivatives =
+          reference.derivatives[g];
+
+      Core::LinAlg::Matrix<num_dim, num_dim> dudxi(true);
+      for (int n = 0; n < num_subcell_nodes; ++n)
+        for (int c = 0; c < num_dim; ++c)
+          for (int k = 0; k < num_dim; ++k) dudxi(c, k) += x[n][c] * derivatives(k, n);
+
+      const Core::LinAlg::Matrix<num_dim, num_dim> integrand = linearized_stress_integrand(
+          linearization[reference.nearest_gauss_point[subcell][g]], dudxi,
+          subcell_gauss_points[g].inverse_jacobian, subcell_gauss_points[g].integration_factor);
+
+      for (int n = 0; n < num_subcell_nodes; ++n)
+        for (int c = 0; c < num_dim; ++c)
+          for (int k = 0; k < num_dim; ++k) y[n][c] += integrand(c, k) * derivatives(k, n);
+    }
+  }
+}  // namespace
+
+Discret::Elements::SolidMatrixFreeEvaluator::SolidMatrixFreeEvaluator(
+    const Core::FE::Discretization& discretization)
+    : element_col_map_(*discretization.element_col_map()),
+      dof_row_map_(*discretization.dof_row_map()),
+      dof_col_map_(*discretization.dof_col_map()),
+      importer_(std::make_shared<Epetra_Import>(dof_col_map_, dof_row_map_))
+{
+  std::vector<int> remaining_element_gids;
+  for (auto* ele : discretization.my_col_element_range())
+  {
+    auto* solid_ele = dynamic_cast<Solid*>(ele);
+    if (solid_ele != nullptr and is_supported(*solid_ele))
+      elements_.emplace_back(solid_ele);
+    else
+      remaining_element_gids.emplace_back(ele->id());
+  }
+
+  remaining_element_col_map_ = std::make_shared<Epetra_Map>(-1,
+      static_cast<int>(remaining_element_gids.size()), remaining_element_gids.data(), 0,
+      element_col_map_.Comm());
+
+  const auto to_index_1d = [](const double x) { return x < -0.5 ? 0 : (x > 0.5 ? 2 : 1); };
+
+  const auto nodes = Core::FE::get_element_nodes_in_parameter_space<celltype>();
+  for (int n = 0; n < num_nodes; ++n)
+  {
+    lexicographic_nodes_[lexicographic_index(
+        to_index_1d(nodes[n][0]), to_index_1d(nodes[n][1]), to_index_1d(nodes[n][2]))] = n;
+  }
+
+  for (int gp = 0; gp < num_nodes; ++gp) gauss_point_index_[gp] = gp;
+  if (elements_.empty()) return;
+
+  // the material history is stored with the Gauss point numbering of the element
+  const Core::FE::GaussIntegration& integration = elements_.front()->get_gauss_rule();
+  const auto to_gauss_point_1d = [](const double x) { return x < -0.1 ? 0 : (x > 0.1 ? 2 : 1); };
+  for (int gp = 0; gp < integration.num_points(); ++gp)
+  {
+    const double* xi = integration.point(gp);
+    const int lexicographic_gp = lexicographic_index(
+        to_gauss_point_1d(xi[0]), to_gauss_point_1d(xi[1]), to_gauss_point_1d(xi[2]));
+    for (int d = 0; d < num_dim; ++d)
+    {
+      FOUR_C_ASSERT_ALWAYS(std::abs(xi[d] - gauss_points_1d[to_gauss_point_1d(xi[d])]) < 1e-12,
+          "The Gauss rule of hex27 element %d is not the tensor product of 3 point rules.",
+          elements_.front()->id());
+    }
+    gauss_point_index_[lexicographic_gp] = gp;
+  }
+}
+
+bool Discret::Elements::SolidMatrixFreeEvaluator::is_supported(const Solid& ele)
+{
+  const SolidElementProperties& properties = ele.get_solid_element_properties();
+  return ele.shape() == celltype and
+         properties.kintype == Inpar::Solid::KinemType::nonlinearTotLag and
+         properties.element_technology == ElementTechnology::none and
+         properties.prestress_technology == PrestressTechnology::none and
+         ele.num_material() == 1 and ele.get_gauss_rule().num_points() == num_nodes;
+}
+
+bool Discret::Elements::SolidMatrixFreeEvaluator::is_valid_for(
+    const Core::FE::Discretization& discretization) const
+{
+  return discretization.element_col_map()->PointSameAs(element_col_map_);
+}
+
+void Discret::Elements::SolidMatrixFreeEvaluator::evaluate(Teuchos::ParameterList& params,
+    const Core::FE::Discretization& discretization, Core::FE::AssembleStrategy& strategy)
+{
+  const Core::LinAlg::Vector<double>& displacements = *discretization.get_state("displacement");
+
+  const int row = strategy.first_dof_set();
+  const int col = strategy.second_dof_set();
+  const bool evaluate_stiffness = strategy.assemblemat1();
+
+  if (evaluate_stiffness)
+  {
+    local_col_dofs_.resize(elements_.size());
+    gauss_points_.resize(elements_.size() * num_nodes);
+    subcell_gauss_points_.resize(elements_.size() * num_subcells * num_subcells);
+  }
+
+  const SubcellReference& reference = subcell_reference();
+  Core::Elements::LocationArray la(discretization.num_dof_sets());
+
+  for (std::size_t e = 0; e < elements_.size(); ++e)
+  {
+    Solid& ele = *elements_[e];
+    ele.ensure_material_post_setup();
+    ele.set_params_interface_ptr(params);
+    ele.location_vector(discretization, la, false);
+    FOUR_C_ASSERT(la[row].lm_.size() == num_dof_per_ele,
+        "Expected %d dofs of element %d, got %d.", num_dof_per_ele, ele.id(),
+        static_cast<int>(la[row].lm_.size()));
+
+    const std::array<double, num_dof_per_ele> element_displacements =
+        Core::FE::extract_values_as_array<num_dof_per_ele>(displacements, la[row].lm_);
+
+    std::array<TensorValues, num_dim> reference_coordinates;
+    std::array<TensorValues, num_dim> nodal_displacements;
+    for (int l = 0; l < num_nodes; ++l)
+    {
+      const int n = lexicographic_nodes_[l];
+      for (int d = 0; d < num_dim; ++d)
+      {
+        reference_coordinates[d][l] = ele.nodes()[n]->x()[d];
+        nodal_displacements[d][l] = element_displacements[num_dim * n + d];
+      }
+    }
+
+    // jacobian[c][k] = dX_c/dxi_k and displacement_gradient[c][k] = du_c/dxi_k at all Gauss points
+    std::array<std::array<TensorValues, num_dim>, num_dim> jacobian;
+    std::array<std::array<TensorValues, num_dim>, num_dim> displacement_gradient;
+    std::array<TensorValues, num_dim> gp_coordinates;
+    Core::LinAlg::Matrix<num_dim, 1> centroid(false);
+    for (int d = 0; d < num_dim; ++d)
+    {
+      jacobian[d] = evaluate_parameter_gradient(reference_coordinates[d]);
+      displacement_gradient[d] = evaluate_parameter_gradient(nodal_displacements[d]);
+      gp_coordinates[d] = interpolate(reference_coordinates[d]);
+      centroid(d) = reference_coordinates[d][lexicographic_index(1, 1, 1)];
+    }
+    params.set("elecenter_coords_ref", centroid);
+
+    Mat::So3Material& material = *ele.solid_material();
+    std::array<std::array<TensorValues, num_dim>, num_dim> force_integrand;
+    for (int gp = 0; gp < num_nodes; ++gp)
+    {
+      GaussPointLinearization linearization;
+      Core::LinAlg::Matrix<num_dim, num_dim> dudxi(false);
+      for (int c = 0; c < num_dim; ++c)
+      {
+        for (int k = 0; k < num_dim; ++k)
+        {
+          linearization.inverse_jacobian(c, k) = jacobian[c][k][gp];
+          dudxi(c, k) = displacement_gradient[c][k][gp];
+        }
+      }
+
+      const double determinant = linearization.inverse_jacobian.invert();
+      FOUR_C_ASSERT_ALWAYS(determinant > 0,
+          "determinant of jacobian is %f <= 0 at Gauss point %d of element %d.", determinant,
+          gauss_point_index_[gp], ele.id());
+      linearization.integration_factor = determinant * gauss_weight(gp);
+
+      Core::LinAlg::Matrix<num_dim, num_dim>& defgrd = linearization.deformation_gradient;
+      defgrd.multiply(dudxi, linearization.inverse_jacobian);
+      for (int d = 0; d < num_dim; ++d) defgrd(d, d) += 1.0;
+
+      Core::LinAlg::Matrix<num_dim, num_dim> cauchygreen(false);
+      cauchygreen.multiply_tn(defgrd, defgrd);
+      const Core::LinAlg::Matrix<num_str, 1> gl_strain =
+          evaluate_green_lagrange_strain(cauchygreen);
+
+      Core::LinAlg::Matrix<num_dim, 1> gp_coordinates_ref(false);
+      for (int d = 0; d < num_dim; ++d) gp_coordinates_ref(d) = gp_coordinates[d][gp];
+      params.set("gp_coords_ref", gp_coordinates_ref);
+
+      material.evaluate(&defgrd, &gl_strain, params, &linearization.pk2, &linearization.cmat,
+          gauss_point_index_[gp], ele.id());
+
+      Core::LinAlg::Matrix<num_dim, num_dim> pk1(false);
+      pk1.multiply(defgrd, stress_voigt_to_matrix(linearization.pk2));
+      Core::LinAlg::Matrix<num_dim, num_dim> integrand(false);
+      integrand.multiply_nt(linearization.integration_factor, pk1, linearization.inverse_jacobian);
+      for (int c = 0; c < num_dim; ++c)
+        for (int k = 0; k < num_dim; ++k) force_integrand[c][k][gp] = integrand(c, k);
+
+      if (evaluate_stiffness) gauss_points_[e * num_nodes + gp] = linearization;
+    }
+
+    strategy.clear_element_storage(la[row].size(), la[col].size());
+    if (strategy.assemblevec1())
+    {
+      std::array<TensorValues, num_dim> force{};
+      for (int c = 0; c < num_dim; ++c) integrate_parameter_gradient(force_integrand[c], force[c]);
+
+      Core::LinAlg::SerialDenseVector& elevec = strategy.elevector1();
+      for (int l = 0; l < num_nodes; ++l)
+        for (int c = 0; c < num_dim; ++c)
+          elevec(num_dim * lexicographic_nodes_[l] + c) = force[c][l];
+      strategy.assemble_vector1(la[row].lm_, la[row].lmowner_);
+    }
+
+    if (not evaluate_stiffness) continue;
+
+    for (int l = 0; l < num_nodes; ++l)
+    {
+      for (int c = 0; c < num_dim; ++c)
+      {
+        const int gid = la[row].lm_[num_dim * lexicographic_nodes_[l] + c];
+        local_col_dofs_[e][num_dim * l + c] = dof_col_map_.LID(gid);
+      }
+    }
+
+    // geometry of the sub-cells and their stiffness matrices for the preconditioner
+    const GaussPointLinearization* linearization = &gauss_points_[e * num_nodes];
+    std::vector<int> subcell_lm(num_dim * num_subcell_nodes);
+    std::vector<int> subcell_lmowner(num_dim * num_subcell_nodes);
+    const std::vector<int> subcell_stride(num_subcell_nodes, num_dim);
+    for (int s = 0; s < num_subcells; ++s)
+    {
+      SubcellGaussPoint* subcell_gauss_points =
+          &subcell_gauss_points_[(e * num_subcells + s) * num_subcells];
+      for (int g = 0; g < num_subcells; ++g)
+      {
+        Core::LinAlg::Matrix<num_dim, num_dim>& inverse_jacobian =
+            subcell_gauss_points[g].inverse_jacobian;
+        inverse_jacobian.clear();
+        for (int n = 0; n < num_subcell_nodes; ++n)
+          for (int c = 0; c < num_dim; ++c)
+            for (int k = 0; k < num_dim; ++k)
+              inverse_jacobian(c, k) +=
+                  reference_coordinates[c][reference.nodes[s][n]] * reference.derivatives[g](k, n);
+
+        const double determinant = inverse_jacobian.invert();
+        FOUR_C_ASSERT_ALWAYS(determinant > 0,
+            "determinant of jacobian is %f <= 0 in sub-cell %d of element %d.", determinant, s,
+            ele.id());
+        subcell_gauss_points[g].integration_factor = determinant;
+      }
+
+      strategy.clear_element_storage(num_dim * num_subcell_nodes, num_dim * num_subcell_nodes);
+      Core::LinAlg::SerialDenseMatrix& elemat = strategy.elematrix1();
+      for (int b = 0; b < num_dim * num_subcell_nodes; ++b)
+      {
+        SubcellValues unit{};
+        unit[b / num_dim][b % num_dim] = 1.0;
+        SubcellValues column{};
+        add_subcell_stiffness_action(s, linearization, subcell_gauss_points, unit, column);
+        for (int a = 0; a < num_dim * num_subcell_nodes; ++a)
+          elemat(a, b) = column[a / num_dim][a % num_dim];
+      }
+
+      for (int n = 0; n < num_subcell_nodes; ++n)
+      {
+        for (int c = 0; c < num_dim; ++c)
+        {
+          const int ele_dof = num_dim * lexicographic_nodes_[reference.nodes[s][n]] + c;
+          subcell_lm[num_dim * n + c] = la[row].lm_[ele_dof];
+          subcell_lmowner[num_dim * n + c] = la[row].lmowner_[ele_dof];
+        }
+      }
+      strategy.assemble_matrix1(ele.id(), subcell_lm, subcell_lm, subcell_lmowner, subcell_stride);
+    }
+  }
+
+  if (evaluate_stiffness) has_linearization_ = true;
+}
+
+void Discret::Elements::SolidMatrixFreeEvaluator::scale_linearization(const double scale)
+{
+  for (GaussPointLinearization& gauss_point : gauss_points_)
+    gauss_point.integration_factor *= scale;
+  for (SubcellGaussPoint& gauss_point : subcell_gauss_points_)
+    gauss_point.integration_factor *= scale;
+}
+
+void Discret::Elements::SolidMatrixFreeEvaluator::apply_stiffness_difference(
+    const Epetra_MultiVector& x, Epetra_MultiVector& y) const
+{
+  FOUR_C_ASSERT(has_linearization_, "The linearization has not been evaluated.");
+
+  Epetra_MultiVector x_col(dof_col_map_, x.NumVectors(), false);
+  x_col.Import(x, *importer_, Insert);
+  Epetra_MultiVector y_col(dof_col_map_, x.NumVectors(), true);
+
+  // every element contributes once, the contributions to dofs of other processors are exported
+  const int my_rank = dof_row_map_.Comm().MyPID();
+  const SubcellReference& reference = subcell_reference();
+  for (int v = 0; v < x.NumVectors(); ++v)
+  {
+    const double* x_values = x_col[v];
+    double* y_values = y_col[v];
+    for (std::size_t e = 0; e < elements_.size(); ++e)
+    {
+      if (elements_[e]->owner() != my_rank) continue;
+
+      const std::array<int, num_dof_per_ele>& dofs = local_col_dofs_[e];
+
+      std::array<TensorValues, num_dim> x_ele;
+      for (int l = 0; l < num_nodes; ++l)
+        for (int c = 0; c < num_dim; ++c) x_ele[c][l] = x_values[dofs[num_dim * l + c]];
+
+      std::array<TensorValues, num_dim> y_ele{};
+      const GaussPointLinearization* linearization = &gauss_points_[e * num_nodes];
+      add_stiffness_action(linearization, x_ele, y_ele);
+
+      for (int s = 0; s < num_subcells; ++s)
+      {
+        SubcellValues x_subcell;
+        for (int n = 0; n < num_subcell_nodes; ++n)
+          for (int c = 0; c < num_dim; ++c) x_subcell[n][c] = x_ele[c][reference.nodes[s][n]];
+
+        SubcellValues y_subcell{};
+        add_subcell_stiffness_action(s, linearization,
+            &subcell_gauss_points_[(e * num_subcells + s) * num_subcells], x_subcell, y_subcell);
+
+        for (int n = 0; n < num_subcell_nodes; ++n)
+          for (int c = 0; c < num_dim; ++c) y_ele[c][reference.nodes[s][n]] -= y_subcell[n][c];
+      }
+
+      for (int l = 0; l < num_nodes; ++l)
+        for (int c = 0; c < num_dim; ++c) y_values[dofs[num_dim * l + c]] += y_ele[c][l];
+    }
+  }
+
+  y.PutScalar(0.0);
+  y.Export(y_col, *importer_, Add);
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,175 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLID_3D_ELE_MATRIX_FREE_EVALUATOR_HPP
+#define FOUR_C_SOLID_3D_ELE_MATRIX_FREE_EVALUATOR_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_fixedsizematrix.hpp"
+
+#include <Epetra_Import.h>
+#include <Epetra_Map.h>
+#include <Epetra_MultiVector.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Teuchos
+{
+  class ParameterList;
+}
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE
+{
+  class AssembleStrategy;
+  class Discretization;
+}  // namespace Core::FE
+
+namespace Discret::Elements
+{
+  class Solid;
+
+  /*!
+   * @brief Apply the tangent stiffness of hex27 solid elements without assembling it
+   *
+   * The element matrices of hex27 elements couple 81 dofs with each other, hence the assembled
+   * stiffness matrix dominates the memory consumption and the sparse matrix-vector products are
+   * limited by the memory bandwidth. Instead, the linearization (inverse Jacobian, deformation
+   * gradient, stress and material tangent) is stored at the Gauss points during the evaluation of
+   * the stiffness and the action of the tangent stiffness on a vector is evaluated element by
+   * element. The gradients at the tensor-product Gauss points and the integration back to the
+   * nodes are evaluated by sum factorization, i.e., one dimension after the other.
+   *
+   * Iterative solvers still need an assembled matrix to build the preconditioner. Hence, the
+   * stiffness matrix of the low-order refined mesh is assembled instead of the hex27 stiffness
+   * matrix: every hex27 element is split into eight hex8 sub-cells using the same nodes, each
+   * integrated with the linearization of the nearest hex27 Gauss point. The exact operator is
+   * obtained by adding the difference of the hex27 and the sub-cell stiffness via
+   * apply_stiffness_difference().
+   *
+   * Supported are hex27 elements with nonlinear total Lagrangian kinematics without element
+   * technology and prestressing and the full 27 point Gauss rule. All other elements of the
+   * discretization are listed in remaining_element_col_map() and have to be evaluated by the usual
+   * element loop.
+   */
+  class SolidMatrixFreeEvaluator
+  {
+   public:
+    //! Collect the supported column elements of @p discretization.
+    explicit SolidMatrixFreeEvaluator(const Core::FE::Discretization& discretization);
+
+    //! Whether the tangent of element @p ele can be applied matrix-free.
+    static bool is_supported(const Solid& ele);
+
+    //! Whether the evaluator was set up for the current element column map of @p discretization.
+    [[nodiscard]] bool is_valid_for(const Core::FE::Discretization& discretization) const;
+
+    //! Column map of the elements that are not handled by this evaluator.
+    [[nodiscard]] const Epetra_Map& remaining_element_col_map() const
+    {
+      return *remaining_element_col_map_;
+    }
+
+    /*!
+     * @brief Evaluate the internal force vector of the supported elements and assemble it with
+     * @p strategy
+     *
+     * If the strategy assembles the first system matrix, the linearization at the Gauss points is
+     * stored and the stiffness matrix of the low-order refined sub-cells is assembled instead of
+     * the hex27 stiffness matrix. The displacements are taken from the state "displacement" of
+     * @p discretization.
+     */
+    void evaluate(Teuchos::ParameterList& params, const Core::FE::Discretization& discretization,
+        Core::FE::AssembleStrategy& strategy);
+
+    //! Whether the last stiffness evaluation went through this evaluator.
+    [[nodiscard]] bool has_linearization() const { return has_linearization_; }
+
+    //! Mark the stored linearization as outdated, e.g. if the stiffness was assembled as usual.
+    void invalidate_linearization() { has_linearization_ = false; }
+
+    //! Scale the stored linearization by @p scale, e.g. by the time integration factor of the
+    //! stiffness within the jacobian.
+    void scale_linearization(double scale);
+
+    /*!
+     * @brief Evaluate @p y = (K - K_lor) @p x
+     *
+     * K is the hex27 stiffness matrix and K_lor the stiffness matrix of the low-order refined
+     * sub-cells of the supported elements at the last stiffness evaluation. Both vectors are based
+     * on the dof row map of the discretization.
+     */
+    void apply_stiffness_difference(const Epetra_MultiVector& x, Epetra_MultiVector& y) const;
+
+    //! number of nodes of a hex27 element
+    static constexpr int num_nodes = 27;
+
+    //! number of displacement dofs of a hex27 element
+    static constexpr int num_dof_per_ele = 81;
+
+    //! number of hex8 sub-cells of a hex27 element and of Gauss points per sub-cell
+    static constexpr int num_subcells = 8;
+
+    //! linearization of the internal force at one Gauss point
+    struct GaussPointLinearization
+    {
+      //! inverse of the jacobian dX/dxi (rows: parameter coordinates)
+      Core::LinAlg::Matrix<3, 3> inverse_jacobian;
+      double integration_factor;
+      Core::LinAlg::Matrix<3, 3> deformation_gradient;
+      Core::LinAlg::Matrix<6, 1> pk2;
+      Core::LinAlg::Matrix<6, 6> cmat;
+    };
+
+    //! geometry of a sub-cell at one of its Gauss points
+    struct SubcellGaussPoint
+    {
+      Core::LinAlg::Matrix<3, 3> inverse_jacobian;
+      double integration_factor;
+    };
+
+   private:
+    std::vector<Solid*> elements_;
+
+    //! element node of every lexicographically ordered node
+    std::array<int, num_nodes> lexicographic_nodes_;
+
+    //! index in the Gauss rule of the element of every lexicographically ordered Gauss point
+    std::array<int, num_nodes> gauss_point_index_;
+
+    //! local column dofs of every element in lexicographic node order
+    std::vector<std::array<int, num_dof_per_ele>> local_col_dofs_;
+
+    //! linearization at the lexicographically ordered Gauss points of every element
+    std::vector<GaussPointLinearization> gauss_points_;
+
+    //! geometry at the Gauss points of the sub-cells of every element
+    std::vector<SubcellGaussPoint> subcell_gauss_points_;
+
+    bool has_linearization_ = false;
+
+    //! element column map the evaluator was set up for
+    Epetra_Map element_col_map_;
+
+    std::shared_ptr<Epetra_Map> remaining_element_col_map_;
+
+    Epetra_Map dof_row_map_;
+
+    Epetra_Map dof_col_map_;
+
+    //! import of the dof row map into the dof column map
+    std::shared_ptr<Epetra_Import> importer_;
+  };
+}  // namespace Discret::Elements
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -617,7 +617,9 @@ std::string NOX::Nln::Aux::get_direction_method_list_name(const Teuchos::Paramet
   {
     dir_str = &pdir.get<std::string>("User Defined Method");
   }
-  if (*dir_str == "Newton" or *dir_str == "Modified Newton")
+  // the quasi-Newton directions share the linear solver of the Newton direction
+  if (*dir_str == "Newton" or *dir_str == "Modified Newton" or *dir_str == "L-BFGS" or
+      *dir_str == "Broyden")
     return "Newton";
   else
   {
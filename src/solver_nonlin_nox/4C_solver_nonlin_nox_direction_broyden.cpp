@@ -0,0 +1,85 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_solver_nonlin_nox_direction_broyden.hpp"
+
+#include "4C_solver_nonlin_nox_group.hpp"
+
+#include <cmath>
+#include <limits>
+
+FOUR_C_NAMESPACE_OPEN
+
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+NOX::Nln::Direction::Broyden::Broyden(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& p)
+    : ModifiedNewton(gd, p)
+{
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool NOX::Nln::Direction::Broyden::compute_with_reused_jacobian(::NOX::Abstract::Vector& dir,
+    NOX::Nln::Group& group, const ::NOX::Abstract::Vector& step,
+    const ::NOX::Abstract::Vector& yvec, const ::NOX::Abstract::Vector& prev_dir)
+{
+  // q = H_k F_{k+1}
+  Teuchos::RCP<::NOX::Abstract::Vector> q = group.getF().clone(::NOX::ShapeCopy);
+  apply_reused_jacobian_inverse(group, group.getF(), *q);
+  apply_updates(u_, s_, *q);
+
+  return update(u_, s_, step, *q, prev_dir, dir);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool NOX::Nln::Direction::Broyden::update(std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& u,
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s, const ::NOX::Abstract::Vector& step,
+    const ::NOX::Abstract::Vector& q, const ::NOX::Abstract::Vector& prev_dir,
+    ::NOX::Abstract::Vector& dir)
+{
+  // H_k y_k = H_k F_{k+1} - H_k F_k = q + prev_dir
+  Teuchos::RCP<::NOX::Abstract::Vector> uk = q.clone();
+  uk->update(1.0, prev_dir, 1.0);
+
+  const double shy = step.innerProduct(*uk);
+  if (std::abs(shy) <= std::sqrt(std::numeric_limits<double>::epsilon()) * step.norm() * uk->norm())
+    return false;
+
+  uk->update(1.0, step, -1.0);
+  uk->scale(1.0 / shy);
+  u.push_back(uk);
+  s.push_back(step.clone());
+
+  // dir = -H_{k+1} F_{k+1}
+  dir = q;
+  dir.update(step.innerProduct(q), *uk, 1.0);
+  dir.scale(-1.0);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::Broyden::apply_updates(
+    const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& u,
+    const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s, ::NOX::Abstract::Vector& w)
+{
+  for (std::size_t j = 0; j < u.size(); ++j) w.update(s[j]->innerProduct(w), *u[j], 1.0);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::Broyden::reset_updates()
+{
+  u_.clear();
+  s_.clear();
+}
+
+FOUR_C_NAMESPACE_CLOSE
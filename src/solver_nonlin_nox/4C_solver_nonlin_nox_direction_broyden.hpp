@@ -0,0 +1,87 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_BROYDEN_HPP
+#define FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_BROYDEN_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_solver_nonlin_nox_direction_modified_newton.hpp"  // base class
+
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace Nln
+  {
+    namespace Direction
+    {
+      /*!
+       \brief Broyden direction based on the reused jacobian
+
+       The inverse of the reused jacobian H_0 is corrected by the rank-one updates of Broyden's
+       ("good") method
+
+         H_{k+1} = H_k + (s_k - H_k y_k) s_k^T H_k / (s_k^T H_k y_k),
+
+       which are stored as pairs of vectors and applied recursively. Since the last direction is
+       -H_k F_k, the product H_k y_k only needs a single solve with the reused jacobian. The stored
+       updates are discarded with each new evaluation of the jacobian. A nearly singular update
+       triggers a new evaluation of the jacobian.
+
+       Reference: C.T. Kelley: Iterative Methods for Linear and Nonlinear Equations, SIAM, 1995,
+       Section 7.3.
+       */
+      class Broyden : public ModifiedNewton
+      {
+       public:
+        //! Constructor
+        Broyden(const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params);
+
+        //! apply the updates @p u, @p s (oldest first) to w = H_0 v, i.e., w = H_k v on return
+        static void apply_updates(const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& u,
+            const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s,
+            ::NOX::Abstract::Vector& w);
+
+        /*! \brief Append the update of the step @p step to @p u, @p s and compute the new
+                   direction @p dir = -H_{k+1} F_{k+1}
+
+            @param q  H_k F_{k+1}
+            @param prev_dir  last direction -H_k F_k
+
+            Return false without any update if the update is nearly singular.
+         */
+        static bool update(std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& u,
+            std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s,
+            const ::NOX::Abstract::Vector& step, const ::NOX::Abstract::Vector& q,
+            const ::NOX::Abstract::Vector& prev_dir, ::NOX::Abstract::Vector& dir);
+
+       protected:
+        bool compute_with_reused_jacobian(::NOX::Abstract::Vector& dir, NOX::Nln::Group& group,
+            const ::NOX::Abstract::Vector& step, const ::NOX::Abstract::Vector& yvec,
+            const ::NOX::Abstract::Vector& prev_dir) override;
+
+        void reset_updates() override;
+
+        std::string name() const override { return "Broyden"; }
+
+       private:
+        //! (s_k - H_k y_k) / (s_k^T H_k y_k) of the stored updates, oldest first
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> u_;
+
+        //! steps s_k of the stored updates, oldest first
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> s_;
+      };
+    }  // namespace Direction
+  }  // namespace Nln
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
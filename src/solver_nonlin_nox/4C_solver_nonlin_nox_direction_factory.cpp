@@ -7,6 +7,9 @@
 
 #include "4C_solver_nonlin_nox_direction_factory.hpp"
 
+#include "4C_solver_nonlin_nox_direction_broyden.hpp"
+#include "4C_solver_nonlin_nox_direction_lbfgs.hpp"
+#include "4C_solver_nonlin_nox_direction_modified_newton.hpp"
 #include "4C_solver_nonlin_nox_direction_newton.hpp"
 
 FOUR_C_NAMESPACE_OPEN
@@ -28,6 +31,12 @@ Teuchos::RCP<::NOX::Direction::Generic> NOX::Nln::Direction::Factory::buildDirec
 
   if (method == "Newton")
     direction = Teuchos::make_rcp<Newton>(gd, params);
+  else if (method == "Modified Newton")
+    direction = Teuchos::make_rcp<ModifiedNewton>(gd, params);
+  else if (method == "L-BFGS")
+    direction = Teuchos::make_rcp<LBFGS>(gd, params);
+  else if (method == "Broyden")
+    direction = Teuchos::make_rcp<Broyden>(gd, params);
   else
   {
     std::ostringstream msg;
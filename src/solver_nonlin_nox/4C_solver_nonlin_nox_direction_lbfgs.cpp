@@ -0,0 +1,90 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_solver_nonlin_nox_direction_lbfgs.hpp"
+
+#include "4C_solver_nonlin_nox_group.hpp"
+
+#include <cmath>
+#include <limits>
+
+FOUR_C_NAMESPACE_OPEN
+
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+NOX::Nln::Direction::LBFGS::LBFGS(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& p)
+    : ModifiedNewton(gd, p)
+{
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool NOX::Nln::Direction::LBFGS::compute_with_reused_jacobian(::NOX::Abstract::Vector& dir,
+    NOX::Nln::Group& group, const ::NOX::Abstract::Vector& step,
+    const ::NOX::Abstract::Vector& yvec, const ::NOX::Abstract::Vector& prev_dir)
+{
+  // store the new pair only if it satisfies the curvature condition
+  const double sy = step.innerProduct(yvec);
+  if (sy > std::sqrt(std::numeric_limits<double>::epsilon()) * step.norm() * yvec.norm())
+  {
+    s_.push_back(step.clone());
+    y_.push_back(yvec.clone());
+    rho_.push_back(1.0 / sy);
+  }
+
+  // the inverse of the reused jacobian is the initial inverse hessian
+  two_loop_recursion(s_, y_, rho_, group.getF(),
+      [&](const ::NOX::Abstract::Vector& v, ::NOX::Abstract::Vector& w)
+      { apply_reused_jacobian_inverse(group, v, w); }, dir);
+
+  dir.scale(-1.0);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::LBFGS::two_loop_recursion(
+    const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s,
+    const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& y, const std::vector<double>& rho,
+    const ::NOX::Abstract::Vector& f,
+    const std::function<void(const ::NOX::Abstract::Vector&, ::NOX::Abstract::Vector&)>& apply_h0,
+    ::NOX::Abstract::Vector& result)
+{
+  const int m = s.size();
+  std::vector<double> alpha(m);
+
+  // first loop, newest pair first
+  Teuchos::RCP<::NOX::Abstract::Vector> q = f.clone();
+  for (int i = m - 1; i >= 0; --i)
+  {
+    alpha[i] = rho[i] * s[i]->innerProduct(*q);
+    q->update(-alpha[i], *y[i], 1.0);
+  }
+
+  apply_h0(*q, result);
+
+  // second loop, oldest pair first
+  for (int i = 0; i < m; ++i)
+  {
+    const double beta = rho[i] * y[i]->innerProduct(result);
+    result.update(alpha[i] - beta, *s[i], 1.0);
+  }
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::LBFGS::reset_updates()
+{
+  s_.clear();
+  y_.clear();
+  rho_.clear();
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,82 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_LBFGS_HPP
+#define FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_LBFGS_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_solver_nonlin_nox_direction_modified_newton.hpp"  // base class
+
+#include <functional>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace Nln
+  {
+    namespace Direction
+    {
+      /*!
+       \brief Limited-memory BFGS direction based on the reused jacobian
+
+       The inverse of the reused jacobian is the initial inverse hessian of the two-loop recursion
+       of the limited-memory BFGS method. The stored pairs of steps and changes of the right-hand
+       side are discarded with each new evaluation of the jacobian, hence the memory is limited by
+       the "Restart Frequency". Pairs violating the curvature condition are skipped.
+
+       Reference: J. Nocedal, S.J. Wright: Numerical Optimization, 2nd edition, Springer, 2006,
+       Algorithm 7.4.
+       */
+      class LBFGS : public ModifiedNewton
+      {
+       public:
+        //! Constructor
+        LBFGS(const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params);
+
+        /*! \brief Two-loop recursion: @p result = H_k @p f
+
+            @param s  stored steps, oldest first
+            @param y  stored changes of the right-hand side, oldest first
+            @param rho  1 / (y^T s) of the stored pairs
+            @param apply_h0  applies the initial inverse hessian: apply_h0(v, w) sets w = H_0 v
+         */
+        static void two_loop_recursion(const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& s,
+            const std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>& y,
+            const std::vector<double>& rho, const ::NOX::Abstract::Vector& f,
+            const std::function<void(const ::NOX::Abstract::Vector&, ::NOX::Abstract::Vector&)>&
+                apply_h0,
+            ::NOX::Abstract::Vector& result);
+
+       protected:
+        bool compute_with_reused_jacobian(::NOX::Abstract::Vector& dir, NOX::Nln::Group& group,
+            const ::NOX::Abstract::Vector& step, const ::NOX::Abstract::Vector& yvec,
+            const ::NOX::Abstract::Vector& prev_dir) override;
+
+        void reset_updates() override;
+
+        std::string name() const override { return "L-BFGS"; }
+
+       private:
+        //! stored steps, oldest first
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> s_;
+
+        //! stored changes of the right-hand side, oldest first
+        std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> y_;
+
+        //! 1 / (y^T s) of the stored pairs
+        std::vector<double> rho_;
+      };
+    }  // namespace Direction
+  }  // namespace Nln
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
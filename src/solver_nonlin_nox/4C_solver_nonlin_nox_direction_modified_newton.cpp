@@ -0,0 +1,155 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_solver_nonlin_nox_direction_modified_newton.hpp"
+
+#include "4C_solver_nonlin_nox_group.hpp"
+
+#include <NOX_Epetra_Vector.H>
+#include <NOX_GlobalData.H>
+#include <NOX_Solver_Generic.H>
+#include <NOX_Utils.H>
+
+FOUR_C_NAMESPACE_OPEN
+
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+NOX::Nln::Direction::ModifiedNewton::ModifiedNewton(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& p)
+    : Newton(gd, p), utils_(gd->getUtils()), params_(&p)
+{
+  Teuchos::ParameterList& pqn = p.sublist("Quasi-Newton");
+  restart_frequency_ = pqn.get<int>("Restart Frequency", 10);
+  max_convergence_rate_ = pqn.get<double>("Max Convergence Rate", 0.5);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool NOX::Nln::Direction::ModifiedNewton::compute(::NOX::Abstract::Vector& dir,
+    ::NOX::Abstract::Group& group, const ::NOX::Solver::Generic& solver)
+{
+  // dynamic cast of the nox_abstract_group
+  NOX::Nln::Group* nlnSoln = dynamic_cast<NOX::Nln::Group*>(&group);
+
+  if (nlnSoln == nullptr)
+  {
+    throw_error("compute", "dynamic_cast to nox_nln_group failed!");
+  }
+
+  bool reuse = solver.getNumIterations() > 0 and !prev_x_.is_null() and
+               num_reused_ < restart_frequency_;
+
+  if (reuse)
+  {
+    // Compute only F at current solution.
+    if (nlnSoln->computeF() != ::NOX::Abstract::Group::Ok)
+      throw_error("compute", "Unable to compute F");
+
+    // fall back to a full Newton step if the convergence rate degrades
+    if (group.getF().norm() > max_convergence_rate_ * prev_norm_f_)
+    {
+      reuse = false;
+    }
+    else
+    {
+      Teuchos::RCP<::NOX::Abstract::Vector> step = group.getX().clone();
+      step->update(-1.0, *prev_x_, 1.0);
+      Teuchos::RCP<::NOX::Abstract::Vector> yvec = group.getF().clone();
+      yvec->update(-1.0, *prev_f_, 1.0);
+
+      reuse = compute_with_reused_jacobian(dir, *nlnSoln, *step, *yvec, *prev_dir_);
+    }
+  }
+
+  if (reuse)
+  {
+    ++num_reused_;
+  }
+  else
+  {
+    reset_updates();
+    num_reused_ = 0;
+
+    if (not Newton::compute(dir, group, solver)) return false;
+  }
+
+  if (utils_->isPrintType(::NOX::Utils::Details))
+  {
+    utils_->out() << "NOX::Nln::Direction::" << name() << " - "
+                  << (reuse ? "reused jacobian" : "new jacobian") << " (" << num_reused_
+                  << " iterations since the last evaluation)\n";
+  }
+
+  // store the current state for the next iteration
+  prev_norm_f_ = group.getF().norm();
+  if (prev_x_.is_null())
+  {
+    prev_x_ = group.getX().clone();
+    prev_f_ = group.getF().clone();
+    prev_dir_ = dir.clone();
+  }
+  else
+  {
+    *prev_x_ = group.getX();
+    *prev_f_ = group.getF();
+    *prev_dir_ = dir;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool NOX::Nln::Direction::ModifiedNewton::compute_with_reused_jacobian(
+    ::NOX::Abstract::Vector& dir, NOX::Nln::Group& group, const ::NOX::Abstract::Vector& step,
+    const ::NOX::Abstract::Vector& yvec, const ::NOX::Abstract::Vector& prev_dir)
+{
+  apply_reused_jacobian_inverse(group, group.getF(), dir);
+  dir.scale(-1.0);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::ModifiedNewton::apply_reused_jacobian_inverse(NOX::Nln::Group& group,
+    const ::NOX::Abstract::Vector& input, ::NOX::Abstract::Vector& result)
+{
+  Teuchos::ParameterList& lsparams = params_->sublist("Newton").sublist("Linear Solver");
+
+  // The jacobian of the shared linear system has not been touched since its last evaluation,
+  // hence we declare it valid for the current solution just for this solve.
+  lsparams.set<bool>("Reuse Jacobian", true);
+  group.set_is_valid_jacobian(true);
+
+  const ::NOX::Abstract::Group::ReturnType status =
+      group.applyJacobianInverse(lsparams, dynamic_cast<const ::NOX::Epetra::Vector&>(input),
+          dynamic_cast<::NOX::Epetra::Vector&>(result));
+
+  group.set_is_valid_jacobian(false);
+  lsparams.set<bool>("Reuse Jacobian", false);
+
+  if (status != ::NOX::Abstract::Group::Ok and utils_->isPrintType(::NOX::Utils::Warning))
+  {
+    utils_->out() << "NOX::Nln::Direction::" << name()
+                  << " - the linear solve with the reused jacobian failed\n";
+  }
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void NOX::Nln::Direction::ModifiedNewton::throw_error(
+    const std::string& functionName, const std::string& errorMsg) const
+{
+  if (utils_->isPrintType(::NOX::Utils::Error))
+    utils_->err() << "NOX::Nln::Direction::" << name() << "::" << functionName << " - "
+                  << errorMsg << std::endl;
+  throw "NOX Error";
+}
+
+FOUR_C_NAMESPACE_CLOSE
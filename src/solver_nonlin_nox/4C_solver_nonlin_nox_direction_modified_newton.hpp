@@ -0,0 +1,113 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_MODIFIED_NEWTON_HPP
+#define FOUR_C_SOLVER_NONLIN_NOX_DIRECTION_MODIFIED_NEWTON_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_solver_nonlin_nox_direction_newton.hpp"  // base class
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace Nln
+  {
+    class Group;
+
+    namespace Direction
+    {
+      /*!
+       \brief Newton direction with a reused jacobian
+
+       The jacobian is only evaluated in the first iteration of each nonlinear solve. In the
+       following iterations, only the right-hand side is evaluated and the linear system is solved
+       with the jacobian of the last evaluation, i.e., a direct solver keeps its factorization and
+       an iterative solver its preconditioner. Derived classes improve the reused jacobian by
+       quasi-Newton updates.
+
+       A full Newton step with a new jacobian is done if
+       - the norm of the right-hand side was not reduced by the factor "Max Convergence Rate"
+         compared to the last iteration, or
+       - the jacobian has been reused in "Restart Frequency" iterations.
+
+       Both parameters are read from the "Quasi-Newton" sub-list of the "Direction" list. The
+       linear solver settings are shared with the "Newton" direction.
+       */
+      class ModifiedNewton : public Newton
+      {
+       public:
+        //! Constructor
+        ModifiedNewton(const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params);
+
+        bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group,
+            const ::NOX::Solver::Generic& solver) override;
+
+       protected:
+        /*! \brief Compute the direction @p dir at the current iterate with the reused jacobian
+
+            @param step   last step x_k - x_{k-1}
+            @param yvec   change of the right-hand side F_k - F_{k-1} over the last step
+            @param prev_dir  last direction (before scaling with the step length)
+
+            The right-hand side of @p group is up to date. Return false to request a new
+            evaluation of the jacobian instead.
+         */
+        virtual bool compute_with_reused_jacobian(::NOX::Abstract::Vector& dir,
+            NOX::Nln::Group& group, const ::NOX::Abstract::Vector& step,
+            const ::NOX::Abstract::Vector& yvec, const ::NOX::Abstract::Vector& prev_dir);
+
+        //! Forget all updates of the reused jacobian, since a new jacobian is evaluated.
+        virtual void reset_updates() {}
+
+        //! Solve the linear system with the reused jacobian: @p result = J^{-1} @p input
+        void apply_reused_jacobian_inverse(NOX::Nln::Group& group,
+            const ::NOX::Abstract::Vector& input, ::NOX::Abstract::Vector& result);
+
+        //! name of the direction for the screen output
+        virtual std::string name() const { return "Modified Newton"; }
+
+       private:
+        // throw NOX error
+        void throw_error(const std::string& functionName, const std::string& errorMsg) const;
+
+       private:
+        //! NOX_Utils pointer
+        Teuchos::RCP<::NOX::Utils> utils_;
+
+        //! direction parameter list
+        Teuchos::ParameterList* params_;
+
+        //! maximum number of iterations with the same jacobian
+        int restart_frequency_;
+
+        //! maximum ratio of the right-hand side norms of two consecutive iterations
+        double max_convergence_rate_;
+
+        //! number of iterations since the last evaluation of the jacobian
+        int num_reused_ = 0;
+
+        //! norm of the right-hand side of the last iteration
+        double prev_norm_f_ = 0.0;
+
+        //! last iterate
+        Teuchos::RCP<::NOX::Abstract::Vector> prev_x_;
+
+        //! right-hand side of the last iterate
+        Teuchos::RCP<::NOX::Abstract::Vector> prev_f_;
+
+        //! last direction
+        Teuchos::RCP<::NOX::Abstract::Vector> prev_dir_;
+      };
+    }  // namespace Direction
+  }  // namespace Nln
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
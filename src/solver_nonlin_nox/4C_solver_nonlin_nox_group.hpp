@@ -190,6 +190,9 @@ namespace NOX
       /// allow to set isValidRHS manually
       inline void set_is_valid_rhs(const bool value) { isValidRHS = value; };
 
+      /// allow to set isValidJacobian manually, e.g. to reuse the jacobian of a previous iterate
+      inline void set_is_valid_jacobian(const bool value) { isValidJacobian = value; };
+
      protected:
       //! resets the isValid flags to false
       void resetIsValid() override;
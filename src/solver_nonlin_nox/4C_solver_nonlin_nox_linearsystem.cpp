@@ -326,8 +326,11 @@ bool NOX::Nln::LinearSystem::applyJacobianInverse(Teuchos::ParameterList& linear
     if (iter == -10)
       throw_error("applyJacobianInverse", "\"Number of Nonlinear Iterations\" was not specified");
 
-    solver_params.refactor = true;
-    solver_params.reset = iter == 0;
+    // a reused jacobian keeps the factorization or preconditioner of the last solve
+    const bool reuse_jacobian = linearSolverParams.get<bool>("Reuse Jacobian", false);
+    solver_params.refactor = not reuse_jacobian;
+    solver_params.reset = iter == 0 and not reuse_jacobian;
+    solver_params.reuse_preconditioner = reuse_jacobian;
 
     auto matrix = Core::Utils::shared_ptr_from_ref(*linProblem.GetOperator());
 
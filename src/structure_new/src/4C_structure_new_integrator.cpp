@@ -260,7 +260,8 @@ void Solid::Integrator::equilibrate_initial_state()
   std::string dir_str = p_nox.sublist("Direction").get<std::string>("Method");
   if (dir_str == "User Defined")
     dir_str = p_nox.sublist("Direction").get<std::string>("User Defined Method");
-  if (dir_str != "Newton" and dir_str != "Modified Newton")
+  if (dir_str != "Newton" and dir_str != "Modified Newton" and dir_str != "L-BFGS" and
+      dir_str != "Broyden")
     FOUR_C_THROW(
         "The EquilibriateState predictor is currently only working for the "
         "direction-method \"Newton\".");
@@ -14,6 +14,7 @@
 #include "4C_io.hpp"
 #include "4C_io_control.hpp"
 #include "4C_io_gmsh.hpp"
+#include "4C_io_performance_telemetry.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_linalg_blocksparsematrix.hpp"
 #include "4C_linalg_vector.hpp"
@@ -113,6 +114,14 @@ void Solid::TimeInt::Base::setup()
     if (dataglobalstate_->get_my_rank() == 0) initialize_energy_file_stream_and_write_headers();
   }
 
+  // Initialize the output of the performance metrics of every time step
+  if (Global::Problem::instance()->io_params().get<bool>("PERFORMANCE_TELEMETRY"))
+  {
+    performance_telemetry_ = std::make_shared<Core::IO::PerformanceTelemetry>(
+        dataglobalstate_->get_comm(), *Global::Problem::instance()->output_control_file(),
+        "performance");
+  }
+
   issetup_ = true;
 }
 
@@ -301,6 +310,8 @@ void Solid::TimeInt::Base::set_number_of_nonlinear_iterations()
   }
 
   dataglobalstate_->set_nln_iteration_number(nlniter);
+  Core::IO::PerformanceTelemetry::record(
+      Core::IO::PerformanceTelemetry::nonlinear_iterations, nlniter);
 }
 
 /*----------------------------------------------------------------------------*
@@ -464,10 +475,20 @@ void Solid::TimeInt::Base::prepare_output(bool force_prepare_timestep)
 void Solid::TimeInt::Base::output(bool forced_writerestart)
 {
   check_init_setup();
-  output_step(forced_writerestart);
-  // write Gmsh output
-  write_gmsh_struct_output_step();
-  int_ptr_->post_output();
+  {
+    Core::IO::PerformanceTelemetry::ScopedTimer telemetry_timer(
+        Core::IO::PerformanceTelemetry::output_time);
+    output_step(forced_writerestart);
+    // write Gmsh output
+    write_gmsh_struct_output_step();
+    int_ptr_->post_output();
+  }
+
+  if (performance_telemetry_)
+  {
+    performance_telemetry_->write_step(
+        data_global_state().get_time_n(), data_global_state().get_step_n());
+  }
 }
 
 /*----------------------------------------------------------------------------*
@@ -28,6 +28,10 @@ class Epetra_Map;
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace Core::IO
+{
+  class PerformanceTelemetry;
+}  // namespace Core::IO
 namespace Core::LinAlg
 {
   class BlockSparseMatrixBase;
@@ -883,6 +887,9 @@ namespace Solid
 
       /// pointer to the dirichlet boundary condition handler
       std::shared_ptr<Solid::Dbc> dbc_ptr_;
+
+      /// writer of the performance metrics of every time step (only if requested)
+      std::shared_ptr<Core::IO::PerformanceTelemetry> performance_telemetry_;
     };  // class Base
   }  // namespace TimeInt
 }  // namespace Solid
@@ -34,9 +34,14 @@ Solid::TimeInt::BaseDataSDyn::BaseDataSDyn()
       masslintype_(Inpar::Solid::MassLin::ml_none),
       lumpmass_(false),
       neglectinertia_(false),
+      explfastpath_(false),
+      explcritdtfactor_(-1.0),
+      explcritdtinterval_(0),
       modeltypes_(nullptr),
       eletechs_(nullptr),
       coupling_model_ptr_(nullptr),
+      eleblockeval_(false),
+      matrixfreetangent_(false),
       dyntype_(Inpar::Solid::dyna_statics),
       stcscale_(Inpar::Solid::stc_inactive),
       stclayer_(-1),
@@ -142,11 +147,21 @@ void Solid::TimeInt::BaseDataSDyn::init(const std::shared_ptr<Core::FE::Discreti
     neglectinertia_ = sdynparams.get<bool>("NEGLECTINERTIA");
   }
   // ---------------------------------------------------------------------------
+  // initialize the explicit fast path control parameters
+  // ---------------------------------------------------------------------------
+  {
+    explfastpath_ = sdynparams.get<bool>("EXPLICIT_FAST_PATH");
+    explcritdtfactor_ = sdynparams.get<double>("EXPLICIT_CRIT_DT_FACTOR");
+    explcritdtinterval_ = sdynparams.get<int>("EXPLICIT_CRIT_DT_INTERVAL");
+  }
+  // ---------------------------------------------------------------------------
   // initialize model evaluator control parameters
   // ---------------------------------------------------------------------------
   {
     modeltypes_ = modeltypes;
     eletechs_ = eletechs;
+    eleblockeval_ = sdynparams.get<bool>("ELEMENT_BLOCK_EVALUATION");
+    matrixfreetangent_ = sdynparams.get<bool>("MATRIX_FREE_TANGENT");
     if (modeltypes_->find(Inpar::Solid::model_partitioned_coupling) != modeltypes->end())
     {
       if (modeltypes_->find(Inpar::Solid::model_monolithic_coupling) != modeltypes->end())
@@ -307,6 +307,30 @@ namespace Solid
       }
       ///@}
 
+      /// @name Get explicit fast path control parameters (read only access)
+      ///@{
+      /// integrate explicit dynamics with the inverted lumped mass matrix only?
+      bool is_explicit_fast_path() const
+      {
+        check_init_setup();
+        return explfastpath_;
+      }
+
+      /// Returns factor of the critical time step size (inactive if not positive)
+      double get_explicit_crit_dt_factor() const
+      {
+        check_init_setup();
+        return explcritdtfactor_;
+      }
+
+      /// Returns step interval to re-estimate the critical time step size
+      int get_explicit_crit_dt_interval() const
+      {
+        check_init_setup();
+        return explcritdtinterval_;
+      }
+      ///@}
+
       /// @name Get model evaluator control parameters (read only access)
       ///@{
       /// Returns types of the current models
@@ -328,6 +352,20 @@ namespace Solid
 
       /// check if the given element technology is active.
       bool have_ele_tech(const Inpar::Solid::EleTech& eletech) const;
+
+      /// evaluate supported solid elements in blocks of several elements at once?
+      bool is_element_block_evaluation() const
+      {
+        check_init_setup();
+        return eleblockeval_;
+      }
+
+      /// apply the tangent stiffness of supported solid elements matrix-free?
+      bool is_matrix_free_tangent() const
+      {
+        check_init_setup();
+        return matrixfreetangent_;
+      }
       ///@}
 
       /// @name Get model specific data container
@@ -733,6 +771,18 @@ namespace Solid
       bool neglectinertia_;
       ///@}
 
+      /// @name Explicit fast path control parameters
+      ///@{
+      /// integrate explicit dynamics with the inverted lumped mass matrix only?
+      bool explfastpath_;
+
+      /// factor of the critical time step size (inactive if not positive)
+      double explcritdtfactor_;
+
+      /// step interval to re-estimate the critical time step size
+      int explcritdtinterval_;
+      ///@}
+
       /// @name Model evaluator control parameters
       ///@{
 
@@ -745,6 +795,12 @@ namespace Solid
       /// pointer to the coupling model evaluator object
       std::shared_ptr<Solid::ModelEvaluator::Generic> coupling_model_ptr_;
 
+      /// evaluate supported solid elements in blocks of several elements at once
+      bool eleblockeval_;
+
+      /// apply the tangent stiffness of supported solid elements matrix-free
+      bool matrixfreetangent_;
+
       ///@}
 
       /// @name implicit and explicit time integrator parameters
@@ -81,16 +81,22 @@ void Solid::EXPLICIT::CentrDiff::set_state(const Core::LinAlg::Vector<double>& x
   global_state().get_acc_np()->Scale(1.0, *accnp_ptr);
 
   // ---------------------------------------------------------------------------
-  // new half-point velocities
+  // new half-point velocities and new end-point displacements (fused update)
   // ---------------------------------------------------------------------------
-  global_state().get_vel_np()->Update(1.0, *global_state().get_vel_n(), 0.0);
-  global_state().get_vel_np()->Update(dthalf, *global_state().get_acc_n(), 1.0);
-
-  // ---------------------------------------------------------------------------
-  // new end-point displacements
-  // ---------------------------------------------------------------------------
-  global_state().get_dis_np()->Update(1.0, *global_state().get_dis_n(), 0.0);
-  global_state().get_dis_np()->Update(dt, *global_state().get_vel_np(), 1.0);
+  {
+    const double* veln = global_state().get_vel_n()->Values();
+    const double* accn = global_state().get_acc_n()->Values();
+    const double* disn = global_state().get_dis_n()->Values();
+    double* velnp = global_state().get_vel_np()->Values();
+    double* disnp = global_state().get_dis_np()->Values();
+
+    const int numdof = global_state().get_dis_np()->MyLength();
+    for (int i = 0; i < numdof; ++i)
+    {
+      velnp[i] = veln[i] + dthalf * accn[i];
+      disnp[i] = disn[i] + dt * velnp[i];
+    }
+  }
 
   // ---------------------------------------------------------------------------
   // update the elemental state
@@ -164,10 +170,16 @@ void Solid::EXPLICIT::CentrDiff::update_step_state()
   //    fviscous_{n} := fviscous_{n+1}
   fviscon_ptr_->Scale(1.0, *fvisconp_ptr_);
 
-  // recompute the velocity to account for new acceleration
-  global_state().get_vel_np()->Update(1.0, *global_state().get_vel_n(), 0.0);
-  global_state().get_vel_np()->Update(dthalf, *global_state().get_acc_n(), 1.0);
-  global_state().get_vel_np()->Update(dthalf, *global_state().get_acc_np(), 1.0);
+  // recompute the velocity to account for new acceleration (fused update)
+  {
+    const double* veln = global_state().get_vel_n()->Values();
+    const double* accn = global_state().get_acc_n()->Values();
+    const double* accnp = global_state().get_acc_np()->Values();
+    double* velnp = global_state().get_vel_np()->Values();
+
+    const int numdof = global_state().get_vel_np()->MyLength();
+    for (int i = 0; i < numdof; ++i) velnp[i] = veln[i] + dthalf * accn[i] + dthalf * accnp[i];
+  }
 
   // ---------------------------------------------------------------------------
   // update model specific variables
@@ -7,13 +7,21 @@
 
 #include "4C_structure_new_timint_explicit.hpp"
 
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
 #include "4C_solver_nonlin_nox_group.hpp"
 #include "4C_solver_nonlin_nox_linearsystem.hpp"
+#include "4C_structure_new_dbc.hpp"
+#include "4C_structure_new_model_evaluator_manager.hpp"
+#include "4C_structure_new_model_evaluator_structure.hpp"
 #include "4C_structure_new_nln_solver_factory.hpp"
+#include "4C_structure_new_timint_basedataglobalstate.hpp"
 #include "4C_structure_new_timint_noxinterface.hpp"
 
 #include <NOX_Abstract_Group.H>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------------*
@@ -36,6 +44,16 @@ void Solid::TimeInt::Explicit::setup()
   // ---------------------------------------------------------------------------
   explint_ptr_ = std::dynamic_pointer_cast<Solid::EXPLICIT::Generic>(integrator_ptr());
   // ---------------------------------------------------------------------------
+  // the explicit fast path needs neither NOX interface nor non-linear solver
+  // ---------------------------------------------------------------------------
+  if (data_sdyn().is_explicit_fast_path())
+  {
+    setup_fast_path();
+    // set setup flag
+    issetup_ = true;
+    return;
+  }
+  // ---------------------------------------------------------------------------
   // build NOX interface
   // ---------------------------------------------------------------------------
   std::shared_ptr<Solid::TimeInt::NoxInterface> noxinterface_ptr =
@@ -63,11 +81,85 @@ void Solid::TimeInt::Explicit::setup()
 }
 
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void Solid::TimeInt::Explicit::setup_fast_path()
+{
+  if (not data_sdyn().is_mass_lumping())
+    FOUR_C_THROW("The explicit fast path requires a lumped mass matrix (set LUMPMASS)!");
+
+  if (data_sdyn().get_model_types().size() != 1)
+    FOUR_C_THROW("The explicit fast path is restricted to the pure structural model!");
+
+  if (dbc().loc_sys_manager_ptr() != nullptr)
+    FOUR_C_THROW("Local coordinate systems are not supported by the explicit fast path!");
+
+  if (data_sdyn().get_explicit_crit_dt_factor() > 0.0 and
+      method_name() == Inpar::Solid::dyna_ab4)
+    FOUR_C_THROW("Adaptive time step size is not supported for AdamsBashforth4!");
+
+  // the lumped mass matrix is constant and was already evaluated for the initial state
+  std::shared_ptr<const Core::LinAlg::SparseMatrix> mass_ptr =
+      std::dynamic_pointer_cast<const Core::LinAlg::SparseMatrix>(
+          data_global_state().get_mass_matrix());
+  if (mass_ptr == nullptr) FOUR_C_THROW("The lumped mass matrix is expected to be a SparseMatrix!");
+
+  const Epetra_Map* dofrowmap_ptr = data_global_state().dof_row_map_view();
+
+  invmass_ptr_ = std::make_shared<Core::LinAlg::Vector<double>>(*dofrowmap_ptr, true);
+  if (mass_ptr->extract_diagonal_copy(*invmass_ptr_) != 0)
+    FOUR_C_THROW("Extraction of the lumped mass matrix diagonal failed!");
+  if (invmass_ptr_->Reciprocal(*invmass_ptr_) != 0)
+    FOUR_C_THROW("The lumped mass matrix has zero diagonal entries!");
+
+  rhs_ptr_ = std::make_shared<Core::LinAlg::Vector<double>>(*dofrowmap_ptr, true);
+  sol_ptr_ = std::make_shared<Core::LinAlg::Vector<double>>(*dofrowmap_ptr, true);
+
+  dtmax_ = get_delta_time();
+  if (data_sdyn().get_explicit_crit_dt_factor() > 0.0) estimate_critical_time_step();
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void Solid::TimeInt::Explicit::estimate_critical_time_step()
+{
+  auto& str_model = dynamic_cast<Solid::ModelEvaluator::Structure&>(
+      explint_ptr_->model_eval().evaluator(Inpar::Solid::model_structure));
+
+  dtcrit_ = str_model.determine_critical_time_step();
+
+  if (data_global_state().get_my_rank() == 0)
+    Core::IO::cout << "Estimated critical time step size: " << dtcrit_ << Core::IO::endl;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void Solid::TimeInt::Explicit::adapt_time_step()
+{
+  const int interval = data_sdyn().get_explicit_crit_dt_interval();
+  const int stepn = data_global_state().get_step_n();
+  if (interval > 0 and stepn > 0 and stepn % interval == 0) estimate_critical_time_step();
+
+  const double timen = data_global_state().get_time_n();
+
+  double dt = std::min(dtmax_, data_sdyn().get_explicit_crit_dt_factor() * dtcrit_);
+
+  // do not step beyond the final time
+  const double dtremaining = get_time_end() - timen;
+  if (dtremaining > 0.0) dt = std::min(dt, dtremaining);
+
+  set_delta_time(dt);
+  set_time_np(timen + dt);
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void Solid::TimeInt::Explicit::prepare_time_step()
 {
   check_init_setup();
+
+  if (is_fast_path() and data_sdyn().get_explicit_crit_dt_factor() > 0.0) adapt_time_step();
+
   // things that need to be done before predict
   pre_predict();
 
@@ -108,6 +200,15 @@ void Solid::TimeInt::Explicit::evaluate(
 void Solid::TimeInt::Explicit::evaluate()
 {
   check_init_setup();
+
+  if (is_fast_path())
+  {
+    // compute the rhs vector at the current state
+    if (not expl_int().apply_force(*data_global_state().get_acc_np(), *rhs_ptr_))
+      FOUR_C_THROW("Evaluation of the force vector failed!");
+    return;
+  }
+
   throw_if_state_not_in_sync_with_nox_group();
   ::NOX::Abstract::Group& grp = nln_solver().solution_group();
 
@@ -239,6 +340,8 @@ int Solid::TimeInt::Explicit::integrate()
 int Solid::TimeInt::Explicit::integrate_step()
 {
   check_init_setup();
+  if (is_fast_path()) return integrate_step_fast_path();
+
   throw_if_state_not_in_sync_with_nox_group();
   // reset the non-linear solver
   nln_solver().reset();
@@ -248,6 +351,34 @@ int Solid::TimeInt::Explicit::integrate_step()
 }
 
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+int Solid::TimeInt::Explicit::integrate_step_fast_path()
+{
+  // prescribed end-point accelerations of the Dirichlet dofs
+  std::shared_ptr<Core::LinAlg::Vector<double>> accnp_ptr = data_global_state().get_acc_np();
+  dbc().apply_dirichlet_bc(get_time_np(), nullptr, nullptr, accnp_ptr, false);
+
+  // the Dirichlet dofs keep their prescribed accelerations, the free dofs start at zero
+  sol_ptr_->Update(1.0, *accnp_ptr, 0.0);
+  dbc().insert_vector_in_non_dbc_dofs(dbc().get_zeros_ptr(), sol_ptr_);
+
+  // evaluate the rhs for the end-point displacements and velocities which are
+  // explicitly given by the scheme
+  if (not expl_int().apply_force(*sol_ptr_, *rhs_ptr_))
+    FOUR_C_THROW("Evaluation of the force vector failed!");
+  dbc().apply_dirichlet_to_rhs(*rhs_ptr_);
+
+  // end-point accelerations of the free dofs a_{n+1} = - M_lumped^{-1} r
+  // (the rhs vanishes at the Dirichlet dofs)
+  sol_ptr_->Multiply(-1.0, *invmass_ptr_, *rhs_ptr_, 1.0);
+
+  // update the end-point state of the explicit scheme
+  expl_int().set_state(*sol_ptr_);
+
+  return 0;
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 std::shared_ptr<const Core::LinAlg::Vector<double>> Solid::TimeInt::Explicit::initial_guess()
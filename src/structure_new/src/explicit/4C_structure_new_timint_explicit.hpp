@@ -112,12 +112,42 @@ namespace Solid
         return *nlnsolver_ptr_;
       };
 
+      //! is the explicit fast path without nonlinear and linear solver active?
+      [[nodiscard]] bool is_fast_path() const { return invmass_ptr_ != nullptr; }
+
      private:
+      //! setup the explicit fast path based on the inverted lumped mass matrix
+      void setup_fast_path();
+
+      //! integrate one time step by applying the inverted lumped mass matrix
+      int integrate_step_fast_path();
+
+      //! estimate the critical time step size on element level
+      void estimate_critical_time_step();
+
+      //! adapt the time step size to the estimated critical time step size
+      void adapt_time_step();
+
       //! ptr to the explicit time integrator object
       std::shared_ptr<Solid::EXPLICIT::Generic> explint_ptr_;
 
       //! ptr to the non-linear solver object
       std::shared_ptr<Solid::Nln::SOLVER::Generic> nlnsolver_ptr_;
+
+      //! inverted lumped mass matrix stored as vector (explicit fast path only)
+      std::shared_ptr<Core::LinAlg::Vector<double>> invmass_ptr_;
+
+      //! right-hand-side vector of the explicit fast path
+      std::shared_ptr<Core::LinAlg::Vector<double>> rhs_ptr_;
+
+      //! solution vector (end-point accelerations) of the explicit fast path
+      std::shared_ptr<Core::LinAlg::Vector<double>> sol_ptr_;
+
+      //! estimated critical time step size
+      double dtcrit_ = -1.0;
+
+      //! maximum time step size as given in the input file
+      double dtmax_ = -1.0;
     };
   }  // namespace TimeInt
 }  // namespace Solid
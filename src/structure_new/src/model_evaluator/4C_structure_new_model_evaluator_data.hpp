@@ -1356,6 +1356,13 @@ namespace Solid
         check_init_setup();
         return timeintconstrandnumb_;
       };
+
+      /// the way how the random numbers of the stochastic forces are generated
+      [[nodiscard]] BrownianDynamics::RandomNumberGeneration random_number_generation() const
+      {
+        check_init_setup();
+        return random_number_generation_;
+      }
       //! @}
 
       /*! @name set routines which are allowed to be called by the elements
@@ -1436,6 +1443,9 @@ namespace Solid
       /// time interval
       double timeintconstrandnumb_;
 
+      /// the way how the random numbers of the stochastic forces are generated
+      BrownianDynamics::RandomNumberGeneration random_number_generation_;
+
       /// the way how damping coefficient values for beams are specified
       BrownianDynamics::BeamDampingCoefficientSpecificationType beam_damping_coeff_specified_via_;
 
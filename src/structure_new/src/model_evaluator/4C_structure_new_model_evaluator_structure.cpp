@@ -12,6 +12,7 @@
 #include "4C_beam3_discretization_runtime_vtu_writer.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_discretization_utils.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
 #include "4C_fem_general_utils_gauss_point_postprocess.hpp"
 #include "4C_global_data.hpp"
 #include "4C_io.hpp"
@@ -25,11 +26,14 @@
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_linalg_vector.hpp"
+#include "4C_solid_3D_ele_block_evaluator.hpp"
+#include "4C_solid_3D_ele_matrix_free_evaluator.hpp"
 #include "4C_structure_new_dbc.hpp"
 #include "4C_structure_new_discretization_runtime_output_params.hpp"
 #include "4C_structure_new_error_evaluator.hpp"
 #include "4C_structure_new_integrator.hpp"
 #include "4C_structure_new_model_evaluator_data.hpp"
+#include "4C_structure_new_nln_linearsystem_matrix_free.hpp"
 #include "4C_structure_new_predict_generic.hpp"
 #include "4C_structure_new_timint_basedataio_runtime_vtk_output.hpp"
 #include "4C_structure_new_timint_implicit.hpp"
@@ -37,6 +41,8 @@
 
 #include <Teuchos_ParameterList.hpp>
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------------*
@@ -265,6 +271,8 @@ bool Solid::ModelEvaluator::Structure::assemble_jacobian(
     Core::LinAlg::SparseOperator& jac, const double& timefac_np) const
 {
   int err = stiff().scale(timefac_np);
+  if (matrix_free_evaluator_ptr_ != nullptr and matrix_free_evaluator_ptr_->has_linearization())
+    matrix_free_evaluator_ptr_->scale_linearization(timefac_np);
   global_state().assign_model_block(jac, stiff(), type(), Solid::MatBlockType::displ_displ);
 
   // add the visco and mass contributions
@@ -1210,10 +1218,98 @@ void Solid::ModelEvaluator::Structure::evaluate_internal(Teuchos::ParameterList&
   // this is about to go, once the old time integration is deleted
   params_interface2_parameter_list(eval_data_ptr(), p);
 
-  discret().evaluate(p, eval_mat[0], eval_mat[1], eval_vec[0], eval_vec[1], eval_vec[2]);
+  if (use_matrix_free_evaluation(eval_mat, eval_vec))
+  {
+    Core::FE::AssembleStrategy strategy(
+        0, 0, eval_mat[0], eval_mat[1], eval_vec[0], eval_vec[1], eval_vec[2]);
+    Core::FE::Utils::evaluate(
+        discret(), p, strategy, &matrix_free_evaluator_ptr_->remaining_element_col_map());
+    matrix_free_evaluator_ptr_->evaluate(p, discret(), strategy);
+  }
+  else if (use_element_block_evaluation(eval_mat, eval_vec))
+  {
+    Core::FE::AssembleStrategy strategy(
+        0, 0, eval_mat[0], eval_mat[1], eval_vec[0], eval_vec[1], eval_vec[2]);
+    Core::FE::Utils::evaluate(
+        discret(), p, strategy, &block_evaluator_ptr_->remaining_element_col_map());
+    block_evaluator_ptr_->evaluate(p, discret(), strategy);
+  }
+  else
+    discret().evaluate(p, eval_mat[0], eval_mat[1], eval_vec[0], eval_vec[1], eval_vec[2]);
+
   discret().clear_state();
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool Solid::ModelEvaluator::Structure::use_element_block_evaluation(
+    const std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
+    const std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec)
+{
+  if (not tim_int().get_data_sdyn().is_element_block_evaluation()) return false;
+
+  const Core::Elements::ActionType action = eval_data().get_action_type();
+  if (action != Core::Elements::struct_calc_nlnstiff and
+      action != Core::Elements::struct_calc_internalforce)
+    return false;
+
+  if (eval_mat[1] != nullptr or eval_vec[1] != nullptr or eval_vec[2] != nullptr) return false;
+
+  // the blocks are set up again after a redistribution of the discretization
+  if (block_evaluator_ptr_ == nullptr or not block_evaluator_ptr_->is_valid_for(discret()))
+    block_evaluator_ptr_ = std::make_shared<Discret::Elements::SolidBlockEvaluator>(discret());
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool Solid::ModelEvaluator::Structure::use_matrix_free_evaluation(
+    const std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
+    const std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec)
+{
+  if (not tim_int().get_data_sdyn().is_matrix_free_tangent()) return false;
+
+  const Core::Elements::ActionType action = eval_data().get_action_type();
+  if ((action != Core::Elements::struct_calc_nlnstiff and
+          action != Core::Elements::struct_calc_internalforce) or
+      eval_mat[1] != nullptr or eval_vec[1] != nullptr or eval_vec[2] != nullptr)
+  {
+    // a stiffness matrix which is assembled as usual replaces the stored linearization
+    if (matrix_free_evaluator_ptr_ != nullptr and eval_mat[0] != nullptr)
+      matrix_free_evaluator_ptr_->invalidate_linearization();
+    return false;
+  }
+
+  // the evaluator is set up again after a redistribution of the discretization
+  if (matrix_free_evaluator_ptr_ == nullptr or
+      not matrix_free_evaluator_ptr_->is_valid_for(discret()))
+  {
+    matrix_free_evaluator_ptr_ =
+        std::make_shared<Discret::Elements::SolidMatrixFreeEvaluator>(discret());
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::MatrixFreeOperator>
+Solid::ModelEvaluator::Structure::create_matrix_free_jacobian(
+    Core::LinAlg::SparseOperator& jac) const
+{
+  if (matrix_free_evaluator_ptr_ == nullptr or not matrix_free_evaluator_ptr_->has_linearization())
+    return nullptr;
+
+  auto* jac_matrix = dynamic_cast<Core::LinAlg::SparseMatrix*>(&jac);
+  FOUR_C_ASSERT_ALWAYS(jac_matrix != nullptr,
+      "The matrix-free tangent is only available for purely structural problems.");
+
+  return std::make_shared<Solid::Nln::LinSystem::MatrixFreeJacobian>(
+      *jac_matrix->epetra_operator(), *matrix_free_evaluator_ptr_,
+      *integrator().get_dbc().get_dbc_map_extractor()->cond_map());
+}
+
 void Solid::ModelEvaluator::Structure::evaluate_internal_specified_elements(
     std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
     std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec,
@@ -1613,6 +1709,89 @@ void Solid::ModelEvaluator::Structure::determine_energy(const Core::LinAlg::Vect
   }
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+double Solid::ModelEvaluator::Structure::determine_critical_time_step()
+{
+  check_init_setup();
+
+  // set required parameters in the evaluation data container
+  eval_data().set_action_type(Core::Elements::struct_calc_nlnstifflmass);
+  eval_data().set_total_time(global_state().get_time_np());
+  eval_data().set_delta_time((*global_state().get_delta_time())[0]);
+
+  // the estimate must not recover element internal variables, hence a zero residual
+  // displacement is set instead of the increment of the last evaluation
+  std::shared_ptr<Core::LinAlg::Vector<double>> zero_dis_incr =
+      Core::LinAlg::create_vector(*global_state().dof_row_map_view(), true);
+
+  // set state vector values needed by elements
+  discret().clear_state();
+  discret().set_state(0, "residual displacement", zero_dis_incr);
+  discret().set_state(0, "displacement", global_state().get_dis_np());
+  discret().set_state(0, "velocity", global_state().get_vel_np());
+  discret().set_state(0, "acceleration", global_state().get_acc_np());
+
+  pre_evaluate_internal();
+
+  Teuchos::ParameterList p;
+  p.set<std::shared_ptr<Core::Elements::ParamsInterface>>("interface", eval_data_ptr());
+  params_interface2_parameter_list(eval_data_ptr(), p);
+
+  // element stiffness and lumped mass matrix
+  Core::LinAlg::SerialDenseMatrix elestiff;
+  Core::LinAlg::SerialDenseMatrix elemass;
+  Core::LinAlg::SerialDenseVector eleforce;
+  Core::LinAlg::SerialDenseVector eleinertia;
+  Core::LinAlg::SerialDenseVector eledummy;
+
+  const int myrank = global_state().get_my_rank();
+  double mydtcrit = std::numeric_limits<double>::max();
+
+  // evaluate element matrices without assembly (row elements only)
+  Core::FE::AssembleStrategy strategy(0, 0, nullptr, nullptr, nullptr, nullptr, nullptr);
+  discret().evaluate(p, strategy,
+      [&](Core::Elements::Element& ele, Core::Elements::LocationArray& la,
+          Core::LinAlg::SerialDenseMatrix&, Core::LinAlg::SerialDenseMatrix&,
+          Core::LinAlg::SerialDenseVector&, Core::LinAlg::SerialDenseVector&,
+          Core::LinAlg::SerialDenseVector&)
+      {
+        if (ele.owner() != myrank) return;
+
+        const int numdof = la[0].size();
+        elestiff.shape(numdof, numdof);
+        elemass.shape(numdof, numdof);
+        eleforce.size(numdof);
+        eleinertia.size(numdof);
+
+        // evaluate a copy of the element, such that the history of the element and its
+        // material, e.g., EAS parameters or plastic strains, remains untouched
+        std::unique_ptr<Core::Elements::Element> elecopy(ele.clone());
+        elecopy->evaluate(p, discret(), la, elestiff, elemass, eleforce, eleinertia, eledummy);
+
+        // bound the squared maximum eigenfrequency of the element
+        double omega2max = 0.0;
+        for (int i = 0; i < numdof; ++i)
+        {
+          if (elemass(i, i) <= 0.0) continue;
+
+          double rowsum = 0.0;
+          for (int j = 0; j < numdof; ++j) rowsum += std::abs(elestiff(i, j));
+
+          omega2max = std::max(omega2max, rowsum / elemass(i, i));
+        }
+
+        if (omega2max > 0.0) mydtcrit = std::min(mydtcrit, 2.0 / std::sqrt(omega2max));
+      });
+
+  discret().clear_state();
+
+  double dtcrit = 0.0;
+  Core::Communication::min_all(&mydtcrit, &dtcrit, 1, discret().get_comm());
+
+  return dtcrit;
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void Solid::ModelEvaluator::Structure::determine_optional_quantity()
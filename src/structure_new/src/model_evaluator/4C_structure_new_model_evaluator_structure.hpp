@@ -27,8 +27,15 @@ namespace Core::IO
 }
 class BeamDiscretizationRuntimeOutputWriter;
 
+namespace Discret::Elements
+{
+  class SolidBlockEvaluator;
+  class SolidMatrixFreeEvaluator;
+}  // namespace Discret::Elements
+
 namespace Core::LinAlg
 {
+  class MatrixFreeOperator;
   class SparseMatrix;
 }  // namespace Core::LinAlg
 
@@ -141,6 +148,19 @@ namespace Solid
        *                      save the global result. */
       void determine_strain_energy(const Core::LinAlg::Vector<double>& disnp, const bool global);
 
+      /*! \brief determine the critical time step size of explicit time integration
+       *
+       *  The maximum eigenfrequency of each element is bounded by applying Gershgorin's theorem
+       *  to the element stiffness and lumped mass matrices. Since the maximum eigenfrequency of
+       *  the assembled system is bounded by the maximum element eigenfrequency, the minimum
+       *  element estimate is a conservative estimate of the critical time step size.
+       *
+       *  \note The element matrices are evaluated on copies of the elements, hence the history
+       *  of the elements and their materials is not modified by the estimate.
+       *
+       *  \return global minimum of the critical time step size of all elements */
+      double determine_critical_time_step();
+
       //! derived
       void determine_optional_quantity() override;
 
@@ -175,6 +195,14 @@ namespace Solid
       //! calculate the L2 displacement error in comparison to the analytical solution.
       void evaluate_analytical_error();
 
+      /*! \brief Create the jacobian which applies the tangent stiffness of the supported solid
+       *  elements matrix-free
+       *
+       *  The assembled jacobian @p jac contains the low-order refined stiffness of these elements.
+       *  Returns nullptr if the last stiffness evaluation did not use the matrix-free evaluator. */
+      std::shared_ptr<Core::LinAlg::MatrixFreeOperator> create_matrix_free_jacobian(
+          Core::LinAlg::SparseOperator& jac) const;
+
       //! [derived]
       void assemble_jacobian_contributions_from_element_level_for_ptc(
           std::shared_ptr<Core::LinAlg::SparseMatrix>& modjac, const double& timefac_n) override;
@@ -248,6 +276,24 @@ namespace Solid
           std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
           std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec);
 
+      /*! \brief Check whether the internal force (and stiffness) is evaluated with the
+       *  element block evaluator and set it up if necessary
+       *
+       *  This is the case if requested in the input, the action is supported and neither
+       *  mass nor inertial forces are evaluated in the same call. */
+      bool use_element_block_evaluation(
+          const std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
+          const std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec);
+
+      /*! \brief Check whether the internal force (and stiffness) is evaluated with the
+       *  matrix-free evaluator and set it up if necessary
+       *
+       *  This is the case if requested in the input, the action is supported and neither
+       *  mass nor inertial forces are evaluated in the same call. */
+      bool use_matrix_free_evaluation(
+          const std::shared_ptr<Core::LinAlg::SparseOperator>* eval_mat,
+          const std::shared_ptr<Core::LinAlg::Vector<double>>* eval_vec);
+
       /*! \brief  Set the params_interface in the parameter list and call the other
        * evaluate_internal_specified_elements routine */
       void evaluate_internal_specified_elements(
@@ -543,6 +589,12 @@ namespace Solid
       //! beam discretization runtime output writer
       std::shared_ptr<BeamDiscretizationRuntimeOutputWriter> beam_vtu_writer_ptr_;
 
+      //! evaluator of blocks of solid elements (only if requested)
+      std::shared_ptr<Discret::Elements::SolidBlockEvaluator> block_evaluator_ptr_;
+
+      //! evaluator of the matrix-free solid elements (only if requested)
+      std::shared_ptr<Discret::Elements::SolidMatrixFreeEvaluator> matrix_free_evaluator_ptr_;
+
       //! @}
     };
 
@@ -0,0 +1,48 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_structure_new_nln_linearsystem_matrix_free.hpp"
+
+#include "4C_solid_3D_ele_matrix_free_evaluator.hpp"
+
+#include <Epetra_MultiVector.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Solid::Nln::LinSystem::MatrixFreeJacobian::MatrixFreeJacobian(Epetra_Operator& assembled_jacobian,
+    const Discret::Elements::SolidMatrixFreeEvaluator& evaluator, const Epetra_Map& dbc_map)
+    : assembled_jacobian_(assembled_jacobian), evaluator_(evaluator)
+{
+  const Epetra_Map& range_map = assembled_jacobian_.OperatorRangeMap();
+  is_dbc_row_.resize(range_map.NumMyElements());
+  for (int lid = 0; lid < range_map.NumMyElements(); ++lid)
+    is_dbc_row_[lid] = dbc_map.MyGID(range_map.GID(lid));
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Solid::Nln::LinSystem::MatrixFreeJacobian::Apply(
+    const Epetra_MultiVector& X, Epetra_MultiVector& Y) const
+{
+  const int err = assembled_jacobian_.Apply(X, Y);
+  if (err != 0) return err;
+
+  Epetra_MultiVector correction(Y.Map(), Y.NumVectors(), false);
+  evaluator_.apply_stiffness_difference(X, correction);
+
+  for (int v = 0; v < Y.NumVectors(); ++v)
+  {
+    for (int lid = 0; lid < Y.MyLength(); ++lid)
+      if (not is_dbc_row_[lid]) Y[v][lid] += correction[v][lid];
+  }
+
+  return 0;
+}
+
+FOUR_C_NAMESPACE_CLOSE
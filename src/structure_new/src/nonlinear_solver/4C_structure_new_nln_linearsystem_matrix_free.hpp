@@ -0,0 +1,94 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_STRUCTURE_NEW_NLN_LINEARSYSTEM_MATRIX_FREE_HPP
+#define FOUR_C_STRUCTURE_NEW_NLN_LINEARSYSTEM_MATRIX_FREE_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_matrix_free_operator.hpp"
+
+#include <Epetra_Map.h>
+
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+// forward declarations
+namespace Discret::Elements
+{
+  class SolidMatrixFreeEvaluator;
+}  // namespace Discret::Elements
+
+namespace Solid
+{
+  namespace Nln
+  {
+    namespace LinSystem
+    {
+      /*! \brief Jacobian of the structural problem with the matrix-free stiffness of the elements
+       *  handled by a Discret::Elements::SolidMatrixFreeEvaluator
+       *
+       *  The assembled jacobian contains the low-order refined stiffness of these elements and is
+       *  used to build the preconditioner. The action of the exact jacobian is the action of the
+       *  assembled jacobian plus the (scaled) difference of the exact and the low-order refined
+       *  element stiffness. The rows of Dirichlet dofs remain the identity rows of the assembled
+       *  jacobian.
+       */
+      class MatrixFreeJacobian : public Core::LinAlg::MatrixFreeOperator
+      {
+       public:
+        MatrixFreeJacobian(Epetra_Operator& assembled_jacobian,
+            const Discret::Elements::SolidMatrixFreeEvaluator& evaluator,
+            const Epetra_Map& dbc_map);
+
+        int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const override;
+
+        int ApplyInverse(const Epetra_MultiVector&, Epetra_MultiVector&) const override
+        {
+          return -1;
+        }
+
+        int SetUseTranspose(bool UseTranspose) override { return UseTranspose ? -1 : 0; }
+
+        double NormInf() const override { return -1.0; }
+
+        const char* Label() const override { return "Solid::Nln::LinSystem::MatrixFreeJacobian"; }
+
+        bool UseTranspose() const override { return false; }
+
+        bool HasNormInf() const override { return false; }
+
+        const Epetra_Comm& Comm() const override { return assembled_jacobian_.Comm(); }
+
+        const Epetra_Map& OperatorDomainMap() const override
+        {
+          return assembled_jacobian_.OperatorDomainMap();
+        }
+
+        const Epetra_Map& OperatorRangeMap() const override
+        {
+          return assembled_jacobian_.OperatorRangeMap();
+        }
+
+        Epetra_Operator& assembled_approximation() const override { return assembled_jacobian_; }
+
+       private:
+        Epetra_Operator& assembled_jacobian_;
+
+        const Discret::Elements::SolidMatrixFreeEvaluator& evaluator_;
+
+        //! whether the local rows of the range map belong to Dirichlet dofs
+        std::vector<bool> is_dbc_row_;
+      };
+    }  // namespace LinSystem
+  }  // namespace Nln
+}  // namespace Solid
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
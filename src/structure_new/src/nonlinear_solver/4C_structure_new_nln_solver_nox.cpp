@@ -159,7 +159,8 @@ void Solid::Nln::SOLVER::Nox::reset_params()
 
   if (method == "User Defined") method = pdir.get<std::string>("User Defined Method");
 
-  if (method == "Newton" or method == "Modified Newton")
+  if (method == "Newton" or method == "Modified Newton" or method == "L-BFGS" or
+      method == "Broyden")
   {
     // get the linear solver sub-sub-sub-list
     Teuchos::ParameterList& lsparams = nlnglobaldata_->get_nln_parameter_list()
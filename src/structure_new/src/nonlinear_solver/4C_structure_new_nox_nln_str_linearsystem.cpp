@@ -11,7 +11,9 @@
 #include "4C_linear_solver_method_linalg.hpp"
 #include "4C_solver_nonlin_nox_interface_jacobian.hpp"
 #include "4C_solver_nonlin_nox_interface_required.hpp"
+#include "4C_structure_new_timint_noxinterface.hpp"
 
+#include <Epetra_LinearProblem.h>
 #include <Teuchos_ParameterList.hpp>
 
 FOUR_C_NAMESPACE_OPEN
@@ -114,4 +116,26 @@ NOX::Nln::SolutionType NOX::Nln::Solid::LinearSystem::get_active_lin_solver(
   return NOX::Nln::sol_structure;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void NOX::Nln::Solid::LinearSystem::set_linear_problem_for_solve(
+    Epetra_LinearProblem& linear_problem, Core::LinAlg::SparseOperator& jac,
+    Core::LinAlg::Vector<double>& lhs, Core::LinAlg::Vector<double>& rhs) const
+{
+  NOX::Nln::LinearSystem::set_linear_problem_for_solve(linear_problem, jac, lhs, rhs);
+
+  const auto* nox_interface =
+      dynamic_cast<const ::Solid::TimeInt::NoxInterface*>(jacInterfacePtr_.get());
+  if (nox_interface == nullptr) return;
+
+  // the assembled jacobian only serves to build the preconditioner
+  matrix_free_jacobian_ = nox_interface->matrix_free_jacobian(jac);
+  if (matrix_free_jacobian_ == nullptr) return;
+
+  FOUR_C_ASSERT_ALWAYS(scaling_.is_null(),
+      "The scaling of the linear system requires the assembled jacobian. Disable the "
+      "matrix-free tangent.");
+  linear_problem.SetOperator(matrix_free_jacobian_.get());
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_linalg_matrix_free_operator.hpp"
 #include "4C_solver_nonlin_nox_linearsystem.hpp"
 
 FOUR_C_NAMESPACE_OPEN
@@ -76,6 +77,15 @@ namespace NOX
             const std::map<NOX::Nln::SolutionType, Teuchos::RCP<Core::LinAlg::Solver>>& solvers,
             Teuchos::RCP<Core::LinAlg::Solver>& currSolver) override;
 
+        //! sets the matrix-free jacobian as operator of the linear problem if requested
+        void set_linear_problem_for_solve(Epetra_LinearProblem& linear_problem,
+            Core::LinAlg::SparseOperator& jac, Core::LinAlg::Vector<double>& lhs,
+            Core::LinAlg::Vector<double>& rhs) const override;
+
+       private:
+        //! jacobian of the current linear solve which applies parts of the stiffness matrix-free
+        mutable std::shared_ptr<Core::LinAlg::MatrixFreeOperator> matrix_free_jacobian_;
+
       };  // class LinearSystem
     }  // namespace Solid
   }  // namespace Nln
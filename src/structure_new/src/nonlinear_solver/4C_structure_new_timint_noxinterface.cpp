@@ -18,6 +18,7 @@
 #include "4C_solver_nonlin_nox_constraint_group.hpp"
 #include "4C_structure_new_dbc.hpp"
 #include "4C_structure_new_impl_generic.hpp"
+#include "4C_structure_new_model_evaluator_structure.hpp"
 #include "4C_structure_new_timint_base.hpp"
 #include "4C_structure_new_utils.hpp"
 
@@ -567,6 +568,19 @@ double Solid::TimeInt::NoxInterface::calc_ref_norm_force()
   return int_ptr_->calc_ref_norm_force(nox_normtype);
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::MatrixFreeOperator>
+Solid::TimeInt::NoxInterface::matrix_free_jacobian(Core::LinAlg::SparseOperator& jac) const
+{
+  check_init_setup();
+  if (not timint_ptr_->get_data_sdyn().is_matrix_free_tangent()) return nullptr;
+
+  const auto& structure = dynamic_cast<const Solid::ModelEvaluator::Structure&>(
+      int_ptr_->evaluator(Inpar::Solid::model_structure));
+  return structure.create_matrix_free_jacobian(jac);
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 Teuchos::RCP<Core::LinAlg::SparseMatrix>
@@ -28,6 +28,7 @@ namespace NOX
 }  // namespace NOX
 namespace Core::LinAlg
 {
+  class MatrixFreeOperator;
   class SparseOperator;
   class SparseMatrix;
 }  // namespace Core::LinAlg
@@ -149,6 +150,13 @@ namespace Solid
       //! Access the implicit integrator
       Solid::Integrator& impl_int();
 
+      /*! \brief Jacobian which applies the tangent stiffness of the supported solid elements
+       *  matrix-free (nullptr if not requested or not available)
+       *
+       *  @p jac is the assembled jacobian which is used to build the preconditioner. */
+      std::shared_ptr<Core::LinAlg::MatrixFreeOperator> matrix_free_jacobian(
+          Core::LinAlg::SparseOperator& jac) const;
+
      protected:
       //! Returns the init state
       inline const bool& is_init() const { return isinit_; };
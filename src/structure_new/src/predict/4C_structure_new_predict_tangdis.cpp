@@ -93,10 +93,11 @@ void Solid::Predict::TangDis::compute(::NOX::Abstract::Group& grp)
   std::string dir_str = nox_params().sublist("Direction").get<std::string>("Method");
   if (dir_str == "User Defined")
     dir_str = nox_params().sublist("Direction").get<std::string>("User Defined Method");
-  if (dir_str != "Newton" and dir_str != "Modified Newton")
+  if (dir_str != "Newton" and dir_str != "Modified Newton" and dir_str != "L-BFGS" and
+      dir_str != "Broyden")
     FOUR_C_THROW(
         "The TangDis predictor is currently only working for the direction-"
-        "methods \"Newton\" and \"Modified Newton\".");
+        "methods \"Newton\", \"Modified Newton\", \"L-BFGS\" and \"Broyden\".");
 
   // ---------------------------------------------------------------------------
   // (re)set the linear solver parameters
@@ -0,0 +1,114 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_cut_mesh.hpp"
+#include "4C_cut_meshintersection.hpp"
+#include "4C_cut_options.hpp"
+#include "4C_cut_volumecell.hpp"
+#include "4C_fem_general_utils_gausspoints.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <iostream>
+#include <vector>
+
+#include "cut_test_utils.hpp"
+
+/*
+ * The direct divergence Gauss rules of the volumecells are computed thread-parallel in
+ * Cut::Mesh::direct_divergence_gauss_rule(). Here, a block of hex8 elements is cut by a tilted
+ * plane and the Gauss rule of each volumecell is recomputed sequentially afterwards. The Gauss
+ * rules have to be bitwise identical, independent of the number of threads used in the cut.
+ */
+void test_direct_divergence_thread_parallel()
+{
+  Cut::MeshIntersection intersection;
+  intersection.get_options().init_for_cuttests();  // use full cln
+
+  // background mesh of 3x3x1 hex8 elements
+  const int numelex = 3;
+  const int numeley = 3;
+  auto nodeid = [&](int i, int j, int k) { return i + (numelex + 1) * (j + (numeley + 1) * k); };
+
+  int elecount = 0;
+  for (int j = 0; j < numeley; ++j)
+  {
+    for (int i = 0; i < numelex; ++i)
+    {
+      const int corners[8][3] = {{i, j, 0}, {i + 1, j, 0}, {i + 1, j + 1, 0}, {i, j + 1, 0},
+          {i, j, 1}, {i + 1, j, 1}, {i + 1, j + 1, 1}, {i, j + 1, 1}};
+
+      Core::LinAlg::SerialDenseMatrix hex8_xyze(3, 8);
+      std::vector<int> nids;
+      for (int n = 0; n < 8; ++n)
+      {
+        for (int dim = 0; dim < 3; ++dim) hex8_xyze(dim, n) = corners[n][dim];
+        nids.push_back(nodeid(corners[n][0], corners[n][1], corners[n][2]));
+      }
+
+      intersection.add_element(++elecount, nids, hex8_xyze, Core::FE::CellType::hex8);
+    }
+  }
+
+  // tilted cut plane through all elements made of two tri3 sides
+  auto height = [](double x, double y) { return 0.3 + 0.1 * x + 0.05 * y; };
+  const double cutcorners[4][2] = {{-0.5, -0.5}, {3.5, -0.5}, {3.5, 3.5}, {-0.5, 3.5}};
+  const int cutsides[2][3] = {{0, 1, 2}, {0, 2, 3}};
+
+  int sidecount = 0;
+  for (const auto& cutside : cutsides)
+  {
+    Core::LinAlg::SerialDenseMatrix tri3_xyze(3, 3);
+    std::vector<int> nids;
+    for (int n = 0; n < 3; ++n)
+    {
+      const double* corner = cutcorners[cutside[n]];
+      tri3_xyze(0, n) = corner[0];
+      tri3_xyze(1, n) = corner[1];
+      tri3_xyze(2, n) = height(corner[0], corner[1]);
+      nids.push_back(1000 + cutside[n]);
+    }
+
+    intersection.add_cut_side(++sidecount, nids, tri3_xyze, Core::FE::CellType::tri3);
+  }
+
+  intersection.cut_test_cut(true, Cut::VCellGaussPts_DirectDivergence);
+
+  std::cout << "Direct divergence Gauss rules computed with "
+            << Kokkos::DefaultHostExecutionSpace().concurrency() << " threads\n";
+
+  // recompute the Gauss rule of each volumecell sequentially and compare
+  int numcomparedcells = 0;
+  for (const auto& vc : intersection.normal_mesh().volume_cells())
+  {
+    std::shared_ptr<Core::FE::GaussPoints> gp_parallel = vc->get_gauss_rule();
+    if (gp_parallel == nullptr) continue;
+
+    vc->compute_direct_divergence_gauss_rule(vc->parent_element(), intersection.normal_mesh());
+    std::shared_ptr<Core::FE::GaussPoints> gp_sequential = vc->get_gauss_rule();
+
+    if (gp_sequential == nullptr or gp_sequential->num_points() != gp_parallel->num_points())
+      FOUR_C_THROW("Gauss rules of thread-parallel and sequential computation differ in size!");
+
+    for (int p = 0; p < gp_parallel->num_points(); ++p)
+    {
+      if (gp_parallel->weight(p) != gp_sequential->weight(p))
+        FOUR_C_THROW("Gauss weights of thread-parallel and sequential computation differ!");
+
+      for (int dim = 0; dim < gp_parallel->num_dimension(); ++dim)
+        if (gp_parallel->point(p)[dim] != gp_sequential->point(p)[dim])
+          FOUR_C_THROW("Gauss points of thread-parallel and sequential computation differ!");
+    }
+
+    ++numcomparedcells;
+  }
+
+  // each element is cut into two volumecells
+  if (numcomparedcells != 2 * numelex * numeley)
+    FOUR_C_THROW("Expected %d volumecells with direct divergence Gauss rule, but found %d!",
+        2 * numelex * numeley, numcomparedcells);
+}
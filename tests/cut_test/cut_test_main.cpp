@@ -14,6 +14,7 @@
 #include "4C_utils_singleton_owner.hpp"
 
 #include <fenv.h>
+#include <Kokkos_Core.hpp>
 #include <Teuchos_CommandLineProcessor.hpp>
 
 #include <map>
@@ -244,6 +245,8 @@ void test_cut_volumes();
 void test_cut_volumes2();
 void test_cut_volumes3();
 
+void test_direct_divergence_thread_parallel();
+
 void test_fluidfluid();
 void test_fluidfluid2();
 
@@ -438,9 +441,13 @@ void set_problem_dimension(const std::map<std::string, testfunct>& functable)
  */
 int main(int argc, char** argv)
 {
-  Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
   MPI_Init(&argc, &argv);
 
+  // Kokkos should be initialized right after MPI.
+  Kokkos::ScopeGuard kokkos_guard{};
+
+  Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+
   std::map<std::string, testfunct> functable;
 
   Core::IO::cout.setup(
@@ -737,6 +744,8 @@ int main(int argc, char** argv)
 
   functable["cut_volumes"] = test_cut_volumes;
 
+  functable["direct_divergence_thread_parallel"] = test_direct_divergence_thread_parallel;
+
   functable["fluidfluid"] = test_fluidfluid;
   functable["fluidfluid2"] = test_fluidfluid2;
 
@@ -49,6 +49,8 @@ four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_randcrosslinking_bea
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_randcrosslinking_beam3rline2_twobonds.dat NP 3)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_repLJ_singlelengthspec_smallsepapprox_twocrossedbeams.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_singlefil.dat NP 3)
+four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_singlefil_counterbased.dat)
+four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_singlefil_counterbased.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_singlefil_ptc_elementbased_everydt.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_singlefil_ptc_elementbased_everyiter.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_vanderWaals_doublelengthspec_smallsepapprox_regularization_constextpol_twocrossedbeams.dat NP 2)
@@ -697,6 +699,7 @@ four_c_test(TEST_FILE fsi_dc_mono_ss_ost_ga_eos.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_mono_ss_ost_ga_rsb.dat NP 3 RESTART_STEP 8)
 four_c_test(TEST_FILE fsi_dc_part_ait_ga_ga.dat NP 2 RESTART_STEP 7)
 four_c_test(TEST_FILE fsi_dc_part_ait_ost_ga.dat NP 2 RESTART_STEP 1)
+four_c_test(TEST_FILE fsi_dc_part_iqnils_ost_ga.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_part_mfnk_ost_ga.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_part_mpe_ost_ga.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE fsi_dc_part_mtrait_ost_ga.dat NP 2)
@@ -932,6 +935,7 @@ four_c_test(TEST_FILE orthopressure_pseudo_solidw6.dat NP 2)
 four_c_test(TEST_FILE orthopressure_solidh8.dat NP 2)
 four_c_test(TEST_FILE orthopressure_solidh8_eas.dat NP 2)
 four_c_test(TEST_FILE orthopressure_solidw6.dat NP 2)
+four_c_test(TEST_FILE particle_dem_1d_adaptive_timestep.dat NP 2 RESTART_STEP 50)
 four_c_test(TEST_FILE particle_dem_1d_adhesion_RegDMT.dat NP 2 RESTART_STEP 5000)
 four_c_test(TEST_FILE particle_dem_1d_adhesion_RegDMT_shift.dat NP 2 RESTART_STEP 5000)
 four_c_test(TEST_FILE particle_dem_1d_adhesion_VdWDMT.dat NP 2 RESTART_STEP 5000)
@@ -1455,6 +1459,7 @@ four_c_test(TEST_FILE solid_ele_wedge6_Standard_mulf.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_wedge6_Standard_shell_ans.4C.yaml NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_wedge6_Standard_shell_eas_ans.4C.yaml NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_wedge6_Standard_stressout.dat NP 2 RESTART_STEP 1)
+four_c_test(TEST_FILE solid_hex8_centrdiff_fast_path_prescribed_acc.dat)
 four_c_test(TEST_FILE solid_material_prestress_iterative_spring_dashpot.4C.yaml NP 2 RESTART_STEP 5)
 four_c_test(TEST_FILE solid_nodal_fiber.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE solid_nodal_fiber_eletypes.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
@@ -1501,6 +1506,7 @@ four_c_test(TEST_FILE sosh8_cooks_nl.dat NP 2)
 four_c_test(TEST_FILE sosh8_eas_cfrp_tape_monitor_dbc.dat NP 3)
 four_c_test(TEST_FILE sosh8_freeflying_ruler.dat NP 2)
 four_c_test(TEST_FILE sosh8_freeflying_ruler_centrdiff_new.dat)
+four_c_test(TEST_FILE sosh8_freeflying_ruler_centrdiff_fast_path.dat)
 four_c_test(TEST_FILE sosh8_freeflying_ruler_centrdiff.dat)
 four_c_test(TEST_FILE sosh8_freeflying_ruler_new.dat NP 2)
 four_c_test(TEST_FILE sosh8_freeflying_ruler_sta.dat NP 2)
@@ -1990,6 +1996,7 @@ if (FOUR_C_WITH_ARBORX)
     four_c_test(TEST_FILE beam3r_herm2line3_static_point_coupling_BTSPH_contact_stent_honeycomb_stretch_r01_circ10_boundingvolume.dat NP 3 RESTART_STEP 20)
     four_c_test(TEST_FILE embeddedmesh_parallel_bending_beam.dat NP 3)
     four_c_test(TEST_FILE embeddedmesh_parallel_bending_beam_fine.dat NP 3)
+    four_c_test(TEST_FILE levelset_zalesaks_disc_51x51_reinitgeo_bandtree.dat NP 2)
 
     # only execute these vtk tests with ArborX
     four_c_test_vtk(beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume-vtk-beam-interaction-geometric-search.dat beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume.dat 2 xxx-beam-interaction-geometric-search.pvd ref/beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume-vtk/beam-interaction-geometric-search.pvd 1e-06 0.0 1.0)
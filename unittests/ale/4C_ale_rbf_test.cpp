@@ -0,0 +1,186 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_ale_rbf.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr int ndim = 2;
+
+  //! Nodes on the boundary of the unit square with a smooth displacement field.
+  class AleRbfTest : public ::testing::Test
+  {
+   protected:
+    AleRbfTest()
+    {
+      constexpr int num_per_edge = 10;
+      for (int edge = 0; edge < 4; ++edge)
+      {
+        for (int i = 0; i < num_per_edge; ++i)
+        {
+          const double s = static_cast<double>(i) / num_per_edge;
+          const std::array<double, 4> x = {s, 1.0, 1.0 - s, 0.0};
+          const std::array<double, 4> y = {0.0, s, 1.0, 1.0 - s};
+          coords_.push_back(x[edge]);
+          coords_.push_back(y[edge]);
+        }
+      }
+
+      for (std::size_t j = 0; j < coords_.size(); j += ndim)
+      {
+        disp_.push_back(0.1 * std::sin(3.0 * coords_[j]) * coords_[j + 1]);
+        disp_.push_back(0.05 * std::cos(2.0 * coords_[j + 1]) + 0.02 * coords_[j]);
+      }
+    }
+
+    //! largest interpolation error at the prescribed nodes
+    [[nodiscard]] double max_error(const ALE::Rbf::Interpolant& interpolant) const
+    {
+      double error = 0.0;
+      std::array<double, ndim> value;
+      for (std::size_t j = 0; j < coords_.size(); j += ndim)
+      {
+        interpolant.evaluate(&coords_[j], value.data());
+        error = std::max(error, std::hypot(value[0] - disp_[j], value[1] - disp_[j + 1]));
+      }
+      return error;
+    }
+
+    //! index of the prescribed node at x (-1 if there is none)
+    [[nodiscard]] int node_index(const double* x) const
+    {
+      for (std::size_t j = 0; j < coords_.size(); j += ndim)
+        if (coords_[j] == x[0] and coords_[j + 1] == x[1]) return j / ndim;
+      return -1;
+    }
+
+    //! largest prescribed displacement
+    [[nodiscard]] double max_disp() const
+    {
+      double max = 0.0;
+      for (std::size_t j = 0; j < disp_.size(); j += ndim)
+        max = std::max(max, std::hypot(disp_[j], disp_[j + 1]));
+      return max;
+    }
+
+    std::vector<double> coords_;
+    std::vector<double> disp_;
+  };
+
+  TEST(AleRbfWendlandTest, CompactSupport)
+  {
+    EXPECT_DOUBLE_EQ(ALE::Rbf::wendland_c2(0.0), 1.0);
+    EXPECT_DOUBLE_EQ(ALE::Rbf::wendland_c2(0.5), std::pow(0.5, 4) * 3.0);
+    EXPECT_DOUBLE_EQ(ALE::Rbf::wendland_c2(1.0), 0.0);
+    EXPECT_DOUBLE_EQ(ALE::Rbf::wendland_c2(1.5), 0.0);
+
+    // the function and its derivative vanish at the boundary of the support
+    EXPECT_NEAR(ALE::Rbf::wendland_c2(1.0 - 1e-4), 0.0, 1e-15);
+    EXPECT_NEAR(
+        (ALE::Rbf::wendland_c2(1.0) - ALE::Rbf::wendland_c2(1.0 - 1e-4)) / 1e-4, 0.0, 1e-10);
+
+    // positive and monotonically decreasing inside the support
+    for (double xi = 0.0; xi < 0.99; xi += 0.01)
+    {
+      EXPECT_GT(ALE::Rbf::wendland_c2(xi), 0.0);
+      EXPECT_GT(ALE::Rbf::wendland_c2(xi), ALE::Rbf::wendland_c2(xi + 0.01));
+    }
+  }
+
+  TEST_F(AleRbfTest, BasisFunctionVanishesOutsideSupport)
+  {
+    const ALE::Rbf::Interpolant interpolant =
+        ALE::Rbf::select_control_points(coords_, disp_, ndim, 0.3, 0.0, 1);
+    ASSERT_EQ(interpolant.num_points(), 1);
+
+    const double* center = interpolant.points.data();
+    const std::array<double, ndim> inside = {center[0] + 0.2, center[1] + 0.2};
+    const std::array<double, ndim> outside = {center[0] + 0.25, center[1] + 0.2};
+
+    EXPECT_DOUBLE_EQ(interpolant.basis_function(center, 0), 1.0);
+    EXPECT_GT(interpolant.basis_function(inside.data(), 0), 0.0);
+    EXPECT_DOUBLE_EQ(interpolant.basis_function(outside.data(), 0), 0.0);
+
+    std::array<double, ndim> value;
+    interpolant.evaluate(outside.data(), value.data());
+    EXPECT_DOUBLE_EQ(value[0], 0.0);
+    EXPECT_DOUBLE_EQ(value[1], 0.0);
+  }
+
+  TEST_F(AleRbfTest, ControlPointsAreInterpolatedExactly)
+  {
+    for (const double radius : {0.4, 2.0})
+    {
+      const ALE::Rbf::Interpolant interpolant =
+          ALE::Rbf::select_control_points(coords_, disp_, ndim, radius, 0.0, 15);
+      ASSERT_EQ(interpolant.num_points(), 15);
+
+      std::array<double, ndim> value;
+      for (int i = 0; i < interpolant.num_points(); ++i)
+      {
+        const double* point = &interpolant.points[i * ndim];
+        const int node = node_index(point);
+        ASSERT_GE(node, 0);
+
+        interpolant.evaluate(point, value.data());
+        EXPECT_NEAR(value[0], disp_[node * ndim], 1e-12);
+        EXPECT_NEAR(value[1], disp_[node * ndim + 1], 1e-12);
+      }
+    }
+  }
+
+  TEST_F(AleRbfTest, GreedySelectionStopsAtTolerance)
+  {
+    int previous_num_points = 0;
+    for (const double tol : {1e-1, 1e-2, 1e-3, 1e-4})
+    {
+      const ALE::Rbf::Interpolant interpolant =
+          ALE::Rbf::select_control_points(coords_, disp_, ndim, 2.0, tol, 1000);
+
+      EXPECT_LE(max_error(interpolant), tol * max_disp());
+
+      // a tighter tolerance needs more points, but not all of them
+      EXPECT_GE(interpolant.num_points(), previous_num_points);
+      EXPECT_LT(interpolant.num_points(), static_cast<int>(coords_.size() / ndim));
+      previous_num_points = interpolant.num_points();
+    }
+    EXPECT_GT(previous_num_points, 1);
+  }
+
+  TEST_F(AleRbfTest, GreedySelectionStopsAtMaximumNumberOfPoints)
+  {
+    const ALE::Rbf::Interpolant interpolant =
+        ALE::Rbf::select_control_points(coords_, disp_, ndim, 2.0, 0.0, 5);
+
+    EXPECT_EQ(interpolant.num_points(), 5);
+    EXPECT_EQ(interpolant.coefficients.size(), 5 * ndim);
+    EXPECT_GT(max_error(interpolant), 0.0);
+  }
+
+  TEST_F(AleRbfTest, ZeroDisplacementsSelectNoPoints)
+  {
+    std::fill(disp_.begin(), disp_.end(), 0.0);
+    const ALE::Rbf::Interpolant interpolant =
+        ALE::Rbf::select_control_points(coords_, disp_, ndim, 2.0, 1e-3, 100);
+
+    EXPECT_EQ(interpolant.num_points(), 0);
+
+    std::array<double, ndim> value = {1.0, 1.0};
+    interpolant.evaluate(coords_.data(), value.data());
+    EXPECT_EQ(value[0], 0.0);
+    EXPECT_EQ(value[1], 0.0);
+  }
+}  // namespace
@@ -0,0 +1,537 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_beam3_reissner.hpp"
+#include "4C_beamcontact_input.hpp"
+#include "4C_beaminteraction_beam_to_beam_potential_pair.hpp"
+#include "4C_beaminteraction_potential_params.hpp"
+#include "4C_fem_condition.hpp"
+#include "4C_geometry_pair_element.hpp"
+#include "4C_geometry_pair_element_evaluation_functions.hpp"
+#include "4C_geometry_pair_scalar_types.hpp"
+#include "4C_global_data.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_fad.hpp"
+
+#include <Sacado.hpp>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace
+{
+  using namespace FourC;
+
+  using Beam = GEOMETRYPAIR::t_hermite;
+  using Solid = GEOMETRYPAIR::t_hex8;
+
+  //! number of evaluation points per beam element
+  constexpr unsigned int n_points = 10;
+
+  //! dynamic FAD type previously used for all beam interaction pairs
+  using DynamicFad = Sacado::Fad::DFad<double>;
+
+  //! fixed size FAD types used by the pairs
+  using PotentialFad = BeamInteraction::beam_to_beam_potential_fad_type<2, 2>;
+  using MeshtyingFad = GEOMETRYPAIR::line_to_volume_scalar_type<Beam, Solid>;
+
+  //! parameter coordinate of the i-th evaluation point on a line element
+  double point_coordinate(const unsigned int i) { return -1.0 + (2.0 * i + 1.0) / n_points; }
+
+  /**
+   * \brief Set the element data such that its DoFs are the derivative directions starting at
+   * first_dof.
+   */
+  template <typename Element, typename ScalarType>
+  GEOMETRYPAIR::ElementData<Element, ScalarType> get_fad_element_data(
+      const Core::LinAlg::Matrix<Element::n_dof_, 1, double>& q, const unsigned int n_dof_total,
+      const unsigned int first_dof)
+  {
+    GEOMETRYPAIR::ElementData<Element, ScalarType> element_data;
+    for (unsigned int i_dof = 0; i_dof < Element::n_dof_; i_dof++)
+      element_data.element_position_(i_dof) =
+          Core::FADUtils::HigherOrderFadValue<ScalarType>::apply(
+              n_dof_total, first_dof + i_dof, q(i_dof));
+    return element_data;
+  }
+
+  //! two beam elements in a distance of about one and a hex8 element around the first one
+  struct TestGeometry
+  {
+    TestGeometry()
+    {
+      const double beam_1[12] = {0.0, 0.0, 0.0, 1.0, 0.1, 0.0, 1.0, 0.2, 0.1, 1.0, 0.0, 0.1};
+      const double beam_2[12] = {0.1, 1.0, 0.0, 0.9, 0.1, 0.3, 0.9, 1.2, 0.4, 1.0, 0.2, 0.0};
+      for (unsigned int i = 0; i < Beam::n_dof_; i++)
+      {
+        q_beam_1(i) = beam_1[i];
+        q_beam_2(i) = beam_2[i];
+      }
+
+      const double corners[8][3] = {{-0.2, -0.5, -0.5}, {1.2, -0.5, -0.5}, {1.2, 0.5, -0.5},
+          {-0.2, 0.5, -0.5}, {-0.2, -0.5, 0.5}, {1.2, -0.5, 0.5}, {1.2, 0.5, 0.5},
+          {-0.2, 0.5, 0.5}};
+      for (unsigned int node = 0; node < 8; node++)
+        for (unsigned int dim = 0; dim < 3; dim++)
+          q_solid(3 * node + dim) = corners[node][dim] + 0.01 * std::sin(3.0 * node + dim);
+    }
+
+    Core::LinAlg::Matrix<Beam::n_dof_, 1, double> q_beam_1;
+    Core::LinAlg::Matrix<Beam::n_dof_, 1, double> q_beam_2;
+    Core::LinAlg::Matrix<Solid::n_dof_, 1, double> q_solid;
+    double beam_length = 1.0;
+  };
+
+  /**
+   * \brief Forces and their linearization of a beam-to-beam interaction potential 1/d^6 evaluated
+   * with the given FAD type. This is a simplified version of the Gauss point loop in
+   * BeamToBeamPotentialPair, which is used to compare the timings of both FAD types.
+   */
+  template <typename ScalarType>
+  void evaluate_beam_to_beam_potential(const TestGeometry& geometry,
+      Core::LinAlg::Matrix<2 * Beam::n_dof_, 1, double>& force,
+      Core::LinAlg::Matrix<2 * Beam::n_dof_, 2 * Beam::n_dof_, double>& stiffness)
+  {
+    constexpr unsigned int n_dof = 2 * Beam::n_dof_;
+    constexpr double exponent = 6.0;
+
+    auto beam_1 = get_fad_element_data<Beam, ScalarType>(geometry.q_beam_1, n_dof, 0);
+    auto beam_2 = get_fad_element_data<Beam, ScalarType>(geometry.q_beam_2, n_dof, Beam::n_dof_);
+    beam_1.shape_function_data_.ref_length_ = geometry.beam_length;
+    beam_2.shape_function_data_.ref_length_ = geometry.beam_length;
+
+    Core::LinAlg::Matrix<n_dof, 1, ScalarType> force_fad(true);
+    Core::LinAlg::Matrix<3, 1, ScalarType> r_1, r_2, dist;
+    Core::LinAlg::Matrix<1, Beam::n_nodes_ * Beam::n_val_, double> N_1, N_2;
+    for (unsigned int i_point_1 = 0; i_point_1 < n_points; i_point_1++)
+    {
+      const double xi_1 = point_coordinate(i_point_1);
+      GEOMETRYPAIR::evaluate_position<Beam>(xi_1, beam_1, r_1);
+      GEOMETRYPAIR::EvaluateShapeFunction<Beam>::evaluate(N_1, xi_1, beam_1.shape_function_data_);
+
+      for (unsigned int i_point_2 = 0; i_point_2 < n_points; i_point_2++)
+      {
+        const double xi_2 = point_coordinate(i_point_2);
+        GEOMETRYPAIR::evaluate_position<Beam>(xi_2, beam_2, r_2);
+        GEOMETRYPAIR::EvaluateShapeFunction<Beam>::evaluate(N_2, xi_2, beam_2.shape_function_data_);
+
+        dist = Core::FADUtils::diff_vector(r_1, r_2);
+        const ScalarType norm_dist = Core::FADUtils::vector_norm(dist);
+        const ScalarType factor = -exponent * std::pow(norm_dist, -exponent - 2.0);
+
+        for (unsigned int i_shape = 0; i_shape < Beam::n_nodes_ * Beam::n_val_; i_shape++)
+        {
+          for (unsigned int dim = 0; dim < 3; dim++)
+          {
+            force_fad(3 * i_shape + dim) += N_1(i_shape) * factor * dist(dim);
+            force_fad(Beam::n_dof_ + 3 * i_shape + dim) -= N_2(i_shape) * factor * dist(dim);
+          }
+        }
+      }
+    }
+
+    for (unsigned int i_dof = 0; i_dof < n_dof; i_dof++)
+    {
+      force(i_dof) = force_fad(i_dof).val();
+      for (unsigned int j_dof = 0; j_dof < n_dof; j_dof++)
+        stiffness(i_dof, j_dof) = force_fad(i_dof).dx(j_dof);
+    }
+  }
+
+  /**
+   * \brief Forces and their linearization of a penalty coupling of the beam centerline and the
+   * solid evaluated with the given FAD type, as done in the beam-to-solid volume meshtying pairs.
+   */
+  template <typename ScalarType>
+  void evaluate_beam_to_solid_meshtying(const TestGeometry& geometry,
+      Core::LinAlg::Matrix<Beam::n_dof_ + Solid::n_dof_, 1, double>& force,
+      Core::LinAlg::Matrix<Beam::n_dof_ + Solid::n_dof_, Beam::n_dof_ + Solid::n_dof_, double>&
+          stiffness)
+  {
+    constexpr unsigned int n_dof = Beam::n_dof_ + Solid::n_dof_;
+    constexpr double penalty_parameter = 100.0;
+
+    auto beam = get_fad_element_data<Beam, ScalarType>(geometry.q_beam_1, n_dof, 0);
+    auto solid = get_fad_element_data<Solid, ScalarType>(geometry.q_solid, n_dof, Beam::n_dof_);
+    beam.shape_function_data_.ref_length_ = geometry.beam_length;
+
+    Core::LinAlg::Matrix<n_dof, 1, ScalarType> force_fad(true);
+    Core::LinAlg::Matrix<3, 1, ScalarType> r_beam, r_solid, dist;
+    Core::LinAlg::Matrix<1, Beam::n_nodes_ * Beam::n_val_, double> N_beam;
+    Core::LinAlg::Matrix<1, Solid::n_nodes_, double> N_solid;
+    Core::LinAlg::Matrix<3, 1, double> xi_solid;
+    for (unsigned int i_point = 0; i_point < n_points; i_point++)
+    {
+      // the projection of the beam point is done with double values in the pairs
+      const double xi_beam = point_coordinate(i_point);
+      xi_solid(0) = xi_beam;
+      xi_solid(1) = 0.1 * xi_beam;
+      xi_solid(2) = 0.2;
+
+      GEOMETRYPAIR::evaluate_position<Beam>(xi_beam, beam, r_beam);
+      GEOMETRYPAIR::evaluate_position<Solid>(xi_solid, solid, r_solid);
+      GEOMETRYPAIR::EvaluateShapeFunction<Beam>::evaluate(
+          N_beam, xi_beam, beam.shape_function_data_);
+      GEOMETRYPAIR::EvaluateShapeFunction<Solid>::evaluate(N_solid, xi_solid);
+
+      dist = Core::FADUtils::diff_vector(r_beam, r_solid);
+      for (unsigned int dim = 0; dim < 3; dim++)
+      {
+        for (unsigned int i_shape = 0; i_shape < Beam::n_nodes_ * Beam::n_val_; i_shape++)
+          force_fad(3 * i_shape + dim) += penalty_parameter * N_beam(i_shape) * dist(dim);
+        for (unsigned int i_node = 0; i_node < Solid::n_nodes_; i_node++)
+          force_fad(Beam::n_dof_ + 3 * i_node + dim) -=
+              penalty_parameter * N_solid(i_node) * dist(dim);
+      }
+    }
+
+    for (unsigned int i_dof = 0; i_dof < n_dof; i_dof++)
+    {
+      force(i_dof) = force_fad(i_dof).val();
+      for (unsigned int j_dof = 0; j_dof < n_dof; j_dof++)
+        stiffness(i_dof, j_dof) = force_fad(i_dof).dx(j_dof);
+    }
+  }
+
+  //! average time in microseconds of the given function
+  template <class Function>
+  double time_per_evaluation(Function&& function)
+  {
+    constexpr int n_repetitions = 2000;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < n_repetitions; n++) function();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / n_repetitions;
+  }
+
+  template <unsigned int n_dof, typename Function>
+  void expect_same_results(Function&& evaluate_dynamic, Function&& evaluate_fixed)
+  {
+    Core::LinAlg::Matrix<n_dof, 1, double> force_dynamic, force_fixed;
+    Core::LinAlg::Matrix<n_dof, n_dof, double> stiffness_dynamic, stiffness_fixed;
+    evaluate_dynamic(force_dynamic, stiffness_dynamic);
+    evaluate_fixed(force_fixed, stiffness_fixed);
+
+    for (unsigned int i_dof = 0; i_dof < n_dof; i_dof++)
+    {
+      EXPECT_NEAR(force_dynamic(i_dof), force_fixed(i_dof), 1e-10 * force_dynamic.norm_inf());
+      for (unsigned int j_dof = 0; j_dof < n_dof; j_dof++)
+        EXPECT_NEAR(stiffness_dynamic(i_dof, j_dof), stiffness_fixed(i_dof, j_dof),
+            1e-10 * stiffness_dynamic.norm_inf());
+    }
+  }
+
+  /**
+   * Class to test the beam-to-beam potential pair with the fixed size FAD type. Two Hermite
+   * Simo-Reissner beam elements with an enclosed angle of about 53 degrees interact via a van der
+   * Waals type potential.
+   */
+  class BeamToBeamPotentialPairTest : public ::testing::Test
+  {
+   protected:
+    static constexpr unsigned int n_nodes = 2;
+    static constexpr unsigned int n_val = 2;
+    static constexpr unsigned int n_dof = 3 * n_nodes * n_val;
+
+    BeamToBeamPotentialPairTest()
+    {
+      // Beam material with a circular cross-section of radius 0.1.
+      Core::IO::InputParameterContainer beam_material;
+      beam_material.add("YOUNG", 1.0);
+      beam_material.add("SHEARMOD", -1.0);
+      beam_material.add("POISSONRATIO", 0.3);
+      beam_material.add("DENS", 1.0);
+      beam_material.add("CROSSAREA", 0.01 * M_PI);
+      beam_material.add("SHEARCORR", 1.0);
+      beam_material.add("MOMINPOL", 0.00005 * M_PI);
+      beam_material.add("MOMIN2", 0.000025 * M_PI);
+      beam_material.add("MOMIN3", 0.000025 * M_PI);
+      beam_material.add("FAD", false);
+      beam_material.add("INTERACTIONRADIUS", 0.1);
+      material_parameter_ = Mat::make_parameter(
+          1, Core::Materials::MaterialType::m_beam_reissner_elast_hyper, beam_material);
+
+      // Create the beam elements with straight reference configurations along the x-axis.
+      const std::vector<std::vector<double>> xrefe = {
+          {0.0, 0.0, 0.0, 1.0, 0.0, 0.0}, {0.2, 0.5, -0.3, 1.2, 0.5, -0.3}};
+      for (unsigned int i_beam = 0; i_beam < 2; i_beam++)
+      {
+        const int node_ids[2] = {static_cast<int>(2 * i_beam), static_cast<int>(2 * i_beam + 1)};
+        beam_elements_[i_beam] = std::make_shared<Discret::Elements::Beam3r>(i_beam, 0);
+        beam_elements_[i_beam]->set_node_ids(2, node_ids);
+        beam_elements_[i_beam]->set_centerline_hermite(true);
+        beam_elements_[i_beam]->set_material(0, material_parameter_->create_material());
+        beam_elements_[i_beam]->set_up_reference_geometry<2, 2, 2>(
+            xrefe[i_beam], std::vector<double>(6, 0.0));
+      }
+
+      // Current positions and tangents of the centerline nodes.
+      q_beam_1_ = {0.0, 0.0, 0.0, 1.0, 0.05, 0.0, 1.0, 0.02, 0.01, 0.95, -0.05, 0.02};
+      q_beam_2_ = {0.2, 0.5, -0.3, 0.6, 0.0, 0.8, 0.8, 0.5, 0.5, 0.6, 0.02, 0.8};
+
+      // Unit line charge densities on both beams.
+      for (auto& condition : line_charge_conditions_)
+      {
+        condition = std::make_shared<Core::Conditions::Condition>(0,
+            Core::Conditions::BeamPotential_LineChargeDensity, false,
+            Core::Conditions::geometry_type_line);
+        condition->parameters().add("VAL", 1.0);
+        condition->parameters().add("FUNCT", std::optional<int>());
+      }
+    }
+
+    /**
+     * \brief Create an initialized and set up pair with the given evaluation strategy.
+     */
+    template <typename ScalarType>
+    std::shared_ptr<BeamInteraction::BeamPotentialPair> create_pair(
+        const Inpar::BeamPotential::BeamPotentialStrategy strategy)
+    {
+      auto parameters = std::make_shared<Teuchos::ParameterList>();
+      Teuchos::ParameterList& beam_potential = parameters->sublist("BEAM POTENTIAL");
+      beam_potential.set<std::string>("POT_LAW_EXPONENT", "6.0");
+      beam_potential.set<std::string>("POT_LAW_PREFACTOR", "1.0");
+      beam_potential.set("STRATEGY", strategy);
+      beam_potential.set("BEAMPOTENTIAL_TYPE", Inpar::BeamPotential::beampot_vol);
+      beam_potential.set("CUTOFF_RADIUS", -1.0);
+      beam_potential.set("REGULARIZATION_TYPE", Inpar::BeamPotential::regularization_none);
+      beam_potential.set("REGULARIZATION_SEPARATION", -1.0);
+      beam_potential.set("NUM_INTEGRATION_SEGMENTS", 2);
+      beam_potential.set("NUM_GAUSSPOINTS", 10);
+      beam_potential.set("AUTOMATIC_DIFFERENTIATION", not std::is_same_v<ScalarType, double>);
+      beam_potential.set("CHOICE_MASTER_SLAVE",
+          Inpar::BeamPotential::MasterSlaveChoice::smaller_eleGID_is_slave);
+      beam_potential.set("POTENTIAL_REDUCTION_LENGTH", -1.0);
+      beam_potential.set("BEAMPOT_OCTREE", BeamContact::boct_none);
+      beam_potential.set("BEAMPOT_BTSOL", false);
+      beam_potential.sublist("RUNTIME VTK OUTPUT").set("VTK_OUTPUT_BEAM_POTENTIAL", false);
+      Global::Problem::instance()->set_parameter_list(parameters);
+
+      auto params = std::make_shared<BeamInteraction::BeamPotentialParams>();
+      params->init(0.0);
+      params->setup();
+
+      auto pair =
+          std::make_shared<BeamInteraction::BeamToBeamPotentialPair<n_nodes, n_val, ScalarType>>();
+      pair->init(params, beam_elements_[0].get(), beam_elements_[1].get());
+      pair->setup();
+      return pair;
+    }
+
+    /**
+     * \brief Evaluate the pair for the given centerline DoFs and assemble the forces and stiffness
+     * of both elements.
+     */
+    void evaluate_pair(BeamInteraction::BeamPotentialPair& pair, const std::vector<double>& q_1,
+        const std::vector<double>& q_2, Core::LinAlg::SerialDenseVector& force,
+        Core::LinAlg::SerialDenseMatrix& stiffness)
+    {
+      const std::vector<Core::Conditions::Condition*> conditions = {
+          line_charge_conditions_[0].get(), line_charge_conditions_[1].get()};
+      Core::LinAlg::SerialDenseVector force_1, force_2;
+      Core::LinAlg::SerialDenseMatrix stiff_11, stiff_12, stiff_21, stiff_22;
+
+      pair.reset_state(0.0, q_1, q_2);
+      EXPECT_TRUE(pair.evaluate(
+          &force_1, &force_2, &stiff_11, &stiff_12, &stiff_21, &stiff_22, conditions, 1.0, 6.0));
+
+      force.size(2 * n_dof);
+      stiffness.shape(2 * n_dof, 2 * n_dof);
+      for (unsigned int i_dof = 0; i_dof < n_dof; i_dof++)
+      {
+        force(i_dof) = force_1(i_dof);
+        force(n_dof + i_dof) = force_2(i_dof);
+        for (unsigned int j_dof = 0; j_dof < n_dof; j_dof++)
+        {
+          stiffness(i_dof, j_dof) = stiff_11(i_dof, j_dof);
+          stiffness(i_dof, n_dof + j_dof) = stiff_12(i_dof, j_dof);
+          stiffness(n_dof + i_dof, j_dof) = stiff_21(i_dof, j_dof);
+          stiffness(n_dof + i_dof, n_dof + j_dof) = stiff_22(i_dof, j_dof);
+        }
+      }
+    }
+
+    /**
+     * \brief Compare the stiffness of the pair with central finite differences of its forces.
+     */
+    void expect_stiffness_matches_finite_differences(BeamInteraction::BeamPotentialPair& pair)
+    {
+      constexpr double delta = 1e-6;
+
+      Core::LinAlg::SerialDenseVector force, force_plus, force_minus;
+      Core::LinAlg::SerialDenseMatrix stiffness, stiffness_perturbed;
+      evaluate_pair(pair, q_beam_1_, q_beam_2_, force, stiffness);
+      const double stiffness_max = max_abs(stiffness);
+      ASSERT_GT(stiffness_max, 0.0);
+
+      for (unsigned int j_dof = 0; j_dof < 2 * n_dof; j_dof++)
+      {
+        std::vector<double> q_1 = q_beam_1_;
+        std::vector<double> q_2 = q_beam_2_;
+        double& q_j = j_dof < n_dof ? q_1[j_dof] : q_2[j_dof - n_dof];
+
+        q_j += delta;
+        evaluate_pair(pair, q_1, q_2, force_plus, stiffness_perturbed);
+        q_j -= 2.0 * delta;
+        evaluate_pair(pair, q_1, q_2, force_minus, stiffness_perturbed);
+
+        for (unsigned int i_dof = 0; i_dof < 2 * n_dof; i_dof++)
+          EXPECT_NEAR(stiffness(i_dof, j_dof),
+              (force_plus(i_dof) - force_minus(i_dof)) / (2.0 * delta), 1e-6 * stiffness_max);
+      }
+    }
+
+    //! maximal absolute entry of a matrix
+    static double max_abs(const Core::LinAlg::SerialDenseMatrix& matrix)
+    {
+      double max = 0.0;
+      for (int i = 0; i < matrix.numRows(); i++)
+        for (int j = 0; j < matrix.numCols(); j++) max = std::max(max, std::abs(matrix(i, j)));
+      return max;
+    }
+
+    //! parameters of the beam material
+    std::unique_ptr<Core::Mat::PAR::Parameter> material_parameter_;
+
+    //! the two beam elements
+    std::array<std::shared_ptr<Discret::Elements::Beam3r>, 2> beam_elements_;
+
+    //! centerline DoFs of both beam elements
+    std::vector<double> q_beam_1_;
+    std::vector<double> q_beam_2_;
+
+    //! line charge conditions of both beam elements
+    std::array<std::shared_ptr<Core::Conditions::Condition>, 2> line_charge_conditions_;
+  };
+
+  /**
+   * Test that the pair with the fixed size FAD type gives the same forces as the pair with the
+   * analytic linearization and that its stiffness is the linearization of the forces.
+   */
+  TEST_F(BeamToBeamPotentialPairTest, DoubleLengthSpecificLargeSeparation)
+  {
+    const auto strategy = Inpar::BeamPotential::strategy_doublelengthspec_largesepapprox;
+    auto pair_analytic = create_pair<double>(strategy);
+    auto pair_fad = create_pair<PotentialFad>(strategy);
+
+    Core::LinAlg::SerialDenseVector force_analytic, force_fad;
+    Core::LinAlg::SerialDenseMatrix stiffness_analytic, stiffness_fad;
+    evaluate_pair(*pair_analytic, q_beam_1_, q_beam_2_, force_analytic, stiffness_analytic);
+    evaluate_pair(*pair_fad, q_beam_1_, q_beam_2_, force_fad, stiffness_fad);
+
+    double force_max = 0.0;
+    for (unsigned int i_dof = 0; i_dof < 2 * n_dof; i_dof++)
+      force_max = std::max(force_max, std::abs(force_analytic(i_dof)));
+    const double stiffness_max = max_abs(stiffness_analytic);
+
+    for (unsigned int i_dof = 0; i_dof < 2 * n_dof; i_dof++)
+    {
+      EXPECT_NEAR(force_fad(i_dof), force_analytic(i_dof), 1e-12 * force_max);
+      for (unsigned int j_dof = 0; j_dof < 2 * n_dof; j_dof++)
+        EXPECT_NEAR(stiffness_fad(i_dof, j_dof), stiffness_analytic(i_dof, j_dof),
+            1e-10 * stiffness_max);
+    }
+
+    expect_stiffness_matches_finite_differences(*pair_fad);
+  }
+
+  /**
+   * Test the stiffness of the pair with the fixed size FAD type for the single length specific
+   * strategy. Here, the parameter coordinate of the closest point on the master beam is the
+   * additional derivative direction of the FAD type.
+   */
+  TEST_F(BeamToBeamPotentialPairTest, SingleLengthSpecificSmallSeparation)
+  {
+    auto pair_fad =
+        create_pair<PotentialFad>(Inpar::BeamPotential::strategy_singlelengthspec_smallsepapprox);
+
+    expect_stiffness_matches_finite_differences(*pair_fad);
+  }
+
+  /**
+   * Test that the fixed size FAD type of the beam-to-solid volume meshtying pairs gives the same
+   * forces and stiffness as the dynamic FAD type.
+   */
+  TEST(BeamInteractionFadScalarTypesTest, BeamToSolidMeshtying)
+  {
+    const TestGeometry geometry;
+    constexpr unsigned int n_dof = Beam::n_dof_ + Solid::n_dof_;
+    using Force = Core::LinAlg::Matrix<n_dof, 1, double>;
+    using Stiffness = Core::LinAlg::Matrix<n_dof, n_dof, double>;
+
+    std::function<void(Force&, Stiffness&)> evaluate_dynamic = [&](Force& f, Stiffness& k)
+    { evaluate_beam_to_solid_meshtying<DynamicFad>(geometry, f, k); };
+    std::function<void(Force&, Stiffness&)> evaluate_fixed = [&](Force& f, Stiffness& k)
+    { evaluate_beam_to_solid_meshtying<MeshtyingFad>(geometry, f, k); };
+
+    expect_same_results<n_dof>(evaluate_dynamic, evaluate_fixed);
+  }
+
+  /*
+   * Timings of the evaluation with dynamic and fixed size FAD types. Run with
+   * --gtest_also_run_disabled_tests --gtest_filter=*Benchmark* in a release build.
+   */
+  TEST(BeamInteractionFadScalarTypesTest, DISABLED_Benchmark)
+  {
+    const TestGeometry geometry;
+
+    Core::LinAlg::Matrix<2 * Beam::n_dof_, 1, double> force_potential;
+    Core::LinAlg::Matrix<2 * Beam::n_dof_, 2 * Beam::n_dof_, double> stiffness_potential;
+    const double t_potential_dynamic = time_per_evaluation(
+        [&]()
+        {
+          evaluate_beam_to_beam_potential<DynamicFad>(
+              geometry, force_potential, stiffness_potential);
+        });
+    const double t_potential_fixed = time_per_evaluation(
+        [&]()
+        {
+          evaluate_beam_to_beam_potential<PotentialFad>(
+              geometry, force_potential, stiffness_potential);
+        });
+
+    Core::LinAlg::Matrix<Beam::n_dof_ + Solid::n_dof_, 1, double> force_meshtying;
+    Core::LinAlg::Matrix<Beam::n_dof_ + Solid::n_dof_, Beam::n_dof_ + Solid::n_dof_, double>
+        stiffness_meshtying;
+    const double t_meshtying_dynamic = time_per_evaluation(
+        [&]()
+        {
+          evaluate_beam_to_solid_meshtying<DynamicFad>(
+              geometry, force_meshtying, stiffness_meshtying);
+        });
+    const double t_meshtying_fixed = time_per_evaluation(
+        [&]()
+        {
+          evaluate_beam_to_solid_meshtying<MeshtyingFad>(
+              geometry, force_meshtying, stiffness_meshtying);
+        });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "beam-to-beam potential:  DFad " << t_potential_dynamic << " us,  SLFad "
+              << t_potential_fixed << " us,  speedup " << t_potential_dynamic / t_potential_fixed
+              << std::endl;
+    std::cout << "beam-to-solid meshtying: DFad " << t_meshtying_dynamic << " us,  SLFad "
+              << t_meshtying_fixed << " us,  speedup " << t_meshtying_dynamic / t_meshtying_fixed
+              << std::endl;
+
+    EXPECT_TRUE(std::isfinite(force_potential.norm2() + force_meshtying.norm2()));
+  }
+}  // namespace
@@ -0,0 +1,183 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fsi_nox_iqn.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+#include <NOX_Epetra_Group.H>
+#include <NOX_Epetra_Interface_Required.H>
+#include <NOX_Epetra_Vector.H>
+#include <NOX_Solver_Factory.H>
+#include <NOX_Solver_Generic.H>
+#include <NOX_StatusTest_Combo.H>
+#include <NOX_StatusTest_MaxIters.H>
+#include <NOX_StatusTest_NormF.H>
+#include <Teuchos_ParameterList.hpp>
+
+#include <array>
+#include <cmath>
+#include <string>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr int n = 5;
+
+  /*!
+   * Residual r(x) = x~(x) - x of the linear fixed-point map x~(x) = A x + b. The spectral radius
+   * of A is larger than one, i.e., the plain fixed-point iteration diverges.
+   */
+  class LinearFixedPointMap : public ::NOX::Epetra::Interface::Required
+  {
+   public:
+    bool computeF(const Epetra_Vector& x, Epetra_Vector& F, const FillType fillFlag) override
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        F[i] = b[i] - x[i];
+        for (int j = 0; j < n; ++j)
+          F[i] += (i == j ? 1.0 + 0.1 * i : 0.3 * std::sin(i + 2.0 * j + 1.0)) * x[j];
+      }
+      return true;
+    }
+
+    //! constant part of the map, changes from one time step to the next
+    std::array<double, n> b;
+  };
+
+  class InterfaceQuasiNewtonTest : public ::testing::Test
+  {
+   protected:
+    InterfaceQuasiNewtonTest()
+        : map_(n, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          fixed_point_map_(Teuchos::make_rcp<LinearFixedPointMap>()),
+          factory_(Teuchos::make_rcp<FourC::NOX::FSI::InterfaceQuasiNewtonFactory>()),
+          x_(map_, true)
+    {
+    }
+
+    //! Set up the parameters of the partitioned solver as FSI::Partitioned does.
+    void set_parameters(const std::string& method, const int reuse, const int restart = 0)
+    {
+      params_.set("Nonlinear Solver", "Line Search Based");
+      params_.sublist("Printing").set("Output Information", static_cast<int>(::NOX::Utils::Error));
+
+      Teuchos::ParameterList& dir_params = params_.sublist("Direction");
+      dir_params.set("Method", "User Defined");
+      dir_params.set("User Defined Direction Factory",
+          Teuchos::rcp_dynamic_cast<::NOX::Direction::UserDefinedFactory>(factory_));
+
+      Teuchos::ParameterList& iqn_params = dir_params.sublist("Interface Quasi-Newton");
+      iqn_params.set<std::string>("Method", method);
+      iqn_params.set("omega", 0.01);
+      iqn_params.set("max columns", 50);
+      iqn_params.set("reuse", reuse);
+      iqn_params.set("restart", restart);
+      iqn_params.set("filter tolerance", 1e-6);
+
+      Teuchos::ParameterList& line_search_params = params_.sublist("Line Search");
+      line_search_params.set("Method", "Full Step");
+      line_search_params.sublist("Full Step").set("Full Step", 1.0);
+    }
+
+    /*!
+     * Solve one time step of the fixed-point problem starting from the solution of the last time
+     * step and return the number of iterations.
+     */
+    int solve_time_step(const int step)
+    {
+      for (int i = 0; i < n; ++i)
+        fixed_point_map_->b[i] = std::cos(0.5 * i) + 0.2 * step * std::sin(i);
+
+      ::NOX::Epetra::Vector nox_x(Teuchos::rcpFromRef(x_), ::NOX::Epetra::Vector::CreateView);
+      auto group = Teuchos::make_rcp<::NOX::Epetra::Group>(
+          params_.sublist("Printing"), fixed_point_map_, nox_x);
+
+      auto combo = Teuchos::make_rcp<::NOX::StatusTest::Combo>(::NOX::StatusTest::Combo::OR);
+      combo->addStatusTest(Teuchos::make_rcp<::NOX::StatusTest::NormF>(
+          1e-8, ::NOX::Abstract::Vector::TwoNorm, ::NOX::StatusTest::NormF::Unscaled));
+      combo->addStatusTest(Teuchos::make_rcp<::NOX::StatusTest::MaxIters>(50));
+
+      Teuchos::RCP<::NOX::Solver::Generic> solver =
+          ::NOX::Solver::buildSolver(group, combo, Teuchos::rcpFromRef(params_));
+      EXPECT_EQ(solver->solve(), ::NOX::StatusTest::Converged);
+
+      // continue the next time step from the converged solution
+      const auto& solution = dynamic_cast<const ::NOX::Epetra::Vector&>(
+          solver->getSolutionGroup().getX());
+      x_ = solution.getEpetraVector();
+
+      return solver->getNumIterations();
+    }
+
+    Epetra_Map map_;
+    Teuchos::RCP<LinearFixedPointMap> fixed_point_map_;
+    Teuchos::RCP<FourC::NOX::FSI::InterfaceQuasiNewtonFactory> factory_;
+    Epetra_Vector x_;
+    Teuchos::ParameterList params_;
+  };
+
+  TEST_F(InterfaceQuasiNewtonTest, LeastSquaresConvergesInNPlusOneIterations)
+  {
+    set_parameters("ILS", 0);
+
+    // one relaxation step and n quasi-Newton steps with a growing number of columns
+    EXPECT_EQ(solve_time_step(0), n + 1);
+
+    // without reuse, the next time step starts from scratch
+    EXPECT_EQ(solve_time_step(1), n + 1);
+  }
+
+  TEST_F(InterfaceQuasiNewtonTest, MultiVectorJacobianConvergesInNPlusOneIterations)
+  {
+    set_parameters("IMVJ", 0);
+
+    EXPECT_EQ(solve_time_step(0), n + 1);
+  }
+
+  TEST_F(InterfaceQuasiNewtonTest, LeastSquaresReusesColumnsOfPreviousTimeStep)
+  {
+    set_parameters("ILS", 1);
+
+    EXPECT_EQ(solve_time_step(0), n + 1);
+
+    // the n columns of the last time step span the whole space and the map is linear
+    EXPECT_EQ(solve_time_step(1), 1);
+  }
+
+  TEST_F(InterfaceQuasiNewtonTest, MultiVectorJacobianKeepsJacobianOfPreviousTimeSteps)
+  {
+    // the reuse of columns only affects ILS
+    set_parameters("IMVJ", 0);
+
+    EXPECT_EQ(solve_time_step(0), n + 1);
+
+    // the inverse Jacobian of the last time step is exact for the linear map
+    EXPECT_EQ(solve_time_step(1), 1);
+
+    // the time step without new columns does not discard the Jacobian
+    EXPECT_EQ(solve_time_step(2), 1);
+  }
+
+  TEST_F(InterfaceQuasiNewtonTest, MultiVectorJacobianRestartsAfterGivenTimeSteps)
+  {
+    set_parameters("IMVJ", 0, 2);
+
+    EXPECT_EQ(solve_time_step(0), n + 1);
+    EXPECT_EQ(solve_time_step(1), 1);
+
+    // the Jacobian is discarded after two time steps
+    EXPECT_EQ(solve_time_step(2), n + 1);
+    EXPECT_EQ(solve_time_step(3), 1);
+  }
+}  // namespace
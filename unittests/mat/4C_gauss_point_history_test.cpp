@@ -0,0 +1,122 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_gauss_point_history.hpp"
+
+#include "4C_comm_pack_buffer.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  Core::LinAlg::Matrix<3, 3> get_test_matrix(double offset)
+  {
+    Core::LinAlg::Matrix<3, 3> matrix(false);
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j) matrix(i, j) = offset + 3.0 * i + j;
+    return matrix;
+  }
+
+  TEST(GaussPointHistoryTest, AssignAndAccess)
+  {
+    Mat::GaussPointHistory<3, 3> history;
+    history.assign(4, get_test_matrix(1.0));
+
+    EXPECT_EQ(history.size(), 4);
+    for (int gp = 0; gp < 4; ++gp) FOUR_C_EXPECT_NEAR(history[gp], get_test_matrix(1.0), 0.0);
+
+    // all Gauss points are stored one after the other
+    EXPECT_EQ(history.data(1), history.data(0) + 9);
+    EXPECT_EQ(history.data(3), history.data(0) + 27);
+  }
+
+  TEST(GaussPointHistoryTest, ViewAndCopy)
+  {
+    Mat::GaussPointHistory<3, 3> history;
+    history.assign(2, get_test_matrix(0.0));
+
+    // changes of a view are stored in the history
+    history[1].update(1.0, get_test_matrix(10.0), 0.0);
+    FOUR_C_EXPECT_NEAR(history[0], get_test_matrix(0.0), 0.0);
+    FOUR_C_EXPECT_NEAR(history[1], get_test_matrix(10.0), 0.0);
+
+    // changes of a copy are not
+    Core::LinAlg::Matrix<3, 3> copy = history.copy(0);
+    copy.scale(2.0);
+    FOUR_C_EXPECT_NEAR(history[0], get_test_matrix(0.0), 0.0);
+  }
+
+  TEST(GaussPointHistoryTest, CopyAllGaussPoints)
+  {
+    Mat::GaussPointHistory<3, 3> last;
+    last.assign(3, get_test_matrix(0.0));
+    Mat::GaussPointHistory<3, 3> current;
+    current.assign(3, get_test_matrix(0.0));
+    for (int gp = 0; gp < 3; ++gp) current[gp].update(1.0, get_test_matrix(gp + 5.0), 0.0);
+
+    last = current;
+
+    for (int gp = 0; gp < 3; ++gp) FOUR_C_EXPECT_NEAR(last[gp], get_test_matrix(gp + 5.0), 0.0);
+  }
+
+  TEST(GaussPointHistoryTest, PackUnpack)
+  {
+    Mat::GaussPointHistory<3, 3> history;
+    history.assign(3, get_test_matrix(0.0));
+    for (int gp = 0; gp < 3; ++gp) history[gp].update(1.0, get_test_matrix(gp + 1.0), 0.0);
+
+    Core::Communication::PackBuffer data;
+    add_to_pack(data, history);
+    add_to_pack(data, 42);
+
+    Mat::GaussPointHistory<3, 3> unpacked;
+    Core::Communication::UnpackBuffer buffer(data());
+    extract_from_pack(buffer, unpacked);
+    int trailer = 0;
+    extract_from_pack(buffer, trailer);
+
+    EXPECT_EQ(unpacked.size(), 3);
+    for (int gp = 0; gp < 3; ++gp)
+      FOUR_C_EXPECT_NEAR(unpacked[gp], get_test_matrix(gp + 1.0), 0.0);
+    EXPECT_EQ(trailer, 42);
+    EXPECT_TRUE(buffer.at_end());
+  }
+
+  TEST(GaussPointHistoryTest, PackedLayoutOfVectorOfMatrices)
+  {
+    std::vector<Core::LinAlg::Matrix<3, 3>> vector_history;
+    Mat::GaussPointHistory<3, 3> history;
+    history.resize(3);
+    for (int gp = 0; gp < 3; ++gp)
+    {
+      vector_history.push_back(get_test_matrix(gp + 1.0));
+      history[gp].update(1.0, get_test_matrix(gp + 1.0), 0.0);
+    }
+
+    // both are packed identically
+    Core::Communication::PackBuffer vector_data;
+    add_to_pack(vector_data, vector_history);
+    Core::Communication::PackBuffer data;
+    add_to_pack(data, history);
+    EXPECT_EQ(data(), vector_data());
+
+    // restart data of a std::vector of matrices can be read into the history
+    Mat::GaussPointHistory<3, 3> unpacked;
+    Core::Communication::UnpackBuffer buffer(vector_data());
+    extract_from_pack(buffer, unpacked);
+
+    EXPECT_EQ(unpacked.size(), 3);
+    for (int gp = 0; gp < 3; ++gp)
+      FOUR_C_EXPECT_NEAR(unpacked[gp], get_test_matrix(gp + 1.0), 0.0);
+    EXPECT_TRUE(buffer.at_end());
+  }
+}  // namespace
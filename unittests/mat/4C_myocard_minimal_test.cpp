@@ -0,0 +1,117 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_myocard_minimal.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  class MyocardMinimalTest : public ::testing::Test
+  {
+   protected:
+    // potential at the Gauss points below, between and above the thresholds of the model
+    const std::vector<double> phi_ = {0.0, 0.01, 0.12, 0.29, 0.31, 0.62, 0.95, 1.3};
+    const int num_gp_ = phi_.size();
+    const double dt_ = 0.1;
+    const int num_steps_ = 20;
+
+    // potential at Gauss point gp in time step step
+    double potential(const int step, const int gp) const { return phi_[gp] * (1.0 + 0.05 * step); }
+
+    static void expect_equal_internal_states(
+        const MyocardMinimal& pointwise, const MyocardMinimal& batched, const int num_gp)
+    {
+      for (int gp = 0; gp < num_gp; ++gp)
+        for (int k = 0; k < 3; ++k)
+          EXPECT_EQ(pointwise.get_internal_state(k, gp), batched.get_internal_state(k, gp));
+
+      EXPECT_EQ(pointwise.get_internal_state(-1, 0), batched.get_internal_state(-1, 0));
+    }
+  };
+
+  TEST_F(MyocardMinimalTest, ReaCoeffAllGPBitwiseIdenticalToPointwise)
+  {
+    for (const bool rush_larsen : {false, true})
+    {
+      MyocardMinimal pointwise(1.0e-6, "M", num_gp_, rush_larsen);
+      MyocardMinimal batched(1.0e-6, "M", num_gp_, rush_larsen);
+
+      std::vector<double> phi(num_gp_);
+      std::vector<double> reacoeff(num_gp_);
+      for (int step = 0; step < num_steps_; ++step)
+      {
+        for (int gp = 0; gp < num_gp_; ++gp) phi[gp] = potential(step, gp);
+
+        batched.rea_coeff_all_gp(phi, dt_, reacoeff);
+        for (int gp = 0; gp < num_gp_; ++gp)
+          EXPECT_EQ(pointwise.rea_coeff(phi[gp], dt_, gp), reacoeff[gp]);
+
+        expect_equal_internal_states(pointwise, batched, num_gp_);
+
+        pointwise.update(phi.back(), dt_);
+        batched.update(phi.back(), dt_);
+      }
+    }
+  }
+
+  TEST_F(MyocardMinimalTest, ReaCoeffNAllGPBitwiseIdenticalToPointwise)
+  {
+    MyocardMinimal pointwise(1.0e-6, "M", num_gp_);
+    MyocardMinimal batched(1.0e-6, "M", num_gp_);
+
+    std::vector<double> phi(num_gp_);
+    std::vector<double> reacoeff(num_gp_);
+    for (int step = 0; step < num_steps_; ++step)
+    {
+      for (int gp = 0; gp < num_gp_; ++gp) phi[gp] = potential(step, gp);
+
+      batched.rea_coeff_n_all_gp(phi, dt_, reacoeff);
+      for (int gp = 0; gp < num_gp_; ++gp)
+        EXPECT_EQ(pointwise.rea_coeff_n(phi[gp], dt_, gp), reacoeff[gp]);
+
+      // advance the gating variables to obtain a new state at t_(n)
+      batched.rea_coeff_all_gp(phi, dt_, reacoeff);
+      for (int gp = 0; gp < num_gp_; ++gp) pointwise.rea_coeff(phi[gp], dt_, gp);
+
+      pointwise.update(phi.back(), dt_);
+      batched.update(phi.back(), dt_);
+
+      expect_equal_internal_states(pointwise, batched, num_gp_);
+    }
+  }
+
+  TEST_F(MyocardMinimalTest, RushLarsenIntegratesGatingVariableExactly)
+  {
+    // above all thresholds the gate v relaxes to zero with the time constant tau_v+ = 1.4506
+    const double phi = 1.0;
+    const double tau_vp = 1.4506;
+    const double dt = 2.0;
+
+    MyocardMinimal rushlarsen(1.0e-6, "M", 1, true);
+    rushlarsen.rea_coeff(phi, dt, 0);
+    EXPECT_NEAR(rushlarsen.get_internal_state(0, 0), std::exp(-dt / tau_vp), 1.0e-14);
+
+    // splitting the time step does not change the result for constant potential
+    MyocardMinimal rushlarsensplit(1.0e-6, "M", 1, true);
+    rushlarsensplit.rea_coeff(phi, 0.5 * dt, 0);
+    rushlarsensplit.update(phi, 0.5 * dt);
+    rushlarsensplit.rea_coeff(phi, 0.5 * dt, 0);
+    EXPECT_NEAR(
+        rushlarsensplit.get_internal_state(0, 0), rushlarsen.get_internal_state(0, 0), 1.0e-14);
+
+    // the implicit Euler scheme is only first order accurate
+    MyocardMinimal implicitEuler(1.0e-6, "M", 1, false);
+    implicitEuler.rea_coeff(phi, dt, 0);
+    EXPECT_NEAR(implicitEuler.get_internal_state(0, 0), 1.0 / (1.0 + dt / tau_vp), 1.0e-14);
+  }
+}  // namespace
@@ -0,0 +1,118 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_algorithm_timint.hpp"
+
+#include "4C_unittest_utils_assertions_test.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+
+namespace
+{
+  using namespace FourC;
+
+  class TimIntAdaptTimeStepTest : public ::testing::Test
+  {
+   protected:
+    std::unique_ptr<PARTICLEALGORITHM::TimIntVelocityVerlet> particletimint_;
+
+    const double dt_ = 0.01;
+    const double dtsafetyfactor_ = 0.75;
+    const double dtmin_ = 1.0e-4;
+    const double dtmax_ = 0.02;
+    const double dtmaxgrowth_ = 1.2;
+
+    TimIntAdaptTimeStepTest()
+    {
+      // create a parameter list
+      Teuchos::ParameterList params;
+      params.set("TIMESTEP", dt_);
+      params.set("ADAPTIVE_TIMESTEP", true);
+      params.set("TIMESTEP_SAFETY_FACTOR", dtsafetyfactor_);
+      params.set("TIMESTEP_MIN", dtmin_);
+      params.set("TIMESTEP_MAX", dtmax_);
+      params.set("TIMESTEP_MAX_GROWTH", dtmaxgrowth_);
+
+      // create particle time integration
+      particletimint_ = std::make_unique<PARTICLEALGORITHM::TimIntVelocityVerlet>(params);
+    }
+  };
+
+  TEST_F(TimIntAdaptTimeStepTest, IsAdaptiveTimeStep)
+  {
+    EXPECT_TRUE(particletimint_->is_adaptive_time_step());
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepScaledWithSafetyFactor)
+  {
+    const double admissibletimestep = 0.012;
+
+    EXPECT_NEAR(particletimint_->adapt_time_step(admissibletimestep),
+        dtsafetyfactor_ * admissibletimestep, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepDecreaseNotLimited)
+  {
+    const double admissibletimestep = 0.001;
+
+    EXPECT_NEAR(particletimint_->adapt_time_step(admissibletimestep),
+        dtsafetyfactor_ * admissibletimestep, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepGrowthLimit)
+  {
+    const double admissibletimestep = 0.016 / dtsafetyfactor_;
+
+    EXPECT_NEAR(particletimint_->adapt_time_step(admissibletimestep), dtmaxgrowth_ * dt_, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepGrowthLimitWithCurrentStepSize)
+  {
+    const double admissibletimestep = 0.016 / dtsafetyfactor_;
+
+    particletimint_->set_current_step_size(0.005);
+
+    EXPECT_NEAR(
+        particletimint_->adapt_time_step(admissibletimestep), dtmaxgrowth_ * 0.005, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepMaximum)
+  {
+    const double admissibletimestep = 1.0;
+
+    particletimint_->set_current_step_size(0.019);
+
+    EXPECT_NEAR(particletimint_->adapt_time_step(admissibletimestep), dtmax_, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepMaximumDefault)
+  {
+    Teuchos::ParameterList params;
+    params.set("TIMESTEP", dt_);
+    params.set("ADAPTIVE_TIMESTEP", true);
+    params.set("TIMESTEP_SAFETY_FACTOR", dtsafetyfactor_);
+    params.set("TIMESTEP_MIN", dtmin_);
+    params.set("TIMESTEP_MAX", -1.0);
+    params.set("TIMESTEP_MAX_GROWTH", dtmaxgrowth_);
+
+    PARTICLEALGORITHM::TimIntVelocityVerlet particletimint(params);
+
+    EXPECT_NEAR(particletimint.adapt_time_step(1.0), dt_, 1.0e-16);
+  }
+
+  TEST_F(TimIntAdaptTimeStepTest, AdaptTimeStepMinimum)
+  {
+    EXPECT_NEAR(
+        particletimint_->adapt_time_step(2.0 * dtmin_), 2.0 * dtsafetyfactor_ * dtmin_, 1.0e-16);
+
+    FOUR_C_EXPECT_THROW_WITH_MESSAGE(particletimint_->adapt_time_step(0.5 * dtmin_),
+        Core::Exception, "smaller than minimum time step size");
+  }
+}  // namespace
@@ -0,0 +1,117 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_dem_history_pair_table.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  struct HistoryPair
+  {
+    double gap_[3] = {0.0, 0.0, 0.0};
+  };
+
+  using HistoryPairTable = ParticleInteraction::DEMHistoryPairTable<HistoryPair>;
+
+  TEST(DEMHistoryPairTableTest, InsertAndFind)
+  {
+    HistoryPairTable table;
+    EXPECT_TRUE(table.empty());
+
+    table(3, 7).second.gap_[0] = 1.5;
+    table(7, 3).second.gap_[0] = -1.5;
+
+    EXPECT_EQ(table.size(), 2);
+    EXPECT_TRUE(table.contains(3, 7));
+    EXPECT_TRUE(table.contains(7, 3));
+    EXPECT_FALSE(table.contains(3, 8));
+    EXPECT_EQ(table.find(3, 8), nullptr);
+
+    ASSERT_NE(table.find(3, 7), nullptr);
+    EXPECT_DOUBLE_EQ(table.find(3, 7)->second.gap_[0], 1.5);
+    EXPECT_DOUBLE_EQ(table.find(7, 3)->second.gap_[0], -1.5);
+
+    // access of existing history pair does not insert
+    table(3, 7).first = true;
+    EXPECT_EQ(table.size(), 2);
+  }
+
+  TEST(DEMHistoryPairTableTest, GrowthKeepsHistoryPairs)
+  {
+    HistoryPairTable table;
+
+    for (int i = 0; i < 1000; ++i)
+      for (int j = 0; j < 5; ++j) table(i, 100000 + j).second.gap_[1] = i + 0.1 * j;
+
+    EXPECT_EQ(table.size(), 5000);
+
+    for (int i = 0; i < 1000; ++i)
+      for (int j = 0; j < 5; ++j)
+        EXPECT_DOUBLE_EQ(table.find(i, 100000 + j)->second.gap_[1], i + 0.1 * j);
+  }
+
+  TEST(DEMHistoryPairTableTest, EraseUntouched)
+  {
+    HistoryPairTable table;
+
+    for (int i = 0; i < 100; ++i)
+    {
+      auto& touched = table(i, i + 1);
+      touched.first = (i % 3 == 0);
+      touched.second.gap_[2] = i;
+    }
+
+    table.erase_untouched();
+
+    EXPECT_EQ(table.size(), 34);
+    for (int i = 0; i < 100; ++i)
+    {
+      EXPECT_EQ(table.contains(i, i + 1), i % 3 == 0);
+      if (i % 3 == 0)
+      {
+        EXPECT_FALSE(table.find(i, i + 1)->first);
+        EXPECT_DOUBLE_EQ(table.find(i, i + 1)->second.gap_[2], i);
+      }
+    }
+
+    // history pairs not touched again are erased in next update
+    table.erase_untouched();
+    EXPECT_TRUE(table.empty());
+  }
+
+  TEST(DEMHistoryPairTableTest, PackUnpack)
+  {
+    HistoryPairTable table;
+    table(1, 2).second.gap_[0] = 0.25;
+    table(4, 2).second.gap_[0] = 0.5;
+    table(1, 9).second.gap_[0] = 0.75;
+
+    // pack history pairs of particle with global id 1
+    std::vector<char> buffer;
+    table.for_each(
+        [&](const int globalid_i, const int globalid_j,
+            const HistoryPairTable::TouchedHistoryPair& touched)
+        {
+          if (globalid_i == 1)
+            HistoryPairTable::pack_history_pair(buffer, globalid_i, globalid_j, touched.second);
+        });
+
+    EXPECT_EQ(buffer.size(), 2 * sizeof(HistoryPairTable::PackedHistoryPair));
+
+    HistoryPairTable received;
+    received.unpack_history_pairs(buffer);
+
+    EXPECT_EQ(received.size(), 2);
+    EXPECT_TRUE(received.find(1, 2)->first);
+    EXPECT_DOUBLE_EQ(received.find(1, 2)->second.gap_[0], 0.25);
+    EXPECT_DOUBLE_EQ(received.find(1, 9)->second.gap_[0], 0.75);
+    EXPECT_FALSE(received.contains(4, 2));
+  }
+}  // namespace
@@ -0,0 +1,398 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_sph_neighbor_pairs.hpp"
+
+#include "4C_inpar_particle.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_particle_engine_container.hpp"
+#include "4C_particle_engine_container_bundle.hpp"
+#include "4C_particle_engine_interface.hpp"
+#include "4C_particle_interaction_sph_kernel.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
+#include <cmath>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  //! particle engine providing particle containers and potential neighbors only
+  class ParticleEngineMock : public PARTICLEENGINE::ParticleEngineInterface
+  {
+   public:
+    explicit ParticleEngineMock(PARTICLEENGINE::ParticleContainerBundleShrdPtr bundle)
+        : bundle_(std::move(bundle))
+    {
+    }
+
+    PARTICLEENGINE::PotentialParticleNeighbors& potential_neighbors() { return neighbors_; }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr get_particle_container_bundle() const override
+    {
+      return bundle_;
+    }
+
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_potential_particle_neighbors()
+        const override
+    {
+      return neighbors_;
+    }
+
+    void distance_between_particles(
+        const double* pos_i, const double* pos_j, double* r_ji) const override
+    {
+      for (int dim = 0; dim < 3; ++dim) r_ji[dim] = pos_j[dim] - pos_i[dim];
+    }
+
+    void free_unique_global_ids(std::vector<int>&) override { not_implemented(); }
+    void get_unique_global_ids_for_all_particles(
+        std::vector<PARTICLEENGINE::ParticleObjShrdPtr>&) override
+    {
+      not_implemented();
+    }
+    void refresh_particles_of_specific_states_and_types(
+        const PARTICLEENGINE::StatesOfTypesToRefresh&) const override
+    {
+      not_implemented();
+    }
+    void hand_over_particles_to_be_removed(std::vector<std::set<int>>&) override
+    {
+      not_implemented();
+    }
+    void hand_over_particles_to_be_inserted(
+        std::vector<std::vector<std::pair<int, PARTICLEENGINE::ParticleObjShrdPtr>>>&) override
+    {
+      not_implemented();
+    }
+    const std::vector<std::vector<int>>& get_communicated_particle_targets() const override
+    {
+      not_implemented();
+    }
+    PARTICLEENGINE::LocalIndexTupleShrdPtr get_local_index_in_specific_container(
+        int) const override
+    {
+      not_implemented();
+    }
+    std::shared_ptr<Core::IO::DiscretizationWriter> get_bin_discretization_writer() const override
+    {
+      not_implemented();
+    }
+    void relate_all_particles_to_all_procs(std::vector<int>&) const override { not_implemented(); }
+    void get_particles_within_radius(
+        const double*, const double, std::vector<PARTICLEENGINE::LocalIndexTuple>&) const override
+    {
+      not_implemented();
+    }
+    std::array<double, 3> bin_size() const override { not_implemented(); }
+    double min_bin_size() const override { not_implemented(); }
+    bool have_periodic_boundary_conditions() const override { return false; }
+    bool have_periodic_boundary_conditions_in_spatial_direction(const int) const override
+    {
+      return false;
+    }
+    double length_of_binning_domain_in_a_spatial_direction(const int) const override
+    {
+      not_implemented();
+    }
+    Core::LinAlg::Matrix<3, 2> const& domain_bounding_box_corner_positions() const override
+    {
+      not_implemented();
+    }
+    int get_number_of_particles() const override { not_implemented(); }
+    int get_number_of_particles_of_specific_type(
+        const PARTICLEENGINE::ParticleType) const override
+    {
+      not_implemented();
+    }
+
+   private:
+    [[noreturn]] static void not_implemented() { FOUR_C_THROW("Not implemented in mock."); }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr bundle_;
+
+    PARTICLEENGINE::PotentialParticleNeighbors neighbors_;
+  };
+
+  /*!
+   * Owned and ghosted particles of two phases on a lattice with unit spacing. Each owned particle
+   * interacts with up to 18 neighbors, such that many conflict-free colors are required.
+   */
+  class SPHNeighborPairsTest : public ::testing::Test
+  {
+   public:
+    static void SetUpTestSuite() { Kokkos::initialize(); }
+
+    static void TearDownTestSuite() { Kokkos::finalize(); }
+
+   protected:
+    SPHNeighborPairsTest()
+    {
+      bundle_ = std::make_shared<PARTICLEENGINE::ParticleContainerBundle>();
+      bundle_->init();
+
+      const std::set<PARTICLEENGINE::StateEnum> states = {PARTICLEENGINE::Position,
+          PARTICLEENGINE::Mass, PARTICLEENGINE::Radius, PARTICLEENGINE::DensitySum};
+      bundle_->setup({{PARTICLEENGINE::Phase1, states}, {PARTICLEENGINE::Phase2, states}});
+
+      const int statesvectorsize = *(--states.end()) + 1;
+
+      // particles with x < 4 are owned, the others are ghosted
+      int globalid = 0;
+      for (int i = 0; i < 6; ++i)
+        for (int j = 0; j < 5; ++j)
+          for (int k = 0; k < 5; ++k)
+          {
+            const auto type = ((i + j + k) % 3 == 0) ? PARTICLEENGINE::Phase2
+                                                     : PARTICLEENGINE::Phase1;
+            const auto status = (i < 4) ? PARTICLEENGINE::Owned : PARTICLEENGINE::Ghosted;
+
+            PARTICLEENGINE::ParticleStates particle(statesvectorsize);
+            particle[PARTICLEENGINE::Position] = {1.0 * i, 1.0 * j, 1.0 * k};
+            particle[PARTICLEENGINE::Mass] = {1.0 + 0.01 * globalid};
+            particle[PARTICLEENGINE::Radius] = {(type == PARTICLEENGINE::Phase1) ? 1.5 : 1.45};
+            particle[PARTICLEENGINE::DensitySum] = {0.0};
+
+            int index = 0;
+            bundle_->get_specific_container(type, status)->add_particle(
+                index, globalid++, particle);
+            particles_.push_back({type, status, index});
+          }
+
+      // potential neighbors of owned particles (each pair of owned particles only once)
+      engine_ = std::make_shared<ParticleEngineMock>(bundle_);
+      for (std::size_t a = 0; a < particles_.size(); ++a)
+      {
+        if (std::get<1>(particles_[a]) != PARTICLEENGINE::Owned) continue;
+
+        for (std::size_t b = 0; b < particles_.size(); ++b)
+        {
+          const bool owned_b = (std::get<1>(particles_[b]) == PARTICLEENGINE::Owned);
+          if (a == b or (owned_b and b < a)) continue;
+
+          engine_->potential_neighbors().push_back({particles_[a], particles_[b]});
+        }
+      }
+
+      Teuchos::ParameterList params_sph;
+      Teuchos::setStringToIntegralParameter<Inpar::PARTICLE::KernelSpaceDimension>(
+          "KERNEL_SPACE_DIM", "Kernel3D", "kernel space dimension number",
+          Teuchos::tuple<std::string>("Kernel3D"),
+          Teuchos::tuple<Inpar::PARTICLE::KernelSpaceDimension>(Inpar::PARTICLE::Kernel3D),
+          &params_sph);
+
+      kernel_ = std::make_shared<ParticleInteraction::SPHKernelCubicSpline>(params_sph);
+      kernel_->init();
+      kernel_->setup();
+
+      neighborpairs_.init();
+      neighborpairs_.setup(engine_, nullptr, kernel_);
+      neighborpairs_.evaluate_neighbor_pairs();
+    }
+
+    //! clear summed weighted masses of all owned particles
+    void clear_density_sum()
+    {
+      for (const auto type : {PARTICLEENGINE::Phase1, PARTICLEENGINE::Phase2})
+        bundle_->get_specific_container(type, PARTICLEENGINE::Owned)
+            ->clear_state(PARTICLEENGINE::DensitySum);
+    }
+
+    //! get summed weighted masses of all owned particles
+    std::vector<double> get_density_sum()
+    {
+      std::vector<double> denssum;
+      for (const auto& [type, status, particle] : particles_)
+        if (status == PARTICLEENGINE::Owned)
+          denssum.push_back(bundle_->get_specific_container(type, status)
+                                ->get_ptr_to_state(PARTICLEENGINE::DensitySum, particle)[0]);
+      return denssum;
+    }
+
+    //! sum weighted masses with the thread-parallel evaluation of buckets of particle pairs
+    std::vector<double> sum_weighted_mass_by_color()
+    {
+      clear_density_sum();
+
+      neighborpairs_.evaluate_particle_pair_buckets_by_color(
+          [&](const ParticleInteraction::SPHParticlePairBucket& bucket)
+          {
+            auto* container_i =
+                bundle_->get_specific_container(bucket.type_i_, PARTICLEENGINE::Owned);
+            auto* container_j =
+                bundle_->get_specific_container(bucket.type_j_, bucket.status_j_);
+
+            const auto mass_i =
+                ParticleInteraction::get_particle_state(*container_i, PARTICLEENGINE::Mass);
+            const auto denssum_i =
+                ParticleInteraction::get_particle_state(*container_i, PARTICLEENGINE::DensitySum);
+            const auto mass_j =
+                ParticleInteraction::get_particle_state(*container_j, PARTICLEENGINE::Mass);
+            const auto denssum_j =
+                ParticleInteraction::get_particle_state(*container_j, PARTICLEENGINE::DensitySum);
+            const bool owned_j = (bucket.status_j_ == PARTICLEENGINE::Owned);
+
+            return [=](const ParticleInteraction::SPHParticlePair& particlepair)
+            {
+              const int particle_i = std::get<2>(particlepair.tuple_i_);
+              const int particle_j = std::get<2>(particlepair.tuple_j_);
+
+              denssum_i(particle_i)[0] += particlepair.Wij_ * mass_j(particle_j)[0];
+              if (owned_j) denssum_j(particle_j)[0] += particlepair.Wji_ * mass_i(particle_i)[0];
+            };
+          });
+
+      return get_density_sum();
+    }
+
+    //! sum weighted masses in a sequential loop over all particle pairs
+    std::vector<double> sum_weighted_mass_sequential()
+    {
+      clear_density_sum();
+
+      for (const auto& particlepair : neighborpairs_.get_ref_to_particle_pair_data())
+      {
+        const auto& [type_i, status_i, particle_i] = particlepair.tuple_i_;
+        const auto& [type_j, status_j, particle_j] = particlepair.tuple_j_;
+
+        auto* container_i = bundle_->get_specific_container(type_i, status_i);
+        auto* container_j = bundle_->get_specific_container(type_j, status_j);
+
+        container_i->get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_i)[0] +=
+            particlepair.Wij_ * container_j->get_ptr_to_state(PARTICLEENGINE::Mass, particle_j)[0];
+
+        if (status_j == PARTICLEENGINE::Owned)
+          container_j->get_ptr_to_state(PARTICLEENGINE::DensitySum, particle_j)[0] +=
+              particlepair.Wji_ *
+              container_i->get_ptr_to_state(PARTICLEENGINE::Mass, particle_i)[0];
+      }
+
+      return get_density_sum();
+    }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr bundle_;
+    std::shared_ptr<ParticleEngineMock> engine_;
+    std::shared_ptr<ParticleInteraction::SPHKernelCubicSpline> kernel_;
+    ParticleInteraction::SPHNeighborPairs neighborpairs_;
+    std::vector<PARTICLEENGINE::LocalIndexTuple> particles_;
+  };
+
+  TEST_F(SPHNeighborPairsTest, BucketsHoldAllParticlePairs)
+  {
+    const auto& particlepairdata = neighborpairs_.get_ref_to_particle_pair_data();
+
+    // lattice neighbors at distance 1 and sqrt(2) within the smaller support radius
+    int numexpected = 0;
+    for (const auto& [tuple_i, tuple_j] : engine_->get_potential_particle_neighbors())
+    {
+      const auto& [type_i, status_i, particle_i] = tuple_i;
+      const auto& [type_j, status_j, particle_j] = tuple_j;
+
+      const double* pos_i = bundle_->get_specific_container(type_i, status_i)
+                                ->get_ptr_to_state(PARTICLEENGINE::Position, particle_i);
+      const double* pos_j = bundle_->get_specific_container(type_j, status_j)
+                                ->get_ptr_to_state(PARTICLEENGINE::Position, particle_j);
+
+      const double dist =
+          std::hypot(pos_j[0] - pos_i[0], pos_j[1] - pos_i[1], pos_j[2] - pos_i[2]);
+      if (dist < 1.45) ++numexpected;
+    }
+    EXPECT_EQ(static_cast<int>(particlepairdata.size()), numexpected);
+
+    std::vector<ParticleInteraction::SPHParticlePairBucket> buckets;
+    std::vector<int> coloroffsets;
+    neighborpairs_.get_relevant_particle_pair_buckets_for_equal_combination(
+        {PARTICLEENGINE::Phase1, PARTICLEENGINE::Phase2}, buckets, coloroffsets);
+
+    ASSERT_GT(coloroffsets.size(), 2);
+    EXPECT_EQ(coloroffsets.front(), 0);
+    EXPECT_EQ(coloroffsets.back(), static_cast<int>(buckets.size()));
+
+    // buckets cover all particle pairs without gaps
+    int numpairs = 0;
+    for (const auto& bucket : buckets)
+    {
+      EXPECT_EQ(bucket.begin_, numpairs);
+      EXPECT_LT(bucket.begin_, bucket.end_);
+      numpairs = bucket.end_;
+
+      for (int k = bucket.begin_; k < bucket.end_; ++k)
+      {
+        EXPECT_EQ(std::get<0>(particlepairdata[k].tuple_i_), bucket.type_i_);
+        EXPECT_EQ(std::get<1>(particlepairdata[k].tuple_i_), PARTICLEENGINE::Owned);
+        EXPECT_EQ(std::get<0>(particlepairdata[k].tuple_j_), bucket.type_j_);
+        EXPECT_EQ(std::get<1>(particlepairdata[k].tuple_j_), bucket.status_j_);
+      }
+    }
+    EXPECT_EQ(numpairs, static_cast<int>(particlepairdata.size()));
+
+    // buckets of only one particle type
+    neighborpairs_.get_relevant_particle_pair_buckets_for_equal_combination(
+        {PARTICLEENGINE::Phase2}, buckets, coloroffsets);
+    for (const auto& bucket : buckets)
+    {
+      EXPECT_EQ(bucket.type_i_, PARTICLEENGINE::Phase2);
+      EXPECT_EQ(bucket.type_j_, PARTICLEENGINE::Phase2);
+    }
+  }
+
+  TEST_F(SPHNeighborPairsTest, ColorsAreConflictFree)
+  {
+    const auto& particlepairdata = neighborpairs_.get_ref_to_particle_pair_data();
+
+    std::vector<ParticleInteraction::SPHParticlePairBucket> buckets;
+    std::vector<int> coloroffsets;
+    neighborpairs_.get_relevant_particle_pair_buckets_for_equal_combination(
+        {PARTICLEENGINE::Phase1, PARTICLEENGINE::Phase2}, buckets, coloroffsets);
+
+    const int numcolors = static_cast<int>(coloroffsets.size()) - 1;
+
+    // all particle pairs could be colored
+    EXPECT_EQ(coloroffsets[numcolors - 1], coloroffsets[numcolors]);
+
+    for (int color = 0; color < numcolors - 1; ++color)
+    {
+      std::set<std::pair<int, int>> ownedparticles;
+      for (int b = coloroffsets[color]; b < coloroffsets[color + 1]; ++b)
+      {
+        for (int k = buckets[b].begin_; k < buckets[b].end_; ++k)
+        {
+          const auto& [type_i, status_i, particle_i] = particlepairdata[k].tuple_i_;
+          const auto& [type_j, status_j, particle_j] = particlepairdata[k].tuple_j_;
+
+          EXPECT_TRUE(ownedparticles.insert({type_i, particle_i}).second);
+          if (status_j == PARTICLEENGINE::Owned)
+            EXPECT_TRUE(ownedparticles.insert({type_j, particle_j}).second);
+        }
+      }
+    }
+  }
+
+  TEST_F(SPHNeighborPairsTest, ParallelEvaluationMatchesSequential)
+  {
+    const std::vector<double> sequential = sum_weighted_mass_sequential();
+    const std::vector<double> parallel = sum_weighted_mass_by_color();
+
+    ASSERT_EQ(parallel.size(), sequential.size());
+    for (std::size_t i = 0; i < parallel.size(); ++i)
+    {
+      EXPECT_GT(parallel[i], 0.0);
+      EXPECT_NEAR(parallel[i], sequential[i], 1.0e-14 * sequential[i]);
+    }
+
+    // the order of summation is fixed by the colors, hence repeated evaluations are identical
+    EXPECT_EQ(sum_weighted_mass_by_color(), parallel);
+  }
+}  // namespace
@@ -0,0 +1,271 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_reduced_lung_tree_solver.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_linalg_fixedsizematrix_solver.hpp"
+#include "4C_linalg_vector.hpp"
+
+#include <Epetra_Map.h>
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  /*
+   * Small bifurcating tree with five resistive airways and three terminal units:
+   *
+   *   airway 0 -- bifurcation --> airways 1, 2
+   *   airway 1 -- bifurcation --> airways 3, 4
+   *   airway 2 -- connection  --> terminal unit 5
+   *   airway 3 -- connection  --> terminal unit 6
+   *   airway 4 -- connection  --> terminal unit 7
+   *
+   * Pressure boundary conditions are given at the inlet of airway 0 and at the outlets of the
+   * terminal units. Every element has the dofs {p_in, p_out, q} with global ids 3*e + {0, 1, 2}.
+   * The global equation ids are: the element equations 0-7 (equal to the element ids), the
+   * bifurcations 8-10 and 11-13, the connections 14-15, 16-17, and 18-19, and the boundary
+   * conditions 20-23.
+   */
+  constexpr int n_elements = 8;
+  constexpr int n_airways = 5;
+  constexpr int n_dofs = 3 * n_elements;
+
+  struct Coupling
+  {
+    int first_equation_id;
+    int parent;
+    std::array<int, 2> children;
+  };
+  const std::array<Coupling, 2> tree_bifurcations = {{{8, 0, {1, 2}}, {11, 1, {3, 4}}}};
+  const std::array<Coupling, 3> tree_connections = {
+      {{14, 2, {5, -1}}, {16, 3, {6, -1}}, {18, 4, {7, -1}}}};
+
+  struct PressureBoundaryCondition
+  {
+    int equation_id;
+    int element;
+    ReducedLung::BoundaryConditionType type;
+  };
+  const std::array<PressureBoundaryCondition, 4> tree_boundary_conditions = {
+      {{20, 0, ReducedLung::BoundaryConditionType::pressure_in},
+          {21, 5, ReducedLung::BoundaryConditionType::pressure_out},
+          {22, 6, ReducedLung::BoundaryConditionType::pressure_out},
+          {23, 7, ReducedLung::BoundaryConditionType::pressure_out}}};
+
+  //! resistance of element e
+  double resistance(const int e) { return e < n_airways ? 1.0 + 0.25 * e : 2.0 + 0.5 * e; }
+
+  //! residual of the global equation g
+  double residual(const int g) { return std::sin(1.3 * g + 0.2); }
+
+  /**
+   * \brief Increments of all dofs from a direct solution of the assembled system, which has the
+   * same entries as the system matrix of the reduced lung model.
+   */
+  Core::LinAlg::Matrix<n_dofs, 1> solve_assembled_system()
+  {
+    Core::LinAlg::Matrix<n_dofs, n_dofs> matrix(true);
+    Core::LinAlg::Matrix<n_dofs, 1> rhs(true);
+    for (int g = 0; g < n_dofs; ++g) rhs(g) = residual(g);
+
+    // element equations p_in - p_out - R*q
+    for (int e = 0; e < n_elements; ++e)
+    {
+      matrix(e, 3 * e) = 1.0;
+      matrix(e, 3 * e + 1) = -1.0;
+      matrix(e, 3 * e + 2) = -resistance(e);
+    }
+    // bifurcations p_out_parent - p_in_child_i and q_parent - q_child_1 - q_child_2
+    for (const Coupling& bif : tree_bifurcations)
+    {
+      for (int c = 0; c < 2; ++c)
+      {
+        matrix(bif.first_equation_id + c, 3 * bif.parent + 1) = 1.0;
+        matrix(bif.first_equation_id + c, 3 * bif.children[c]) = -1.0;
+        matrix(bif.first_equation_id + 2, 3 * bif.children[c] + 2) = -1.0;
+      }
+      matrix(bif.first_equation_id + 2, 3 * bif.parent + 2) = 1.0;
+    }
+    // connections p_out_parent - p_in_child and q_parent - q_child
+    for (const Coupling& conn : tree_connections)
+    {
+      matrix(conn.first_equation_id, 3 * conn.parent + 1) = 1.0;
+      matrix(conn.first_equation_id, 3 * conn.children[0]) = -1.0;
+      matrix(conn.first_equation_id + 1, 3 * conn.parent + 2) = 1.0;
+      matrix(conn.first_equation_id + 1, 3 * conn.children[0] + 2) = -1.0;
+    }
+    // pressure boundary conditions
+    for (const PressureBoundaryCondition& bc : tree_boundary_conditions)
+    {
+      const bool inlet = bc.type == ReducedLung::BoundaryConditionType::pressure_in;
+      matrix(bc.equation_id, 3 * bc.element + (inlet ? 0 : 1)) = 1.0;
+    }
+
+    Core::LinAlg::Matrix<n_dofs, 1> x(true);
+    Core::LinAlg::FixedSizeSerialDenseSolver<n_dofs, n_dofs, 1> solver;
+    solver.set_matrix(matrix);
+    solver.set_vectors(x, rhs);
+    EXPECT_EQ(solver.solve(), 0);
+    return x;
+  }
+
+  /**
+   * \brief Distribute the tree with the given element owners, solve it with the tree solver, and
+   * compare the increments of the locally owned dofs with the solution of the assembled system.
+   */
+  void expect_tree_solver_matches_assembled_system(const std::function<int(int)>& owner)
+  {
+    MPI_Comm comm(MPI_COMM_WORLD);
+    const int my_rank = Core::Communication::my_mpi_rank(comm);
+
+    // Couplings and boundary conditions are owned by the rank owning the parent element.
+    std::vector<int> equation_owner(n_dofs);
+    for (int e = 0; e < n_elements; ++e) equation_owner[e] = owner(e);
+    for (const Coupling& bif : tree_bifurcations)
+      for (int i = 0; i < 3; ++i) equation_owner[bif.first_equation_id + i] = owner(bif.parent);
+    for (const Coupling& conn : tree_connections)
+      for (int i = 0; i < 2; ++i) equation_owner[conn.first_equation_id + i] = owner(conn.parent);
+    for (const PressureBoundaryCondition& bc : tree_boundary_conditions)
+      equation_owner[bc.equation_id] = owner(bc.element);
+
+    std::vector<int> my_equations;
+    std::vector<int> local_equation_id(n_dofs, -1);
+    for (int g = 0; g < n_dofs; ++g)
+    {
+      if (equation_owner[g] != my_rank) continue;
+      local_equation_id[g] = my_equations.size();
+      my_equations.push_back(g);
+    }
+    std::vector<int> my_dofs;
+    for (int e = 0; e < n_elements; ++e)
+      if (owner(e) == my_rank) my_dofs.insert(my_dofs.end(), {3 * e, 3 * e + 1, 3 * e + 2});
+
+    // Create the locally owned entities of the reduced lung model.
+    std::vector<ReducedLung::Airway> airways;
+    std::vector<ReducedLung::TerminalUnit> terminal_units;
+    std::vector<double> airway_resistances;
+    std::vector<double> terminal_unit_resistances;
+    for (int e = 0; e < n_elements; ++e)
+    {
+      if (owner(e) != my_rank) continue;
+      const std::vector<int> dofs = {3 * e, 3 * e + 1, 3 * e + 2};
+      if (e < n_airways)
+      {
+        airways.push_back({.global_equation_id = e,
+            .local_equation_id = local_equation_id[e],
+            .local_airway_id = static_cast<int>(airways.size()),
+            .airway_type = ReducedLung::AirwayType::resistive,
+            .global_dof_ids = dofs});
+        airway_resistances.push_back(resistance(e));
+      }
+      else
+      {
+        terminal_units.push_back({.global_equation_id = e,
+            .local_equation_id = local_equation_id[e],
+            .local_terminal_unit_id = static_cast<int>(terminal_units.size()),
+            .tu_type = ReducedLung::TerminalUnitType::kelvin_voigt,
+            .E = 1.0,
+            .eta = 1.0,
+            .global_dof_ids = dofs});
+        terminal_unit_resistances.push_back(resistance(e));
+      }
+    }
+    std::vector<ReducedLung::Bifurcation> bifurcations;
+    for (const Coupling& bif : tree_bifurcations)
+    {
+      if (owner(bif.parent) != my_rank) continue;
+      const auto [child_1, child_2] = bif.children;
+      bifurcations.push_back({.first_global_equation_id = bif.first_equation_id,
+          .first_local_equation_id = local_equation_id[bif.first_equation_id],
+          .local_bifurcation_id = static_cast<int>(bifurcations.size()),
+          .global_parent_element_id = bif.parent,
+          .global_child_1_element_id = child_1,
+          .global_child_2_element_id = child_2,
+          .global_dof_ids = {3 * bif.parent + 1, 3 * child_1, 3 * child_2, 3 * bif.parent + 2,
+              3 * child_1 + 2, 3 * child_2 + 2}});
+    }
+    std::vector<ReducedLung::Connection> connections;
+    for (const Coupling& conn : tree_connections)
+    {
+      if (owner(conn.parent) != my_rank) continue;
+      const int child = conn.children[0];
+      connections.push_back({.first_global_equation_id = conn.first_equation_id,
+          .first_local_equation_id = local_equation_id[conn.first_equation_id],
+          .local_connection_id = static_cast<int>(connections.size()),
+          .global_parent_element_id = conn.parent,
+          .global_child_element_id = child,
+          .global_dof_ids = {3 * conn.parent + 1, 3 * child, 3 * conn.parent + 2, 3 * child + 2}});
+    }
+    std::vector<ReducedLung::BoundaryCondition> boundary_conditions;
+    for (const PressureBoundaryCondition& bc : tree_boundary_conditions)
+    {
+      if (owner(bc.element) != my_rank) continue;
+      const bool inlet = bc.type == ReducedLung::BoundaryConditionType::pressure_in;
+      boundary_conditions.push_back({.global_element_id = bc.element,
+          .global_equation_id = bc.equation_id,
+          .local_equation_id = local_equation_id[bc.equation_id],
+          .local_bc_id = static_cast<int>(boundary_conditions.size()),
+          .bc_type = bc.type,
+          .global_dof_id = 3 * bc.element + (inlet ? 0 : 1),
+          .funct_num = 0});
+    }
+
+    const Epetra_Comm& epetra_comm = Core::Communication::as_epetra_comm(comm);
+    const Epetra_Map row_map(
+        -1, static_cast<int>(my_equations.size()), my_equations.data(), 0, epetra_comm);
+    const Epetra_Map dof_map(-1, static_cast<int>(my_dofs.size()), my_dofs.data(), 0, epetra_comm);
+    Core::LinAlg::Vector<double> rhs(row_map, true);
+    for (unsigned i = 0; i < my_equations.size(); ++i) rhs[i] = residual(my_equations[i]);
+    Core::LinAlg::Vector<double> x(dof_map, true);
+
+    ReducedLung::TreeSolver tree_solver(
+        airways, terminal_units, connections, bifurcations, boundary_conditions, dof_map, comm);
+    tree_solver.solve(airway_resistances, terminal_unit_resistances, rhs, x);
+
+    const Core::LinAlg::Matrix<n_dofs, 1> x_reference = solve_assembled_system();
+    for (unsigned i = 0; i < my_dofs.size(); ++i)
+      EXPECT_NEAR(x[i], x_reference(my_dofs[i]), 1e-12 * x_reference.norm_inf());
+  }
+
+  TEST(TreeSolverTest, AllElementsOnOneRank)
+  {
+    expect_tree_solver_matches_assembled_system([](const int) { return 0; });
+  }
+
+  TEST(TreeSolverTest, SubtreesOnDifferentRanks)
+  {
+    // root on rank 0, the subtree of airway 1 on rank 1, and the subtree of airway 2 on rank 2
+    const std::array<int, n_elements> owners = {0, 1, 2, 1, 1, 2, 1, 1};
+    expect_tree_solver_matches_assembled_system([&](const int e) { return owners[e]; });
+  }
+
+  TEST(TreeSolverTest, ElementsDistributedRoundRobin)
+  {
+    MPI_Comm comm(MPI_COMM_WORLD);
+    const int n_ranks = Core::Communication::num_mpi_ranks(comm);
+    expect_tree_solver_matches_assembled_system([&](const int e) { return e % n_ranks; });
+  }
+
+  TEST(TreeSolverTest, ElementsDistributedInReverseOrder)
+  {
+    // the ranks contribute to the interface problem in an order differing from the element ids
+    MPI_Comm comm(MPI_COMM_WORLD);
+    const int n_ranks = Core::Communication::num_mpi_ranks(comm);
+    expect_tree_solver_matches_assembled_system(
+        [&](const int e) { return (n_elements - 1 - e) % n_ranks; });
+  }
+}  // namespace
@@ -0,0 +1,195 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_solid_3D_ele_block_evaluator.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_inpar_structure.hpp"
+#include "4C_io_input_parameter_container.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_solid_3D_ele.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+namespace
+{
+  using namespace FourC;
+
+  class SolidBlockEvaluatorTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      Core::IO::InputParameterContainer mat_stvenant;
+      mat_stvenant.add("YOUNG", 100.0);
+      mat_stvenant.add("NUE", 0.3);
+      mat_stvenant.add("DENS", 1.0);
+
+      Global::Problem& problem = (*Global::Problem::instance());
+      problem.materials()->set_read_from_problem(0);
+      problem.materials()->insert(
+          1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("structure", MPI_COMM_WORLD, 3);
+    }
+
+    /*!
+     * Create a distorted mesh of num_ele_x * num_ele_y * 1 hex8 elements. The number of elements
+     * is not a multiple of the block size, such that the last block is only partially filled.
+     */
+    void create_distorted_mesh(const bool invert_first_element)
+    {
+      for (int k = 0; k < 2; ++k)
+      {
+        for (int j = 0; j <= num_ele_y; ++j)
+        {
+          for (int i = 0; i <= num_ele_x; ++i)
+          {
+            const int id = node_id(i, j, k);
+            const std::vector<double> x = {i + 0.2 * std::sin(1.3 * id),
+                j + 0.2 * std::sin(1.3 * id + 1.0), 1.2 * k + 0.2 * std::sin(1.3 * id + 2.0)};
+            discretization_->add_node(std::make_shared<Core::Nodes::Node>(id, x, 0));
+          }
+        }
+      }
+
+      Core::IO::InputParameterContainer container;
+      container.add("MAT", 1);
+      container.add("KINEM", Inpar::Solid::KinemType::nonlinearTotLag);
+
+      for (int j = 0; j < num_ele_y; ++j)
+      {
+        for (int i = 0; i < num_ele_x; ++i)
+        {
+          std::array<int, 8> node_ids = {node_id(i, j, 0), node_id(i + 1, j, 0),
+              node_id(i + 1, j + 1, 0), node_id(i, j + 1, 0), node_id(i, j, 1),
+              node_id(i + 1, j, 1), node_id(i + 1, j + 1, 1), node_id(i, j + 1, 1)};
+
+          // exchanging the bottom and the top face gives a negative Jacobian determinant
+          const int ele_id = i + num_ele_x * j;
+          if (ele_id == 0 and invert_first_element)
+            std::rotate(node_ids.begin(), node_ids.begin() + 4, node_ids.end());
+
+          auto ele = std::make_shared<Discret::Elements::Solid>(ele_id, 0);
+          ele->set_node_ids(8, node_ids.data());
+          ele->read_element("SOLID", "HEX8", container);
+          discretization_->add_element(ele);
+        }
+      }
+      discretization_->fill_complete(true, false, false);
+
+      // set a non-trivial displacement state
+      auto displacements =
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true);
+      for (int lid = 0; lid < displacements->MyLength(); ++lid)
+      {
+        const int gid = discretization_->dof_row_map()->GID(lid);
+        (*displacements)[lid] = 0.05 * std::sin(0.7 * gid + 0.3);
+      }
+      discretization_->set_state("displacement", displacements);
+
+      params_.set<std::string>("action", "calc_struct_nlnstiff");
+    }
+
+    //! Create an empty stiffness matrix and force vector to assemble into.
+    std::pair<std::shared_ptr<Core::LinAlg::SparseMatrix>,
+        std::shared_ptr<Core::LinAlg::Vector<double>>>
+    create_system() const
+    {
+      return {std::make_shared<Core::LinAlg::SparseMatrix>(*discretization_->dof_row_map(), 81),
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true)};
+    }
+
+    static int node_id(const int i, const int j, const int k)
+    {
+      return i + (num_ele_x + 1) * (j + (num_ele_y + 1) * k);
+    }
+
+    static constexpr int num_ele_x = 3;
+    static constexpr int num_ele_y = 3;
+
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+    Teuchos::ParameterList params_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(SolidBlockEvaluatorTest, AllElementsAreEvaluatedInBlocks)
+  {
+    create_distorted_mesh(false);
+
+    const Discret::Elements::SolidBlockEvaluator block_evaluator(*discretization_);
+
+    EXPECT_TRUE(block_evaluator.is_valid_for(*discretization_));
+    EXPECT_EQ(block_evaluator.remaining_element_col_map().NumGlobalElements(), 0);
+  }
+
+  TEST_F(SolidBlockEvaluatorTest, ForceAndStiffnessMatchElementEvaluation)
+  {
+    create_distorted_mesh(false);
+
+    // reference: the usual element loop
+    auto [reference_stiffness, reference_force] = create_system();
+    {
+      Core::FE::AssembleStrategy strategy(
+          0, 0, reference_stiffness, nullptr, reference_force, nullptr, nullptr);
+      discretization_->evaluate(params_, strategy);
+      reference_stiffness->complete();
+    }
+
+    auto [block_stiffness, block_force] = create_system();
+    {
+      const Discret::Elements::SolidBlockEvaluator block_evaluator(*discretization_);
+      Core::FE::AssembleStrategy strategy(
+          0, 0, block_stiffness, nullptr, block_force, nullptr, nullptr);
+      block_evaluator.evaluate(params_, *discretization_, strategy);
+    }
+
+    double reference_force_norm = 0.0;
+    reference_force->NormInf(&reference_force_norm);
+    ASSERT_GT(reference_force_norm, 0.0);
+
+    block_force->Update(-1.0, *reference_force, 1.0);
+    double force_difference = 0.0;
+    block_force->NormInf(&force_difference);
+    EXPECT_NEAR(force_difference, 0.0, 1e-12 * reference_force_norm);
+
+    const double reference_stiffness_norm = reference_stiffness->NormInf();
+    block_stiffness->add(*reference_stiffness, false, -1.0, 1.0);
+    block_stiffness->complete();
+    EXPECT_NEAR(block_stiffness->NormInf(), 0.0, 1e-12 * reference_stiffness_norm);
+  }
+
+  TEST_F(SolidBlockEvaluatorTest, InvertedElementThrowsWithoutErrorTolerance)
+  {
+    create_distorted_mesh(true);
+
+    const Discret::Elements::SolidBlockEvaluator block_evaluator(*discretization_);
+    auto [stiffness, force] = create_system();
+    Core::FE::AssembleStrategy strategy(0, 0, stiffness, nullptr, force, nullptr, nullptr);
+
+    FOUR_C_EXPECT_THROW_WITH_MESSAGE(block_evaluator.evaluate(params_, *discretization_, strategy),
+        Core::Exception, "determinant of jacobian");
+  }
+}  // namespace
@@ -0,0 +1,280 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_solid_3D_ele_matrix_free_evaluator.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_global_data.hpp"
+#include "4C_inpar_structure.hpp"
+#include "4C_io_input_parameter_container.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_solid_3D_ele.hpp"
+#include "4C_structure_new_nln_linearsystem_matrix_free.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_MultiVector.h>
+#include <Teuchos_ParameterList.hpp>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  class SolidMatrixFreeEvaluatorTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      Core::IO::InputParameterContainer mat_stvenant;
+      mat_stvenant.add("YOUNG", 100.0);
+      mat_stvenant.add("NUE", 0.3);
+      mat_stvenant.add("DENS", 1.0);
+
+      Global::Problem& problem = (*Global::Problem::instance());
+      problem.materials()->set_read_from_problem(0);
+      problem.materials()->insert(
+          1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("structure", MPI_COMM_WORLD, 3);
+      create_distorted_mesh();
+
+      params_.set<std::string>("action", "calc_struct_nlnstiff");
+      set_displacements(0.0);
+    }
+
+    //! Create a distorted mesh of two hex27 elements in x-direction.
+    void create_distorted_mesh()
+    {
+      // the nodes are the points of a lattice with 2 points per element and direction
+      for (int c = 0; c < num_lattice_points[2]; ++c)
+      {
+        for (int b = 0; b < num_lattice_points[1]; ++b)
+        {
+          for (int a = 0; a < num_lattice_points[0]; ++a)
+          {
+            const int id = lattice_id(a, b, c);
+            const std::vector<double> x = {0.5 * a + 0.04 * std::sin(1.1 * id),
+                0.5 * b + 0.04 * std::sin(1.1 * id + 1.0),
+                0.6 * c + 0.04 * std::sin(1.1 * id + 2.0)};
+            discretization_->add_node(std::make_shared<Core::Nodes::Node>(id, x, 0));
+          }
+        }
+      }
+
+      Core::IO::InputParameterContainer container;
+      container.add("MAT", 1);
+      container.add("KINEM", Inpar::Solid::KinemType::nonlinearTotLag);
+
+      const auto xi_nodes =
+          Core::FE::get_element_nodes_in_parameter_space<Core::FE::CellType::hex27>();
+      for (int e = 0; e < num_elements; ++e)
+      {
+        std::vector<int> node_ids;
+        for (const auto& xi : xi_nodes)
+        {
+          node_ids.emplace_back(lattice_id(2 * e + static_cast<int>(std::round(xi[0] + 1.0)),
+              static_cast<int>(std::round(xi[1] + 1.0)),
+              static_cast<int>(std::round(xi[2] + 1.0))));
+        }
+
+        auto ele = std::make_shared<Discret::Elements::Solid>(e, 0);
+        ele->set_node_ids(static_cast<int>(node_ids.size()), node_ids.data());
+        ele->read_element("SOLID", "HEX27", container);
+        discretization_->add_element(ele);
+      }
+      discretization_->fill_complete(true, false, false);
+    }
+
+    //! Set the displacement state u = u_0 + @p scale * du for a fixed u_0 and direction du.
+    void set_displacements(const double scale)
+    {
+      auto displacements =
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true);
+      for (int lid = 0; lid < displacements->MyLength(); ++lid)
+      {
+        const int gid = discretization_->dof_row_map()->GID(lid);
+        (*displacements)[lid] = 0.03 * std::sin(0.7 * gid + 0.3) + scale * direction(gid);
+      }
+      discretization_->set_state("displacement", displacements);
+    }
+
+    //! component of the direction du of the dof @p gid
+    static double direction(const int gid) { return std::cos(1.9 * gid); }
+
+    //! Map of the dofs on the face x = 0.
+    [[nodiscard]] Epetra_Map create_dbc_map() const
+    {
+      std::vector<int> dbc_dofs;
+      for (const Core::Nodes::Node* node : discretization_->my_row_node_range())
+      {
+        if (node->id() % num_lattice_points[0] != 0) continue;
+        for (const int dof : discretization_->dof(0, node)) dbc_dofs.emplace_back(dof);
+      }
+      return Epetra_Map(-1, static_cast<int>(dbc_dofs.size()), dbc_dofs.data(), 0,
+          discretization_->dof_row_map()->Comm());
+    }
+
+    //! Evaluate the internal force vector of the matrix-free evaluator.
+    std::shared_ptr<Core::LinAlg::Vector<double>> evaluate_force(
+        Discret::Elements::SolidMatrixFreeEvaluator& evaluator)
+    {
+      auto force =
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true);
+      Core::FE::AssembleStrategy strategy(0, 0, nullptr, nullptr, force, nullptr, nullptr);
+      evaluator.evaluate(params_, *discretization_, strategy);
+      return force;
+    }
+
+    //! Evaluate the low-order refined stiffness matrix and the internal force vector.
+    std::pair<std::shared_ptr<Core::LinAlg::SparseMatrix>,
+        std::shared_ptr<Core::LinAlg::Vector<double>>>
+    evaluate_stiffness(Discret::Elements::SolidMatrixFreeEvaluator& evaluator)
+    {
+      auto stiffness =
+          std::make_shared<Core::LinAlg::SparseMatrix>(*discretization_->dof_row_map(), 81);
+      auto force =
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true);
+      Core::FE::AssembleStrategy strategy(0, 0, stiffness, nullptr, force, nullptr, nullptr);
+      evaluator.evaluate(params_, *discretization_, strategy);
+      stiffness->complete();
+      return {stiffness, force};
+    }
+
+    //! Evaluate the assembled hex27 stiffness matrix and force vector with the element loop.
+    std::pair<std::shared_ptr<Core::LinAlg::SparseMatrix>,
+        std::shared_ptr<Core::LinAlg::Vector<double>>>
+    evaluate_assembled_stiffness()
+    {
+      auto stiffness =
+          std::make_shared<Core::LinAlg::SparseMatrix>(*discretization_->dof_row_map(), 81);
+      auto force =
+          std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map(), true);
+      Core::FE::AssembleStrategy strategy(0, 0, stiffness, nullptr, force, nullptr, nullptr);
+      discretization_->evaluate(params_, strategy);
+      stiffness->complete();
+      return {stiffness, force};
+    }
+
+    static int lattice_id(const int a, const int b, const int c)
+    {
+      return a + num_lattice_points[0] * (b + num_lattice_points[1] * c);
+    }
+
+    static constexpr int num_elements = 2;
+    static constexpr std::array<int, 3> num_lattice_points = {2 * num_elements + 1, 3, 3};
+
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+    Teuchos::ParameterList params_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(SolidMatrixFreeEvaluatorTest, InternalForceMatchesElementEvaluation)
+  {
+    Discret::Elements::SolidMatrixFreeEvaluator evaluator(*discretization_);
+    EXPECT_EQ(evaluator.remaining_element_col_map().NumGlobalElements(), 0);
+
+    const auto [reference_stiffness, reference_force] = evaluate_assembled_stiffness();
+    const auto [lor_stiffness, force] = evaluate_stiffness(evaluator);
+    EXPECT_TRUE(evaluator.has_linearization());
+
+    double reference_force_norm = 0.0;
+    reference_force->NormInf(&reference_force_norm);
+    ASSERT_GT(reference_force_norm, 0.0);
+
+    force->Update(-1.0, *reference_force, 1.0);
+    double force_difference = 0.0;
+    force->NormInf(&force_difference);
+    EXPECT_NEAR(force_difference, 0.0, 1e-12 * reference_force_norm);
+  }
+
+  TEST_F(SolidMatrixFreeEvaluatorTest, JacobianMatchesAssembledStiffnessWithDirichletRows)
+  {
+    Discret::Elements::SolidMatrixFreeEvaluator evaluator(*discretization_);
+    const auto [reference_stiffness, reference_force] = evaluate_assembled_stiffness();
+    const auto [lor_stiffness, force] = evaluate_stiffness(evaluator);
+
+    // the Dirichlet rows of both assembled matrices are replaced by identity rows
+    const Epetra_Map dbc_map = create_dbc_map();
+    ASSERT_GT(dbc_map.NumGlobalElements(), 0);
+    reference_stiffness->apply_dirichlet(dbc_map, true);
+    lor_stiffness->apply_dirichlet(dbc_map, true);
+
+    const Solid::Nln::LinSystem::MatrixFreeJacobian jacobian(*lor_stiffness, evaluator, dbc_map);
+
+    const Epetra_Map& dof_row_map = *discretization_->dof_row_map();
+    Epetra_MultiVector x(dof_row_map, 2, false);
+    for (int lid = 0; lid < dof_row_map.NumMyElements(); ++lid)
+    {
+      x[0][lid] = std::sin(2.3 * dof_row_map.GID(lid) + 0.1);
+      x[1][lid] = std::cos(0.4 * dof_row_map.GID(lid));
+    }
+
+    Epetra_MultiVector y(dof_row_map, 2, true);
+    Epetra_MultiVector y_reference(dof_row_map, 2, true);
+    ASSERT_EQ(jacobian.Apply(x, y), 0);
+    ASSERT_EQ(reference_stiffness->Apply(x, y_reference), 0);
+
+    const double tolerance = 1e-10 * reference_stiffness->NormInf();
+    for (int v = 0; v < 2; ++v)
+    {
+      for (int lid = 0; lid < dof_row_map.NumMyElements(); ++lid)
+      {
+        EXPECT_NEAR(y[v][lid], y_reference[v][lid], tolerance);
+        if (dbc_map.MyGID(dof_row_map.GID(lid))) EXPECT_NEAR(y[v][lid], x[v][lid], 1e-14);
+      }
+    }
+  }
+
+  TEST_F(SolidMatrixFreeEvaluatorTest, JacobianMatchesFiniteDifferenceOfInternalForce)
+  {
+    Discret::Elements::SolidMatrixFreeEvaluator evaluator(*discretization_);
+    const auto [lor_stiffness, force] = evaluate_stiffness(evaluator);
+
+    const Epetra_Map& dof_row_map = *discretization_->dof_row_map();
+    const Epetra_Map no_dbc_map(-1, 0, nullptr, 0, dof_row_map.Comm());
+    const Solid::Nln::LinSystem::MatrixFreeJacobian jacobian(*lor_stiffness, evaluator, no_dbc_map);
+
+    Epetra_MultiVector du(dof_row_map, 1, false);
+    for (int lid = 0; lid < dof_row_map.NumMyElements(); ++lid)
+      du[0][lid] = direction(dof_row_map.GID(lid));
+    Epetra_MultiVector tangent_action(dof_row_map, 1, true);
+    ASSERT_EQ(jacobian.Apply(du, tangent_action), 0);
+
+    // central difference of the internal force in direction du
+    constexpr double h = 1e-6;
+    Discret::Elements::SolidMatrixFreeEvaluator force_evaluator(*discretization_);
+    set_displacements(h);
+    const auto force_plus = evaluate_force(force_evaluator);
+    set_displacements(-h);
+    const auto force_minus = evaluate_force(force_evaluator);
+
+    double tangent_norm = 0.0;
+    tangent_action.NormInf(&tangent_norm);
+    ASSERT_GT(tangent_norm, 0.0);
+    for (int lid = 0; lid < dof_row_map.NumMyElements(); ++lid)
+    {
+      const double finite_difference = ((*force_plus)[lid] - (*force_minus)[lid]) / (2.0 * h);
+      EXPECT_NEAR(tangent_action[0][lid], finite_difference, 1e-6 * tangent_norm);
+    }
+  }
+}  // namespace
@@ -0,0 +1,179 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_solver_nonlin_nox_direction_broyden.hpp"
+#include "4C_solver_nonlin_nox_direction_lbfgs.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+#include <NOX_Epetra_Vector.H>
+
+#include <array>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr int n = 3;
+  using Matrix = std::array<std::array<double, n>, n>;
+
+  class QuasiNewtonUpdateTest : public ::testing::Test
+  {
+   protected:
+    QuasiNewtonUpdateTest() : map_(n, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)) {}
+
+    Teuchos::RCP<::NOX::Abstract::Vector> create_vector(const std::array<double, n>& values)
+    {
+      Epetra_Vector vector(map_, false);
+      for (int i = 0; i < n; ++i) vector[i] = values[i];
+      return Teuchos::make_rcp<::NOX::Epetra::Vector>(vector);
+    }
+
+    static double& value(::NOX::Abstract::Vector& vector, const int i)
+    {
+      return dynamic_cast<::NOX::Epetra::Vector&>(vector).getEpetraVector()[i];
+    }
+
+    static double value(const ::NOX::Abstract::Vector& vector, const int i)
+    {
+      return dynamic_cast<const ::NOX::Epetra::Vector&>(vector).getEpetraVector()[i];
+    }
+
+    //! w = M v
+    static void multiply(
+        const Matrix& matrix, const ::NOX::Abstract::Vector& v, ::NOX::Abstract::Vector& w)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        value(w, i) = 0.0;
+        for (int j = 0; j < n; ++j) value(w, i) += matrix[i][j] * value(v, j);
+      }
+    }
+
+    static void expect_near(
+        const ::NOX::Abstract::Vector& actual, const ::NOX::Abstract::Vector& expected)
+    {
+      for (int i = 0; i < n; ++i) EXPECT_NEAR(value(actual, i), value(expected, i), 1.0e-12);
+    }
+
+    Epetra_Map map_;
+
+    //! hessian of the quadratic problem 1/2 x^T A x - b^T x
+    const Matrix hessian_ = {{{4.0, 1.0, 0.0}, {1.0, 3.0, 1.0}, {0.0, 1.0, 2.0}}};
+  };
+
+  TEST_F(QuasiNewtonUpdateTest, LBFGSSatisfiesSecantCondition)
+  {
+    // initial inverse hessian H_0 = 0.5 I
+    auto apply_h0 = [](const ::NOX::Abstract::Vector& v, ::NOX::Abstract::Vector& w)
+    { w.update(0.5, v, 0.0); };
+
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> s = {create_vector({1.0, -2.0, 0.5})};
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> y = {s[0]->clone(::NOX::ShapeCopy)};
+    multiply(hessian_, *s[0], *y[0]);
+    const std::vector<double> rho = {1.0 / s[0]->innerProduct(*y[0])};
+
+    // H_1 y_0 = s_0
+    Teuchos::RCP<::NOX::Abstract::Vector> result = s[0]->clone(::NOX::ShapeCopy);
+    NOX::Nln::Direction::LBFGS::two_loop_recursion(s, y, rho, *y[0], apply_h0, *result);
+    expect_near(*result, *s[0]);
+  }
+
+  TEST_F(QuasiNewtonUpdateTest, LBFGSRecoversInverseHessianFromConjugateSteps)
+  {
+    auto apply_h0 = [](const ::NOX::Abstract::Vector& v, ::NOX::Abstract::Vector& w) { w = v; };
+
+    // steps along A-conjugate directions, as generated by exact line searches on the quadratic
+    // problem, from the unit vectors by Gram-Schmidt in the A inner product
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> s;
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> y;
+    std::vector<double> rho;
+    for (int k = 0; k < n; ++k)
+    {
+      std::array<double, n> unit_vector{};
+      unit_vector[k] = 1.0;
+      Teuchos::RCP<::NOX::Abstract::Vector> sk = create_vector(unit_vector);
+      for (int j = 0; j < k; ++j) sk->update(-rho[j] * y[j]->innerProduct(*sk), *s[j], 1.0);
+
+      Teuchos::RCP<::NOX::Abstract::Vector> yk = sk->clone(::NOX::ShapeCopy);
+      multiply(hessian_, *sk, *yk);
+      s.push_back(sk);
+      y.push_back(yk);
+      rho.push_back(1.0 / sk->innerProduct(*yk));
+    }
+
+    // for n conjugate pairs, the two-loop recursion applies the exact inverse hessian
+    const Teuchos::RCP<::NOX::Abstract::Vector> f = create_vector({1.0, 2.0, -1.0});
+    Teuchos::RCP<::NOX::Abstract::Vector> result = f->clone(::NOX::ShapeCopy);
+    NOX::Nln::Direction::LBFGS::two_loop_recursion(s, y, rho, *f, apply_h0, *result);
+
+    Teuchos::RCP<::NOX::Abstract::Vector> hessian_result = f->clone(::NOX::ShapeCopy);
+    multiply(hessian_, *result, *hessian_result);
+    expect_near(*hessian_result, *f);
+  }
+
+  TEST_F(QuasiNewtonUpdateTest, BroydenSolvesLinearProblemInTwoNSteps)
+  {
+    // initial inverse jacobian H_0 = diag(A)^{-1}
+    auto apply_h0 = [&](const ::NOX::Abstract::Vector& v, ::NOX::Abstract::Vector& w)
+    {
+      for (int i = 0; i < n; ++i) value(w, i) = value(v, i) / hessian_[i][i];
+    };
+
+    const Teuchos::RCP<::NOX::Abstract::Vector> b = create_vector({1.0, 2.0, -1.0});
+    Teuchos::RCP<::NOX::Abstract::Vector> x = create_vector({0.0, 0.0, 0.0});
+    Teuchos::RCP<::NOX::Abstract::Vector> f = x->clone(::NOX::ShapeCopy);
+    auto compute_f = [&]()
+    {
+      multiply(hessian_, *x, *f);
+      f->update(-1.0, *b, 1.0);
+    };
+
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> u;
+    std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> s;
+
+    // first step with the initial inverse jacobian
+    compute_f();
+    const double norm_f0 = f->norm();
+    Teuchos::RCP<::NOX::Abstract::Vector> dir = x->clone(::NOX::ShapeCopy);
+    apply_h0(*f, *dir);
+    dir->scale(-1.0);
+    x->update(1.0, *dir, 1.0);
+
+    Teuchos::RCP<::NOX::Abstract::Vector> q = x->clone(::NOX::ShapeCopy);
+    Teuchos::RCP<::NOX::Abstract::Vector> yvec = x->clone(::NOX::ShapeCopy);
+    Teuchos::RCP<::NOX::Abstract::Vector> hy = x->clone(::NOX::ShapeCopy);
+    for (int k = 1; k < 2 * n; ++k)
+    {
+      compute_f();
+      if (f->norm() < 1.0e-12 * norm_f0) break;
+
+      // q = H_k F_{k+1}
+      apply_h0(*f, *q);
+      NOX::Nln::Direction::Broyden::apply_updates(u, s, *q);
+
+      const Teuchos::RCP<::NOX::Abstract::Vector> step = dir->clone();
+      ASSERT_TRUE(NOX::Nln::Direction::Broyden::update(u, s, *step, *q, *step, *dir));
+
+      // secant condition H_{k+1} y_k = s_k
+      multiply(hessian_, *step, *yvec);
+      apply_h0(*yvec, *hy);
+      NOX::Nln::Direction::Broyden::apply_updates(u, s, *hy);
+      expect_near(*hy, *step);
+
+      x->update(1.0, *dir, 1.0);
+    }
+
+    // Broyden's method terminates after at most 2n steps for linear problems
+    compute_f();
+    EXPECT_LT(f->norm(), 1.0e-10 * norm_f0);
+  }
+}  // namespace